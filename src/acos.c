@@ -20,11 +20,6 @@
 #include <errno.h>
 #include "include/internal/m99_math.h"
 
-/* Helper macros for accessing high/low parts of double */
-/* SAS/C uses big-endian, so high word is first */
-#define __HI(x) *(int*)&x
-#define __LO(x) *(1+(int*)&x)
-
 static const double
 one=  1.00000000000000000000e+00, /* 0x3FF00000, 0x00000000 */
 pi =  3.14159265358979311600e+00, /* 0x400921FB, 0x54442D18 */
@@ -125,7 +120,7 @@ double acos(double x)
     
     /* Set errno for domain error (|x| > 1) */
     if (x < -1.0 || x > 1.0) {
-        errno = EDOM;
+        __ma_seterr(EDOM);
     }
     
     return result;
@@ -73,7 +73,7 @@ double acosh(double x)
         xcpt.name = "acosh";
         xcpt.arg1 = x;
         if (!matherr(&xcpt)) {
-            errno = EDOM;
+            __ma_seterr(EDOM);
             return NAN;
         }
         return xcpt.retval;
@@ -86,7 +86,7 @@ double acosh(double x)
         xcpt.name = "acosh";
         xcpt.arg1 = x;
         if (!matherr(&xcpt)) {
-            errno = ERANGE;
+            __ma_seterr(ERANGE);
             return log(2 * SQRT_MAXDOUBLE);
         }
         return xcpt.retval;
@@ -63,7 +63,7 @@ float acoshf(float x)
     
     /* Check for domain error */
     if (x < 1.0f) {
-        errno = EDOM;
+        __ma_seterr(EDOM);
         if (matherr) {
             struct exception exc;
             exc.type = DOMAIN;
@@ -80,7 +80,7 @@ float acoshf(float x)
     
     /* Check for overflow */
     if (x > SQRT_MAXDOUBLE) {
-        errno = ERANGE;
+        __ma_seterr(ERANGE);
         if (matherr) {
             struct exception exc;
             exc.type = OVERFLOW;
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * double acospi(double x)
+ * Return acos(x)/pi
+ */
+
+#include <math.h>
+#include "include/internal/m99_math.h"
+
+/* Shared kernel - see pown.c */
+extern void __kernel_mul12(double a, double b, double *hi, double *lo);
+
+static const double
+invpi    =  3.18309886183790691216e-01, /* 0x3FD45F30, 0x6DC9C883 */
+invpi_lo = -1.96786766751824858819e-17; /* 0xBC76B01E, 0xC5417056 */
+
+/****** ma.lib/acospi *******************************************************
+*
+*   NAME	
+* 	acospi -- Return acos(x)/pi. (V1.0)
+*
+*   SYNOPSIS
+*	double result = acospi(double x);
+*	  D0		     D0
+*	double acospi(double x);
+*
+*   FUNCTION
+*	Compute the arc cosine of x in half-turns, scaling the result of
+*	acos() by a double-double 1/pi.
+*
+*   INPUTS
+*	x - Input value, in [-1,1].
+*
+*   RESULT
+*	result - acos(x)/pi, in [0,1]. Exactly 1/2 for x = 0 and exactly
+*	        1 for x = -1. Returns NaN for |x| > 1.
+*
+*   EXAMPLE
+*	double h = acospi(-0.5);
+*
+*   NOTES
+*	C23. Sets errno to EDOM for |x| > 1, as acos() does.
+*
+*   SEE ALSO
+*	cospi(), asinpi(), atanpi(), acos(), ma_acosd(), math.h
+*
+******************************************************************************/
+
+double acospi(double x)
+{
+    double a, h, l;
+
+    if (x == 0.0) return 0.5;
+    if (x == -1.0) return 1.0;
+    a = acos(x);
+    __kernel_mul12(a, invpi, &h, &l);
+    return h+(l+a*invpi_lo);
+}
@@ -54,10 +54,8 @@
 * 
 ******************************************************************************/
 
-/* Global state */
-static m99_math_type_t current_math_type = M99_MATH_AUTO;
-static int optimization_flags = M99_OPT_FPU | M99_OPT_IEEE;
-static m99_math_error_t last_error = M99_ERR_NONE;
+/* Backend selection, optimization flags and the last error are kept
+ * in the calling task's ma_ctx (see ma_ctx.c), not in globals. */
 
 /*
  * amiga_math_init - Initialize AmigaOS math libraries
@@ -66,6 +64,8 @@ static m99_math_error_t last_error = M99_ERR_NONE;
  */
 int amiga_math_init(void)
 {
+    ma_ctx *ctx = ma_ctx_current();
+
     /* Try to open mathffp.library */
     MathFFPBase = (struct MathFFPBase *)OpenLibrary("mathffp.library", 0);
     
@@ -77,22 +77,22 @@ int amiga_math_init(void)
     
     /* Check if we have at least one math library */
     if (!MathFFPBase && !MathIEEEBase && !MathTransBase) {
-        last_error = M99_ERR_LIB_OPEN;
+        ctx->error = M99_ERR_LIB_OPEN;
         return 0;
     }
     
     /* Auto-detect best math library if not specified */
-    if (current_math_type == M99_MATH_AUTO) {
+    if (ctx->math_type == M99_MATH_AUTO) {
         if (MathTransBase) {
-            current_math_type = M99_MATH_TRANS;
+            ctx->math_type = M99_MATH_TRANS;
         } else if (MathIEEEBase) {
-            current_math_type = M99_MATH_IEEE;
+            ctx->math_type = M99_MATH_IEEE;
         } else if (MathFFPBase) {
-            current_math_type = M99_MATH_FFP;
+            ctx->math_type = M99_MATH_FFP;
         }
     }
     
-    last_error = M99_ERR_NONE;
+    ctx->error = M99_ERR_NONE;
     return 1;
 }
 
@@ -122,7 +122,7 @@ void amiga_math_cleanup(void)
  */
 void m99_set_math_type(m99_math_type_t type)
 {
-    current_math_type = type;
+    ma_ctx_current()->math_type = type;
 }
 
 /*
@@ -130,7 +130,7 @@ void m99_set_math_type(m99_math_type_t type)
  */
 m99_math_type_t m99_get_math_type(void)
 {
-    return current_math_type;
+    return ma_ctx_current()->math_type;
 }
 
 /*
@@ -162,7 +162,7 @@ int m99_has_trans(void)
  */
 void m99_set_optimization(int flags)
 {
-    optimization_flags = flags;
+    ma_ctx_current()->optimization = flags;
 }
 
 /*
@@ -170,7 +170,7 @@ void m99_set_optimization(int flags)
  */
 int m99_get_optimization(void)
 {
-    return optimization_flags;
+    return ma_ctx_current()->optimization;
 }
 
 /*
@@ -178,7 +178,7 @@ int m99_get_optimization(void)
  */
 m99_math_error_t m99_get_error(void)
 {
-    return last_error;
+    return ma_ctx_current()->error;
 }
 
 /*
@@ -213,7 +213,7 @@ const char *m99_get_error_string(m99_math_error_t error)
  */
 void m99_clear_error(void)
 {
-    last_error = M99_ERR_NONE;
+    ma_ctx_clearexcept(ma_ctx_current(), MA_FE_ALL_EXCEPT);
 }
 
 #endif /* _AMIGA_MATH_INIT_C */
@@ -25,11 +25,6 @@
 #include <errno.h>
 #include "include/internal/m99_math.h"
 
-/* Helper macros for accessing high/low parts of double */
-/* SAS/C uses big-endian, so high word is first */
-#define __HI(x) *(int*)&x
-#define __LO(x) *(1+(int*)&x)
-
 static const double
 one =  1.00000000000000000000e+00, /* 0x3FF00000, 0x00000000 */
 huge =  1.000e+300,
@@ -131,7 +126,7 @@ double asin(double x)
     
     /* Set errno for domain error (|x| > 1) */
     if (x < -1.0 || x > 1.0) {
-        errno = EDOM;
+        __ma_seterr(EDOM);
     }
     
     return result;
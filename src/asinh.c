@@ -74,7 +74,7 @@ double asinh(double x)
         xcpt.arg1 = x;
         if (!matherr(&xcpt)) {
             fprintf(stderr, "asinh: OVERFLOW error\n");
-            errno = ERANGE;
+            __ma_seterr(ERANGE);
             xcpt.retval = log(2 * SQRT_MAXDOUBLE);
         }
         return xcpt.retval;
@@ -70,7 +70,7 @@ float asinhf(float x)
     /* Check for overflow */
     xmax = (float)sqrt(FLT_MAX - 1.0);
     if (x < -xmax || x > xmax) {
-        errno = ERANGE;
+        __ma_seterr(ERANGE);
         if (matherr) {
             struct exception exc;
             exc.type = OVERFLOW;
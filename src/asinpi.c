@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * double asinpi(double x)
+ * Return asin(x)/pi
+ */
+
+#include <math.h>
+#include "include/internal/m99_math.h"
+
+/* Shared kernel - see pown.c */
+extern void __kernel_mul12(double a, double b, double *hi, double *lo);
+
+static const double
+invpi    =  3.18309886183790691216e-01, /* 0x3FD45F30, 0x6DC9C883 */
+invpi_lo = -1.96786766751824858819e-17; /* 0xBC76B01E, 0xC5417056 */
+
+/****** ma.lib/asinpi *******************************************************
+*
+*   NAME	
+* 	asinpi -- Return asin(x)/pi. (V1.0)
+*
+*   SYNOPSIS
+*	double result = asinpi(double x);
+*	  D0		     D0
+*	double asinpi(double x);
+*
+*   FUNCTION
+*	Compute the arc sine of x in half-turns. The result of asin() is
+*	multiplied by a double-double 1/pi, so the scaling adds no
+*	rounding error of its own beyond the final one.
+*
+*   INPUTS
+*	x - Input value, in [-1,1].
+*
+*   RESULT
+*	result - asin(x)/pi, in [-1/2,1/2]. Exactly +-1/2 for x = +-1.
+*	        Returns NaN for |x| > 1.
+*
+*   EXAMPLE
+*	double h = asinpi(0.5);
+*
+*   NOTES
+*	C23. Sets errno to EDOM for |x| > 1, as asin() does.
+*
+*   SEE ALSO
+*	sinpi(), acospi(), atanpi(), asin(), ma_asind(), math.h
+*
+******************************************************************************/
+
+double asinpi(double x)
+{
+    double a, h, l;
+
+    if (x == 0.0) return x;			/* keep the sign of zero */
+    if (fabs(x) == 1.0) return 0.5*x;
+    a = asin(x);
+    __kernel_mul12(a, invpi, &h, &l);
+    return h+(l+a*invpi_lo);
+}
@@ -21,11 +21,6 @@
 #include <math.h>
 #include "include/internal/m99_math.h"
 
-/* Helper macros for accessing high/low parts of double */
-/* SAS/C uses big-endian, so high word is first */
-#define __HI(x) *(int*)&x
-#define __LO(x) *(1+(int*)&x)
-
 static const double
 tiny  = 1.0e-300,
 zero  = 0.0,
@@ -141,4 +136,3 @@ double atan2(double y, double x)
     return __ieee754_atan2(y, x);
 }
 
-
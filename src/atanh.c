@@ -72,7 +72,7 @@ double atanh(double x)
         xcpt.arg1 = x;
         if (!matherr(&xcpt)) {
             fprintf(stderr, "atanh: DOMAIN error\n");
-            errno = EDOM;
+            __ma_seterr(EDOM);
             xcpt.retval = 0.0;
         }
         return xcpt.retval;
@@ -66,7 +66,7 @@ float atanhf(float x)
     
     /* Check for domain error */
     if (x <= -1.0f || x >= 1.0f) {
-        errno = EDOM;
+        __ma_seterr(EDOM);
         if (matherr) {
             struct exception exc;
             exc.type = DOMAIN;
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * double atanpi(double x)
+ * Return atan(x)/pi
+ */
+
+#include <math.h>
+#include "include/internal/m99_math.h"
+
+/* Shared kernel - see pown.c */
+extern void __kernel_mul12(double a, double b, double *hi, double *lo);
+
+static const double
+invpi    =  3.18309886183790691216e-01, /* 0x3FD45F30, 0x6DC9C883 */
+invpi_lo = -1.96786766751824858819e-17; /* 0xBC76B01E, 0xC5417056 */
+
+/****** ma.lib/atanpi *******************************************************
+*
+*   NAME	
+* 	atanpi -- Return atan(x)/pi. (V1.0)
+*
+*   SYNOPSIS
+*	double result = atanpi(double x);
+*	  D0		     D0
+*	double atanpi(double x);
+*
+*   FUNCTION
+*	Compute the arc tangent of x in half-turns, scaling the result of
+*	atan() by a double-double 1/pi.
+*
+*   INPUTS
+*	x - Input value.
+*
+*   RESULT
+*	result - atan(x)/pi, in [-1/2,1/2]. Exactly +-1/4 for x = +-1
+*	        and exactly +-1/2 for x = +-Infinity.
+*
+*   EXAMPLE
+*	double h = atanpi(1.0);
+*
+*   NOTES
+*	C23.
+*
+*   SEE ALSO
+*	tanpi(), asinpi(), acospi(), atan(), ma_atand(), math.h
+*
+******************************************************************************/
+
+double atanpi(double x)
+{
+    double a, h, l, ax;
+
+    ax = fabs(x);
+    if (x == 0.0) return x;			/* keep the sign of zero */
+    if (ax == 1.0) return 0.25*x;
+    if (ax > 1.0e300 && ax-ax != 0.0) {	/* +-inf */
+        return (x > 0.0) ? 0.5 : -0.5;
+    }
+    a = atan(x);
+    __kernel_mul12(a, invpi, &h, &l);
+    return h+(l+a*invpi_lo);
+}
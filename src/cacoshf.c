@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * float_complex cacoshf(float_complex z)
+ * Complex arc hyperbolic cosine (float).
+ */
+
+#include <math.h>
+#include <complex.h>
+#include "include/internal/m99_math.h"
+
+/* Float kernels - see kernelf.c */
+extern float __kernel_atan2f(float y, float x);
+extern float __kernel_asinhf(float x);
+
+/****** ma.lib/cacoshf ******************************************************
+* 
+*   NAME	
+* 	cacoshf -- Return complex arc hyperbolic cosine (float). (V1.0)
+*
+*   SYNOPSIS
+*	float_complex result = cacoshf(float_complex z);
+*	  D0		   D0
+*	float_complex cacoshf(float_complex z);
+*
+*   FUNCTION
+*	Compute the principal value of acosh(z) with Kahan's formulas:
+*	with s1 = csqrt(z-1) and s2 = csqrt(z+1),
+*	    re = asinh(re(conj(s1)*s2))
+*	    im = 2*atan2(im(s1), re(s2))
+* 
+*   INPUTS
+*	z - Float complex number structure with real and imaginary parts.
+*	
+*   RESULT
+*	result - Arc hyperbolic cosine of z. The real part is non-negative
+*	        and the imaginary part lies in [-pi, pi].
+* 
+*   EXAMPLE
+*	float_complex z = {0.5f, 0.0f};
+*	float_complex a = cacoshf(z);
+*
+*   NOTES
+*	The branch cut is the real axis below 1.
+* 
+*   SEE ALSO
+*	cacosh(), casinhf(), catanhf(), cacosf(), complex.h
+* 
+******************************************************************************/
+
+float_complex cacoshf(float_complex z)
+{
+    float_complex u, v, s1, s2, result;
+
+    u.re = z.re-1.0f;
+    u.im = z.im;
+    v.re = z.re+1.0f;
+    v.im = z.im;
+    s1 = csqrtf(u);
+    s2 = csqrtf(v);
+    result.re = __kernel_asinhf(s1.re*s2.re + s1.im*s2.im);
+    result.im = 2.0f*__kernel_atan2f(s1.im, s2.re);
+    return result;
+}
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * float cargf(float_complex z)
+ * Complex argument (float).
+ */
+
+#include <math.h>
+#include <complex.h>
+#include "include/internal/m99_math.h"
+
+/* Float kernels - see kernelf.c */
+extern float __kernel_atan2f(float y, float x);
+
+/****** ma.lib/cargf ********************************************************
+* 
+*   NAME	
+* 	cargf -- Return argument of complex number (float). (V1.0)
+*
+*   SYNOPSIS
+*	float result = cargf(float_complex z);
+*	  D0		   D0
+*	float cargf(float_complex z);
+*
+*   FUNCTION
+*	Compute the argument (phase angle) of the complex number z, the
+*	angle atan2(im, re) in radians, in float arithmetic.
+* 
+*   INPUTS
+*	z - Float complex number structure with real and imaginary parts.
+*	
+*   RESULT
+*	result - Argument of z in the range [-pi, pi]. The sign of a zero
+*	        imaginary part selects the branch for negative real z.
+* 
+*   EXAMPLE
+*	float_complex z = {0.0f, 1.0f};
+*	float a = cargf(z);
+*
+*   NOTES
+*	Follows the special cases of atan2().
+* 
+*   SEE ALSO
+*	carg(), cabsf(), complex.h
+* 
+******************************************************************************/
+
+float cargf(float_complex z)
+{
+    return __kernel_atan2f(z.im, z.re);
+}
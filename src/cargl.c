@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * long double cargl(long_double_complex z)
+ * Argument of complex number (long double).
+ */
+
+#include <math.h>
+#include <complex.h>
+#include "include/internal/m99_math.h"
+
+/****** ma.lib/cargl ********************************************************
+* 
+*   NAME	
+* 	cargl -- Return argument of complex number (long double). (V1.0)
+*
+*   SYNOPSIS
+*	long double result = cargl(long_double_complex z);
+*	  D0		   D0
+*	long double cargl(long_double_complex z);
+*
+*   FUNCTION
+*	Compute the argument (phase angle) of z in radians.
+*	long double has the same format as double under SAS/C, so this
+*	is evaluated by carg() at full long double precision.
+* 
+*   INPUTS
+*	z - Long double complex number structure with real and imaginary parts.
+*	
+*   RESULT
+*	result - Argument (phase angle) of z in radians, as carg().
+* 
+*   EXAMPLE
+*	long_double_complex z = {1.0L, 2.0L};
+*	long double r = cargl(z);
+*
+*   NOTES
+*	Special values follow the double version.
+* 
+*   SEE ALSO
+*	carg(), cargf(), complex.h
+* 
+******************************************************************************/
+
+long double cargl(long_double_complex z)
+{
+    complex_t w;
+
+    w.re = (double)z.re;
+    w.im = (double)z.im;
+    return (long double)carg(w);
+}
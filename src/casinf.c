@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * float_complex casinf(float_complex z)
+ * Complex arc sine (float).
+ */
+
+#include <math.h>
+#include <complex.h>
+#include "include/internal/m99_math.h"
+
+/* Float kernels - see kernelf.c */
+extern float __kernel_atan2f(float y, float x);
+extern float __kernel_asinhf(float x);
+
+/****** ma.lib/casinf *******************************************************
+* 
+*   NAME	
+* 	casinf -- Return complex arc sine (float). (V1.0)
+*
+*   SYNOPSIS
+*	float_complex result = casinf(float_complex z);
+*	  D0		   D0
+*	float_complex casinf(float_complex z);
+*
+*   FUNCTION
+*	Compute the principal value of asin(z) with Kahan's formulas:
+*	with s1 = csqrt(1-z) and s2 = csqrt(1+z),
+*	    re = atan2(re(z), re(s1*s2))
+*	    im = asinh(im(conj(s1)*s2))
+*	which stay accurate close to the branch points +-1.
+* 
+*   INPUTS
+*	z - Float complex number structure with real and imaginary parts.
+*	
+*   RESULT
+*	result - Arc sine of z. The real part lies in [-pi/2, pi/2].
+* 
+*   EXAMPLE
+*	float_complex z = {2.0f, 0.0f};
+*	float_complex a = casinf(z);
+*
+*   NOTES
+*	The branch cuts are the real axis outside [-1, 1].
+* 
+*   SEE ALSO
+*	casin(), cacosf(), catanf(), casinhf(), complex.h
+* 
+******************************************************************************/
+
+float_complex casinf(float_complex z)
+{
+    float_complex u, v, s1, s2, result;
+
+    u.re = 1.0f-z.re;
+    u.im = -z.im;
+    v.re = 1.0f+z.re;
+    v.im = z.im;
+    s1 = csqrtf(u);
+    s2 = csqrtf(v);
+    result.re = __kernel_atan2f(z.re, s1.re*s2.re - s1.im*s2.im);
+    result.im = __kernel_asinhf(s1.re*s2.im - s1.im*s2.re);
+    return result;
+}
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * float_complex casinhf(float_complex z)
+ * Complex arc hyperbolic sine (float).
+ */
+
+#include <math.h>
+#include <complex.h>
+#include "include/internal/m99_math.h"
+
+/****** ma.lib/casinhf ******************************************************
+* 
+*   NAME	
+* 	casinhf -- Return complex arc hyperbolic sine (float). (V1.0)
+*
+*   SYNOPSIS
+*	float_complex result = casinhf(float_complex z);
+*	  D0		   D0
+*	float_complex casinhf(float_complex z);
+*
+*   FUNCTION
+*	Compute asinh(z) as -i*casinf(i*z).
+* 
+*   INPUTS
+*	z - Float complex number structure with real and imaginary parts.
+*	
+*   RESULT
+*	result - Arc hyperbolic sine of z. The imaginary part lies in
+*	        [-pi/2, pi/2].
+* 
+*   EXAMPLE
+*	float_complex z = {0.0f, 2.0f};
+*	float_complex a = casinhf(z);
+*
+*   NOTES
+*	The branch cuts are the imaginary axis outside [-i, i].
+* 
+*   SEE ALSO
+*	casinh(), cacoshf(), catanhf(), casinf(), complex.h
+* 
+******************************************************************************/
+
+float_complex casinhf(float_complex z)
+{
+    float_complex iz, w, result;
+
+    iz.re = -z.im;
+    iz.im = z.re;
+    w = casinf(iz);
+    result.re = w.im;
+    result.im = -w.re;
+    return result;
+}
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * long_double_complex casinl(long_double_complex z)
+ * Complex arc sine (long double).
+ */
+
+#include <math.h>
+#include <complex.h>
+#include "include/internal/m99_math.h"
+
+/****** ma.lib/casinl *******************************************************
+* 
+*   NAME	
+* 	casinl -- Return complex arc sine (long double). (V1.0)
+*
+*   SYNOPSIS
+*	long_double_complex result = casinl(long_double_complex z);
+*	  D0		   D0
+*	long_double_complex casinl(long_double_complex z);
+*
+*   FUNCTION
+*	Compute the principal value of the arc sine of z.
+*	long double has the same format as double under SAS/C, so this
+*	is evaluated by casin() at full long double precision.
+* 
+*   INPUTS
+*	z - Long double complex number structure with real and imaginary parts.
+*	
+*   RESULT
+*	result - Principal value of the arc sine of z, as casin().
+* 
+*   EXAMPLE
+*	long_double_complex z = {1.0L, 2.0L};
+*	long_double_complex r = casinl(z);
+*
+*   NOTES
+*	Special values follow the double version.
+* 
+*   SEE ALSO
+*	casin(), casinf(), complex.h
+* 
+******************************************************************************/
+
+long_double_complex casinl(long_double_complex z)
+{
+    complex_t a, r;
+    long_double_complex result;
+
+    a.re = (double)z.re;
+    a.im = (double)z.im;
+    r = casin(a);
+    result.re = (long double)r.re;
+    result.im = (long double)r.im;
+    return result;
+}
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * float_complex catanf(float_complex z)
+ * Complex arc tangent (float).
+ */
+
+#include <math.h>
+#include <complex.h>
+#include "include/internal/m99_math.h"
+
+/****** ma.lib/catanf *******************************************************
+* 
+*   NAME	
+* 	catanf -- Return complex arc tangent (float). (V1.0)
+*
+*   SYNOPSIS
+*	float_complex result = catanf(float_complex z);
+*	  D0		   D0
+*	float_complex catanf(float_complex z);
+*
+*   FUNCTION
+*	Compute atan(z) as -i*catanhf(i*z).
+* 
+*   INPUTS
+*	z - Float complex number structure with real and imaginary parts.
+*	
+*   RESULT
+*	result - Arc tangent of z. The real part lies in [-pi/2, pi/2].
+* 
+*   EXAMPLE
+*	float_complex z = {1.0f, 1.0f};
+*	float_complex a = catanf(z);
+*
+*   NOTES
+*	The branch cuts are the imaginary axis outside [-i, i].
+* 
+*   SEE ALSO
+*	catan(), casinf(), cacosf(), catanhf(), complex.h
+* 
+******************************************************************************/
+
+float_complex catanf(float_complex z)
+{
+    float_complex iz, w, result;
+
+    iz.re = -z.im;
+    iz.im = z.re;
+    w = catanhf(iz);
+    result.re = w.im;
+    result.im = -w.re;
+    return result;
+}
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * float_complex catanhf(float_complex z)
+ * Complex arc hyperbolic tangent (float).
+ */
+
+#include <math.h>
+#include <complex.h>
+#include "include/internal/m99_math.h"
+
+/* Float kernels - see kernelf.c */
+extern float __kernel_hypotf(float x, float y);
+extern float __kernel_atan2f(float y, float x);
+extern float __kernel_log1pf(float x);
+
+/****** ma.lib/catanhf ******************************************************
+* 
+*   NAME	
+* 	catanhf -- Return complex arc hyperbolic tangent (float). (V1.0)
+*
+*   SYNOPSIS
+*	float_complex result = catanhf(float_complex z);
+*	  D0		   D0
+*	float_complex catanhf(float_complex z);
+*
+*   FUNCTION
+*	Compute the principal value of atanh(z) for z = x + iy as
+*	    re = log1p(4x / ((1-x)^2 + y^2)) / 4
+*	    im = atan2(2y, (1-x)(1+x) - y^2) / 2
+*	For very large |z| the result tends to 1/z + i*copysign(pi/2, y),
+*	which is used directly to avoid overflow in the squares.
+* 
+*   INPUTS
+*	z - Float complex number structure with real and imaginary parts.
+*	
+*   RESULT
+*	result - Arc hyperbolic tangent of z. The imaginary part lies in
+*	        [-pi/2, pi/2]. catanhf(+-1) has an infinite real part.
+* 
+*   EXAMPLE
+*	float_complex z = {0.5f, 0.0f};
+*	float_complex a = catanhf(z);
+*
+*   NOTES
+*	The branch cuts are the real axis outside [-1, 1].
+* 
+*   SEE ALSO
+*	catanh(), casinhf(), cacoshf(), catanf(), complex.h
+* 
+******************************************************************************/
+
+float_complex catanhf(float_complex z)
+{
+    float_complex result;
+    float x, y, ax, ay, h, d;
+
+    x = z.re;
+    y = z.im;
+    ax = x < 0.0f ? -x : x;
+    ay = y < 0.0f ? -y : y;
+    if(ax > 1.0e18f || ay > 1.0e18f) {
+        h = __kernel_hypotf(x, y);
+        result.re = (x/h)/h;
+        result.im = y < 0.0f ? -1.5707963705f : 1.5707963705f;
+        return result;
+    }
+    /* atanh(-z) = -atanh(z); work with x >= 0 so 4x/d never
+     * approaches -1 */
+    d = (1.0f-ax)*(1.0f-ax) + ay*ay;
+    result.re = 0.25f*__kernel_log1pf(4.0f*ax/d);
+    if(x < 0.0f) result.re = -result.re;
+    result.im = 0.5f*__kernel_atan2f(2.0f*y, (1.0f-ax)*(1.0f+ax) - ay*ay);
+    return result;
+}
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * long_double_complex catanhl(long_double_complex z)
+ * Complex arc hyperbolic tangent (long double).
+ */
+
+#include <math.h>
+#include <complex.h>
+#include "include/internal/m99_math.h"
+
+/****** ma.lib/catanhl ******************************************************
+* 
+*   NAME	
+* 	catanhl -- Return complex arc hyperbolic tangent (long double). (V1.0)
+*
+*   SYNOPSIS
+*	long_double_complex result = catanhl(long_double_complex z);
+*	  D0		   D0
+*	long_double_complex catanhl(long_double_complex z);
+*
+*   FUNCTION
+*	Compute the principal value of the arc hyperbolic tangent of z.
+*	long double has the same format as double under SAS/C, so this
+*	is evaluated by catanh() at full long double precision.
+* 
+*   INPUTS
+*	z - Long double complex number structure with real and imaginary parts.
+*	
+*   RESULT
+*	result - Principal value of the arc hyperbolic tangent of z, as catanh().
+* 
+*   EXAMPLE
+*	long_double_complex z = {1.0L, 2.0L};
+*	long_double_complex r = catanhl(z);
+*
+*   NOTES
+*	Special values follow the double version.
+* 
+*   SEE ALSO
+*	catanh(), catanhf(), complex.h
+* 
+******************************************************************************/
+
+long_double_complex catanhl(long_double_complex z)
+{
+    complex_t a, r;
+    long_double_complex result;
+
+    a.re = (double)z.re;
+    a.im = (double)z.im;
+    r = catanh(a);
+    result.re = (long double)r.re;
+    result.im = (long double)r.im;
+    return result;
+}
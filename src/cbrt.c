@@ -13,6 +13,7 @@
 #include <float.h>
 
 #include <amiga/math.h>
+#include "include/internal/m99_math.h"
 
 /*
  * cbrt - cube root
@@ -94,7 +95,7 @@ double cbrt(double x)
     
     /* Check for overflow */
     if (result == INFINITY) {
-        errno = ERANGE;
+        __ma_seterr(ERANGE);
     }
     
     return result;
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * float_complex ccosf(float_complex z)
+ * Complex cosine (float).
+ */
+
+#include <math.h>
+#include <complex.h>
+#include "include/internal/m99_math.h"
+
+/* Float kernels - see kernelf.c */
+extern float __kernel_expf(float x);
+extern void __kernel_sincosf(float x, float *s, float *c);
+extern void __kernel_sinhcoshf(float x, float *sh, float *ch);
+
+/****** ma.lib/ccosf ********************************************************
+* 
+*   NAME	
+* 	ccosf -- Return complex cosine (float). (V1.0)
+*
+*   SYNOPSIS
+*	float_complex result = ccosf(float_complex z);
+*	  D0		   D0
+*	float_complex ccosf(float_complex z);
+*
+*   FUNCTION
+*	Compute cos(a + bi) = cos(a)cosh(b) - i*sin(a)sinh(b) with the
+*	float sin/cos and sinh/cosh kernels.
+* 
+*   INPUTS
+*	z - Float complex number structure with real and imaginary parts.
+*	
+*   RESULT
+*	result - Complex cosine of z.
+* 
+*   EXAMPLE
+*	float_complex z = {1.0f, 1.0f};
+*	float_complex c = ccosf(z);
+*
+*   NOTES
+*	ccosf(z) equals ccoshf(i*z).
+* 
+*   SEE ALSO
+*	ccos(), csinf(), ctanf(), ccoshf(), complex.h
+* 
+******************************************************************************/
+
+float_complex ccosf(float_complex z)
+{
+    float_complex result;
+    float s, c, sh, ch, e, h;
+
+    __kernel_sincosf(z.re, &s, &c);
+    if(z.im > 88.0f || z.im < -88.0f) {
+        /* cosh(b) may overflow on its own while c*cosh(b) does not */
+        e = __kernel_expf(0.5f*(z.im > 0.0f ? z.im : -z.im));
+        h = 0.5f*e;
+        result.re = (c*h)*e;
+        result.im = -((s*h)*e);
+        if(z.im < 0.0f) result.im = -result.im;
+        return result;
+    }
+    __kernel_sinhcoshf(z.im, &sh, &ch);
+    result.re = c*ch;
+    result.im = -(s*sh);
+    return result;
+}
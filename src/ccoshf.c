@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * float_complex ccoshf(float_complex z)
+ * Complex hyperbolic cosine (float).
+ */
+
+#include <math.h>
+#include <complex.h>
+#include "include/internal/m99_math.h"
+
+/* Float kernels - see kernelf.c */
+extern float __kernel_expf(float x);
+extern void __kernel_sincosf(float x, float *s, float *c);
+extern void __kernel_sinhcoshf(float x, float *sh, float *ch);
+
+/****** ma.lib/ccoshf *******************************************************
+* 
+*   NAME	
+* 	ccoshf -- Return complex hyperbolic cosine (float). (V1.0)
+*
+*   SYNOPSIS
+*	float_complex result = ccoshf(float_complex z);
+*	  D0		   D0
+*	float_complex ccoshf(float_complex z);
+*
+*   FUNCTION
+*	Compute cosh(a + bi) = cosh(a)cos(b) + i*sinh(a)sin(b) with the
+*	float sin/cos and sinh/cosh kernels.
+* 
+*   INPUTS
+*	z - Float complex number structure with real and imaginary parts.
+*	
+*   RESULT
+*	result - Complex hyperbolic cosine of z.
+* 
+*   EXAMPLE
+*	float_complex z = {1.0f, 1.0f};
+*	float_complex c = ccoshf(z);
+*
+*   NOTES
+*	ccoshf(z) equals ccosf(i*z).
+* 
+*   SEE ALSO
+*	ccosh(), csinhf(), ctanhf(), ccosf(), complex.h
+* 
+******************************************************************************/
+
+float_complex ccoshf(float_complex z)
+{
+    float_complex result;
+    float s, c, sh, ch, e, h;
+
+    __kernel_sincosf(z.im, &s, &c);
+    if(z.re > 88.0f || z.re < -88.0f) {
+        /* cosh(a) may overflow on its own while cosh(a)*c does not */
+        e = __kernel_expf(0.5f*(z.re > 0.0f ? z.re : -z.re));
+        h = 0.5f*e;
+        result.re = (c*h)*e;
+        result.im = (s*h)*e;
+        if(z.re < 0.0f) result.im = -result.im;
+        return result;
+    }
+    __kernel_sinhcoshf(z.re, &sh, &ch);
+    result.re = ch*c;
+    result.im = sh*s;
+    return result;
+}
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * long_double_complex ccoshl(long_double_complex z)
+ * Complex hyperbolic cosine (long double).
+ */
+
+#include <math.h>
+#include <complex.h>
+#include "include/internal/m99_math.h"
+
+/****** ma.lib/ccoshl *******************************************************
+* 
+*   NAME	
+* 	ccoshl -- Return complex hyperbolic cosine (long double). (V1.0)
+*
+*   SYNOPSIS
+*	long_double_complex result = ccoshl(long_double_complex z);
+*	  D0		   D0
+*	long_double_complex ccoshl(long_double_complex z);
+*
+*   FUNCTION
+*	Compute the complex hyperbolic cosine of z.
+*	long double has the same format as double under SAS/C, so this
+*	is evaluated by ccosh() at full long double precision.
+* 
+*   INPUTS
+*	z - Long double complex number structure with real and imaginary parts.
+*	
+*   RESULT
+*	result - Complex hyperbolic cosine of z, as ccosh().
+* 
+*   EXAMPLE
+*	long_double_complex z = {1.0L, 2.0L};
+*	long_double_complex r = ccoshl(z);
+*
+*   NOTES
+*	Special values follow the double version.
+* 
+*   SEE ALSO
+*	ccosh(), ccoshf(), complex.h
+* 
+******************************************************************************/
+
+long_double_complex ccoshl(long_double_complex z)
+{
+    complex_t a, r;
+    long_double_complex result;
+
+    a.re = (double)z.re;
+    a.im = (double)z.im;
+    r = ccosh(a);
+    result.re = (long double)r.re;
+    result.im = (long double)r.im;
+    return result;
+}
@@ -19,11 +19,6 @@
 #include <math.h>
 #include "include/internal/m99_math.h"
 
-/* Helper macros for accessing high/low parts of double */
-/* SAS/C uses big-endian, so high word is first */
-#define __HI(x) *(int*)&x
-#define __LO(x) *(1+(int*)&x)
-
 static const double huge = 1.0e300;
 
 /****** ma.lib/ceil *********************************************************
@@ -105,4 +100,3 @@ double ceil(double x)
     return x;
 }
 
-
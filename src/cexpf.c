@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * float_complex cexpf(float_complex z)
+ * Complex exponential (float).
+ */
+
+#include <math.h>
+#include <complex.h>
+#include "include/internal/m99_math.h"
+
+/* Float kernels - see kernelf.c */
+extern float __kernel_expf(float x);
+extern void __kernel_sincosf(float x, float *s, float *c);
+
+/****** ma.lib/cexpf ********************************************************
+* 
+*   NAME	
+* 	cexpf -- Return complex exponential of z (float). (V1.0)
+*
+*   SYNOPSIS
+*	float_complex result = cexpf(float_complex z);
+*	  D0		   D0
+*	float_complex cexpf(float_complex z);
+*
+*   FUNCTION
+*	Compute e^z for z = a + bi as e^a * (cos(b) + i*sin(b)) using
+*	the float exp and sin/cos kernels. If e^a alone would overflow but
+*	the scaled result is representable, e^a is applied in two halves.
+* 
+*   INPUTS
+*	z - Float complex number structure with real and imaginary parts.
+*	
+*   RESULT
+*	result - Complex exponential of z. A zero imaginary part gives an
+*	        exact real result with the same zero imaginary part.
+* 
+*   EXAMPLE
+*	float_complex z = {0.0f, 3.14159265f};
+*	float_complex e = cexpf(z);
+*
+*   NOTES
+*	Evaluated entirely in float arithmetic.
+* 
+*   SEE ALSO
+*	cexp(), clogf(), cpowf(), complex.h
+* 
+******************************************************************************/
+
+float_complex cexpf(float_complex z)
+{
+    float_complex result;
+    float e, s, c;
+
+    if(z.im == 0.0f) {
+        result.re = __kernel_expf(z.re);
+        result.im = z.im;
+        return result;
+    }
+    __kernel_sincosf(z.im, &s, &c);
+    if(z.re > 88.0f && z.re < 176.0f) {
+        /* exp(re) overflows on its own; split it in two halves */
+        e = __kernel_expf(0.5f*z.re);
+        result.re = (e*c)*e;
+        result.im = (e*s)*e;
+    } else {
+        e = __kernel_expf(z.re);
+        result.re = e*c;
+        result.im = e*s;
+    }
+    return result;
+}
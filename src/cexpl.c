@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * long_double_complex cexpl(long_double_complex z)
+ * Complex exponential of z (long double).
+ */
+
+#include <math.h>
+#include <complex.h>
+#include "include/internal/m99_math.h"
+
+/****** ma.lib/cexpl ********************************************************
+* 
+*   NAME	
+* 	cexpl -- Return complex exponential of z (long double). (V1.0)
+*
+*   SYNOPSIS
+*	long_double_complex result = cexpl(long_double_complex z);
+*	  D0		   D0
+*	long_double_complex cexpl(long_double_complex z);
+*
+*   FUNCTION
+*	Compute the complex exponential e^z.
+*	long double has the same format as double under SAS/C, so this
+*	is evaluated by cexp() at full long double precision.
+* 
+*   INPUTS
+*	z - Long double complex number structure with real and imaginary parts.
+*	
+*   RESULT
+*	result - Complex exponential e^z, as cexp().
+* 
+*   EXAMPLE
+*	long_double_complex z = {1.0L, 2.0L};
+*	long_double_complex r = cexpl(z);
+*
+*   NOTES
+*	Special values follow the double version.
+* 
+*   SEE ALSO
+*	cexp(), cexpf(), complex.h
+* 
+******************************************************************************/
+
+long_double_complex cexpl(long_double_complex z)
+{
+    complex_t a, r;
+    long_double_complex result;
+
+    a.re = (double)z.re;
+    a.im = (double)z.im;
+    r = cexp(a);
+    result.re = (long double)r.re;
+    result.im = (long double)r.im;
+    return result;
+}
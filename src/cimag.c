@@ -11,6 +11,8 @@
 
 #include "complex.h"
 
+#undef cimag
+
 /****** ma.lib/cimag ***********************************************************
 * 
 *   NAME	
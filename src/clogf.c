@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * float_complex clogf(float_complex z)
+ * Complex natural logarithm (float).
+ */
+
+#include <math.h>
+#include <complex.h>
+#include "include/internal/m99_math.h"
+
+/* Float kernels - see kernelf.c */
+extern float __kernel_hypotf(float x, float y);
+extern float __kernel_atan2f(float y, float x);
+extern float __kernel_logf(float x);
+extern float __kernel_log1pf(float x);
+
+/****** ma.lib/clogf ********************************************************
+* 
+*   NAME	
+* 	clogf -- Return complex natural logarithm (float). (V1.0)
+*
+*   SYNOPSIS
+*	float_complex result = clogf(float_complex z);
+*	  D0		   D0
+*	float_complex clogf(float_complex z);
+*
+*   FUNCTION
+*	Compute the principal value of the natural logarithm of z,
+*	log|z| + i*arg(z). When |z| is close to 1 the real part is computed
+*	as log1p((a-1)(a+1) + b*b)/2, with a and b the larger and smaller
+*	magnitudes, and the squares are formed exactly in double so
+*	that the real part keeps full relative accuracy.
+* 
+*   INPUTS
+*	z - Float complex number structure with real and imaginary parts.
+*	
+*   RESULT
+*	result - Natural logarithm of z. The imaginary part lies in
+*	        [-pi, pi]. clogf(0) is -Infinity + i*arg(0).
+* 
+*   EXAMPLE
+*	float_complex z = {0.0f, 1.0f};
+*	float_complex l = clogf(z);
+*
+*   NOTES
+*	The branch cut is the negative real axis.
+* 
+*   SEE ALSO
+*	clog(), cexpf(), cpowf(), complex.h
+* 
+******************************************************************************/
+
+float_complex clogf(float_complex z)
+{
+    float_complex result;
+    float a, b, t, h;
+
+    a = z.re < 0.0f ? -z.re : z.re;
+    b = z.im < 0.0f ? -z.im : z.im;
+    if(a < b) { t = a; a = b; b = t; }
+    h = __kernel_hypotf(a, b);
+    if(h > 0.7f && h < 1.4f) {
+        /*
+         * a*a + b*b - 1 in double: the squares of floats are exact
+         * there and so is a*a - 1 for a*a in [0.245,1.96], leaving
+         * one rounding in the final sum.
+         */
+        result.re = 0.5f*__kernel_log1pf(
+            (float)(((double)a*a-1.0)+(double)b*b));
+    } else {
+        result.re = __kernel_logf(h);
+    }
+    result.im = __kernel_atan2f(z.im, z.re);
+    return result;
+}
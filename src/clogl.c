@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * long_double_complex clogl(long_double_complex z)
+ * Complex natural logarithm (long double).
+ */
+
+#include <math.h>
+#include <complex.h>
+#include "include/internal/m99_math.h"
+
+/****** ma.lib/clogl ********************************************************
+* 
+*   NAME	
+* 	clogl -- Return complex natural logarithm (long double). (V1.0)
+*
+*   SYNOPSIS
+*	long_double_complex result = clogl(long_double_complex z);
+*	  D0		   D0
+*	long_double_complex clogl(long_double_complex z);
+*
+*   FUNCTION
+*	Compute the principal value of the natural logarithm of z,
+*	log|z| + i*arg(z).
+*	long double has the same format as double under SAS/C, so this
+*	is evaluated with log(), hypot() and atan2() at full precision.
+* 
+*   INPUTS
+*	z - Long double complex number structure with real and imaginary parts.
+*	
+*   RESULT
+*	result - Principal value of the natural logarithm of z.
+* 
+*   EXAMPLE
+*	long_double_complex z = {1.0L, 2.0L};
+*	long_double_complex r = clogl(z);
+*
+*   NOTES
+*	Special values follow the double version.
+* 
+*   SEE ALSO
+*	clog(), clogf(), complex.h
+* 
+******************************************************************************/
+
+long_double_complex clogl(long_double_complex z)
+{
+    long_double_complex result;
+
+    result.re = (long double)log(hypot((double)z.re, (double)z.im));
+    result.im = (long double)atan2((double)z.im, (double)z.re);
+    return result;
+}
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * double compoundn(double x, long n)
+ * Return (1+x) raised to the integer power n
+ */
+
+#include <math.h>
+#include "include/internal/m99_math.h"
+
+/* Shared integer power kernels - see pown.c */
+extern double __kernel_pown(double xh, double xl, unsigned long n, double *lo, double *e);
+extern double __kernel_pown_finish(double hi, double lo, double e, int inv);
+
+static const double one = 1.0;
+
+/****** ma.lib/compoundn ****************************************************
+*
+*   NAME	
+* 	compoundn -- Return compound interest factor (1+x)^n. (V1.0)
+*
+*   SYNOPSIS
+*	double result = compoundn(double x, long n);
+*	  D0		        D0        D0
+*	double compoundn(double x, long n);
+*
+*   FUNCTION
+*	Compute (1+x) raised to the integer power n. The sum 1+x is kept
+*	exactly as a double-double value, so small rates are not rounded
+*	away before the power is taken, and the power itself is computed
+*	by binary exponentiation as in pown().
+*
+*   INPUTS
+*	x - Rate. Must be >= -1.
+*	n - Number of periods.
+*
+*   RESULT
+*	result - (1+x)^n. Returns NaN if x < -1, 1.0 if n is 0, and
+*	        +Infinity for x = -1 with negative n.
+*
+*   EXAMPLE
+*	double growth = compoundn(0.05, 30);
+*
+*   NOTES
+*	Sets errno to EDOM if x < -1. C23 declares n as long long;
+*	ma.lib uses long, as for pown().
+*
+*   SEE ALSO
+*	pown(), log1p(), expm1(), math.h
+*
+******************************************************************************/
+
+double compoundn(double x, long n)
+{
+    double hi, lo, r, e;
+    unsigned long k;
+
+    if (x < -one) {
+        __ma_seterr(EDOM);
+        return __ma_zero/__ma_zero;
+    }
+    if (n == 0) return one;
+    if (x != x) return x+x;		/* NaN */
+    if (x == -one) return (n > 0) ? __ma_zero : one/__ma_zero;
+    if (x-x != 0.0) return (n > 0) ? x : __ma_zero;	/* +inf */
+
+    /* 1+x = hi+lo exactly */
+    hi = one+x;
+    if (fabs(x) > one) lo = (x-hi)+one;
+    else lo = (one-hi)+x;
+
+    k = (n < 0) ? 0UL-(unsigned long)n : (unsigned long)n;
+    r = __kernel_pown(hi, lo, k, &lo, &e);
+    return __kernel_pown_finish(r, lo, e, n < 0);
+}
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * float_complex conjf(float_complex z)
+ * Complex conjugate (float).
+ */
+
+#include <math.h>
+#include <complex.h>
+#include "include/internal/m99_math.h"
+
+/****** ma.lib/conjf ********************************************************
+* 
+*   NAME	
+* 	conjf -- Return complex conjugate (float). (V1.0)
+*
+*   SYNOPSIS
+*	float_complex result = conjf(float_complex z);
+*	  D0		   D0
+*	float_complex conjf(float_complex z);
+*
+*   FUNCTION
+*	Return the complex conjugate of z, re - i*im.
+* 
+*   INPUTS
+*	z - Float complex number structure with real and imaginary parts.
+*	
+*   RESULT
+*	result - Conjugate of z. The sign of the imaginary part is flipped
+*	        even if it is zero or NaN.
+* 
+*   EXAMPLE
+*	float_complex z = {1.0f, 2.0f};
+*	float_complex c = conjf(z);
+*
+*   NOTES
+*	Exact.
+* 
+*   SEE ALSO
+*	conj(), cprojf(), complex.h
+* 
+******************************************************************************/
+
+float_complex conjf(float_complex z)
+{
+    float_complex result;
+
+    result.re = z.re;
+    result.im = -z.im;
+    return result;
+}
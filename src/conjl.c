@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * long_double_complex conjl(long_double_complex z)
+ * Complex conjugate (long double).
+ */
+
+#include <math.h>
+#include <complex.h>
+#include "include/internal/m99_math.h"
+
+/****** ma.lib/conjl ********************************************************
+* 
+*   NAME	
+* 	conjl -- Return complex conjugate (long double). (V1.0)
+*
+*   SYNOPSIS
+*	long_double_complex result = conjl(long_double_complex z);
+*	  D0		   D0
+*	long_double_complex conjl(long_double_complex z);
+*
+*   FUNCTION
+*	Return the complex conjugate of z, re - i*im.
+* 
+*   INPUTS
+*	z - Long double complex number structure with real and imaginary parts.
+*	
+*   RESULT
+*	result - Conjugate of z.
+* 
+*   EXAMPLE
+*	long_double_complex z = {1.0L, 2.0L};
+*	long_double_complex r = conjl(z);
+*
+*   NOTES
+*	Exact.
+* 
+*   SEE ALSO
+*	conj(), conjf(), complex.h
+* 
+******************************************************************************/
+
+long_double_complex conjl(long_double_complex z)
+{
+    long_double_complex result;
+
+    result.re = z.re;
+    result.im = -z.im;
+    return result;
+}
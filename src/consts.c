@@ -0,0 +1,14 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Constants shared by the kernels
+ *
+ * One copy for the whole library instead of one in each object that
+ * needs it; see m99_math.h.
+ */
+
+#include "include/internal/m99_math.h"
+
+double __ma_zero = 0.0;
+float __ma_zerof = 0.0f;
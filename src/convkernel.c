@@ -0,0 +1,857 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Shared kernels for ma_dtoa() and ma_strtod()
+ *
+ * The table holds the powers of ten from 10**-342 to 10**340 with
+ * 128-bit significands, normalized so that the top bit is set: for
+ * q >= 0 the leading 128 bits of 5**q, truncated, and for q < 0 a
+ * quotient 2**b/5**-q rounded up, as in Lemire's fast_float. The
+ * Eisel-Lemire parser needs all 128 bits; Grisu uses the top 64.
+ *
+ * The arithmetic is on 32-bit limbs throughout, each product built
+ * from 16-bit halves as the 68000 multiplies. The big-integer
+ * helpers keep their own size bookkeeping and leave the limb loops
+ * to the mpn core in mpn.c.
+ */
+
+#include <amiga/mpn.h>
+#include "include/internal/conv.h"
+
+const unsigned long __ma_pow10_tab[][4] = {
+    { 0xeef453d6UL, 0x923bd65aUL, 0x113faa29UL, 0x06a13b3fUL }, /* -342 */
+    { 0x9558b466UL, 0x1b6565f8UL, 0x4ac7ca59UL, 0xa424c507UL }, /* -341 */
+    { 0xbaaee17fUL, 0xa23ebf76UL, 0x5d79bcf0UL, 0x0d2df649UL }, /* -340 */
+    { 0xe95a99dfUL, 0x8ace6f53UL, 0xf4d82c2cUL, 0x107973dcUL }, /* -339 */
+    { 0x91d8a02bUL, 0xb6c10594UL, 0x79071b9bUL, 0x8a4be869UL }, /* -338 */
+    { 0xb64ec836UL, 0xa47146f9UL, 0x9748e282UL, 0x6cdee284UL }, /* -337 */
+    { 0xe3e27a44UL, 0x4d8d98b7UL, 0xfd1b1b23UL, 0x08169b25UL }, /* -336 */
+    { 0x8e6d8c6aUL, 0xb0787f72UL, 0xfe30f0f5UL, 0xe50e20f7UL }, /* -335 */
+    { 0xb208ef85UL, 0x5c969f4fUL, 0xbdbd2d33UL, 0x5e51a935UL }, /* -334 */
+    { 0xde8b2b66UL, 0xb3bc4723UL, 0xad2c7880UL, 0x35e61382UL }, /* -333 */
+    { 0x8b16fb20UL, 0x3055ac76UL, 0x4c3bcb50UL, 0x21afcc31UL }, /* -332 */
+    { 0xaddcb9e8UL, 0x3c6b1793UL, 0xdf4abe24UL, 0x2a1bbf3dUL }, /* -331 */
+    { 0xd953e862UL, 0x4b85dd78UL, 0xd71d6dadUL, 0x34a2af0dUL }, /* -330 */
+    { 0x87d4713dUL, 0x6f33aa6bUL, 0x8672648cUL, 0x40e5ad68UL }, /* -329 */
+    { 0xa9c98d8cUL, 0xcb009506UL, 0x680efdafUL, 0x511f18c2UL }, /* -328 */
+    { 0xd43bf0efUL, 0xfdc0ba48UL, 0x0212bd1bUL, 0x2566def2UL }, /* -327 */
+    { 0x84a57695UL, 0xfe98746dUL, 0x014bb630UL, 0xf7604b57UL }, /* -326 */
+    { 0xa5ced43bUL, 0x7e3e9188UL, 0x419ea3bdUL, 0x35385e2dUL }, /* -325 */
+    { 0xcf42894aUL, 0x5dce35eaUL, 0x52064cacUL, 0x828675b9UL }, /* -324 */
+    { 0x818995ceUL, 0x7aa0e1b2UL, 0x7343efebUL, 0xd1940993UL }, /* -323 */
+    { 0xa1ebfb42UL, 0x19491a1fUL, 0x1014ebe6UL, 0xc5f90bf8UL }, /* -322 */
+    { 0xca66fa12UL, 0x9f9b60a6UL, 0xd41a26e0UL, 0x77774ef6UL }, /* -321 */
+    { 0xfd00b897UL, 0x478238d0UL, 0x8920b098UL, 0x955522b4UL }, /* -320 */
+    { 0x9e20735eUL, 0x8cb16382UL, 0x55b46e5fUL, 0x5d5535b0UL }, /* -319 */
+    { 0xc5a89036UL, 0x2fddbc62UL, 0xeb2189f7UL, 0x34aa831dUL }, /* -318 */
+    { 0xf712b443UL, 0xbbd52b7bUL, 0xa5e9ec75UL, 0x01d523e4UL }, /* -317 */
+    { 0x9a6bb0aaUL, 0x55653b2dUL, 0x47b233c9UL, 0x2125366eUL }, /* -316 */
+    { 0xc1069cd4UL, 0xeabe89f8UL, 0x999ec0bbUL, 0x696e840aUL }, /* -315 */
+    { 0xf148440aUL, 0x256e2c76UL, 0xc00670eaUL, 0x43ca250dUL }, /* -314 */
+    { 0x96cd2a86UL, 0x5764dbcaUL, 0x38040692UL, 0x6a5e5728UL }, /* -313 */
+    { 0xbc807527UL, 0xed3e12bcUL, 0xc6050837UL, 0x04f5ecf2UL }, /* -312 */
+    { 0xeba09271UL, 0xe88d976bUL, 0xf7864a44UL, 0xc633682eUL }, /* -311 */
+    { 0x93445b87UL, 0x31587ea3UL, 0x7ab3ee6aUL, 0xfbe0211dUL }, /* -310 */
+    { 0xb8157268UL, 0xfdae9e4cUL, 0x5960ea05UL, 0xbad82964UL }, /* -309 */
+    { 0xe61acf03UL, 0x3d1a45dfUL, 0x6fb92487UL, 0x298e33bdUL }, /* -308 */
+    { 0x8fd0c162UL, 0x06306babUL, 0xa5d3b6d4UL, 0x79f8e056UL }, /* -307 */
+    { 0xb3c4f1baUL, 0x87bc8696UL, 0x8f48a489UL, 0x9877186cUL }, /* -306 */
+    { 0xe0b62e29UL, 0x29aba83cUL, 0x331acdabUL, 0xfe94de87UL }, /* -305 */
+    { 0x8c71dcd9UL, 0xba0b4925UL, 0x9ff0c08bUL, 0x7f1d0b14UL }, /* -304 */
+    { 0xaf8e5410UL, 0x288e1b6fUL, 0x07ecf0aeUL, 0x5ee44dd9UL }, /* -303 */
+    { 0xdb71e914UL, 0x32b1a24aUL, 0xc9e82cd9UL, 0xf69d6150UL }, /* -302 */
+    { 0x892731acUL, 0x9faf056eUL, 0xbe311c08UL, 0x3a225cd2UL }, /* -301 */
+    { 0xab70fe17UL, 0xc79ac6caUL, 0x6dbd630aUL, 0x48aaf406UL }, /* -300 */
+    { 0xd64d3d9dUL, 0xb981787dUL, 0x092cbbccUL, 0xdad5b108UL }, /* -299 */
+    { 0x85f04682UL, 0x93f0eb4eUL, 0x25bbf560UL, 0x08c58ea5UL }, /* -298 */
+    { 0xa76c5823UL, 0x38ed2621UL, 0xaf2af2b8UL, 0x0af6f24eUL }, /* -297 */
+    { 0xd1476e2cUL, 0x07286faaUL, 0x1af5af66UL, 0x0db4aee1UL }, /* -296 */
+    { 0x82cca4dbUL, 0x847945caUL, 0x50d98d9fUL, 0xc890ed4dUL }, /* -295 */
+    { 0xa37fce12UL, 0x6597973cUL, 0xe50ff107UL, 0xbab528a0UL }, /* -294 */
+    { 0xcc5fc196UL, 0xfefd7d0cUL, 0x1e53ed49UL, 0xa96272c8UL }, /* -293 */
+    { 0xff77b1fcUL, 0xbebcdc4fUL, 0x25e8e89cUL, 0x13bb0f7aUL }, /* -292 */
+    { 0x9faacf3dUL, 0xf73609b1UL, 0x77b19161UL, 0x8c54e9acUL }, /* -291 */
+    { 0xc795830dUL, 0x75038c1dUL, 0xd59df5b9UL, 0xef6a2417UL }, /* -290 */
+    { 0xf97ae3d0UL, 0xd2446f25UL, 0x4b057328UL, 0x6b44ad1dUL }, /* -289 */
+    { 0x9becce62UL, 0x836ac577UL, 0x4ee367f9UL, 0x430aec32UL }, /* -288 */
+    { 0xc2e801fbUL, 0x244576d5UL, 0x229c41f7UL, 0x93cda73fUL }, /* -287 */
+    { 0xf3a20279UL, 0xed56d48aUL, 0x6b435275UL, 0x78c1110fUL }, /* -286 */
+    { 0x9845418cUL, 0x345644d6UL, 0x830a1389UL, 0x6b78aaa9UL }, /* -285 */
+    { 0xbe5691efUL, 0x416bd60cUL, 0x23cc986bUL, 0xc656d553UL }, /* -284 */
+    { 0xedec366bUL, 0x11c6cb8fUL, 0x2cbfbe86UL, 0xb7ec8aa8UL }, /* -283 */
+    { 0x94b3a202UL, 0xeb1c3f39UL, 0x7bf7d714UL, 0x32f3d6a9UL }, /* -282 */
+    { 0xb9e08a83UL, 0xa5e34f07UL, 0xdaf5ccd9UL, 0x3fb0cc53UL }, /* -281 */
+    { 0xe858ad24UL, 0x8f5c22c9UL, 0xd1b3400fUL, 0x8f9cff68UL }, /* -280 */
+    { 0x91376c36UL, 0xd99995beUL, 0x23100809UL, 0xb9c21fa1UL }, /* -279 */
+    { 0xb5854744UL, 0x8ffffb2dUL, 0xabd40a0cUL, 0x2832a78aUL }, /* -278 */
+    { 0xe2e69915UL, 0xb3fff9f9UL, 0x16c90c8fUL, 0x323f516cUL }, /* -277 */
+    { 0x8dd01fadUL, 0x907ffc3bUL, 0xae3da7d9UL, 0x7f6792e3UL }, /* -276 */
+    { 0xb1442798UL, 0xf49ffb4aUL, 0x99cd11cfUL, 0xdf41779cUL }, /* -275 */
+    { 0xdd95317fUL, 0x31c7fa1dUL, 0x40405643UL, 0xd711d583UL }, /* -274 */
+    { 0x8a7d3eefUL, 0x7f1cfc52UL, 0x482835eaUL, 0x666b2572UL }, /* -273 */
+    { 0xad1c8eabUL, 0x5ee43b66UL, 0xda324365UL, 0x0005eecfUL }, /* -272 */
+    { 0xd863b256UL, 0x369d4a40UL, 0x90bed43eUL, 0x40076a82UL }, /* -271 */
+    { 0x873e4f75UL, 0xe2224e68UL, 0x5a7744a6UL, 0xe804a291UL }, /* -270 */
+    { 0xa90de353UL, 0x5aaae202UL, 0x711515d0UL, 0xa205cb36UL }, /* -269 */
+    { 0xd3515c28UL, 0x31559a83UL, 0x0d5a5b44UL, 0xca873e03UL }, /* -268 */
+    { 0x8412d999UL, 0x1ed58091UL, 0xe858790aUL, 0xfe9486c2UL }, /* -267 */
+    { 0xa5178fffUL, 0x668ae0b6UL, 0x626e974dUL, 0xbe39a872UL }, /* -266 */
+    { 0xce5d73ffUL, 0x402d98e3UL, 0xfb0a3d21UL, 0x2dc8128fUL }, /* -265 */
+    { 0x80fa687fUL, 0x881c7f8eUL, 0x7ce66634UL, 0xbc9d0b99UL }, /* -264 */
+    { 0xa139029fUL, 0x6a239f72UL, 0x1c1fffc1UL, 0xebc44e80UL }, /* -263 */
+    { 0xc9874347UL, 0x44ac874eUL, 0xa327ffb2UL, 0x66b56220UL }, /* -262 */
+    { 0xfbe91419UL, 0x15d7a922UL, 0x4bf1ff9fUL, 0x0062baa8UL }, /* -261 */
+    { 0x9d71ac8fUL, 0xada6c9b5UL, 0x6f773fc3UL, 0x603db4a9UL }, /* -260 */
+    { 0xc4ce17b3UL, 0x99107c22UL, 0xcb550fb4UL, 0x384d21d3UL }, /* -259 */
+    { 0xf6019da0UL, 0x7f549b2bUL, 0x7e2a53a1UL, 0x46606a48UL }, /* -258 */
+    { 0x99c10284UL, 0x4f94e0fbUL, 0x2eda7444UL, 0xcbfc426dUL }, /* -257 */
+    { 0xc0314325UL, 0x637a1939UL, 0xfa911155UL, 0xfefb5308UL }, /* -256 */
+    { 0xf03d93eeUL, 0xbc589f88UL, 0x793555abUL, 0x7eba27caUL }, /* -255 */
+    { 0x96267c75UL, 0x35b763b5UL, 0x4bc1558bUL, 0x2f3458deUL }, /* -254 */
+    { 0xbbb01b92UL, 0x83253ca2UL, 0x9eb1aaedUL, 0xfb016f16UL }, /* -253 */
+    { 0xea9c2277UL, 0x23ee8bcbUL, 0x465e15a9UL, 0x79c1cadcUL }, /* -252 */
+    { 0x92a1958aUL, 0x7675175fUL, 0x0bfacd89UL, 0xec191ec9UL }, /* -251 */
+    { 0xb749faedUL, 0x14125d36UL, 0xcef980ecUL, 0x671f667bUL }, /* -250 */
+    { 0xe51c79a8UL, 0x5916f484UL, 0x82b7e127UL, 0x80e7401aUL }, /* -249 */
+    { 0x8f31cc09UL, 0x37ae58d2UL, 0xd1b2ecb8UL, 0xb0908810UL }, /* -248 */
+    { 0xb2fe3f0bUL, 0x8599ef07UL, 0x861fa7e6UL, 0xdcb4aa15UL }, /* -247 */
+    { 0xdfbdceceUL, 0x67006ac9UL, 0x67a791e0UL, 0x93e1d49aUL }, /* -246 */
+    { 0x8bd6a141UL, 0x006042bdUL, 0xe0c8bb2cUL, 0x5c6d24e0UL }, /* -245 */
+    { 0xaecc4991UL, 0x4078536dUL, 0x58fae9f7UL, 0x73886e18UL }, /* -244 */
+    { 0xda7f5bf5UL, 0x90966848UL, 0xaf39a475UL, 0x506a899eUL }, /* -243 */
+    { 0x888f9979UL, 0x7a5e012dUL, 0x6d8406c9UL, 0x52429603UL }, /* -242 */
+    { 0xaab37fd7UL, 0xd8f58178UL, 0xc8e5087bUL, 0xa6d33b83UL }, /* -241 */
+    { 0xd5605fcdUL, 0xcf32e1d6UL, 0xfb1e4a9aUL, 0x90880a64UL }, /* -240 */
+    { 0x855c3be0UL, 0xa17fcd26UL, 0x5cf2eea0UL, 0x9a55067fUL }, /* -239 */
+    { 0xa6b34ad8UL, 0xc9dfc06fUL, 0xf42faa48UL, 0xc0ea481eUL }, /* -238 */
+    { 0xd0601d8eUL, 0xfc57b08bUL, 0xf13b94daUL, 0xf124da26UL }, /* -237 */
+    { 0x823c1279UL, 0x5db6ce57UL, 0x76c53d08UL, 0xd6b70858UL }, /* -236 */
+    { 0xa2cb1717UL, 0xb52481edUL, 0x54768c4bUL, 0x0c64ca6eUL }, /* -235 */
+    { 0xcb7ddcddUL, 0xa26da268UL, 0xa9942f5dUL, 0xcf7dfd09UL }, /* -234 */
+    { 0xfe5d5415UL, 0x0b090b02UL, 0xd3f93b35UL, 0x435d7c4cUL }, /* -233 */
+    { 0x9efa548dUL, 0x26e5a6e1UL, 0xc47bc501UL, 0x4a1a6dafUL }, /* -232 */
+    { 0xc6b8e9b0UL, 0x709f109aUL, 0x359ab641UL, 0x9ca1091bUL }, /* -231 */
+    { 0xf867241cUL, 0x8cc6d4c0UL, 0xc30163d2UL, 0x03c94b62UL }, /* -230 */
+    { 0x9b407691UL, 0xd7fc44f8UL, 0x79e0de63UL, 0x425dcf1dUL }, /* -229 */
+    { 0xc2109436UL, 0x4dfb5636UL, 0x985915fcUL, 0x12f542e4UL }, /* -228 */
+    { 0xf294b943UL, 0xe17a2bc4UL, 0x3e6f5b7bUL, 0x17b2939dUL }, /* -227 */
+    { 0x979cf3caUL, 0x6cec5b5aUL, 0xa705992cUL, 0xeecf9c42UL }, /* -226 */
+    { 0xbd8430bdUL, 0x08277231UL, 0x50c6ff78UL, 0x2a838353UL }, /* -225 */
+    { 0xece53cecUL, 0x4a314ebdUL, 0xa4f8bf56UL, 0x35246428UL }, /* -224 */
+    { 0x940f4613UL, 0xae5ed136UL, 0x871b7795UL, 0xe136be99UL }, /* -223 */
+    { 0xb9131798UL, 0x99f68584UL, 0x28e2557bUL, 0x59846e3fUL }, /* -222 */
+    { 0xe757dd7eUL, 0xc07426e5UL, 0x331aeadaUL, 0x2fe589cfUL }, /* -221 */
+    { 0x9096ea6fUL, 0x3848984fUL, 0x3ff0d2c8UL, 0x5def7621UL }, /* -220 */
+    { 0xb4bca50bUL, 0x065abe63UL, 0x0fed077aUL, 0x756b53a9UL }, /* -219 */
+    { 0xe1ebce4dUL, 0xc7f16dfbUL, 0xd3e84959UL, 0x12c62894UL }, /* -218 */
+    { 0x8d3360f0UL, 0x9cf6e4bdUL, 0x64712dd7UL, 0xabbbd95cUL }, /* -217 */
+    { 0xb080392cUL, 0xc4349decUL, 0xbd8d794dUL, 0x96aacfb3UL }, /* -216 */
+    { 0xdca04777UL, 0xf541c567UL, 0xecf0d7a0UL, 0xfc5583a0UL }, /* -215 */
+    { 0x89e42caaUL, 0xf9491b60UL, 0xf41686c4UL, 0x9db57244UL }, /* -214 */
+    { 0xac5d37d5UL, 0xb79b6239UL, 0x311c2875UL, 0xc522ced5UL }, /* -213 */
+    { 0xd77485cbUL, 0x25823ac7UL, 0x7d633293UL, 0x366b828bUL }, /* -212 */
+    { 0x86a8d39eUL, 0xf77164bcUL, 0xae5dff9cUL, 0x02033197UL }, /* -211 */
+    { 0xa8530886UL, 0xb54dbdebUL, 0xd9f57f83UL, 0x0283fdfcUL }, /* -210 */
+    { 0xd267caa8UL, 0x62a12d66UL, 0xd072df63UL, 0xc324fd7bUL }, /* -209 */
+    { 0x8380dea9UL, 0x3da4bc60UL, 0x4247cb9eUL, 0x59f71e6dUL }, /* -208 */
+    { 0xa4611653UL, 0x8d0deb78UL, 0x52d9be85UL, 0xf074e608UL }, /* -207 */
+    { 0xcd795be8UL, 0x70516656UL, 0x67902e27UL, 0x6c921f8bUL }, /* -206 */
+    { 0x806bd971UL, 0x4632dff6UL, 0x00ba1cd8UL, 0xa3db53b6UL }, /* -205 */
+    { 0xa086cfcdUL, 0x97bf97f3UL, 0x80e8a40eUL, 0xccd228a4UL }, /* -204 */
+    { 0xc8a883c0UL, 0xfdaf7df0UL, 0x6122cd12UL, 0x8006b2cdUL }, /* -203 */
+    { 0xfad2a4b1UL, 0x3d1b5d6cUL, 0x796b8057UL, 0x20085f81UL }, /* -202 */
+    { 0x9cc3a6eeUL, 0xc6311a63UL, 0xcbe33036UL, 0x74053bb0UL }, /* -201 */
+    { 0xc3f490aaUL, 0x77bd60fcUL, 0xbedbfc44UL, 0x11068a9cUL }, /* -200 */
+    { 0xf4f1b4d5UL, 0x15acb93bUL, 0xee92fb55UL, 0x15482d44UL }, /* -199 */
+    { 0x99171105UL, 0x2d8bf3c5UL, 0x751bdd15UL, 0x2d4d1c4aUL }, /* -198 */
+    { 0xbf5cd546UL, 0x78eef0b6UL, 0xd262d45aUL, 0x78a0635dUL }, /* -197 */
+    { 0xef340a98UL, 0x172aace4UL, 0x86fb8971UL, 0x16c87c34UL }, /* -196 */
+    { 0x9580869fUL, 0x0e7aac0eUL, 0xd45d35e6UL, 0xae3d4da0UL }, /* -195 */
+    { 0xbae0a846UL, 0xd2195712UL, 0x89748360UL, 0x59cca109UL }, /* -194 */
+    { 0xe998d258UL, 0x869facd7UL, 0x2bd1a438UL, 0x703fc94bUL }, /* -193 */
+    { 0x91ff8377UL, 0x5423cc06UL, 0x7b6306a3UL, 0x4627ddcfUL }, /* -192 */
+    { 0xb67f6455UL, 0x292cbf08UL, 0x1a3bc84cUL, 0x17b1d542UL }, /* -191 */
+    { 0xe41f3d6aUL, 0x7377eecaUL, 0x20caba5fUL, 0x1d9e4a93UL }, /* -190 */
+    { 0x8e938662UL, 0x882af53eUL, 0x547eb47bUL, 0x7282ee9cUL }, /* -189 */
+    { 0xb23867fbUL, 0x2a35b28dUL, 0xe99e619aUL, 0x4f23aa43UL }, /* -188 */
+    { 0xdec681f9UL, 0xf4c31f31UL, 0x6405fa00UL, 0xe2ec94d4UL }, /* -187 */
+    { 0x8b3c113cUL, 0x38f9f37eUL, 0xde83bc40UL, 0x8dd3dd04UL }, /* -186 */
+    { 0xae0b158bUL, 0x4738705eUL, 0x9624ab50UL, 0xb148d445UL }, /* -185 */
+    { 0xd98ddaeeUL, 0x19068c76UL, 0x3badd624UL, 0xdd9b0957UL }, /* -184 */
+    { 0x87f8a8d4UL, 0xcfa417c9UL, 0xe54ca5d7UL, 0x0a80e5d6UL }, /* -183 */
+    { 0xa9f6d30aUL, 0x038d1dbcUL, 0x5e9fcf4cUL, 0xcd211f4cUL }, /* -182 */
+    { 0xd47487ccUL, 0x8470652bUL, 0x7647c320UL, 0x0069671fUL }, /* -181 */
+    { 0x84c8d4dfUL, 0xd2c63f3bUL, 0x29ecd9f4UL, 0x0041e073UL }, /* -180 */
+    { 0xa5fb0a17UL, 0xc777cf09UL, 0xf4681071UL, 0x00525890UL }, /* -179 */
+    { 0xcf79cc9dUL, 0xb955c2ccUL, 0x7182148dUL, 0x4066eeb4UL }, /* -178 */
+    { 0x81ac1fe2UL, 0x93d599bfUL, 0xc6f14cd8UL, 0x48405530UL }, /* -177 */
+    { 0xa21727dbUL, 0x38cb002fUL, 0xb8ada00eUL, 0x5a506a7cUL }, /* -176 */
+    { 0xca9cf1d2UL, 0x06fdc03bUL, 0xa6d90811UL, 0xf0e4851cUL }, /* -175 */
+    { 0xfd442e46UL, 0x88bd304aUL, 0x908f4a16UL, 0x6d1da663UL }, /* -174 */
+    { 0x9e4a9cecUL, 0x15763e2eUL, 0x9a598e4eUL, 0x043287feUL }, /* -173 */
+    { 0xc5dd4427UL, 0x1ad3cdbaUL, 0x40eff1e1UL, 0x853f29fdUL }, /* -172 */
+    { 0xf7549530UL, 0xe188c128UL, 0xd12bee59UL, 0xe68ef47cUL }, /* -171 */
+    { 0x9a94dd3eUL, 0x8cf578b9UL, 0x82bb74f8UL, 0x301958ceUL }, /* -170 */
+    { 0xc13a148eUL, 0x3032d6e7UL, 0xe36a5236UL, 0x3c1faf01UL }, /* -169 */
+    { 0xf18899b1UL, 0xbc3f8ca1UL, 0xdc44e6c3UL, 0xcb279ac1UL }, /* -168 */
+    { 0x96f5600fUL, 0x15a7b7e5UL, 0x29ab103aUL, 0x5ef8c0b9UL }, /* -167 */
+    { 0xbcb2b812UL, 0xdb11a5deUL, 0x7415d448UL, 0xf6b6f0e7UL }, /* -166 */
+    { 0xebdf6617UL, 0x91d60f56UL, 0x111b495bUL, 0x3464ad21UL }, /* -165 */
+    { 0x936b9fceUL, 0xbb25c995UL, 0xcab10dd9UL, 0x00beec34UL }, /* -164 */
+    { 0xb84687c2UL, 0x69ef3bfbUL, 0x3d5d514fUL, 0x40eea742UL }, /* -163 */
+    { 0xe65829b3UL, 0x046b0afaUL, 0x0cb4a5a3UL, 0x112a5112UL }, /* -162 */
+    { 0x8ff71a0fUL, 0xe2c2e6dcUL, 0x47f0e785UL, 0xeaba72abUL }, /* -161 */
+    { 0xb3f4e093UL, 0xdb73a093UL, 0x59ed2167UL, 0x65690f56UL }, /* -160 */
+    { 0xe0f218b8UL, 0xd25088b8UL, 0x306869c1UL, 0x3ec3532cUL }, /* -159 */
+    { 0x8c974f73UL, 0x83725573UL, 0x1e414218UL, 0xc73a13fbUL }, /* -158 */
+    { 0xafbd2350UL, 0x644eeacfUL, 0xe5d1929eUL, 0xf90898faUL }, /* -157 */
+    { 0xdbac6c24UL, 0x7d62a583UL, 0xdf45f746UL, 0xb74abf39UL }, /* -156 */
+    { 0x894bc396UL, 0xce5da772UL, 0x6b8bba8cUL, 0x328eb783UL }, /* -155 */
+    { 0xab9eb47cUL, 0x81f5114fUL, 0x066ea92fUL, 0x3f326564UL }, /* -154 */
+    { 0xd686619bUL, 0xa27255a2UL, 0xc80a537bUL, 0x0efefebdUL }, /* -153 */
+    { 0x8613fd01UL, 0x45877585UL, 0xbd06742cUL, 0xe95f5f36UL }, /* -152 */
+    { 0xa798fc41UL, 0x96e952e7UL, 0x2c481138UL, 0x23b73704UL }, /* -151 */
+    { 0xd17f3b51UL, 0xfca3a7a0UL, 0xf75a1586UL, 0x2ca504c5UL }, /* -150 */
+    { 0x82ef8513UL, 0x3de648c4UL, 0x9a984d73UL, 0xdbe722fbUL }, /* -149 */
+    { 0xa3ab6658UL, 0x0d5fdaf5UL, 0xc13e60d0UL, 0xd2e0ebbaUL }, /* -148 */
+    { 0xcc963feeUL, 0x10b7d1b3UL, 0x318df905UL, 0x079926a8UL }, /* -147 */
+    { 0xffbbcfe9UL, 0x94e5c61fUL, 0xfdf17746UL, 0x497f7052UL }, /* -146 */
+    { 0x9fd561f1UL, 0xfd0f9bd3UL, 0xfeb6ea8bUL, 0xedefa633UL }, /* -145 */
+    { 0xc7caba6eUL, 0x7c5382c8UL, 0xfe64a52eUL, 0xe96b8fc0UL }, /* -144 */
+    { 0xf9bd690aUL, 0x1b68637bUL, 0x3dfdce7aUL, 0xa3c673b0UL }, /* -143 */
+    { 0x9c1661a6UL, 0x51213e2dUL, 0x06bea10cUL, 0xa65c084eUL }, /* -142 */
+    { 0xc31bfa0fUL, 0xe5698db8UL, 0x486e494fUL, 0xcff30a62UL }, /* -141 */
+    { 0xf3e2f893UL, 0xdec3f126UL, 0x5a89dba3UL, 0xc3efccfaUL }, /* -140 */
+    { 0x986ddb5cUL, 0x6b3a76b7UL, 0xf8962946UL, 0x5a75e01cUL }, /* -139 */
+    { 0xbe895233UL, 0x86091465UL, 0xf6bbb397UL, 0xf1135823UL }, /* -138 */
+    { 0xee2ba6c0UL, 0x678b597fUL, 0x746aa07dUL, 0xed582e2cUL }, /* -137 */
+    { 0x94db4838UL, 0x40b717efUL, 0xa8c2a44eUL, 0xb4571cdcUL }, /* -136 */
+    { 0xba121a46UL, 0x50e4ddebUL, 0x92f34d62UL, 0x616ce413UL }, /* -135 */
+    { 0xe896a0d7UL, 0xe51e1566UL, 0x77b020baUL, 0xf9c81d17UL }, /* -134 */
+    { 0x915e2486UL, 0xef32cd60UL, 0x0ace1474UL, 0xdc1d122eUL }, /* -133 */
+    { 0xb5b5ada8UL, 0xaaff80b8UL, 0x0d819992UL, 0x132456baUL }, /* -132 */
+    { 0xe3231912UL, 0xd5bf60e6UL, 0x10e1fff6UL, 0x97ed6c69UL }, /* -131 */
+    { 0x8df5efabUL, 0xc5979c8fUL, 0xca8d3ffaUL, 0x1ef463c1UL }, /* -130 */
+    { 0xb1736b96UL, 0xb6fd83b3UL, 0xbd308ff8UL, 0xa6b17cb2UL }, /* -129 */
+    { 0xddd0467cUL, 0x64bce4a0UL, 0xac7cb3f6UL, 0xd05ddbdeUL }, /* -128 */
+    { 0x8aa22c0dUL, 0xbef60ee4UL, 0x6bcdf07aUL, 0x423aa96bUL }, /* -127 */
+    { 0xad4ab711UL, 0x2eb3929dUL, 0x86c16c98UL, 0xd2c953c6UL }, /* -126 */
+    { 0xd89d64d5UL, 0x7a607744UL, 0xe871c7bfUL, 0x077ba8b7UL }, /* -125 */
+    { 0x87625f05UL, 0x6c7c4a8bUL, 0x11471cd7UL, 0x64ad4972UL }, /* -124 */
+    { 0xa93af6c6UL, 0xc79b5d2dUL, 0xd598e40dUL, 0x3dd89bcfUL }, /* -123 */
+    { 0xd389b478UL, 0x79823479UL, 0x4aff1d10UL, 0x8d4ec2c3UL }, /* -122 */
+    { 0x843610cbUL, 0x4bf160cbUL, 0xcedf722aUL, 0x585139baUL }, /* -121 */
+    { 0xa54394feUL, 0x1eedb8feUL, 0xc2974eb4UL, 0xee658828UL }, /* -120 */
+    { 0xce947a3dUL, 0xa6a9273eUL, 0x733d2262UL, 0x29feea32UL }, /* -119 */
+    { 0x811ccc66UL, 0x8829b887UL, 0x0806357dUL, 0x5a3f525fUL }, /* -118 */
+    { 0xa163ff80UL, 0x2a3426a8UL, 0xca07c2dcUL, 0xb0cf26f7UL }, /* -117 */
+    { 0xc9bcff60UL, 0x34c13052UL, 0xfc89b393UL, 0xdd02f0b5UL }, /* -116 */
+    { 0xfc2c3f38UL, 0x41f17c67UL, 0xbbac2078UL, 0xd443ace2UL }, /* -115 */
+    { 0x9d9ba783UL, 0x2936edc0UL, 0xd54b944bUL, 0x84aa4c0dUL }, /* -114 */
+    { 0xc5029163UL, 0xf384a931UL, 0x0a9e795eUL, 0x65d4df11UL }, /* -113 */
+    { 0xf64335bcUL, 0xf065d37dUL, 0x4d4617b5UL, 0xff4a16d5UL }, /* -112 */
+    { 0x99ea0196UL, 0x163fa42eUL, 0x504bced1UL, 0xbf8e4e45UL }, /* -111 */
+    { 0xc06481fbUL, 0x9bcf8d39UL, 0xe45ec286UL, 0x2f71e1d6UL }, /* -110 */
+    { 0xf07da27aUL, 0x82c37088UL, 0x5d767327UL, 0xbb4e5a4cUL }, /* -109 */
+    { 0x964e858cUL, 0x91ba2655UL, 0x3a6a07f8UL, 0xd510f86fUL }, /* -108 */
+    { 0xbbe226efUL, 0xb628afeaUL, 0x890489f7UL, 0x0a55368bUL }, /* -107 */
+    { 0xeadab0abUL, 0xa3b2dbe5UL, 0x2b45ac74UL, 0xccea842eUL }, /* -106 */
+    { 0x92c8ae6bUL, 0x464fc96fUL, 0x3b0b8bc9UL, 0x0012929dUL }, /* -105 */
+    { 0xb77ada06UL, 0x17e3bbcbUL, 0x09ce6ebbUL, 0x40173744UL }, /* -104 */
+    { 0xe5599087UL, 0x9ddcaabdUL, 0xcc420a6aUL, 0x101d0515UL }, /* -103 */
+    { 0x8f57fa54UL, 0xc2a9eab6UL, 0x9fa94682UL, 0x4a12232dUL }, /* -102 */
+    { 0xb32df8e9UL, 0xf3546564UL, 0x47939822UL, 0xdc96abf9UL }, /* -101 */
+    { 0xdff97724UL, 0x70297ebdUL, 0x59787e2bUL, 0x93bc56f7UL }, /* -100 */
+    { 0x8bfbea76UL, 0xc619ef36UL, 0x57eb4edbUL, 0x3c55b65aUL }, /* -99 */
+    { 0xaefae514UL, 0x77a06b03UL, 0xede62292UL, 0x0b6b23f1UL }, /* -98 */
+    { 0xdab99e59UL, 0x958885c4UL, 0xe95fab36UL, 0x8e45ecedUL }, /* -97 */
+    { 0x88b402f7UL, 0xfd75539bUL, 0x11dbcb02UL, 0x18ebb414UL }, /* -96 */
+    { 0xaae103b5UL, 0xfcd2a881UL, 0xd652bdc2UL, 0x9f26a119UL }, /* -95 */
+    { 0xd59944a3UL, 0x7c0752a2UL, 0x4be76d33UL, 0x46f0495fUL }, /* -94 */
+    { 0x857fcae6UL, 0x2d8493a5UL, 0x6f70a440UL, 0x0c562ddbUL }, /* -93 */
+    { 0xa6dfbd9fUL, 0xb8e5b88eUL, 0xcb4ccd50UL, 0x0f6bb952UL }, /* -92 */
+    { 0xd097ad07UL, 0xa71f26b2UL, 0x7e2000a4UL, 0x1346a7a7UL }, /* -91 */
+    { 0x825ecc24UL, 0xc873782fUL, 0x8ed40066UL, 0x8c0c28c8UL }, /* -90 */
+    { 0xa2f67f2dUL, 0xfa90563bUL, 0x72890080UL, 0x2f0f32faUL }, /* -89 */
+    { 0xcbb41ef9UL, 0x79346bcaUL, 0x4f2b40a0UL, 0x3ad2ffb9UL }, /* -88 */
+    { 0xfea126b7UL, 0xd78186bcUL, 0xe2f610c8UL, 0x4987bfa8UL }, /* -87 */
+    { 0x9f24b832UL, 0xe6b0f436UL, 0x0dd9ca7dUL, 0x2df4d7c9UL }, /* -86 */
+    { 0xc6ede63fUL, 0xa05d3143UL, 0x91503d1cUL, 0x79720dbbUL }, /* -85 */
+    { 0xf8a95fcfUL, 0x88747d94UL, 0x75a44c63UL, 0x97ce912aUL }, /* -84 */
+    { 0x9b69dbe1UL, 0xb548ce7cUL, 0xc986afbeUL, 0x3ee11abaUL }, /* -83 */
+    { 0xc24452daUL, 0x229b021bUL, 0xfbe85badUL, 0xce996168UL }, /* -82 */
+    { 0xf2d56790UL, 0xab41c2a2UL, 0xfae27299UL, 0x423fb9c3UL }, /* -81 */
+    { 0x97c560baUL, 0x6b0919a5UL, 0xdccd879fUL, 0xc967d41aUL }, /* -80 */
+    { 0xbdb6b8e9UL, 0x05cb600fUL, 0x5400e987UL, 0xbbc1c920UL }, /* -79 */
+    { 0xed246723UL, 0x473e3813UL, 0x290123e9UL, 0xaab23b68UL }, /* -78 */
+    { 0x9436c076UL, 0x0c86e30bUL, 0xf9a0b672UL, 0x0aaf6521UL }, /* -77 */
+    { 0xb9447093UL, 0x8fa89bceUL, 0xf808e40eUL, 0x8d5b3e69UL }, /* -76 */
+    { 0xe7958cb8UL, 0x7392c2c2UL, 0xb60b1d12UL, 0x30b20e04UL }, /* -75 */
+    { 0x90bd77f3UL, 0x483bb9b9UL, 0xb1c6f22bUL, 0x5e6f48c2UL }, /* -74 */
+    { 0xb4ecd5f0UL, 0x1a4aa828UL, 0x1e38aeb6UL, 0x360b1af3UL }, /* -73 */
+    { 0xe2280b6cUL, 0x20dd5232UL, 0x25c6da63UL, 0xc38de1b0UL }, /* -72 */
+    { 0x8d590723UL, 0x948a535fUL, 0x579c487eUL, 0x5a38ad0eUL }, /* -71 */
+    { 0xb0af48ecUL, 0x79ace837UL, 0x2d835a9dUL, 0xf0c6d851UL }, /* -70 */
+    { 0xdcdb1b27UL, 0x98182244UL, 0xf8e43145UL, 0x6cf88e65UL }, /* -69 */
+    { 0x8a08f0f8UL, 0xbf0f156bUL, 0x1b8e9ecbUL, 0x641b58ffUL }, /* -68 */
+    { 0xac8b2d36UL, 0xeed2dac5UL, 0xe272467eUL, 0x3d222f3fUL }, /* -67 */
+    { 0xd7adf884UL, 0xaa879177UL, 0x5b0ed81dUL, 0xcc6abb0fUL }, /* -66 */
+    { 0x86ccbb52UL, 0xea94baeaUL, 0x98e94712UL, 0x9fc2b4e9UL }, /* -65 */
+    { 0xa87fea27UL, 0xa539e9a5UL, 0x3f2398d7UL, 0x47b36224UL }, /* -64 */
+    { 0xd29fe4b1UL, 0x8e88640eUL, 0x8eec7f0dUL, 0x19a03aadUL }, /* -63 */
+    { 0x83a3eeeeUL, 0xf9153e89UL, 0x1953cf68UL, 0x300424acUL }, /* -62 */
+    { 0xa48ceaaaUL, 0xb75a8e2bUL, 0x5fa8c342UL, 0x3c052dd7UL }, /* -61 */
+    { 0xcdb02555UL, 0x653131b6UL, 0x3792f412UL, 0xcb06794dUL }, /* -60 */
+    { 0x808e1755UL, 0x5f3ebf11UL, 0xe2bbd88bUL, 0xbee40bd0UL }, /* -59 */
+    { 0xa0b19d2aUL, 0xb70e6ed6UL, 0x5b6aceaeUL, 0xae9d0ec4UL }, /* -58 */
+    { 0xc8de0475UL, 0x64d20a8bUL, 0xf245825aUL, 0x5a445275UL }, /* -57 */
+    { 0xfb158592UL, 0xbe068d2eUL, 0xeed6e2f0UL, 0xf0d56712UL }, /* -56 */
+    { 0x9ced737bUL, 0xb6c4183dUL, 0x55464dd6UL, 0x9685606bUL }, /* -55 */
+    { 0xc428d05aUL, 0xa4751e4cUL, 0xaa97e14cUL, 0x3c26b886UL }, /* -54 */
+    { 0xf5330471UL, 0x4d9265dfUL, 0xd53dd99fUL, 0x4b3066a8UL }, /* -53 */
+    { 0x993fe2c6UL, 0xd07b7fabUL, 0xe546a803UL, 0x8efe4029UL }, /* -52 */
+    { 0xbf8fdb78UL, 0x849a5f96UL, 0xde985204UL, 0x72bdd033UL }, /* -51 */
+    { 0xef73d256UL, 0xa5c0f77cUL, 0x963e6685UL, 0x8f6d4440UL }, /* -50 */
+    { 0x95a86376UL, 0x27989aadUL, 0xdde70013UL, 0x79a44aa8UL }, /* -49 */
+    { 0xbb127c53UL, 0xb17ec159UL, 0x5560c018UL, 0x580d5d52UL }, /* -48 */
+    { 0xe9d71b68UL, 0x9dde71afUL, 0xaab8f01eUL, 0x6e10b4a6UL }, /* -47 */
+    { 0x92267121UL, 0x62ab070dUL, 0xcab39613UL, 0x04ca70e8UL }, /* -46 */
+    { 0xb6b00d69UL, 0xbb55c8d1UL, 0x3d607b97UL, 0xc5fd0d22UL }, /* -45 */
+    { 0xe45c10c4UL, 0x2a2b3b05UL, 0x8cb89a7dUL, 0xb77c506aUL }, /* -44 */
+    { 0x8eb98a7aUL, 0x9a5b04e3UL, 0x77f3608eUL, 0x92adb242UL }, /* -43 */
+    { 0xb267ed19UL, 0x40f1c61cUL, 0x55f038b2UL, 0x37591ed3UL }, /* -42 */
+    { 0xdf01e85fUL, 0x912e37a3UL, 0x6b6c46deUL, 0xc52f6688UL }, /* -41 */
+    { 0x8b61313bUL, 0xbabce2c6UL, 0x2323ac4bUL, 0x3b3da015UL }, /* -40 */
+    { 0xae397d8aUL, 0xa96c1b77UL, 0xabec975eUL, 0x0a0d081aUL }, /* -39 */
+    { 0xd9c7dcedUL, 0x53c72255UL, 0x96e7bd35UL, 0x8c904a21UL }, /* -38 */
+    { 0x881cea14UL, 0x545c7575UL, 0x7e50d641UL, 0x77da2e54UL }, /* -37 */
+    { 0xaa242499UL, 0x697392d2UL, 0xdde50bd1UL, 0xd5d0b9e9UL }, /* -36 */
+    { 0xd4ad2dbfUL, 0xc3d07787UL, 0x955e4ec6UL, 0x4b44e864UL }, /* -35 */
+    { 0x84ec3c97UL, 0xda624ab4UL, 0xbd5af13bUL, 0xef0b113eUL }, /* -34 */
+    { 0xa6274bbdUL, 0xd0fadd61UL, 0xecb1ad8aUL, 0xeacdd58eUL }, /* -33 */
+    { 0xcfb11eadUL, 0x453994baUL, 0x67de18edUL, 0xa5814af2UL }, /* -32 */
+    { 0x81ceb32cUL, 0x4b43fcf4UL, 0x80eacf94UL, 0x8770ced7UL }, /* -31 */
+    { 0xa2425ff7UL, 0x5e14fc31UL, 0xa1258379UL, 0xa94d028dUL }, /* -30 */
+    { 0xcad2f7f5UL, 0x359a3b3eUL, 0x096ee458UL, 0x13a04330UL }, /* -29 */
+    { 0xfd87b5f2UL, 0x8300ca0dUL, 0x8bca9d6eUL, 0x188853fcUL }, /* -28 */
+    { 0x9e74d1b7UL, 0x91e07e48UL, 0x775ea264UL, 0xcf55347eUL }, /* -27 */
+    { 0xc6120625UL, 0x76589ddaUL, 0x95364afeUL, 0x032a819eUL }, /* -26 */
+    { 0xf79687aeUL, 0xd3eec551UL, 0x3a83ddbdUL, 0x83f52205UL }, /* -25 */
+    { 0x9abe14cdUL, 0x44753b52UL, 0xc4926a96UL, 0x72793543UL }, /* -24 */
+    { 0xc16d9a00UL, 0x95928a27UL, 0x75b7053cUL, 0x0f178294UL }, /* -23 */
+    { 0xf1c90080UL, 0xbaf72cb1UL, 0x5324c68bUL, 0x12dd6339UL }, /* -22 */
+    { 0x971da050UL, 0x74da7beeUL, 0xd3f6fc16UL, 0xebca5e04UL }, /* -21 */
+    { 0xbce50864UL, 0x92111aeaUL, 0x88f4bb1cUL, 0xa6bcf585UL }, /* -20 */
+    { 0xec1e4a7dUL, 0xb69561a5UL, 0x2b31e9e3UL, 0xd06c32e6UL }, /* -19 */
+    { 0x9392ee8eUL, 0x921d5d07UL, 0x3aff322eUL, 0x62439fd0UL }, /* -18 */
+    { 0xb877aa32UL, 0x36a4b449UL, 0x09befeb9UL, 0xfad487c3UL }, /* -17 */
+    { 0xe69594beUL, 0xc44de15bUL, 0x4c2ebe68UL, 0x7989a9b4UL }, /* -16 */
+    { 0x901d7cf7UL, 0x3ab0acd9UL, 0x0f9d3701UL, 0x4bf60a11UL }, /* -15 */
+    { 0xb424dc35UL, 0x095cd80fUL, 0x538484c1UL, 0x9ef38c95UL }, /* -14 */
+    { 0xe12e1342UL, 0x4bb40e13UL, 0x2865a5f2UL, 0x06b06fbaUL }, /* -13 */
+    { 0x8cbccc09UL, 0x6f5088cbUL, 0xf93f87b7UL, 0x442e45d4UL }, /* -12 */
+    { 0xafebff0bUL, 0xcb24aafeUL, 0xf78f69a5UL, 0x1539d749UL }, /* -11 */
+    { 0xdbe6feceUL, 0xbdedd5beUL, 0xb573440eUL, 0x5a884d1cUL }, /* -10 */
+    { 0x89705f41UL, 0x36b4a597UL, 0x31680a88UL, 0xf8953031UL }, /* -9 */
+    { 0xabcc7711UL, 0x8461cefcUL, 0xfdc20d2bUL, 0x36ba7c3eUL }, /* -8 */
+    { 0xd6bf94d5UL, 0xe57a42bcUL, 0x3d329076UL, 0x04691b4dUL }, /* -7 */
+    { 0x8637bd05UL, 0xaf6c69b5UL, 0xa63f9a49UL, 0xc2c1b110UL }, /* -6 */
+    { 0xa7c5ac47UL, 0x1b478423UL, 0x0fcf80dcUL, 0x33721d54UL }, /* -5 */
+    { 0xd1b71758UL, 0xe219652bUL, 0xd3c36113UL, 0x404ea4a9UL }, /* -4 */
+    { 0x83126e97UL, 0x8d4fdf3bUL, 0x645a1cacUL, 0x083126eaUL }, /* -3 */
+    { 0xa3d70a3dUL, 0x70a3d70aUL, 0x3d70a3d7UL, 0x0a3d70a4UL }, /* -2 */
+    { 0xccccccccUL, 0xccccccccUL, 0xccccccccUL, 0xcccccccdUL }, /* -1 */
+    { 0x80000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL }, /* 0 */
+    { 0xa0000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL }, /* 1 */
+    { 0xc8000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL }, /* 2 */
+    { 0xfa000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL }, /* 3 */
+    { 0x9c400000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL }, /* 4 */
+    { 0xc3500000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL }, /* 5 */
+    { 0xf4240000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL }, /* 6 */
+    { 0x98968000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL }, /* 7 */
+    { 0xbebc2000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL }, /* 8 */
+    { 0xee6b2800UL, 0x00000000UL, 0x00000000UL, 0x00000000UL }, /* 9 */
+    { 0x9502f900UL, 0x00000000UL, 0x00000000UL, 0x00000000UL }, /* 10 */
+    { 0xba43b740UL, 0x00000000UL, 0x00000000UL, 0x00000000UL }, /* 11 */
+    { 0xe8d4a510UL, 0x00000000UL, 0x00000000UL, 0x00000000UL }, /* 12 */
+    { 0x9184e72aUL, 0x00000000UL, 0x00000000UL, 0x00000000UL }, /* 13 */
+    { 0xb5e620f4UL, 0x80000000UL, 0x00000000UL, 0x00000000UL }, /* 14 */
+    { 0xe35fa931UL, 0xa0000000UL, 0x00000000UL, 0x00000000UL }, /* 15 */
+    { 0x8e1bc9bfUL, 0x04000000UL, 0x00000000UL, 0x00000000UL }, /* 16 */
+    { 0xb1a2bc2eUL, 0xc5000000UL, 0x00000000UL, 0x00000000UL }, /* 17 */
+    { 0xde0b6b3aUL, 0x76400000UL, 0x00000000UL, 0x00000000UL }, /* 18 */
+    { 0x8ac72304UL, 0x89e80000UL, 0x00000000UL, 0x00000000UL }, /* 19 */
+    { 0xad78ebc5UL, 0xac620000UL, 0x00000000UL, 0x00000000UL }, /* 20 */
+    { 0xd8d726b7UL, 0x177a8000UL, 0x00000000UL, 0x00000000UL }, /* 21 */
+    { 0x87867832UL, 0x6eac9000UL, 0x00000000UL, 0x00000000UL }, /* 22 */
+    { 0xa968163fUL, 0x0a57b400UL, 0x00000000UL, 0x00000000UL }, /* 23 */
+    { 0xd3c21bceUL, 0xcceda100UL, 0x00000000UL, 0x00000000UL }, /* 24 */
+    { 0x84595161UL, 0x401484a0UL, 0x00000000UL, 0x00000000UL }, /* 25 */
+    { 0xa56fa5b9UL, 0x9019a5c8UL, 0x00000000UL, 0x00000000UL }, /* 26 */
+    { 0xcecb8f27UL, 0xf4200f3aUL, 0x00000000UL, 0x00000000UL }, /* 27 */
+    { 0x813f3978UL, 0xf8940984UL, 0x40000000UL, 0x00000000UL }, /* 28 */
+    { 0xa18f07d7UL, 0x36b90be5UL, 0x50000000UL, 0x00000000UL }, /* 29 */
+    { 0xc9f2c9cdUL, 0x04674edeUL, 0xa4000000UL, 0x00000000UL }, /* 30 */
+    { 0xfc6f7c40UL, 0x45812296UL, 0x4d000000UL, 0x00000000UL }, /* 31 */
+    { 0x9dc5ada8UL, 0x2b70b59dUL, 0xf0200000UL, 0x00000000UL }, /* 32 */
+    { 0xc5371912UL, 0x364ce305UL, 0x6c280000UL, 0x00000000UL }, /* 33 */
+    { 0xf684df56UL, 0xc3e01bc6UL, 0xc7320000UL, 0x00000000UL }, /* 34 */
+    { 0x9a130b96UL, 0x3a6c115cUL, 0x3c7f4000UL, 0x00000000UL }, /* 35 */
+    { 0xc097ce7bUL, 0xc90715b3UL, 0x4b9f1000UL, 0x00000000UL }, /* 36 */
+    { 0xf0bdc21aUL, 0xbb48db20UL, 0x1e86d400UL, 0x00000000UL }, /* 37 */
+    { 0x96769950UL, 0xb50d88f4UL, 0x13144480UL, 0x00000000UL }, /* 38 */
+    { 0xbc143fa4UL, 0xe250eb31UL, 0x17d955a0UL, 0x00000000UL }, /* 39 */
+    { 0xeb194f8eUL, 0x1ae525fdUL, 0x5dcfab08UL, 0x00000000UL }, /* 40 */
+    { 0x92efd1b8UL, 0xd0cf37beUL, 0x5aa1cae5UL, 0x00000000UL }, /* 41 */
+    { 0xb7abc627UL, 0x050305adUL, 0xf14a3d9eUL, 0x40000000UL }, /* 42 */
+    { 0xe596b7b0UL, 0xc643c719UL, 0x6d9ccd05UL, 0xd0000000UL }, /* 43 */
+    { 0x8f7e32ceUL, 0x7bea5c6fUL, 0xe4820023UL, 0xa2000000UL }, /* 44 */
+    { 0xb35dbf82UL, 0x1ae4f38bUL, 0xdda2802cUL, 0x8a800000UL }, /* 45 */
+    { 0xe0352f62UL, 0xa19e306eUL, 0xd50b2037UL, 0xad200000UL }, /* 46 */
+    { 0x8c213d9dUL, 0xa502de45UL, 0x4526f422UL, 0xcc340000UL }, /* 47 */
+    { 0xaf298d05UL, 0x0e4395d6UL, 0x9670b12bUL, 0x7f410000UL }, /* 48 */
+    { 0xdaf3f046UL, 0x51d47b4cUL, 0x3c0cdd76UL, 0x5f114000UL }, /* 49 */
+    { 0x88d8762bUL, 0xf324cd0fUL, 0xa5880a69UL, 0xfb6ac800UL }, /* 50 */
+    { 0xab0e93b6UL, 0xefee0053UL, 0x8eea0d04UL, 0x7a457a00UL }, /* 51 */
+    { 0xd5d238a4UL, 0xabe98068UL, 0x72a49045UL, 0x98d6d880UL }, /* 52 */
+    { 0x85a36366UL, 0xeb71f041UL, 0x47a6da2bUL, 0x7f864750UL }, /* 53 */
+    { 0xa70c3c40UL, 0xa64e6c51UL, 0x999090b6UL, 0x5f67d924UL }, /* 54 */
+    { 0xd0cf4b50UL, 0xcfe20765UL, 0xfff4b4e3UL, 0xf741cf6dUL }, /* 55 */
+    { 0x82818f12UL, 0x81ed449fUL, 0xbff8f10eUL, 0x7a8921a4UL }, /* 56 */
+    { 0xa321f2d7UL, 0x226895c7UL, 0xaff72d52UL, 0x192b6a0dUL }, /* 57 */
+    { 0xcbea6f8cUL, 0xeb02bb39UL, 0x9bf4f8a6UL, 0x9f764490UL }, /* 58 */
+    { 0xfee50b70UL, 0x25c36a08UL, 0x02f236d0UL, 0x4753d5b4UL }, /* 59 */
+    { 0x9f4f2726UL, 0x179a2245UL, 0x01d76242UL, 0x2c946590UL }, /* 60 */
+    { 0xc722f0efUL, 0x9d80aad6UL, 0x424d3ad2UL, 0xb7b97ef5UL }, /* 61 */
+    { 0xf8ebad2bUL, 0x84e0d58bUL, 0xd2e08987UL, 0x65a7deb2UL }, /* 62 */
+    { 0x9b934c3bUL, 0x330c8577UL, 0x63cc55f4UL, 0x9f88eb2fUL }, /* 63 */
+    { 0xc2781f49UL, 0xffcfa6d5UL, 0x3cbf6b71UL, 0xc76b25fbUL }, /* 64 */
+    { 0xf316271cUL, 0x7fc3908aUL, 0x8bef464eUL, 0x3945ef7aUL }, /* 65 */
+    { 0x97edd871UL, 0xcfda3a56UL, 0x97758bf0UL, 0xe3cbb5acUL }, /* 66 */
+    { 0xbde94e8eUL, 0x43d0c8ecUL, 0x3d52eeedUL, 0x1cbea317UL }, /* 67 */
+    { 0xed63a231UL, 0xd4c4fb27UL, 0x4ca7aaa8UL, 0x63ee4bddUL }, /* 68 */
+    { 0x945e455fUL, 0x24fb1cf8UL, 0x8fe8caa9UL, 0x3e74ef6aUL }, /* 69 */
+    { 0xb975d6b6UL, 0xee39e436UL, 0xb3e2fd53UL, 0x8e122b44UL }, /* 70 */
+    { 0xe7d34c64UL, 0xa9c85d44UL, 0x60dbbca8UL, 0x7196b616UL }, /* 71 */
+    { 0x90e40fbeUL, 0xea1d3a4aUL, 0xbc8955e9UL, 0x46fe31cdUL }, /* 72 */
+    { 0xb51d13aeUL, 0xa4a488ddUL, 0x6babab63UL, 0x98bdbe41UL }, /* 73 */
+    { 0xe264589aUL, 0x4dcdab14UL, 0xc696963cUL, 0x7eed2dd1UL }, /* 74 */
+    { 0x8d7eb760UL, 0x70a08aecUL, 0xfc1e1de5UL, 0xcf543ca2UL }, /* 75 */
+    { 0xb0de6538UL, 0x8cc8ada8UL, 0x3b25a55fUL, 0x43294bcbUL }, /* 76 */
+    { 0xdd15fe86UL, 0xaffad912UL, 0x49ef0eb7UL, 0x13f39ebeUL }, /* 77 */
+    { 0x8a2dbf14UL, 0x2dfcc7abUL, 0x6e356932UL, 0x6c784337UL }, /* 78 */
+    { 0xacb92ed9UL, 0x397bf996UL, 0x49c2c37fUL, 0x07965404UL }, /* 79 */
+    { 0xd7e77a8fUL, 0x87daf7fbUL, 0xdc33745eUL, 0xc97be906UL }, /* 80 */
+    { 0x86f0ac99UL, 0xb4e8dafdUL, 0x69a028bbUL, 0x3ded71a3UL }, /* 81 */
+    { 0xa8acd7c0UL, 0x222311bcUL, 0xc40832eaUL, 0x0d68ce0cUL }, /* 82 */
+    { 0xd2d80db0UL, 0x2aabd62bUL, 0xf50a3fa4UL, 0x90c30190UL }, /* 83 */
+    { 0x83c7088eUL, 0x1aab65dbUL, 0x792667c6UL, 0xda79e0faUL }, /* 84 */
+    { 0xa4b8cab1UL, 0xa1563f52UL, 0x577001b8UL, 0x91185938UL }, /* 85 */
+    { 0xcde6fd5eUL, 0x09abcf26UL, 0xed4c0226UL, 0xb55e6f86UL }, /* 86 */
+    { 0x80b05e5aUL, 0xc60b6178UL, 0x544f8158UL, 0x315b05b4UL }, /* 87 */
+    { 0xa0dc75f1UL, 0x778e39d6UL, 0x696361aeUL, 0x3db1c721UL }, /* 88 */
+    { 0xc913936dUL, 0xd571c84cUL, 0x03bc3a19UL, 0xcd1e38e9UL }, /* 89 */
+    { 0xfb587849UL, 0x4ace3a5fUL, 0x04ab48a0UL, 0x4065c723UL }, /* 90 */
+    { 0x9d174b2dUL, 0xcec0e47bUL, 0x62eb0d64UL, 0x283f9c76UL }, /* 91 */
+    { 0xc45d1df9UL, 0x42711d9aUL, 0x3ba5d0bdUL, 0x324f8394UL }, /* 92 */
+    { 0xf5746577UL, 0x930d6500UL, 0xca8f44ecUL, 0x7ee36479UL }, /* 93 */
+    { 0x9968bf6aUL, 0xbbe85f20UL, 0x7e998b13UL, 0xcf4e1ecbUL }, /* 94 */
+    { 0xbfc2ef45UL, 0x6ae276e8UL, 0x9e3fedd8UL, 0xc321a67eUL }, /* 95 */
+    { 0xefb3ab16UL, 0xc59b14a2UL, 0xc5cfe94eUL, 0xf3ea101eUL }, /* 96 */
+    { 0x95d04aeeUL, 0x3b80ece5UL, 0xbba1f1d1UL, 0x58724a12UL }, /* 97 */
+    { 0xbb445da9UL, 0xca61281fUL, 0x2a8a6e45UL, 0xae8edc97UL }, /* 98 */
+    { 0xea157514UL, 0x3cf97226UL, 0xf52d09d7UL, 0x1a3293bdUL }, /* 99 */
+    { 0x924d692cUL, 0xa61be758UL, 0x593c2626UL, 0x705f9c56UL }, /* 100 */
+    { 0xb6e0c377UL, 0xcfa2e12eUL, 0x6f8b2fb0UL, 0x0c77836cUL }, /* 101 */
+    { 0xe498f455UL, 0xc38b997aUL, 0x0b6dfb9cUL, 0x0f956447UL }, /* 102 */
+    { 0x8edf98b5UL, 0x9a373fecUL, 0x4724bd41UL, 0x89bd5eacUL }, /* 103 */
+    { 0xb2977ee3UL, 0x00c50fe7UL, 0x58edec91UL, 0xec2cb657UL }, /* 104 */
+    { 0xdf3d5e9bUL, 0xc0f653e1UL, 0x2f2967b6UL, 0x6737e3edUL }, /* 105 */
+    { 0x8b865b21UL, 0x5899f46cUL, 0xbd79e0d2UL, 0x0082ee74UL }, /* 106 */
+    { 0xae67f1e9UL, 0xaec07187UL, 0xecd85906UL, 0x80a3aa11UL }, /* 107 */
+    { 0xda01ee64UL, 0x1a708de9UL, 0xe80e6f48UL, 0x20cc9495UL }, /* 108 */
+    { 0x884134feUL, 0x908658b2UL, 0x3109058dUL, 0x147fdcddUL }, /* 109 */
+    { 0xaa51823eUL, 0x34a7eedeUL, 0xbd4b46f0UL, 0x599fd415UL }, /* 110 */
+    { 0xd4e5e2cdUL, 0xc1d1ea96UL, 0x6c9e18acUL, 0x7007c91aUL }, /* 111 */
+    { 0x850fadc0UL, 0x9923329eUL, 0x03e2cf6bUL, 0xc604ddb0UL }, /* 112 */
+    { 0xa6539930UL, 0xbf6bff45UL, 0x84db8346UL, 0xb786151cUL }, /* 113 */
+    { 0xcfe87f7cUL, 0xef46ff16UL, 0xe6126418UL, 0x65679a63UL }, /* 114 */
+    { 0x81f14faeUL, 0x158c5f6eUL, 0x4fcb7e8fUL, 0x3f60c07eUL }, /* 115 */
+    { 0xa26da399UL, 0x9aef7749UL, 0xe3be5e33UL, 0x0f38f09dUL }, /* 116 */
+    { 0xcb090c80UL, 0x01ab551cUL, 0x5cadf5bfUL, 0xd3072cc5UL }, /* 117 */
+    { 0xfdcb4fa0UL, 0x02162a63UL, 0x73d9732fUL, 0xc7c8f7f6UL }, /* 118 */
+    { 0x9e9f11c4UL, 0x014dda7eUL, 0x2867e7fdUL, 0xdcdd9afaUL }, /* 119 */
+    { 0xc646d635UL, 0x01a1511dUL, 0xb281e1fdUL, 0x541501b8UL }, /* 120 */
+    { 0xf7d88bc2UL, 0x4209a565UL, 0x1f225a7cUL, 0xa91a4226UL }, /* 121 */
+    { 0x9ae75759UL, 0x6946075fUL, 0x3375788dUL, 0xe9b06958UL }, /* 122 */
+    { 0xc1a12d2fUL, 0xc3978937UL, 0x0052d6b1UL, 0x641c83aeUL }, /* 123 */
+    { 0xf209787bUL, 0xb47d6b84UL, 0xc0678c5dUL, 0xbd23a49aUL }, /* 124 */
+    { 0x9745eb4dUL, 0x50ce6332UL, 0xf840b7baUL, 0x963646e0UL }, /* 125 */
+    { 0xbd176620UL, 0xa501fbffUL, 0xb650e5a9UL, 0x3bc3d898UL }, /* 126 */
+    { 0xec5d3fa8UL, 0xce427affUL, 0xa3e51f13UL, 0x8ab4cebeUL }, /* 127 */
+    { 0x93ba47c9UL, 0x80e98cdfUL, 0xc66f336cUL, 0x36b10137UL }, /* 128 */
+    { 0xb8a8d9bbUL, 0xe123f017UL, 0xb80b0047UL, 0x445d4184UL }, /* 129 */
+    { 0xe6d3102aUL, 0xd96cec1dUL, 0xa60dc059UL, 0x157491e5UL }, /* 130 */
+    { 0x9043ea1aUL, 0xc7e41392UL, 0x87c89837UL, 0xad68db2fUL }, /* 131 */
+    { 0xb454e4a1UL, 0x79dd1877UL, 0x29babe45UL, 0x98c311fbUL }, /* 132 */
+    { 0xe16a1dc9UL, 0xd8545e94UL, 0xf4296dd6UL, 0xfef3d67aUL }, /* 133 */
+    { 0x8ce2529eUL, 0x2734bb1dUL, 0x1899e4a6UL, 0x5f58660cUL }, /* 134 */
+    { 0xb01ae745UL, 0xb101e9e4UL, 0x5ec05dcfUL, 0xf72e7f8fUL }, /* 135 */
+    { 0xdc21a117UL, 0x1d42645dUL, 0x76707543UL, 0xf4fa1f73UL }, /* 136 */
+    { 0x899504aeUL, 0x72497ebaUL, 0x6a06494aUL, 0x791c53a8UL }, /* 137 */
+    { 0xabfa45daUL, 0x0edbde69UL, 0x0487db9dUL, 0x17636892UL }, /* 138 */
+    { 0xd6f8d750UL, 0x9292d603UL, 0x45a9d284UL, 0x5d3c42b6UL }, /* 139 */
+    { 0x865b8692UL, 0x5b9bc5c2UL, 0x0b8a2392UL, 0xba45a9b2UL }, /* 140 */
+    { 0xa7f26836UL, 0xf282b732UL, 0x8e6cac77UL, 0x68d7141eUL }, /* 141 */
+    { 0xd1ef0244UL, 0xaf2364ffUL, 0x3207d795UL, 0x430cd926UL }, /* 142 */
+    { 0x8335616aUL, 0xed761f1fUL, 0x7f44e6bdUL, 0x49e807b8UL }, /* 143 */
+    { 0xa402b9c5UL, 0xa8d3a6e7UL, 0x5f16206cUL, 0x9c6209a6UL }, /* 144 */
+    { 0xcd036837UL, 0x130890a1UL, 0x36dba887UL, 0xc37a8c0fUL }, /* 145 */
+    { 0x80222122UL, 0x6be55a64UL, 0xc2494954UL, 0xda2c9789UL }, /* 146 */
+    { 0xa02aa96bUL, 0x06deb0fdUL, 0xf2db9baaUL, 0x10b7bd6cUL }, /* 147 */
+    { 0xc83553c5UL, 0xc8965d3dUL, 0x6f928294UL, 0x94e5acc7UL }, /* 148 */
+    { 0xfa42a8b7UL, 0x3abbf48cUL, 0xcb772339UL, 0xba1f17f9UL }, /* 149 */
+    { 0x9c69a972UL, 0x84b578d7UL, 0xff2a7604UL, 0x14536efbUL }, /* 150 */
+    { 0xc38413cfUL, 0x25e2d70dUL, 0xfef51385UL, 0x19684abaUL }, /* 151 */
+    { 0xf46518c2UL, 0xef5b8cd1UL, 0x7eb25866UL, 0x5fc25d69UL }, /* 152 */
+    { 0x98bf2f79UL, 0xd5993802UL, 0xef2f773fUL, 0xfbd97a61UL }, /* 153 */
+    { 0xbeeefb58UL, 0x4aff8603UL, 0xaafb550fUL, 0xfacfd8faUL }, /* 154 */
+    { 0xeeaaba2eUL, 0x5dbf6784UL, 0x95ba2a53UL, 0xf983cf38UL }, /* 155 */
+    { 0x952ab45cUL, 0xfa97a0b2UL, 0xdd945a74UL, 0x7bf26183UL }, /* 156 */
+    { 0xba756174UL, 0x393d88dfUL, 0x94f97111UL, 0x9aeef9e4UL }, /* 157 */
+    { 0xe912b9d1UL, 0x478ceb17UL, 0x7a37cd56UL, 0x01aab85dUL }, /* 158 */
+    { 0x91abb422UL, 0xccb812eeUL, 0xac62e055UL, 0xc10ab33aUL }, /* 159 */
+    { 0xb616a12bUL, 0x7fe617aaUL, 0x577b986bUL, 0x314d6009UL }, /* 160 */
+    { 0xe39c4976UL, 0x5fdf9d94UL, 0xed5a7e85UL, 0xfda0b80bUL }, /* 161 */
+    { 0x8e41ade9UL, 0xfbebc27dUL, 0x14588f13UL, 0xbe847307UL }, /* 162 */
+    { 0xb1d21964UL, 0x7ae6b31cUL, 0x596eb2d8UL, 0xae258fc8UL }, /* 163 */
+    { 0xde469fbdUL, 0x99a05fe3UL, 0x6fca5f8eUL, 0xd9aef3bbUL }, /* 164 */
+    { 0x8aec23d6UL, 0x80043beeUL, 0x25de7bb9UL, 0x480d5854UL }, /* 165 */
+    { 0xada72cccUL, 0x20054ae9UL, 0xaf561aa7UL, 0x9a10ae6aUL }, /* 166 */
+    { 0xd910f7ffUL, 0x28069da4UL, 0x1b2ba151UL, 0x8094da04UL }, /* 167 */
+    { 0x87aa9affUL, 0x79042286UL, 0x90fb44d2UL, 0xf05d0842UL }, /* 168 */
+    { 0xa99541bfUL, 0x57452b28UL, 0x353a1607UL, 0xac744a53UL }, /* 169 */
+    { 0xd3fa922fUL, 0x2d1675f2UL, 0x42889b89UL, 0x97915ce8UL }, /* 170 */
+    { 0x847c9b5dUL, 0x7c2e09b7UL, 0x69956135UL, 0xfebada11UL }, /* 171 */
+    { 0xa59bc234UL, 0xdb398c25UL, 0x43fab983UL, 0x7e699095UL }, /* 172 */
+    { 0xcf02b2c2UL, 0x1207ef2eUL, 0x94f967e4UL, 0x5e03f4bbUL }, /* 173 */
+    { 0x8161afb9UL, 0x4b44f57dUL, 0x1d1be0eeUL, 0xbac278f5UL }, /* 174 */
+    { 0xa1ba1ba7UL, 0x9e1632dcUL, 0x6462d92aUL, 0x69731732UL }, /* 175 */
+    { 0xca28a291UL, 0x859bbf93UL, 0x7d7b8f75UL, 0x03cfdcfeUL }, /* 176 */
+    { 0xfcb2cb35UL, 0xe702af78UL, 0x5cda7352UL, 0x44c3d43eUL }, /* 177 */
+    { 0x9defbf01UL, 0xb061adabUL, 0x3a088813UL, 0x6afa64a7UL }, /* 178 */
+    { 0xc56baec2UL, 0x1c7a1916UL, 0x088aaa18UL, 0x45b8fdd0UL }, /* 179 */
+    { 0xf6c69a72UL, 0xa3989f5bUL, 0x8aad549eUL, 0x57273d45UL }, /* 180 */
+    { 0x9a3c2087UL, 0xa63f6399UL, 0x36ac54e2UL, 0xf678864bUL }, /* 181 */
+    { 0xc0cb28a9UL, 0x8fcf3c7fUL, 0x84576a1bUL, 0xb416a7ddUL }, /* 182 */
+    { 0xf0fdf2d3UL, 0xf3c30b9fUL, 0x656d44a2UL, 0xa11c51d5UL }, /* 183 */
+    { 0x969eb7c4UL, 0x7859e743UL, 0x9f644ae5UL, 0xa4b1b325UL }, /* 184 */
+    { 0xbc4665b5UL, 0x96706114UL, 0x873d5d9fUL, 0x0dde1feeUL }, /* 185 */
+    { 0xeb57ff22UL, 0xfc0c7959UL, 0xa90cb506UL, 0xd155a7eaUL }, /* 186 */
+    { 0x9316ff75UL, 0xdd87cbd8UL, 0x09a7f124UL, 0x42d588f2UL }, /* 187 */
+    { 0xb7dcbf53UL, 0x54e9beceUL, 0x0c11ed6dUL, 0x538aeb2fUL }, /* 188 */
+    { 0xe5d3ef28UL, 0x2a242e81UL, 0x8f1668c8UL, 0xa86da5faUL }, /* 189 */
+    { 0x8fa47579UL, 0x1a569d10UL, 0xf96e017dUL, 0x694487bcUL }, /* 190 */
+    { 0xb38d92d7UL, 0x60ec4455UL, 0x37c981dcUL, 0xc395a9acUL }, /* 191 */
+    { 0xe070f78dUL, 0x3927556aUL, 0x85bbe253UL, 0xf47b1417UL }, /* 192 */
+    { 0x8c469ab8UL, 0x43b89562UL, 0x93956d74UL, 0x78ccec8eUL }, /* 193 */
+    { 0xaf584166UL, 0x54a6babbUL, 0x387ac8d1UL, 0x970027b2UL }, /* 194 */
+    { 0xdb2e51bfUL, 0xe9d0696aUL, 0x06997b05UL, 0xfcc0319eUL }, /* 195 */
+    { 0x88fcf317UL, 0xf22241e2UL, 0x441fece3UL, 0xbdf81f03UL }, /* 196 */
+    { 0xab3c2fddUL, 0xeeaad25aUL, 0xd527e81cUL, 0xad7626c3UL }, /* 197 */
+    { 0xd60b3bd5UL, 0x6a5586f1UL, 0x8a71e223UL, 0xd8d3b074UL }, /* 198 */
+    { 0x85c70565UL, 0x62757456UL, 0xf6872d56UL, 0x67844e49UL }, /* 199 */
+    { 0xa738c6beUL, 0xbb12d16cUL, 0xb428f8acUL, 0x016561dbUL }, /* 200 */
+    { 0xd106f86eUL, 0x69d785c7UL, 0xe13336d7UL, 0x01beba52UL }, /* 201 */
+    { 0x82a45b45UL, 0x0226b39cUL, 0xecc00246UL, 0x61173473UL }, /* 202 */
+    { 0xa34d7216UL, 0x42b06084UL, 0x27f002d7UL, 0xf95d0190UL }, /* 203 */
+    { 0xcc20ce9bUL, 0xd35c78a5UL, 0x31ec038dUL, 0xf7b441f4UL }, /* 204 */
+    { 0xff290242UL, 0xc83396ceUL, 0x7e670471UL, 0x75a15271UL }, /* 205 */
+    { 0x9f79a169UL, 0xbd203e41UL, 0x0f0062c6UL, 0xe984d386UL }, /* 206 */
+    { 0xc75809c4UL, 0x2c684dd1UL, 0x52c07b78UL, 0xa3e60868UL }, /* 207 */
+    { 0xf92e0c35UL, 0x37826145UL, 0xa7709a56UL, 0xccdf8a82UL }, /* 208 */
+    { 0x9bbcc7a1UL, 0x42b17ccbUL, 0x88a66076UL, 0x400bb691UL }, /* 209 */
+    { 0xc2abf989UL, 0x935ddbfeUL, 0x6acff893UL, 0xd00ea435UL }, /* 210 */
+    { 0xf356f7ebUL, 0xf83552feUL, 0x0583f6b8UL, 0xc4124d43UL }, /* 211 */
+    { 0x98165af3UL, 0x7b2153deUL, 0xc3727a33UL, 0x7a8b704aUL }, /* 212 */
+    { 0xbe1bf1b0UL, 0x59e9a8d6UL, 0x744f18c0UL, 0x592e4c5cUL }, /* 213 */
+    { 0xeda2ee1cUL, 0x7064130cUL, 0x1162def0UL, 0x6f79df73UL }, /* 214 */
+    { 0x9485d4d1UL, 0xc63e8be7UL, 0x8addcb56UL, 0x45ac2ba8UL }, /* 215 */
+    { 0xb9a74a06UL, 0x37ce2ee1UL, 0x6d953e2bUL, 0xd7173692UL }, /* 216 */
+    { 0xe8111c87UL, 0xc5c1ba99UL, 0xc8fa8db6UL, 0xccdd0437UL }, /* 217 */
+    { 0x910ab1d4UL, 0xdb9914a0UL, 0x1d9c9892UL, 0x400a22a2UL }, /* 218 */
+    { 0xb54d5e4aUL, 0x127f59c8UL, 0x2503beb6UL, 0xd00cab4bUL }, /* 219 */
+    { 0xe2a0b5dcUL, 0x971f303aUL, 0x2e44ae64UL, 0x840fd61dUL }, /* 220 */
+    { 0x8da471a9UL, 0xde737e24UL, 0x5ceaecfeUL, 0xd289e5d2UL }, /* 221 */
+    { 0xb10d8e14UL, 0x56105dadUL, 0x7425a83eUL, 0x872c5f47UL }, /* 222 */
+    { 0xdd50f199UL, 0x6b947518UL, 0xd12f124eUL, 0x28f77719UL }, /* 223 */
+    { 0x8a5296ffUL, 0xe33cc92fUL, 0x82bd6b70UL, 0xd99aaa6fUL }, /* 224 */
+    { 0xace73cbfUL, 0xdc0bfb7bUL, 0x636cc64dUL, 0x1001550bUL }, /* 225 */
+    { 0xd8210befUL, 0xd30efa5aUL, 0x3c47f7e0UL, 0x5401aa4eUL }, /* 226 */
+    { 0x8714a775UL, 0xe3e95c78UL, 0x65acfaecUL, 0x34810a71UL }, /* 227 */
+    { 0xa8d9d153UL, 0x5ce3b396UL, 0x7f1839a7UL, 0x41a14d0dUL }, /* 228 */
+    { 0xd31045a8UL, 0x341ca07cUL, 0x1ede4811UL, 0x1209a050UL }, /* 229 */
+    { 0x83ea2b89UL, 0x2091e44dUL, 0x934aed0aUL, 0xab460432UL }, /* 230 */
+    { 0xa4e4b66bUL, 0x68b65d60UL, 0xf81da84dUL, 0x5617853fUL }, /* 231 */
+    { 0xce1de406UL, 0x42e3f4b9UL, 0x36251260UL, 0xab9d668eUL }, /* 232 */
+    { 0x80d2ae83UL, 0xe9ce78f3UL, 0xc1d72b7cUL, 0x6b426019UL }, /* 233 */
+    { 0xa1075a24UL, 0xe4421730UL, 0xb24cf65bUL, 0x8612f81fUL }, /* 234 */
+    { 0xc94930aeUL, 0x1d529cfcUL, 0xdee033f2UL, 0x6797b627UL }, /* 235 */
+    { 0xfb9b7cd9UL, 0xa4a7443cUL, 0x169840efUL, 0x017da3b1UL }, /* 236 */
+    { 0x9d412e08UL, 0x06e88aa5UL, 0x8e1f2895UL, 0x60ee864eUL }, /* 237 */
+    { 0xc491798aUL, 0x08a2ad4eUL, 0xf1a6f2baUL, 0xb92a27e2UL }, /* 238 */
+    { 0xf5b5d7ecUL, 0x8acb58a2UL, 0xae10af69UL, 0x6774b1dbUL }, /* 239 */
+    { 0x9991a6f3UL, 0xd6bf1765UL, 0xacca6da1UL, 0xe0a8ef29UL }, /* 240 */
+    { 0xbff610b0UL, 0xcc6edd3fUL, 0x17fd090aUL, 0x58d32af3UL }, /* 241 */
+    { 0xeff394dcUL, 0xff8a948eUL, 0xddfc4b4cUL, 0xef07f5b0UL }, /* 242 */
+    { 0x95f83d0aUL, 0x1fb69cd9UL, 0x4abdaf10UL, 0x1564f98eUL }, /* 243 */
+    { 0xbb764c4cUL, 0xa7a4440fUL, 0x9d6d1ad4UL, 0x1abe37f1UL }, /* 244 */
+    { 0xea53df5fUL, 0xd18d5513UL, 0x84c86189UL, 0x216dc5edUL }, /* 245 */
+    { 0x92746b9bUL, 0xe2f8552cUL, 0x32fd3cf5UL, 0xb4e49bb4UL }, /* 246 */
+    { 0xb7118682UL, 0xdbb66a77UL, 0x3fbc8c33UL, 0x221dc2a1UL }, /* 247 */
+    { 0xe4d5e823UL, 0x92a40515UL, 0x0fabaf3fUL, 0xeaa5334aUL }, /* 248 */
+    { 0x8f05b116UL, 0x3ba6832dUL, 0x29cb4d87UL, 0xf2a7400eUL }, /* 249 */
+    { 0xb2c71d5bUL, 0xca9023f8UL, 0x743e20e9UL, 0xef511012UL }, /* 250 */
+    { 0xdf78e4b2UL, 0xbd342cf6UL, 0x914da924UL, 0x6b255416UL }, /* 251 */
+    { 0x8bab8eefUL, 0xb6409c1aUL, 0x1ad089b6UL, 0xc2f7548eUL }, /* 252 */
+    { 0xae9672abUL, 0xa3d0c320UL, 0xa184ac24UL, 0x73b529b1UL }, /* 253 */
+    { 0xda3c0f56UL, 0x8cc4f3e8UL, 0xc9e5d72dUL, 0x90a2741eUL }, /* 254 */
+    { 0x88658996UL, 0x17fb1871UL, 0x7e2fa67cUL, 0x7a658892UL }, /* 255 */
+    { 0xaa7eebfbUL, 0x9df9de8dUL, 0xddbb901bUL, 0x98feeab7UL }, /* 256 */
+    { 0xd51ea6faUL, 0x85785631UL, 0x552a7422UL, 0x7f3ea565UL }, /* 257 */
+    { 0x8533285cUL, 0x936b35deUL, 0xd53a8895UL, 0x8f87275fUL }, /* 258 */
+    { 0xa67ff273UL, 0xb8460356UL, 0x8a892abaUL, 0xf368f137UL }, /* 259 */
+    { 0xd01fef10UL, 0xa657842cUL, 0x2d2b7569UL, 0xb0432d85UL }, /* 260 */
+    { 0x8213f56aUL, 0x67f6b29bUL, 0x9c3b2962UL, 0x0e29fc73UL }, /* 261 */
+    { 0xa298f2c5UL, 0x01f45f42UL, 0x8349f3baUL, 0x91b47b8fUL }, /* 262 */
+    { 0xcb3f2f76UL, 0x42717713UL, 0x241c70a9UL, 0x36219a73UL }, /* 263 */
+    { 0xfe0efb53UL, 0xd30dd4d7UL, 0xed238cd3UL, 0x83aa0110UL }, /* 264 */
+    { 0x9ec95d14UL, 0x63e8a506UL, 0xf4363804UL, 0x324a40aaUL }, /* 265 */
+    { 0xc67bb459UL, 0x7ce2ce48UL, 0xb143c605UL, 0x3edcd0d5UL }, /* 266 */
+    { 0xf81aa16fUL, 0xdc1b81daUL, 0xdd94b786UL, 0x8e94050aUL }, /* 267 */
+    { 0x9b10a4e5UL, 0xe9913128UL, 0xca7cf2b4UL, 0x191c8326UL }, /* 268 */
+    { 0xc1d4ce1fUL, 0x63f57d72UL, 0xfd1c2f61UL, 0x1f63a3f0UL }, /* 269 */
+    { 0xf24a01a7UL, 0x3cf2dccfUL, 0xbc633b39UL, 0x673c8cecUL }, /* 270 */
+    { 0x976e4108UL, 0x8617ca01UL, 0xd5be0503UL, 0xe085d813UL }, /* 271 */
+    { 0xbd49d14aUL, 0xa79dbc82UL, 0x4b2d8644UL, 0xd8a74e18UL }, /* 272 */
+    { 0xec9c459dUL, 0x51852ba2UL, 0xddf8e7d6UL, 0x0ed1219eUL }, /* 273 */
+    { 0x93e1ab82UL, 0x52f33b45UL, 0xcabb90e5UL, 0xc942b503UL }, /* 274 */
+    { 0xb8da1662UL, 0xe7b00a17UL, 0x3d6a751fUL, 0x3b936243UL }, /* 275 */
+    { 0xe7109bfbUL, 0xa19c0c9dUL, 0x0cc51267UL, 0x0a783ad4UL }, /* 276 */
+    { 0x906a617dUL, 0x450187e2UL, 0x27fb2b80UL, 0x668b24c5UL }, /* 277 */
+    { 0xb484f9dcUL, 0x9641e9daUL, 0xb1f9f660UL, 0x802dedf6UL }, /* 278 */
+    { 0xe1a63853UL, 0xbbd26451UL, 0x5e7873f8UL, 0xa0396973UL }, /* 279 */
+    { 0x8d07e334UL, 0x55637eb2UL, 0xdb0b487bUL, 0x6423e1e8UL }, /* 280 */
+    { 0xb049dc01UL, 0x6abc5e5fUL, 0x91ce1a9aUL, 0x3d2cda62UL }, /* 281 */
+    { 0xdc5c5301UL, 0xc56b75f7UL, 0x7641a140UL, 0xcc7810fbUL }, /* 282 */
+    { 0x89b9b3e1UL, 0x1b6329baUL, 0xa9e904c8UL, 0x7fcb0a9dUL }, /* 283 */
+    { 0xac2820d9UL, 0x623bf429UL, 0x546345faUL, 0x9fbdcd44UL }, /* 284 */
+    { 0xd732290fUL, 0xbacaf133UL, 0xa97c1779UL, 0x47ad4095UL }, /* 285 */
+    { 0x867f59a9UL, 0xd4bed6c0UL, 0x49ed8eabUL, 0xcccc485dUL }, /* 286 */
+    { 0xa81f3014UL, 0x49ee8c70UL, 0x5c68f256UL, 0xbfff5a74UL }, /* 287 */
+    { 0xd226fc19UL, 0x5c6a2f8cUL, 0x73832eecUL, 0x6fff3111UL }, /* 288 */
+    { 0x83585d8fUL, 0xd9c25db7UL, 0xc831fd53UL, 0xc5ff7eabUL }, /* 289 */
+    { 0xa42e74f3UL, 0xd032f525UL, 0xba3e7ca8UL, 0xb77f5e55UL }, /* 290 */
+    { 0xcd3a1230UL, 0xc43fb26fUL, 0x28ce1bd2UL, 0xe55f35ebUL }, /* 291 */
+    { 0x80444b5eUL, 0x7aa7cf85UL, 0x7980d163UL, 0xcf5b81b3UL }, /* 292 */
+    { 0xa0555e36UL, 0x1951c366UL, 0xd7e105bcUL, 0xc332621fUL }, /* 293 */
+    { 0xc86ab5c3UL, 0x9fa63440UL, 0x8dd9472bUL, 0xf3fefaa7UL }, /* 294 */
+    { 0xfa856334UL, 0x878fc150UL, 0xb14f98f6UL, 0xf0feb951UL }, /* 295 */
+    { 0x9c935e00UL, 0xd4b9d8d2UL, 0x6ed1bf9aUL, 0x569f33d3UL }, /* 296 */
+    { 0xc3b83581UL, 0x09e84f07UL, 0x0a862f80UL, 0xec4700c8UL }, /* 297 */
+    { 0xf4a642e1UL, 0x4c6262c8UL, 0xcd27bb61UL, 0x2758c0faUL }, /* 298 */
+    { 0x98e7e9ccUL, 0xcfbd7dbdUL, 0x8038d51cUL, 0xb897789cUL }, /* 299 */
+    { 0xbf21e440UL, 0x03acdd2cUL, 0xe0470a63UL, 0xe6bd56c3UL }, /* 300 */
+    { 0xeeea5d50UL, 0x04981478UL, 0x1858ccfcUL, 0xe06cac74UL }, /* 301 */
+    { 0x95527a52UL, 0x02df0ccbUL, 0x0f37801eUL, 0x0c43ebc8UL }, /* 302 */
+    { 0xbaa718e6UL, 0x8396cffdUL, 0xd3056025UL, 0x8f54e6baUL }, /* 303 */
+    { 0xe950df20UL, 0x247c83fdUL, 0x47c6b82eUL, 0xf32a2069UL }, /* 304 */
+    { 0x91d28b74UL, 0x16cdd27eUL, 0x4cdc331dUL, 0x57fa5441UL }, /* 305 */
+    { 0xb6472e51UL, 0x1c81471dUL, 0xe0133fe4UL, 0xadf8e952UL }, /* 306 */
+    { 0xe3d8f9e5UL, 0x63a198e5UL, 0x58180fddUL, 0xd97723a6UL }, /* 307 */
+    { 0x8e679c2fUL, 0x5e44ff8fUL, 0x570f09eaUL, 0xa7ea7648UL }, /* 308 */
+    { 0xb201833bUL, 0x35d63f73UL, 0x2cd2cc65UL, 0x51e513daUL }, /* 309 */
+    { 0xde81e40aUL, 0x034bcf4fUL, 0xf8077f7eUL, 0xa65e58d1UL }, /* 310 */
+    { 0x8b112e86UL, 0x420f6191UL, 0xfb04afafUL, 0x27faf782UL }, /* 311 */
+    { 0xadd57a27UL, 0xd29339f6UL, 0x79c5db9aUL, 0xf1f9b563UL }, /* 312 */
+    { 0xd94ad8b1UL, 0xc7380874UL, 0x18375281UL, 0xae7822bcUL }, /* 313 */
+    { 0x87cec76fUL, 0x1c830548UL, 0x8f229391UL, 0x0d0b15b5UL }, /* 314 */
+    { 0xa9c2794aUL, 0xe3a3c69aUL, 0xb2eb3875UL, 0x504ddb22UL }, /* 315 */
+    { 0xd433179dUL, 0x9c8cb841UL, 0x5fa60692UL, 0xa46151ebUL }, /* 316 */
+    { 0x849feec2UL, 0x81d7f328UL, 0xdbc7c41bUL, 0xa6bcd333UL }, /* 317 */
+    { 0xa5c7ea73UL, 0x224deff3UL, 0x12b9b522UL, 0x906c0800UL }, /* 318 */
+    { 0xcf39e50fUL, 0xeae16befUL, 0xd768226bUL, 0x34870a00UL }, /* 319 */
+    { 0x81842f29UL, 0xf2cce375UL, 0xe6a11583UL, 0x00d46640UL }, /* 320 */
+    { 0xa1e53af4UL, 0x6f801c53UL, 0x60495ae3UL, 0xc1097fd0UL }, /* 321 */
+    { 0xca5e89b1UL, 0x8b602368UL, 0x385bb19cUL, 0xb14bdfc4UL }, /* 322 */
+    { 0xfcf62c1dUL, 0xee382c42UL, 0x46729e03UL, 0xdd9ed7b5UL }, /* 323 */
+    { 0x9e19db92UL, 0xb4e31ba9UL, 0x6c07a2c2UL, 0x6a8346d1UL }, /* 324 */
+    { 0xc5a05277UL, 0x621be293UL, 0xc7098b73UL, 0x05241885UL }, /* 325 */
+    { 0xf7086715UL, 0x3aa2db38UL, 0xb8cbee4fUL, 0xc66d1ea7UL }, /* 326 */
+    { 0x9a65406dUL, 0x44a5c903UL, 0x737f74f1UL, 0xdc043328UL }, /* 327 */
+    { 0xc0fe9088UL, 0x95cf3b44UL, 0x505f522eUL, 0x53053ff2UL }, /* 328 */
+    { 0xf13e34aaUL, 0xbb430a15UL, 0x647726b9UL, 0xe7c68fefUL }, /* 329 */
+    { 0x96c6e0eaUL, 0xb509e64dUL, 0x5eca7834UL, 0x30dc19f5UL }, /* 330 */
+    { 0xbc789925UL, 0x624c5fe0UL, 0xb67d1641UL, 0x3d132072UL }, /* 331 */
+    { 0xeb96bf6eUL, 0xbadf77d8UL, 0xe41c5bd1UL, 0x8c57e88fUL }, /* 332 */
+    { 0x933e37a5UL, 0x34cbaae7UL, 0x8e91b962UL, 0xf7b6f159UL }, /* 333 */
+    { 0xb80dc58eUL, 0x81fe95a1UL, 0x723627bbUL, 0xb5a4adb0UL }, /* 334 */
+    { 0xe61136f2UL, 0x227e3b09UL, 0xcec3b1aaUL, 0xa30dd91cUL }, /* 335 */
+    { 0x8fcac257UL, 0x558ee4e6UL, 0x213a4f0aUL, 0xa5e8a7b1UL }, /* 336 */
+    { 0xb3bd72edUL, 0x2af29e1fUL, 0xa988e2cdUL, 0x4f62d19dUL }, /* 337 */
+    { 0xe0accfa8UL, 0x75af45a7UL, 0x93eb1b80UL, 0xa33b8605UL }, /* 338 */
+    { 0x8c6c01c9UL, 0x498d8b88UL, 0xbc72f130UL, 0x660533c3UL }, /* 339 */
+    { 0xaf87023bUL, 0x9bf0ee6aUL, 0xeb8fad7cUL, 0x7f8680b4UL }  /* 340 */
+};
+
+/* 64-bit product of two 32-bit values */
+static void mul32(unsigned long a, unsigned long b,
+                  unsigned long *hi, unsigned long *lo)
+{
+    unsigned long a0, a1, b0, b1, p0, p1, p2, mid;
+
+    a0 = a & 0xffff;
+    a1 = a >> 16;
+    b0 = b & 0xffff;
+    b1 = b >> 16;
+    p0 = a0*b0;
+    p1 = a0*b1;
+    p2 = a1*b0;
+    mid = (p0 >> 16) + (p1 & 0xffff) + (p2 & 0xffff);
+    *lo = (p0 & 0xffff) | (mid << 16);
+    *hi = a1*b1 + (p1 >> 16) + (p2 >> 16) + (mid >> 16);
+}
+
+/*
+ * __ma_umul64 - The full 128-bit product of a and b, in hi and lo.
+ */
+void __ma_umul64(const unsigned_long_long_t *a, const unsigned_long_long_t *b,
+                 unsigned_long_long_t *hi, unsigned_long_long_t *lo)
+{
+    unsigned long h0, l0, h1, l1, h2, l2, h3, l3, t, c;
+
+    mul32(a->lo, b->lo, &h0, &l0);
+    mul32(a->lo, b->hi, &h1, &l1);
+    mul32(a->hi, b->lo, &h2, &l2);
+    mul32(a->hi, b->hi, &h3, &l3);
+
+    lo->lo = l0;
+    t = h0+l1;
+    c = (t < l1);
+    t += l2;
+    c += (t < l2);
+    lo->hi = t;
+    t = l3+c;
+    c = (t < c);
+    t += h1;
+    c += (t < h1);
+    t += h2;
+    c += (t < h2);
+    hi->lo = t;
+    hi->hi = h3+c;
+}
+
+/*
+ * __ma_big_set - b = hi*2**32 + lo.
+ */
+void __ma_big_set(ma_big_t *b, unsigned long hi, unsigned long lo)
+{
+    b->d[0] = lo;
+    b->d[1] = hi;
+    b->n = (hi) ? 2 : (lo) ? 1 : 0;
+}
+
+/*
+ * __ma_big_muladd - b = b*m + a.
+ */
+void __ma_big_muladd(ma_big_t *b, unsigned long m, unsigned long a)
+{
+    unsigned long c;
+
+    if (b->n == 0) {
+        b->d[0] = a;
+        b->n = (a) ? 1 : 0;
+        return;
+    }
+    c = ma_mpn_mul_1(b->d, b->d, b->n, m);
+    c += ma_mpn_add(b->d, b->d, b->n, &a, 1);
+    if (c) b->d[b->n++] = c;
+}
+
+/*
+ * __ma_big_mulpow5 - b = b*5**k, k >= 0.
+ */
+void __ma_big_mulpow5(ma_big_t *b, int k)
+{
+    static const unsigned long pow5[14] = {
+        1UL, 5UL, 25UL, 125UL, 625UL, 3125UL, 15625UL, 78125UL,
+        390625UL, 1953125UL, 9765625UL, 48828125UL, 244140625UL,
+        1220703125UL
+    };
+
+    for (; k >= 13; k -= 13)
+        __ma_big_muladd(b, pow5[13], 0);
+    if (k > 0) __ma_big_muladd(b, pow5[k], 0);
+}
+
+/*
+ * __ma_big_shl - b = b*2**k, k >= 0.
+ */
+void __ma_big_shl(ma_big_t *b, int k)
+{
+    int w, s, i;
+
+    if (b->n == 0) return;
+    w = k >> 5;
+    s = k & 31;
+    if (s) {
+        b->d[b->n] = 0;
+        for (i = b->n; i > 0; i--)
+            b->d[i] = (b->d[i] << s) | (b->d[i-1] >> (32-s));
+        b->d[0] <<= s;
+        if (b->d[b->n]) b->n++;
+    }
+    if (w) {
+        for (i = b->n-1; i >= 0; i--)
+            b->d[i+w] = b->d[i];
+        for (i = 0; i < w; i++)
+            b->d[i] = 0;
+        b->n += w;
+    }
+}
+
+/*
+ * __ma_big_add - a = a+b.
+ */
+void __ma_big_add(ma_big_t *a, const ma_big_t *b)
+{
+    unsigned long c;
+
+    while (a->n < b->n) a->d[a->n++] = 0;
+    c = ma_mpn_add(a->d, a->d, a->n, b->d, b->n);
+    if (c) a->d[a->n++] = c;
+}
+
+/*
+ * __ma_big_sub - a = a-b, where a >= b.
+ */
+void __ma_big_sub(ma_big_t *a, const ma_big_t *b)
+{
+    ma_mpn_sub(a->d, a->d, a->n, b->d, b->n);
+    while (a->n > 0 && a->d[a->n-1] == 0) a->n--;
+}
+
+/*
+ * __ma_big_cmp - Return <0, 0 or >0 as a <, = or > b.
+ */
+int __ma_big_cmp(const ma_big_t *a, const ma_big_t *b)
+{
+    int i;
+
+    if (a->n != b->n) return (a->n > b->n) ? 1 : -1;
+    for (i = a->n-1; i >= 0; i--) {
+        if (a->d[i] != b->d[i]) return (a->d[i] > b->d[i]) ? 1 : -1;
+    }
+    return 0;
+}
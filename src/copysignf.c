@@ -54,10 +54,6 @@
 * 
 ******************************************************************************/
 
-/* Helper macros for accessing high/low parts of float */
-/* SAS/C uses big-endian, so high word is first */
-#define __HI(x) *(int*)&x
-
 float copysignf(float x, float y)
 {
     __HI(x) = (__HI(x)&0x7fffffff)|(__HI(y)&0x80000000);
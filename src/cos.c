@@ -17,10 +17,6 @@
 #include <math.h>
 #include "include/internal/m99_math.h"
 
-/* Helper macros for accessing high/low parts of double */
-/* SAS/C uses big-endian, so high word is first */
-#define __HI(x) *(int*)&x
-
 /* Internal functions for cos - reuse from sin.c */
 extern int __ieee754_rem_pio2(double x, double *y);
 extern double __kernel_sin(double x, double y, int iy);
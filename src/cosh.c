@@ -18,11 +18,6 @@
 #include <math.h>
 #include "include/internal/m99_math.h"
 
-/* Helper macros for accessing high/low parts of double */
-/* SAS/C uses big-endian, so high word is first */
-#define __HI(x) *(int*)&x
-#define __LO(x) *(1+(int*)&x)
-
 static const double one = 1.0, half=0.5, huge = 1.0e300;
 
 static double __ieee754_cosh(double x)
@@ -107,4 +102,3 @@ double cosh(double x)
     return __ieee754_cosh(x);
 }
 
-
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * double cospi(double x)
+ * Return cos(pi*x)
+ */
+
+#include <math.h>
+#include <errno.h>
+#include "include/internal/m99_math.h"
+
+/* Shared kernels - see sin.c and sinpi.c */
+extern double __kernel_sin(double x, double y, int iy);
+extern double __kernel_cos(double x, double y);
+extern int __kernel_rempi(double x, double *r, double *y);
+
+static const double zero = 0.0;
+
+/****** ma.lib/cospi ********************************************************
+*
+*   NAME	
+* 	cospi -- Return cos(pi*x). (V1.0)
+*
+*   SYNOPSIS
+*	double result = cospi(double x);
+*	  D0		    D0
+*	double cospi(double x);
+*
+*   FUNCTION
+*	Compute the cosine of pi times x, with the same exact reduction
+*	modulo 2 as sinpi().
+*
+*   INPUTS
+*	x - Input value, in half-turns.
+*
+*   RESULT
+*	result - cos(pi*x). Exactly +-1 for any integer x and exactly +0
+*	        for any half-integer x. Returns NaN for an infinite or NaN
+*	        x.
+*
+*   EXAMPLE
+*	double c = cospi(1.0);
+*
+*   NOTES
+*	C23. Sets errno to EDOM for infinite x.
+*
+*   SEE ALSO
+*	sinpi(), tanpi(), acospi(), cos(), ma_cosd(), math.h
+*
+******************************************************************************/
+
+double cospi(double x)
+{
+    double r, y[2];
+    int n;
+
+    /* cospi(Inf or NaN) is NaN */
+    if((__HI(x)&0x7fffffff) >= 0x7ff00000) {
+        if(x == x) __ma_seterr(EDOM);
+        return x-x;
+    }
+
+    n = __kernel_rempi(x, &r, y);
+    if(r == zero && (n&1) != 0) return zero;	/* half-integer */
+    switch(n) {
+        case 0: return  __kernel_cos(y[0],y[1]);
+        case 1: return -__kernel_sin(y[0],y[1],1);
+        case 2: return -__kernel_cos(y[0],y[1]);
+        default:
+                return  __kernel_sin(y[0],y[1],1);
+    }
+}
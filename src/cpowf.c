@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * float_complex cpowf(float_complex z, float_complex w)
+ * Complex power (float).
+ */
+
+#include <math.h>
+#include <complex.h>
+#include "include/internal/m99_math.h"
+
+/****** ma.lib/cpowf ********************************************************
+* 
+*   NAME	
+* 	cpowf -- Return z raised to the complex power w (float). (V1.0)
+*
+*   SYNOPSIS
+*	float_complex result = cpowf(float_complex z, float_complex w);
+*	  D0		   D0
+*	float_complex cpowf(float_complex z, float_complex w);
+*
+*   FUNCTION
+*	Compute z^w as cexpf(w * clogf(z)) in float arithmetic.
+* 
+*   INPUTS
+*	z - Float complex base.
+*	w - Float complex exponent.
+*	
+*   RESULT
+*	result - z raised to the power w. 0^w is 1 if w is 0 and 0
+*	        otherwise.
+* 
+*   EXAMPLE
+*	float_complex z = {0.0f, 1.0f};
+*	float_complex w = {2.0f, 0.0f};
+*	float_complex p = cpowf(z, w);
+*
+*   NOTES
+*	The principal branch of clogf() is used, so the result has a
+*	branch cut along the negative real axis of z.
+* 
+*   SEE ALSO
+*	cpow(), cexpf(), clogf(), complex.h
+* 
+******************************************************************************/
+
+float_complex cpowf(float_complex z, float_complex w)
+{
+    float_complex l, t, result;
+
+    if(z.re == 0.0f && z.im == 0.0f) {
+        result.re = (w.re == 0.0f && w.im == 0.0f) ? 1.0f : 0.0f;
+        result.im = 0.0f;
+        return result;
+    }
+    l = clogf(z);
+    t.re = w.re*l.re - w.im*l.im;
+    t.im = w.re*l.im + w.im*l.re;
+    return cexpf(t);
+}
@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * complex_t cpowi(complex_t z, long n)
+ * Return complex z raised to the integer power n
+ */
+
+#include <math.h>
+#include <complex.h>
+#include "include/internal/m99_math.h"
+
+/* Shared integer power kernels - see pown.c */
+extern void __kernel_mul22(double ah, double al, double bh, double bl,
+                           double *hi, double *lo);
+
+static const double
+one    = 1.0,
+two400 = 2.58224987808690858966e+120,	/* 0x58F00000, 0x00000000 */
+twom400= 3.87259191484931827282e-121;	/* 0x26F00000, 0x00000000 */
+
+/*
+ * add22 - Double-double sum (ah+al)+(bh+bl).
+ */
+static void add22(double ah, double al, double bh, double bl,
+                  double *hi, double *lo)
+{
+    double s, v, e;
+
+    s = ah+bh;
+    v = s-ah;
+    e = ((ah-(s-v))+(bh-v))+(al+bl);
+    *hi = s+e;
+    *lo = e-(*hi-s);
+}
+
+/*
+ * cmul22 - Complex product x*y, each part held as a double-double pair
+ * {re, re_lo, im, im_lo}. r may be the same array as x or y.
+ */
+static void cmul22(const double *x, const double *y, double *r)
+{
+    double ach, acl, bdh, bdl, adh, adl, bch, bcl;
+
+    __kernel_mul22(x[0], x[1], y[0], y[1], &ach, &acl);
+    __kernel_mul22(x[2], x[3], y[2], y[3], &bdh, &bdl);
+    __kernel_mul22(x[0], x[1], y[2], y[3], &adh, &adl);
+    __kernel_mul22(x[2], x[3], y[0], y[1], &bch, &bcl);
+    add22(ach, acl, -bdh, -bdl, &r[0], &r[1]);
+    add22(adh, adl, bch, bcl, &r[2], &r[3]);
+}
+
+/*
+ * renorm - Keep the larger part of z within [2**-400, 2**400] by exact
+ * power of two scaling, recording the scale in *e.
+ */
+static void renorm(double *z, double *e)
+{
+    double m = fabs(z[0]) > fabs(z[2]) ? fabs(z[0]) : fabs(z[2]);
+    double s;
+    int i;
+
+    if (m < twom400) {
+        s = two400; *e -= 400.0;
+    } else if (m > two400) {
+        s = twom400; *e += 400.0;
+    } else {
+        return;
+    }
+    for (i = 0; i < 4; i++) z[i] *= s;
+}
+
+/****** ma.lib/cpowi ********************************************************
+*
+*   NAME	
+* 	cpowi -- Return complex number raised to an integer power. (V1.0)
+*
+*   SYNOPSIS
+*	complex_t result = cpowi(complex_t z, long n);
+*	  D0		       D0          D0
+*	complex_t cpowi(complex_t z, long n);
+*
+*   FUNCTION
+*	Compute z raised to the integer power n by binary exponentiation
+*	instead of through clog() and cexp(). The products are carried
+*	out in double-double precision, and the operands are kept scaled
+*	so that no intermediate overflows or underflows.
+*
+*   INPUTS
+*	z - Complex base.
+*	n - Integer exponent.
+*
+*   RESULT
+*	result - z^n. Returns 1+0i if n is 0, and a complex infinity for
+*	        a zero z and negative n.
+*
+*   EXAMPLE
+*	complex_t z = {1.0, 1.0};
+*	complex_t r = cpowi(z, 8);
+*
+*   NOTES
+*	Infinite and NaN parts are passed on to cpow().
+*
+*   SEE ALSO
+*	cpow(), pown(), powi(), complex.h
+*
+******************************************************************************/
+
+complex_t cpowi(complex_t z, long n)
+{
+    complex_t result, w;
+    double b[4], r[4];
+    double be, re, m, d, rre, rim;
+    unsigned long k;
+    int ex;
+
+    if (n == 0) {
+        result.re = one;
+        result.im = 0.0;
+        return result;
+    }
+    if (z.re-z.re != 0.0 || z.im-z.im != 0.0) {
+        w.re = (double)n;
+        w.im = 0.0;
+        return cpow(z, w);
+    }
+    if (z.re == 0.0 && z.im == 0.0) {
+        result.re = (n > 0) ? __ma_zero : one/__ma_zero;
+        result.im = 0.0;
+        return result;
+    }
+
+    /* z = b * 2**be with the larger part of b in [0.5,1) */
+    m = fabs(z.re) > fabs(z.im) ? fabs(z.re) : fabs(z.im);
+    (void)frexp(m, &ex);
+    b[0] = ldexp(z.re, -ex); b[1] = 0.0;
+    b[2] = ldexp(z.im, -ex); b[3] = 0.0;
+    be = (double)ex;
+    r[0] = one; r[1] = 0.0; r[2] = 0.0; r[3] = 0.0;
+    re = 0.0;
+
+    k = (n < 0) ? 0UL-(unsigned long)n : (unsigned long)n;
+    for (;;) {
+        if (k & 1) {
+            cmul22(r, b, r);
+            re += be;
+            renorm(r, &re);
+        }
+        k >>= 1;
+        if (k == 0) break;
+        cmul22(b, b, b);
+        be += be;
+        renorm(b, &be);
+    }
+
+    rre = r[0]+r[1];
+    rim = r[2]+r[3];
+    if (n < 0) {
+        /* 1/(a+ib) = (a-ib)/(a*a+b*b); a,b are scaled, so no overflow */
+        d = rre*rre + rim*rim;
+        rre = rre/d;
+        rim = -rim/d;
+        re = -re;
+    }
+    if (re > 4000.0) re = 4000.0;
+    else if (re < -4000.0) re = -4000.0;
+    result.re = scalbn(rre, (int)re);
+    result.im = scalbn(rim, (int)re);
+    return result;
+}
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * long_double_complex cpowl(long_double_complex z, long_double_complex w)
+ * Z raised to the complex power w (long double).
+ */
+
+#include <math.h>
+#include <complex.h>
+#include "include/internal/m99_math.h"
+
+/****** ma.lib/cpowl ********************************************************
+* 
+*   NAME	
+* 	cpowl -- Return z raised to the complex power w (long double). (V1.0)
+*
+*   SYNOPSIS
+*	long_double_complex result = cpowl(long_double_complex z, long_double_complex w);
+*	  D0		   D0
+*	long_double_complex cpowl(long_double_complex z, long_double_complex w);
+*
+*   FUNCTION
+*	Compute z raised to the complex power w.
+*	long double has the same format as double under SAS/C, so this
+*	is evaluated by cpow() at full long double precision.
+* 
+*   INPUTS
+*	z - Long double complex base.
+*	w - Long double complex exponent.
+*	
+*   RESULT
+*	result - Z raised to the complex power w, as cpow().
+* 
+*   EXAMPLE
+*	long_double_complex z = {1.0L, 2.0L};
+*	long_double_complex w = {2.0L, 0.0L};
+*	long_double_complex r = cpowl(z, w);
+*
+*   NOTES
+*	Special values follow the double version.
+* 
+*   SEE ALSO
+*	cpow(), cpowf(), complex.h
+* 
+******************************************************************************/
+
+long_double_complex cpowl(long_double_complex z, long_double_complex w)
+{
+    complex_t a, b, r;
+    long_double_complex result;
+
+    a.re = (double)z.re;
+    a.im = (double)z.im;
+    b.re = (double)w.re;
+    b.im = (double)w.im;
+    r = cpow(a, b);
+    result.re = (long double)r.re;
+    result.im = (long double)r.im;
+    return result;
+}
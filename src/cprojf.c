@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * float_complex cprojf(float_complex z)
+ * Complex projection onto the Riemann sphere (float).
+ */
+
+#include <math.h>
+#include <complex.h>
+#include "include/internal/m99_math.h"
+
+/****** ma.lib/cprojf *******************************************************
+* 
+*   NAME	
+* 	cprojf -- Return projection of z onto the Riemann sphere (float). (V1.0)
+*
+*   SYNOPSIS
+*	float_complex result = cprojf(float_complex z);
+*	  D0		   D0
+*	float_complex cprojf(float_complex z);
+*
+*   FUNCTION
+*	Return z unchanged, except that a complex infinity (either part
+*	infinite, even if the other part is NaN) projects to
+*	+Infinity + i*copysign(0, im).
+* 
+*   INPUTS
+*	z - Float complex number structure with real and imaginary parts.
+*	
+*   RESULT
+*	result - Projection of z.
+* 
+*   EXAMPLE
+*	float_complex z = {1.0f/0.0f, -2.0f};
+*	float_complex p = cprojf(z);
+*
+*   NOTES
+*	Exact.
+* 
+*   SEE ALSO
+*	cproj(), conjf(), complex.h
+* 
+******************************************************************************/
+
+float_complex cprojf(float_complex z)
+{
+    float_complex result;
+    int hr, hi;
+
+    result = z;
+    hr = __HI(z.re)&0x7fffffff;
+    hi = __HI(z.im)&0x7fffffff;
+    if(hr==0x7f800000||hi==0x7f800000) {
+        __HI(result.re) = 0x7f800000;
+        __HI(result.im) = __HI(z.im)&0x80000000;
+    }
+    return result;
+}
@@ -11,6 +11,8 @@
 
 #include "complex.h"
 
+#undef creal
+
 /****** ma.lib/creal ***********************************************************
 * 
 *   NAME	
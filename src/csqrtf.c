@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * float_complex csqrtf(float_complex z)
+ * Complex square root (float).
+ */
+
+#include <math.h>
+#include <complex.h>
+#include "include/internal/m99_math.h"
+
+/* Float kernels - see kernelf.c */
+extern float __kernel_hypotf(float x, float y);
+extern float __kernel_sqrtf(float x);
+
+/****** ma.lib/csqrtf *******************************************************
+* 
+*   NAME	
+* 	csqrtf -- Return complex square root (float). (V1.0)
+*
+*   SYNOPSIS
+*	float_complex result = csqrtf(float_complex z);
+*	  D0		   D0
+*	float_complex csqrtf(float_complex z);
+*
+*   FUNCTION
+*	Compute the principal square root of z with Kahan's method: the
+*	real part is taken from sqrt((|a| + |z|)/2), the other part by
+*	division, so that neither suffers cancellation. Very large
+*	arguments are scaled by 1/4 first so |z| cannot overflow.
+* 
+*   INPUTS
+*	z - Float complex number structure with real and imaginary parts.
+*	
+*   RESULT
+*	result - Square root of z with non-negative real part. The sign
+*	        of the imaginary part follows the sign of z.im, including
+*	        for a zero imaginary part.
+* 
+*   EXAMPLE
+*	float_complex z = {-4.0f, 0.0f};
+*	float_complex r = csqrtf(z);
+*
+*   NOTES
+*	The branch cut is the negative real axis.
+* 
+*   SEE ALSO
+*	csqrt(), cpowf(), cabsf(), complex.h
+* 
+******************************************************************************/
+
+float_complex csqrtf(float_complex z)
+{
+    float_complex result;
+    float a, b, t;
+    int scale;
+
+    a = z.re;
+    b = z.im;
+    if(a == 0.0f && b == 0.0f) {
+        result.re = 0.0f;
+        result.im = b;
+        return result;
+    }
+    if((__HI(b)&0x7fffffff) == 0x7f800000) {	/* csqrt(x +- i*Inf) */
+        __HI(result.re) = 0x7f800000;
+        result.im = b;
+        return result;
+    }
+    scale = 0;
+    if(a > 7.5e37f || a < -7.5e37f || b > 7.5e37f || b < -7.5e37f) {
+        a *= 0.25f;
+        b *= 0.25f;
+        scale = 1;
+    }
+    if(a >= 0.0f) {
+        t = __kernel_sqrtf(0.5f*(a+__kernel_hypotf(a, b)));
+        result.re = t;
+        result.im = b/(t+t);
+    } else {
+        t = __kernel_sqrtf(0.5f*(__kernel_hypotf(a, b)-a));
+        result.re = (b < 0.0f ? -b : b)/(t+t);
+        result.im = t;
+        __HI(result.im) |= __HI(b)&0x80000000;
+    }
+    if(scale) {
+        result.re *= 2.0f;
+        result.im *= 2.0f;
+    }
+    return result;
+}
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * long_double_complex csqrtl(long_double_complex z)
+ * Complex square root (long double).
+ */
+
+#include <math.h>
+#include <complex.h>
+#include "include/internal/m99_math.h"
+
+/****** ma.lib/csqrtl *******************************************************
+* 
+*   NAME	
+* 	csqrtl -- Return complex square root (long double). (V1.0)
+*
+*   SYNOPSIS
+*	long_double_complex result = csqrtl(long_double_complex z);
+*	  D0		   D0
+*	long_double_complex csqrtl(long_double_complex z);
+*
+*   FUNCTION
+*	Compute the principal square root of z.
+*	long double has the same format as double under SAS/C, so this
+*	is evaluated by csqrt() at full long double precision.
+* 
+*   INPUTS
+*	z - Long double complex number structure with real and imaginary parts.
+*	
+*   RESULT
+*	result - Principal square root of z, as csqrt().
+* 
+*   EXAMPLE
+*	long_double_complex z = {1.0L, 2.0L};
+*	long_double_complex r = csqrtl(z);
+*
+*   NOTES
+*	Special values follow the double version.
+* 
+*   SEE ALSO
+*	csqrt(), csqrtf(), complex.h
+* 
+******************************************************************************/
+
+long_double_complex csqrtl(long_double_complex z)
+{
+    complex_t a, r;
+    long_double_complex result;
+
+    a.re = (double)z.re;
+    a.im = (double)z.im;
+    r = csqrt(a);
+    result.re = (long double)r.re;
+    result.im = (long double)r.im;
+    return result;
+}
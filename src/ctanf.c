@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * float_complex ctanf(float_complex z)
+ * Complex tangent (float).
+ */
+
+#include <math.h>
+#include <complex.h>
+#include "include/internal/m99_math.h"
+
+/****** ma.lib/ctanf ********************************************************
+* 
+*   NAME	
+* 	ctanf -- Return complex tangent (float). (V1.0)
+*
+*   SYNOPSIS
+*	float_complex result = ctanf(float_complex z);
+*	  D0		   D0
+*	float_complex ctanf(float_complex z);
+*
+*   FUNCTION
+*	Compute tan(z) as -i*ctanhf(i*z).
+* 
+*   INPUTS
+*	z - Float complex number structure with real and imaginary parts.
+*	
+*   RESULT
+*	result - Complex tangent of z.
+* 
+*   EXAMPLE
+*	float_complex z = {1.0f, 1.0f};
+*	float_complex t = ctanf(z);
+*
+*   NOTES
+*	Inherits the accuracy and overflow behaviour of ctanhf().
+* 
+*   SEE ALSO
+*	ctan(), csinf(), ccosf(), ctanhf(), complex.h
+* 
+******************************************************************************/
+
+float_complex ctanf(float_complex z)
+{
+    float_complex iz, w, result;
+
+    iz.re = -z.im;
+    iz.im = z.re;
+    w = ctanhf(iz);
+    result.re = w.im;
+    result.im = -w.re;
+    return result;
+}
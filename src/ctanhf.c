@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * float_complex ctanhf(float_complex z)
+ * Complex hyperbolic tangent (float).
+ */
+
+#include <math.h>
+#include <complex.h>
+#include "include/internal/m99_math.h"
+
+/* Float kernels - see kernelf.c */
+extern float __kernel_expf(float x);
+extern void __kernel_sincosf(float x, float *s, float *c);
+extern void __kernel_sinhcoshf(float x, float *sh, float *ch);
+
+/****** ma.lib/ctanhf *******************************************************
+* 
+*   NAME	
+* 	ctanhf -- Return complex hyperbolic tangent (float). (V1.0)
+*
+*   SYNOPSIS
+*	float_complex result = ctanhf(float_complex z);
+*	  D0		   D0
+*	float_complex ctanhf(float_complex z);
+*
+*   FUNCTION
+*	Compute tanh(a + bi) with Kahan's formula: with t = tan(b),
+*	beta = 1 + t*t and s = sinh(a),
+*	    tanh(z) = (beta*cosh(a)*s + i*t) / (1 + beta*s*s).
+*	For |a| > 9 the real part is +-1 to float precision and the
+*	imaginary part is 4*sin(b)*cos(b)*exp(-2|a|).
+* 
+*   INPUTS
+*	z - Float complex number structure with real and imaginary parts.
+*	
+*   RESULT
+*	result - Complex hyperbolic tangent of z.
+* 
+*   EXAMPLE
+*	float_complex z = {1.0f, 1.0f};
+*	float_complex t = ctanhf(z);
+*
+*   NOTES
+*	The formula avoids the overflow and cancellation of computing
+*	sinh(z)/cosh(z) directly.
+* 
+*   SEE ALSO
+*	ctanh(), csinhf(), ccoshf(), ctanf(), complex.h
+* 
+******************************************************************************/
+
+float_complex ctanhf(float_complex z)
+{
+    float_complex result;
+    float s, c, t, beta, sh, ch, denom;
+
+    __kernel_sincosf(z.im, &s, &c);
+    if(z.re > 9.0f || z.re < -9.0f) {
+        result.re = z.re > 0.0f ? 1.0f : -1.0f;
+        result.im = 4.0f*s*c*__kernel_expf(-2.0f*(z.re > 0.0f ? z.re : -z.re));
+        return result;
+    }
+    t = s/c;
+    beta = 1.0f+t*t;
+    __kernel_sinhcoshf(z.re, &sh, &ch);
+    denom = 1.0f+beta*sh*sh;
+    result.re = (beta*ch*sh)/denom;
+    result.im = t/denom;
+    return result;
+}
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * long_double_complex ctanhl(long_double_complex z)
+ * Complex hyperbolic tangent (long double).
+ */
+
+#include <math.h>
+#include <complex.h>
+#include "include/internal/m99_math.h"
+
+/****** ma.lib/ctanhl *******************************************************
+* 
+*   NAME	
+* 	ctanhl -- Return complex hyperbolic tangent (long double). (V1.0)
+*
+*   SYNOPSIS
+*	long_double_complex result = ctanhl(long_double_complex z);
+*	  D0		   D0
+*	long_double_complex ctanhl(long_double_complex z);
+*
+*   FUNCTION
+*	Compute the complex hyperbolic tangent of z.
+*	long double has the same format as double under SAS/C, so this
+*	is evaluated by ctanh() at full long double precision.
+* 
+*   INPUTS
+*	z - Long double complex number structure with real and imaginary parts.
+*	
+*   RESULT
+*	result - Complex hyperbolic tangent of z, as ctanh().
+* 
+*   EXAMPLE
+*	long_double_complex z = {1.0L, 2.0L};
+*	long_double_complex r = ctanhl(z);
+*
+*   NOTES
+*	Special values follow the double version.
+* 
+*   SEE ALSO
+*	ctanh(), ctanhf(), complex.h
+* 
+******************************************************************************/
+
+long_double_complex ctanhl(long_double_complex z)
+{
+    complex_t a, r;
+    long_double_complex result;
+
+    a.re = (double)z.re;
+    a.im = (double)z.im;
+    r = ctanh(a);
+    result.re = (long double)r.re;
+    result.im = (long double)r.im;
+    return result;
+}
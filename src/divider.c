@@ -0,0 +1,471 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Division by invariant integers
+ *
+ * Method :
+ *	Granlund and Montgomery, "Division by Invariant Integers using
+ *	Multiplication" (1994), in the form used by libdivide. For a
+ *	divisor d that is not a power of 2, with L = floor(log2(|d|)),
+ *	the magic number is m = floor(2**(N+L)/|d|)+1 for an N-bit
+ *	dividend. If m*|d| overshoots 2**(N+L) by less than 2**L, the
+ *	quotient is mulhi(m, n) >> L. Otherwise m needs N+1 bits; its
+ *	low N bits are kept and the quotient is recovered as
+ *	((n-q)/2 + q) >> L, with q = mulhi(m, n), without overflow.
+ *	Signed division works on |d| with one bit less of magic, and
+ *	corrects the truncation toward zero afterwards. Powers of 2 are
+ *	plain shifts.
+ *	Setting up a divider costs one bit-serial division; each
+ *	quotient after that costs one multiply-high and a few adds and
+ *	shifts.
+ */
+
+#include <errno.h>
+#include "include/internal/longlong.h"
+#include "include/internal/conv.h"
+#include "include/internal/bits.h"
+
+/* Flags in the 'more' byte, below them the shift */
+#define DIV_SHIFT_MASK  0x3F
+#define DIV_ADD_MARKER  0x40
+#define DIV_NEGATIVE    0x80
+
+/* Position of the top set bit of x != 0 */
+static int floor_log2_32(unsigned long x)
+{
+    return 31 - __ma_clz32(x);
+}
+
+static int floor_log2_64(const unsigned_long_long_t *x)
+{
+    return (x->hi) ? 32+floor_log2_32(x->hi) : floor_log2_32(x->lo);
+}
+
+/* High 32 bits of a*b, from 16-bit halves */
+static unsigned long mulhi32(unsigned long a, unsigned long b)
+{
+    unsigned long a0, a1, b0, b1, p1, p2, mid;
+
+    a0 = a & 0xFFFF;
+    a1 = a >> 16;
+    b0 = b & 0xFFFF;
+    b1 = b >> 16;
+    p1 = a0*b1;
+    p2 = a1*b0;
+    mid = ((a0*b0) >> 16) + (p1 & 0xFFFF) + (p2 & 0xFFFF);
+    return a1*b1 + (p1 >> 16) + (p2 >> 16) + (mid >> 16);
+}
+
+/* q = floor(2**e * 2**32 / d) and its remainder, with 2**e < d */
+static unsigned long div_pow2_32(int e, unsigned long d, unsigned long *rem)
+{
+    unsigned long r, q, top;
+    int i;
+
+    r = 1UL << e;
+    q = 0;
+    for (i = 0; i < 32; i++) {
+        top = r & 0x80000000UL;
+        r <<= 1;
+        q <<= 1;
+        if (top || r >= d) {
+            r -= d;
+            q |= 1;
+        }
+    }
+    *rem = r;
+    return q;
+}
+
+/* As div_pow2_32() for 64 bits: q = floor(2**e * 2**64 / d) */
+static void div_pow2_64(int e, const unsigned_long_long_t *d,
+                        unsigned_long_long_t *q, unsigned_long_long_t *rem)
+{
+    unsigned long rh, rl, top;
+    int i;
+
+    rh = (e >= 32) ? 1UL << (e-32) : 0;
+    rl = (e >= 32) ? 0 : 1UL << e;
+    q->hi = q->lo = 0;
+    for (i = 0; i < 64; i++) {
+        top = rh & 0x80000000UL;
+        rh = (rh << 1) | (rl >> 31);
+        rl <<= 1;
+        q->hi = (q->hi << 1) | (q->lo >> 31);
+        q->lo <<= 1;
+        if (top || rh > d->hi || (rh == d->hi && rl >= d->lo)) {
+            rh -= d->hi + (rl < d->lo);
+            rl -= d->lo;
+            q->lo |= 1;
+        }
+    }
+    rem->hi = rh;
+    rem->lo = rl;
+}
+
+/*
+ * magic32 - The magic number for |d| and an N = 32 - adj bit dividend,
+ * adj 0 for unsigned and 1 for signed, with the flags in *more.
+ */
+static unsigned long magic32(unsigned long d, int adj, unsigned char *more)
+{
+    unsigned long m, rem, twice;
+    int l;
+
+    l = floor_log2_32(d);
+    if ((d & (d-1)) == 0) {
+        *more = (unsigned char)l;
+        return 0;
+    }
+    m = div_pow2_32(l-adj, d, &rem);
+    if (d-rem < (1UL << l)) {
+        *more = (unsigned char)(l-adj);
+    } else {
+        m += m;
+        twice = rem+rem;
+        if (twice >= d || twice < rem) m++;
+        *more = (unsigned char)(l | DIV_ADD_MARKER);
+    }
+    return m+1;
+}
+
+/* As magic32() for 64 bits */
+static void magic64(const unsigned_long_long_t *d, int adj,
+                    unsigned_long_long_t *m, unsigned char *more)
+{
+    unsigned_long_long_t rem, twice, e;
+    int l;
+
+    l = floor_log2_64(d);
+    if ((d->hi == 0) ? (d->lo & (d->lo-1)) == 0
+                     : (d->lo == 0 && (d->hi & (d->hi-1)) == 0)) {
+        *more = (unsigned char)l;
+        m->hi = m->lo = 0;
+        return;
+    }
+    div_pow2_64(l-adj, d, m, &rem);
+
+    /* e = d-rem, compared with 2**l */
+    e.hi = d->hi - rem.hi - (d->lo < rem.lo);
+    e.lo = d->lo - rem.lo;
+    if ((l >= 32) ? (e.hi < (1UL << (l-32))) : (e.hi == 0 && e.lo < (1UL << l))) {
+        *more = (unsigned char)(l-adj);
+    } else {
+        m->hi = (m->hi << 1) | (m->lo >> 31);
+        m->lo <<= 1;
+        twice.hi = (rem.hi << 1) | (rem.lo >> 31);
+        twice.lo = rem.lo << 1;
+        if ((rem.hi & 0x80000000UL) || twice.hi > d->hi ||
+            (twice.hi == d->hi && twice.lo >= d->lo)) {
+            if (++m->lo == 0) m->hi++;
+        }
+        *more = (unsigned char)(l | DIV_ADD_MARKER);
+    }
+    if (++m->lo == 0) m->hi++;
+}
+
+/* High 64 bits of the unsigned product a*b */
+static void mulhi64(const unsigned_long_long_t *a, const unsigned_long_long_t *b,
+                    unsigned_long_long_t *r)
+{
+    unsigned_long_long_t lo;
+
+    __ma_umul64(a, b, r, &lo);
+}
+
+/* x >> s, 0 <= s < 64, arithmetic if sign */
+static void shr64(unsigned_long_long_t *x, int s, int sign)
+{
+    unsigned long fill;
+
+    if (s == 0) return;
+    fill = (sign && (x->hi & 0x80000000UL)) ? 0xFFFFFFFFUL : 0;
+    if (s >= 32) {
+        x->lo = (s == 32) ? x->hi : (x->hi >> (s-32)) | (fill << (64-s));
+        x->hi = fill;
+    } else {
+        x->lo = (x->lo >> s) | (x->hi << (32-s));
+        x->hi = (x->hi >> s) | (fill << (32-s));
+    }
+}
+
+static void neg64(unsigned_long_long_t *x)
+{
+    x->hi = ~x->hi + (x->lo == 0);
+    x->lo = ~x->lo + 1;
+}
+
+/****** ma.lib/ma_lldiv_init ************************************************
+*
+*   NAME	
+* 	ma_lldiv_init -- Prepare fast division by an invariant integer. (V1.0)
+*
+*   SYNOPSIS
+*	int ok = ma_lldiv_init(ma_lldivider *d, long_long_t divisor);
+*	 D0		        A0              D0/D1
+*	int ma_lldiv_init(ma_lldivider *d, long_long_t divisor);
+*	int ma_ulldiv_init(ma_ulldivider *d, unsigned_long_long_t divisor);
+*	int ma_ldiv_init(ma_ldivider *d, long divisor);
+*	int ma_uldiv_init(ma_uldivider *d, unsigned long divisor);
+*
+*   FUNCTION
+*	Work out a multiplier and shift that turn division by divisor
+*	into a multiply-high, for the matching ma_lldiv_apply() family
+*	to use as often as needed. Worth it once the same divisor is
+*	used more than a few times, as in bucketing, rescaling of
+*	timestamps or fixed-point values, and radix conversion.
+*
+*   INPUTS
+*	d - Divider to set up.
+*	divisor - Any nonzero value.
+*
+*   RESULT
+*	ok - 1, or 0 if divisor is 0, with errno set to EDOM.
+*
+*   EXAMPLE
+*	ma_lldivider per_second;
+*	ma_lldiv_init(&per_second, long_to_long_long(50));
+*	for (i = 0; i < n; i++)
+*	    secs[i] = ma_lldiv_apply(&per_second, ticks[i]);
+*
+*   NOTES
+*	ma.lib extension. Setting up costs about as much as one call to
+*	long_long_div().
+*
+*   SEE ALSO
+*	ma_lldiv_apply(), long_long_div(), longlong.h
+*
+******************************************************************************/
+
+int ma_lldiv_init(ma_lldivider *d, long_long_t divisor)
+{
+    unsigned_long_long_t a;
+    int neg;
+
+    if ((divisor.hi | divisor.lo) == 0) {
+        errno = EDOM;
+        d->magic.hi = d->magic.lo = 0;
+        d->more = 0;
+        return 0;
+    }
+    a.hi = divisor.hi;
+    a.lo = divisor.lo;
+    neg = (a.hi & 0x80000000UL) != 0;
+    if (neg) neg64(&a);
+    magic64(&a, 1, &d->magic, &d->more);
+    if (neg) {
+        d->more |= DIV_NEGATIVE;
+        if (d->magic.hi | d->magic.lo) neg64(&d->magic);
+    }
+    return 1;
+}
+
+int ma_ulldiv_init(ma_ulldivider *d, unsigned_long_long_t divisor)
+{
+    if ((divisor.hi | divisor.lo) == 0) {
+        errno = EDOM;
+        d->magic.hi = d->magic.lo = 0;
+        d->more = 0;
+        return 0;
+    }
+    magic64(&divisor, 0, &d->magic, &d->more);
+    return 1;
+}
+
+int ma_ldiv_init(ma_ldivider *d, long divisor)
+{
+    unsigned long a;
+
+    if (divisor == 0) {
+        errno = EDOM;
+        d->magic = 0;
+        d->more = 0;
+        return 0;
+    }
+    a = (divisor < 0) ? 0-(unsigned long)divisor : (unsigned long)divisor;
+    d->magic = (long)magic32(a, 1, &d->more);
+    if (divisor < 0) {
+        d->more |= DIV_NEGATIVE;
+        d->magic = (long)(0-(unsigned long)d->magic);
+    }
+    return 1;
+}
+
+int ma_uldiv_init(ma_uldivider *d, unsigned long divisor)
+{
+    if (divisor == 0) {
+        errno = EDOM;
+        d->magic = 0;
+        d->more = 0;
+        return 0;
+    }
+    d->magic = magic32(divisor, 0, &d->more);
+    return 1;
+}
+
+/****** ma.lib/ma_lldiv_apply ***********************************************
+*
+*   NAME	
+* 	ma_lldiv_apply -- Divide by a prepared invariant integer. (V1.0)
+*
+*   SYNOPSIS
+*	long_long_t q = ma_lldiv_apply(const ma_lldivider *d, long_long_t x);
+*	  D0/D1		               A0                   D0/D1
+*	long_long_t ma_lldiv_apply(const ma_lldivider *d, long_long_t x);
+*	unsigned_long_long_t ma_ulldiv_apply(const ma_ulldivider *d,
+*	                                     unsigned_long_long_t x);
+*	long ma_ldiv_apply(const ma_ldivider *d, long x);
+*	unsigned long ma_uldiv_apply(const ma_uldivider *d, unsigned long x);
+*
+*   FUNCTION
+*	Return x divided by the divisor given to the matching init
+*	function, truncated toward zero as long_long_div() and the C
+*	'/' operator do. The remainder, if needed, is x - q*divisor.
+*
+*   INPUTS
+*	d - Divider set up by ma_lldiv_init() or its kin.
+*	x - Dividend.
+*
+*   RESULT
+*	q - The quotient. 0 if the divider was set up with a zero
+*	    divisor.
+*
+*   EXAMPLE
+*	ma_uldivider ten;
+*	ma_uldiv_init(&ten, 10);
+*	digit = x - ma_uldiv_apply(&ten, x)*10;
+*
+*   NOTES
+*	ma.lib extension. The 64-bit forms cost one 64 by 64-bit
+*	multiply-high, the 32-bit forms one 32 by 32-bit, instead of a
+*	bit-serial division. As long_long_div(), the most negative value
+*	divided by -1 sets errno to ERANGE and returns the most positive.
+*
+*   SEE ALSO
+*	ma_lldiv_init(), long_long_div(), longlong.h
+*
+******************************************************************************/
+
+long_long_t ma_lldiv_apply(const ma_lldivider *d, long_long_t x)
+{
+    unsigned_long_long_t q, n, m;
+    long_long_t r;
+    int shift, neg;
+
+    shift = d->more & DIV_SHIFT_MASK;
+    neg = (d->more & DIV_NEGATIVE) != 0;
+    n.hi = x.hi;
+    n.lo = x.lo;
+    if ((d->magic.hi | d->magic.lo) == 0) {
+        /* a power of 2: round negative dividends toward zero */
+        q = n;
+        if (n.hi & 0x80000000UL) {
+            /* q += 2**shift - 1 */
+            m.hi = (shift > 32) ? (1UL << (shift-32))-1 : 0;
+            m.lo = (shift >= 32) ? 0xFFFFFFFFUL : (1UL << shift)-1;
+            q.lo += m.lo;
+            q.hi += m.hi + (q.lo < m.lo);
+        }
+        shr64(&q, shift, 1);
+        if (neg) {
+            if (q.hi == 0x80000000UL && q.lo == 0) {
+                errno = ERANGE;			/* LONG_LONG_MIN / -1 */
+                return handle_overflow(0);
+            }
+            neg64(&q);
+        }
+    } else {
+        /* signed multiply-high from the unsigned one */
+        mulhi64(&d->magic, &n, &q);
+        if (d->magic.hi & 0x80000000UL) {
+            q.hi -= n.hi + (q.lo < n.lo);
+            q.lo -= n.lo;
+        }
+        if (n.hi & 0x80000000UL) {
+            q.hi -= d->magic.hi + (q.lo < d->magic.lo);
+            q.lo -= d->magic.lo;
+        }
+        if (d->more & DIV_ADD_MARKER) {
+            /* q += n, or -n for a negative divisor */
+            m = n;
+            if (neg) neg64(&m);
+            q.lo += m.lo;
+            q.hi += m.hi + (q.lo < m.lo);
+        }
+        shr64(&q, shift, 1);
+        if (q.hi & 0x80000000UL) {
+            if (++q.lo == 0) q.hi++;
+        }
+    }
+    r.hi = q.hi;
+    r.lo = q.lo;
+    return r;
+}
+
+unsigned_long_long_t ma_ulldiv_apply(const ma_ulldivider *d,
+                                     unsigned_long_long_t x)
+{
+    unsigned_long_long_t q, t;
+    int shift;
+
+    shift = d->more & DIV_SHIFT_MASK;
+    if ((d->magic.hi | d->magic.lo) == 0) {
+        q = x;
+        shr64(&q, shift, 0);
+        return q;
+    }
+    mulhi64(&d->magic, &x, &q);
+    if (d->more & DIV_ADD_MARKER) {
+        /* ((x-q) >> 1) + q, which cannot overflow */
+        t.hi = x.hi - q.hi - (x.lo < q.lo);
+        t.lo = x.lo - q.lo;
+        t.lo = (t.lo >> 1) | (t.hi << 31);
+        t.hi >>= 1;
+        q.lo += t.lo;
+        q.hi += t.hi + (q.lo < t.lo);
+    }
+    shr64(&q, shift, 0);
+    return q;
+}
+
+long ma_ldiv_apply(const ma_ldivider *d, long x)
+{
+    unsigned long uq;
+    long q;
+    int shift;
+
+    shift = d->more & DIV_SHIFT_MASK;
+    if (d->magic == 0) {
+        uq = (unsigned long)x;
+        if (x < 0) uq += (1UL << shift)-1;
+        q = (long)uq >> shift;
+        if (d->more & DIV_NEGATIVE) {
+            if (q == (long)0x80000000UL) {
+                errno = ERANGE;			/* LONG_MIN / -1 */
+                return 0x7FFFFFFFL;
+            }
+            q = -q;
+        }
+        return q;
+    }
+    uq = mulhi32((unsigned long)d->magic, (unsigned long)x);
+    if (d->magic < 0) uq -= (unsigned long)x;
+    if (x < 0) uq -= (unsigned long)d->magic;
+    if (d->more & DIV_ADD_MARKER)
+        uq += (d->more & DIV_NEGATIVE) ? 0-(unsigned long)x : (unsigned long)x;
+    q = (long)uq >> shift;
+    if (q < 0) q++;
+    return q;
+}
+
+unsigned long ma_uldiv_apply(const ma_uldivider *d, unsigned long x)
+{
+    unsigned long q;
+
+    if (d->magic == 0) return x >> d->more;
+    q = mulhi32(d->magic, x);
+    if (d->more & DIV_ADD_MARKER)
+        return (((x-q) >> 1)+q) >> (d->more & DIV_SHIFT_MASK);
+    return q >> d->more;
+}
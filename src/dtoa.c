@@ -0,0 +1,640 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * int ma_dtoa(double x, char *buf)
+ * int ma_dtoa_digits(double x, char *digits, int *exp10)
+ * int ma_dtoa_hex(double x, char *buf)
+ * Shortest decimal and exact hexadecimal forms of a double
+ *
+ * Method :
+ *	The shortest digits that read back to x are found by Grisu3
+ *	(Loitsch, "Printing Floating-Point Numbers Quickly and Accurately
+ *	with Integers", 2010). x and the bounds of the interval that rounds
+ *	to it are scaled by a cached power of ten, the top 64 bits of the
+ *	table that ma_strtod() uses, so that the integral part fits a long;
+ *	digits are then cut off as soon as they lie inside the interval,
+ *	shrunk by the error of the scaling. Grisu3 knows when that error
+ *	leaves it unsure, for about one double in two hundred, and then
+ *	the digits are found exactly with big integers instead (Steele and
+ *	White's free-format algorithm, as refined by Burger and Dybvig).
+ *	Either way the digits are the shortest, and of those the nearest
+ *	to x.
+ */
+
+#include <math.h>
+#include <amiga/conv.h>
+#include "include/internal/m99_math.h"
+#include "include/internal/conv.h"
+
+/* The range of the scaled exponent that keeps the integral part in 32 bits */
+#define MIN_TARGET_EXP  (-60)
+#define MAX_TARGET_EXP  (-32)
+
+static const unsigned long pow10[10] = {
+    1UL, 10UL, 100UL, 1000UL, 10000UL, 100000UL, 1000000UL, 10000000UL,
+    100000000UL, 1000000000UL
+};
+
+/* A 64-bit significand f and binary exponent e: f*2**e */
+typedef struct {
+    unsigned_long_long_t f;
+    int e;
+} diyfp;
+
+static void add64(unsigned_long_long_t *r, const unsigned_long_long_t *a,
+                  const unsigned_long_long_t *b)
+{
+    unsigned long lo;
+
+    lo = a->lo+b->lo;
+    r->hi = a->hi+b->hi+(lo < b->lo);
+    r->lo = lo;
+}
+
+static void sub64(unsigned_long_long_t *r, const unsigned_long_long_t *a,
+                  const unsigned_long_long_t *b)
+{
+    unsigned long lo;
+
+    lo = a->lo-b->lo;
+    r->hi = a->hi-b->hi-(a->lo < b->lo);
+    r->lo = lo;
+}
+
+static int lt64(const unsigned_long_long_t *a, const unsigned_long_long_t *b)
+{
+    return a->hi < b->hi || (a->hi == b->hi && a->lo < b->lo);
+}
+
+/* m*10, which must not overflow */
+static void mul10(unsigned_long_long_t *m)
+{
+    unsigned long hi, lo;
+
+    hi = (m->hi << 3)+(m->hi << 1)+(m->lo >> 29)+(m->lo >> 31);
+    lo = (m->lo << 3)+(m->lo << 1);
+    hi += (lo < (m->lo << 3));
+    m->hi = hi;
+    m->lo = lo;
+}
+
+/* Shift the significand left until its top bit is set */
+static void normalize(diyfp *x)
+{
+    if (x->f.hi == 0) {
+        x->f.hi = x->f.lo;
+        x->f.lo = 0;
+        x->e -= 32;
+    }
+    while ((x->f.hi & 0x80000000UL) == 0) {
+        x->f.hi = (x->f.hi << 1) | (x->f.lo >> 31);
+        x->f.lo <<= 1;
+        x->e--;
+    }
+}
+
+/* a*b, the top 64 bits of the product rounded */
+static void times(diyfp *r, const diyfp *a, const diyfp *b)
+{
+    unsigned_long_long_t hi, lo;
+
+    __ma_umul64(&a->f, &b->f, &hi, &lo);
+    if (lo.hi & 0x80000000UL) {
+        if (++hi.lo == 0) hi.hi++;
+    }
+    r->f = hi;
+    r->e = a->e+b->e+64;
+}
+
+/*
+ * round_weed - Move the last digit down while that brings the digits
+ * closer to x, and say whether they are then certain to be right.
+ * All distances are scaled as rest is, in units of the last digit.
+ */
+static int round_weed(char *buf, int len,
+                      const unsigned_long_long_t *dist_high_w,
+                      const unsigned_long_long_t *unsafe,
+                      unsigned_long_long_t rest,
+                      const unsigned_long_long_t *ten_kappa,
+                      const unsigned_long_long_t *unit)
+{
+    unsigned_long_long_t small, big, t, u, v;
+
+    sub64(&small, dist_high_w, unit);
+    add64(&big, dist_high_w, unit);
+
+    /* step the last digit down while it stays inside and gets closer */
+    for (;;) {
+        if (!lt64(&rest, &small)) break;
+        sub64(&t, unsafe, &rest);
+        if (lt64(&t, ten_kappa)) break;
+        add64(&t, &rest, ten_kappa);
+        if (!lt64(&t, &small)) {
+            sub64(&u, &small, &rest);
+            sub64(&v, &t, &small);
+            if (lt64(&u, &v)) break;
+        }
+        buf[len-1]--;
+        rest = t;
+    }
+
+    /* unsure if the next digit down might also be nearer */
+    if (lt64(&rest, &big)) {
+        sub64(&t, unsafe, &rest);
+        if (!lt64(&t, ten_kappa)) {
+            add64(&t, &rest, ten_kappa);
+            if (lt64(&t, &big)) return 0;
+            sub64(&u, &big, &rest);
+            sub64(&v, &t, &big);
+            if (lt64(&v, &u)) return 0;
+        }
+    }
+
+    /* the digits are right unless the error could put them outside */
+    t = *unit;
+    add64(&t, &t, &t);
+    if (lt64(&rest, &t)) return 0;
+    add64(&t, &t, &t);
+    sub64(&u, unsafe, &t);
+    return !lt64(&u, &rest) && !lt64(unsafe, &t);
+}
+
+/*
+ * grisu3 - The shortest digits of the finite double x > 0 in buf, with
+ * x about buf*10**(*dexp). Returns the number of digits, or 0 if the
+ * digits cannot be trusted.
+ */
+static int grisu3(double x, char *buf, int *dexp)
+{
+    diyfp v, w, mp, mm, c, sw, smp, smm;
+    unsigned_long_long_t too_low, too_high, unsafe, rest, frac, ten_kappa;
+    unsigned_long_long_t unit, dist;
+    unsigned long integrals, divisor, mask;
+    int hx, be, q, s, kappa, len, lz;
+
+    /* x = v.f*2**v.e exactly */
+    hx = __HI(x);
+    be = (hx >> 20) & 0x7ff;
+    v.f.hi = hx & 0x000fffff;
+    v.f.lo = (unsigned long)__LO(x);
+    if (be) {
+        v.f.hi |= 0x00100000UL;
+        v.e = be-1075;
+    } else {
+        v.e = -1074;
+    }
+
+    /* the bounds halfway to the neighbours, the lower closer at 2**k */
+    unit.hi = 0;
+    unit.lo = 1;
+    add64(&mp.f, &v.f, &v.f);
+    add64(&mp.f, &mp.f, &unit);
+    mp.e = v.e-1;
+    normalize(&mp);
+    add64(&mm.f, &v.f, &v.f);
+    mm.e = v.e-1;
+    if (v.f.hi == 0x00100000UL && v.f.lo == 0 && be > 1) {
+        add64(&mm.f, &mm.f, &mm.f);
+        mm.e--;
+    }
+    sub64(&mm.f, &mm.f, &unit);
+    lz = mm.e-mp.e;
+    if (lz >= 32) {
+        mm.f.hi = mm.f.lo << (lz-32);
+        mm.f.lo = 0;
+    } else if (lz > 0) {
+        mm.f.hi = (mm.f.hi << lz) | (mm.f.lo >> (32-lz));
+        mm.f.lo <<= lz;
+    }
+    mm.e = mp.e;
+    w = v;
+    normalize(&w);
+
+    /* a power of ten that brings the exponent into the target range */
+    q = (int)(((long)(MIN_TARGET_EXP-w.e-1) * 78913L) >> 18);
+    while (__ma_pow10_exp(q)-63 < MIN_TARGET_EXP-(w.e+64)) q++;
+    {
+        const unsigned long *p = __ma_pow10_tab[q-MA_POW10_MIN];
+
+        c.f.hi = p[0];
+        c.f.lo = p[1];
+        if ((p[2] & 0x80000000UL) && ++c.f.lo == 0) c.f.hi++;
+        c.e = (int)__ma_pow10_exp(q)-63;
+    }
+    times(&sw, &w, &c);
+    times(&smp, &mp, &c);
+    times(&smm, &mm, &c);
+
+    /*
+     * The scaled values may be off by one unit each; widen the bounds
+     * by that so the interval surely holds every candidate, and note
+     * how far it can be trusted.
+     */
+    sub64(&too_low, &smm.f, &unit);
+    add64(&too_high, &smp.f, &unit);
+    sub64(&unsafe, &too_high, &too_low);
+    s = -sw.e;					/* 32 to 60 */
+    integrals = too_high.hi >> (s-32);
+    mask = (s > 32) ? (1UL << (s-32))-1 : 0;
+    frac.hi = too_high.hi & mask;
+    frac.lo = too_high.lo;
+    sub64(&dist, &too_high, &sw.f);
+
+    /* the integral digits */
+    kappa = 10;
+    while (kappa > 1 && integrals < pow10[kappa-1]) kappa--;
+    divisor = pow10[kappa-1];
+    len = 0;
+    while (kappa > 0) {
+        buf[len++] = (char)('0'+integrals/divisor);
+        integrals %= divisor;
+        kappa--;
+        rest.hi = (integrals << (s-32)) | frac.hi;
+        rest.lo = frac.lo;
+        if (lt64(&rest, &unsafe)) {
+            ten_kappa.hi = divisor << (s-32);
+            ten_kappa.lo = 0;
+            *dexp = kappa-q;
+            return round_weed(buf, len, &dist, &unsafe, rest, &ten_kappa,
+                              &unit) ? len : 0;
+        }
+        divisor /= 10;
+    }
+
+    /* the fractional digits */
+    for (;;) {
+        mul10(&frac);
+        mul10(&unit);
+        mul10(&unsafe);
+        buf[len++] = (char)('0'+(frac.hi >> (s-32)));
+        frac.hi &= mask;
+        kappa--;
+        if (lt64(&frac, &unsafe)) break;
+    }
+    ten_kappa.hi = 1UL << (s-32);
+    ten_kappa.lo = 0;
+    {
+        unsigned_long_long_t hi, lo;
+
+        __ma_umul64(&dist, &unit, &hi, &lo);
+        dist = lo;
+    }
+    *dexp = kappa-q;
+    return round_weed(buf, len, &dist, &unsafe, frac, &ten_kappa, &unit)
+        ? len : 0;
+}
+
+/*
+ * exact - The shortest digits of the finite double x > 0, nearest x,
+ * found with big integers: x = r/s*10**k and the bounds of its rounding
+ * interval r+-m, digits taken from r/s until the rest is within m.
+ */
+static int exact(double x, char *buf, int *dexp)
+{
+    ma_big_t r, s, m, t;
+    unsigned long fh, fl;
+    int hx, be, e, k, len, d, even, asym, lowok, highok, c;
+
+    hx = __HI(x);
+    be = (hx >> 20) & 0x7ff;
+    fh = hx & 0x000fffff;
+    fl = (unsigned long)__LO(x);
+    if (be) {
+        fh |= 0x00100000UL;
+        e = be-1075;
+    } else {
+        e = -1074;
+    }
+    even = (fl & 1) == 0;
+    asym = (fh == 0x00100000UL && fl == 0 && be > 1);
+
+    /* r/s = x and m = half the gap above, the gap below is m or m/2 */
+    __ma_big_set(&r, fh, fl);
+    __ma_big_shl(&r, asym ? 2 : 1);
+    __ma_big_set(&s, 0, asym ? 4 : 2);
+    __ma_big_set(&m, 0, 1);
+    if (e >= 0) {
+        __ma_big_shl(&r, e);
+        __ma_big_shl(&m, e);
+    } else {
+        __ma_big_shl(&s, -e);
+    }
+
+    /*
+     * floor(log10(x)) or less, from the exponent of the top bit, then
+     * raised until the upper bound is below 10**k
+     */
+    k = e+52;
+    if (fh == 0) {
+        k = e+31;
+        for (c = 31; !(fl & (1UL << c)); c--) k--;
+    } else {
+        for (c = 20; !(fh & (1UL << c)); c--) k--;
+    }
+    k = (int)(((long)k * 78913L) >> 18)-1;
+    if (k >= 0) {
+        __ma_big_mulpow5(&s, k);
+        __ma_big_shl(&s, k);
+    } else {
+        __ma_big_mulpow5(&r, -k);
+        __ma_big_shl(&r, -k);
+        __ma_big_mulpow5(&m, -k);
+        __ma_big_shl(&m, -k);
+    }
+    for (;;) {
+        t = m;
+        if (asym) __ma_big_shl(&t, 1);
+        __ma_big_add(&t, &r);
+        c = __ma_big_cmp(&t, &s);
+        if (c < 0 || (c == 0 && !even)) break;
+        __ma_big_muladd(&s, 10, 0);
+        k++;
+    }
+
+    len = 0;
+    for (;;) {
+        __ma_big_muladd(&r, 10, 0);
+        __ma_big_muladd(&m, 10, 0);
+        d = 0;
+        while (__ma_big_cmp(&r, &s) >= 0) {
+            __ma_big_sub(&r, &s);
+            d++;
+        }
+        c = __ma_big_cmp(&r, &m);
+        lowok = (c < 0 || (c == 0 && even));
+        t = m;
+        if (asym) __ma_big_shl(&t, 1);
+        __ma_big_add(&t, &r);
+        c = __ma_big_cmp(&t, &s);
+        highok = (c > 0 || (c == 0 && even));
+        if (lowok || highok) {
+            if (lowok && highok) {
+                t = r;
+                __ma_big_shl(&t, 1);
+                c = __ma_big_cmp(&t, &s);
+                if (c > 0 || (c == 0 && (d & 1))) lowok = 0;
+            }
+            buf[len++] = (char)('0'+d+!lowok);
+            break;
+        }
+        buf[len++] = (char)('0'+d);
+    }
+    *dexp = k-len;
+    return len;
+}
+
+/* The shortest digits of finite x > 0, with their exponent */
+static int shortest(double x, char *buf, int *dexp)
+{
+    int len;
+
+    len = grisu3(x, buf, dexp);
+    if (len == 0) len = exact(x, buf, dexp);
+    buf[len] = '\0';
+    return len;
+}
+
+/****** ma.lib/ma_dtoa_digits ***********************************************
+*
+*   NAME	
+* 	ma_dtoa_digits -- Return shortest decimal digits of a double. (V1.0)
+*
+*   SYNOPSIS
+*	int len = ma_dtoa_digits(double x, char *digits, int *exp10);
+*	 D0			 D0	   A0		 A1
+*	int ma_dtoa_digits(double x, char *digits, int *exp10);
+*
+*   FUNCTION
+*	Find the fewest decimal digits D such that D*10**exp10 reads back
+*	as |x|, and of those the nearest to |x|. The digits are stored
+*	as a string, without a sign, point or trailing zeros, for callers
+*	that lay the number out themselves.
+*
+*   INPUTS
+*	x      - Value to convert.
+*	digits - Buffer of at least 18 chars for the digits and a NUL.
+*	exp10  - Set to the power of ten of the last digit.
+*
+*   RESULT
+*	len - The number of digits, at most 17. Zero gives "0" and an
+*	      exponent of 0; Infinity and NaN give 0 and an empty string.
+*
+*   EXAMPLE
+*	char d[18];
+*	int e;
+*	int n = ma_dtoa_digits(0.3, d, &e);
+*	n is 1, d is "3" and e is -1.
+*
+*   NOTES
+*	ma.lib extension. Only integer arithmetic is used.
+*
+*   SEE ALSO
+*	ma_dtoa(), ma_strtod(), amiga/conv.h
+*
+******************************************************************************/
+
+int ma_dtoa_digits(double x, char *digits, int *exp10)
+{
+    int hx;
+
+    *exp10 = 0;
+    hx = __HI(x)&0x7fffffff;
+    if (hx >= 0x7ff00000) {
+        digits[0] = '\0';
+        return 0;
+    }
+    if ((hx|__LO(x)) == 0) {
+        digits[0] = '0';
+        digits[1] = '\0';
+        return 1;
+    }
+    __HI(x) = hx;
+    return shortest(x, digits, exp10);
+}
+
+/****** ma.lib/ma_dtoa ******************************************************
+*
+*   NAME	
+* 	ma_dtoa -- Convert a double to its shortest decimal string. (V1.0)
+*
+*   SYNOPSIS
+*	int len = ma_dtoa(double x, char *buf);
+*	 D0		  D0	    A0
+*	int ma_dtoa(double x, char *buf);
+*
+*   FUNCTION
+*	Write the shortest decimal string that ma_strtod(), or any
+*	correctly rounding strtod(), reads back as exactly x. Numbers
+*	from 1e-4 up to 1e17 are written in plain notation, as "0.001"
+*	or "12345", and others with an exponent of at least two digits,
+*	as "1e+100" or "-2.5e-07". Infinity and NaN are written as
+*	"inf", "-inf" and "nan".
+*
+*   INPUTS
+*	x   - Value to convert.
+*	buf - Buffer of at least MA_DTOA_BUFSIZE chars.
+*
+*   RESULT
+*	len - Length of the string, not counting the NUL.
+*
+*   EXAMPLE
+*	char buf[MA_DTOA_BUFSIZE];
+*	ma_dtoa(0.1+0.2, buf);
+*	buf is "0.30000000000000004".
+*
+*   NOTES
+*	ma.lib extension. Unlike printf("%.17g"), the digits are never
+*	more than needed, so 0.1 prints as "0.1". Only integer
+*	arithmetic is used, so the output does not depend on the FPU.
+*
+*   SEE ALSO
+*	ma_dtoa_digits(), ma_dtoa_hex(), ma_strtod(), amiga/conv.h
+*
+******************************************************************************/
+
+int ma_dtoa(double x, char *buf)
+{
+    char d[18];
+    char *p;
+    int hx, n, dexp, xp, i;
+
+    p = buf;
+    hx = __HI(x);
+    if (hx < 0 && ((hx&0x7fffffff) < 0x7ff00000 ||
+                   ((hx&0x000fffff)|__LO(x)) == 0))
+        *p++ = '-';				/* not for NaN */
+    hx &= 0x7fffffff;
+    if (hx >= 0x7ff00000) {
+        if (((hx&0x000fffff)|__LO(x)) == 0) {
+            p[0] = 'i'; p[1] = 'n'; p[2] = 'f';
+        } else {
+            p[0] = 'n'; p[1] = 'a'; p[2] = 'n';
+        }
+        p[3] = '\0';
+        return (int)(p+3-buf);
+    }
+
+    n = ma_dtoa_digits(x, d, &dexp);
+    xp = n+dexp-1;				/* x = d.ddd*10**xp */
+    if (xp >= -4 && xp < 17) {
+        if (xp < 0) {
+            *p++ = '0';
+            *p++ = '.';
+            for (i = xp+1; i < 0; i++) *p++ = '0';
+            for (i = 0; i < n; i++) *p++ = d[i];
+        } else {
+            for (i = 0; i < n && i <= xp; i++) *p++ = d[i];
+            for (; i <= xp; i++) *p++ = '0';
+            if (n > xp+1) {
+                *p++ = '.';
+                for (; i < n; i++) *p++ = d[i];
+            }
+        }
+    } else {
+        *p++ = d[0];
+        if (n > 1) {
+            *p++ = '.';
+            for (i = 1; i < n; i++) *p++ = d[i];
+        }
+        *p++ = 'e';
+        if (xp < 0) {
+            *p++ = '-';
+            xp = -xp;
+        } else {
+            *p++ = '+';
+        }
+        if (xp >= 100) *p++ = (char)('0'+xp/100);
+        *p++ = (char)('0'+xp/10%10);
+        *p++ = (char)('0'+xp%10);
+    }
+    *p = '\0';
+    return (int)(p-buf);
+}
+
+/****** ma.lib/ma_dtoa_hex **************************************************
+*
+*   NAME	
+* 	ma_dtoa_hex -- Convert a double to an exact hexadecimal string. (V1.0)
+*
+*   SYNOPSIS
+*	int len = ma_dtoa_hex(double x, char *buf);
+*	 D0		      D0	A0
+*	int ma_dtoa_hex(double x, char *buf);
+*
+*   FUNCTION
+*	Write x exactly in the C99 hexadecimal form of printf("%a"),
+*	without trailing zeros: "0x1.8p+1" for 3, "0x0.0000000000001p-1022"
+*	for the smallest subnormal and "0x0p+0" for zero. Infinity and
+*	NaN are written as "inf", "-inf" and "nan".
+*
+*   INPUTS
+*	x   - Value to convert.
+*	buf - Buffer of at least MA_DTOA_BUFSIZE chars.
+*
+*   RESULT
+*	len - Length of the string, not counting the NUL.
+*
+*   EXAMPLE
+*	char buf[MA_DTOA_BUFSIZE];
+*	ma_dtoa_hex(0.1, buf);
+*	buf is "0x1.999999999999ap-4".
+*
+*   NOTES
+*	ma.lib extension. ma_strtod() reads the result back exactly.
+*
+*   SEE ALSO
+*	ma_dtoa(), ma_strtod(), amiga/conv.h
+*
+******************************************************************************/
+
+/* Fraction digit i of a double, 0 the most significant */
+#define HEXDIGIT(fh, fl, i) \
+    (int)((((i) < 5) ? (fh) >> (16-(i)*4) : (fl) >> (48-(i)*4)) & 0xf)
+
+int ma_dtoa_hex(double x, char *buf)
+{
+    static const char hex[] = "0123456789abcdef";
+    unsigned long fh, fl;
+    char *p;
+    int hx, be, e, n, i;
+
+    hx = __HI(x);
+    be = (hx >> 20) & 0x7ff;
+    if (be == 0x7ff) return ma_dtoa(x, buf);
+
+    p = buf;
+    if (hx < 0) *p++ = '-';
+    *p++ = '0';
+    *p++ = 'x';
+    fh = hx & 0x000fffff;
+    fl = (unsigned long)__LO(x);
+    if (be == 0 && (fh|fl) == 0) {
+        e = 0;
+        *p++ = '0';
+    } else {
+        e = (be) ? be-1023 : -1022;
+        *p++ = (be) ? '1' : '0';
+
+        /* the 13 fraction digits, less the trailing zeros */
+        n = 13;
+        while (n > 0 && HEXDIGIT(fh, fl, n-1) == 0) n--;
+        if (n > 0) {
+            *p++ = '.';
+            for (i = 0; i < n; i++) *p++ = hex[HEXDIGIT(fh, fl, i)];
+        }
+    }
+    *p++ = 'p';
+    if (e < 0) {
+        *p++ = '-';
+        e = -e;
+    } else {
+        *p++ = '+';
+    }
+    if (e >= 1000) *p++ = (char)('0'+e/1000);
+    if (e >= 100) *p++ = (char)('0'+e/100%10);
+    if (e >= 10) *p++ = (char)('0'+e/10%10);
+    *p++ = (char)('0'+e%10);
+    *p = '\0';
+    return (int)(p-buf);
+}
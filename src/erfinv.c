@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * double ma_erfinv(double x)
+ * double ma_erfcinv(double x)
+ * Inverse error functions
+ *
+ * Method :
+ *	erfinv(x) = ndtri((1+x)/2)/sqrt(2). The normal quantile kernel
+ *	takes q = p-1/2 and r = min(p,1-p) apart, and both are exact here:
+ *	for erfinv q = x/2 and 2r = 1-|x|, for erfcinv(y) q = (1-y)/2 and
+ *	2r = y or 2-y, the subtractions being exact wherever the kernel
+ *	uses them. So erfcinv keeps full relative accuracy for y far below
+ *	the spacing of doubles near 1. 2r is passed rather than r, which
+ *	would lose bits or underflow for subnormal y; there the tail is
+ *	entered with -log(r) = ln2-log(2r).
+ *
+ *	AS241 is good to about 7 ulps. One Newton step on erf(y) = 2q near
+ *	the centre, or on erfc(|y|) = 2r further out, brings the result
+ *	within 2 ulps for the price of one erf or erfc and one exp.
+ */
+
+#include <math.h>
+#include <errno.h>
+#include "include/internal/m99_math.h"
+
+/* AS241 normal quantile - see ndtri.c */
+extern double __kernel_ppnd(double q, double r);
+extern double __kernel_ppnd_tail(double q, double s);
+
+static const double
+one   =  1.0,
+two   =  2.0,
+half  =  0.5,
+ln2   =  6.93147180559945286227e-01, /* 0x3FE62E42, 0xFEFA39EF */
+twom1021 = 4.45014771701440276618e-308, /* 0x00200000, 0x00000000 */
+sqrth =  7.07106781186547572737e-01, /* 0x3FE6A09E, 0x667F3BCD */
+tsqpi =  1.12837916709551255856e+00, /* 0x3FF20DD7, 0x50429B6D 2/sqrt(pi) */
+rtiny =  1.0e-305,		/* no Newton step below: erfc would underflow */
+spim1 = -1.13773074547241989651e-01; /* 0xBFBD203B, 0x725884AB sqrt(pi)/2-1 */
+
+/*
+ * __kernel_erfinv - The y with erf(y) = 2q and erfc(|y|) = t, given
+ * q = p-1/2 and t = 2*min(p,1-p) > 0 for some p in (0,1). The Newton
+ * step takes its residual from q when |q| < 1/4 and from t otherwise,
+ * so q must be exact in the first case and t in the second.
+ */
+double __kernel_erfinv(double q, double t)
+{
+    double y, a, r;
+
+    if (t < twom1021)			/* t/2 would not be exact */
+        return sqrth*__kernel_ppnd_tail(q, ln2-log(t));
+    r = half*t;
+    y = sqrth*__kernel_ppnd(q, r);
+    if (fabs(q) < 0.25) {
+        return y-(erf(y)-(q+q))/(tsqpi*exp(-y*y));
+    }
+    if (r < rtiny) return y;
+    a = fabs(y);
+    a += (erfc(a)-t)/(tsqpi*exp(-a*a));
+    return (q < 0.0) ? -a : a;
+}
+
+/****** ma.lib/ma_erfinv *****************************************************
+*
+*   NAME	
+* 	ma_erfinv -- Inverse error functions. (V1.0)
+*
+*   SYNOPSIS
+*	double result = ma_erfinv(double x);
+*	  D0		        D0
+*	double ma_erfinv(double x);
+*	double ma_erfcinv(double x);
+*	void ma_erfinv_v(double *dst, const double *src, unsigned long n);
+*	void ma_erfcinv_v(double *dst, const double *src, unsigned long n);
+*
+*   FUNCTION
+*	ma_erfinv() returns the y for which erf(y) is x, and ma_erfcinv()
+*	the y for which erfc(y) is x, from the rational approximation
+*	behind ma_ndtri() rather than by iterating on erf(). The array
+*	forms do the same for n values from src, storing the results in
+*	dst, which may be the same array.
+*
+*   INPUTS
+*	x - Input value, in [-1,1] for ma_erfinv() and [0,2] for
+*	    ma_erfcinv().
+*
+*   RESULT
+*	result - The inverse error function of x. +-Infinity at the ends
+*	        of the domain and NaN outside it.
+*
+*   EXAMPLE
+*	double y = ma_erfcinv(1e-300);
+*
+*   NOTES
+*	ma.lib extension. Accurate to within 2 ulps, down to arguments of
+*	1e-305 for ma_erfcinv(); use it for tail probabilities, which it
+*	takes without the rounding that 1-x would add. Sets errno to EDOM
+*	outside the domain and ERANGE at its ends.
+*
+*   SEE ALSO
+*	erf(), erfc(), ma_ndtri(), ma_normcdf(), math.h
+*
+******************************************************************************/
+
+double ma_erfinv(double x)
+{
+    double ax;
+
+    ax = fabs(x);
+    if (!(ax < one)) {
+        if (ax == one) {
+            __ma_seterr(ERANGE);
+            return x/__ma_zero;
+        }
+        if (x == x) __ma_seterr(EDOM);
+        return (x-x)/(x-x);
+    }
+    if ((__HI(x)&0x7fffffff) < 0x3e300000) {	/* |x| < 2**-28 */
+        if (x == 0.0) return x;			/* keep the sign of 0 */
+        return x+spim1*x;
+    }
+    return __kernel_erfinv(half*x, one-ax);
+}
+
+double ma_erfcinv(double x)
+{
+    if (!(x > 0.0 && x < two)) {
+        if (x == 0.0 || x == two) {
+            __ma_seterr(ERANGE);
+            return (x == 0.0) ? one/__ma_zero : -one/__ma_zero;
+        }
+        if (x == x) __ma_seterr(EDOM);
+        return (x-x)/(x-x);
+    }
+    return __kernel_erfinv(half*(one-x), (x < one) ? x : two-x);
+}
+
+void ma_erfinv_v(double *dst, const double *src, unsigned long n)
+{
+    while (n--) {
+        *dst++ = ma_erfinv(*src++);
+    }
+}
+
+void ma_erfcinv_v(double *dst, const double *src, unsigned long n)
+{
+    while (n--) {
+        *dst++ = ma_erfcinv(*src++);
+    }
+}
@@ -17,11 +17,6 @@
 #include <math.h>
 #include "include/internal/m99_math.h"
 
-/* Helper macros for accessing high/low parts of double */
-/* SAS/C uses big-endian, so high word is first */
-#define __HI(x) *(int*)&x
-#define __LO(x) *(1+(int*)&x)
-
 static const double
 one	= 1.0,
 halF[2]	= {0.5,-0.5,},
@@ -131,4 +126,3 @@ double exp(double x)
     return __ieee754_exp(x);
 }
 
-
@@ -96,7 +96,7 @@ double expm1(double x)
     
     /* For larger x, use standard formula but check for overflow */
     if (x > 700.0) {
-        errno = ERANGE;
+        __ma_seterr(ERANGE);
         return INFINITY;
     }
     
@@ -108,7 +108,7 @@ double expm1(double x)
     
     /* Check for overflow */
     if (result == INFINITY) {
-        errno = ERANGE;
+        __ma_seterr(ERANGE);
     }
     
     return result;
@@ -15,10 +15,9 @@
 
 #include <math.h>
 #include "include/internal/m99_math.h"
+#include "include/internal/fpu.h"
 
-/* Helper macros for accessing high/low parts of double */
-/* SAS/C uses big-endian, so high word is first */
-#define __HI(x) *(int*)&x
+#undef fabs
 
 /****** ma.lib/fabs *********************************************************
 * 
@@ -57,6 +56,10 @@
 
 double fabs(double x)
 {
+#ifdef MA_FPU
+    return __ma_fpu_fabs(x);        /* x is already in an FP register */
+#else
     __HI(x) &= 0x7fffffff;
     return x;
+#endif
 }
@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * ffp - Motorola FFP <-> IEEE 754 conversions
+ *
+ * FFP has a 24-bit mantissa like IEEE single precision, so conversions
+ * between the two are exact bit moves; only the exponent range
+ * differs. Doubles are rounded to nearest even on the way in.
+ */
+
+#include <amiga/ffp.h>
+#include "include/internal/m99_math.h"
+
+#define __SP(x) *(int*)&x		/* word of a float */
+
+/* FFP exponent 0 is IEEE single exponent 62, IEEE double exponent 958 */
+#define SP_BIAS 62
+#define DP_BIAS 958
+
+/* IEEE single word -> FFP: 0 below 2**-65, saturated above 2**63 */
+#define SP_TO_FFP(w, f) do { \
+    unsigned long e_ = ((w) >> 23) & 0xff; \
+    if (e_ < SP_BIAS) { \
+        (f) = 0; \
+    } else if (e_ > SP_BIAS + 127) { \
+        (f) = ((w) & 0x7fffffUL) && e_ == 0xff ? 0 : \
+              MA_FFP_MAX | (((w) >> 24) & 0x80); \
+    } else { \
+        (f) = ((((w) & 0x7fffffUL) | 0x800000UL) << 8) | \
+              (((w) >> 24) & 0x80) | (e_ - SP_BIAS); \
+    } \
+} while (0)
+
+/* FFP -> IEEE single word; always exact */
+#define FFP_TO_SP(f, w) do { \
+    if (((f) & 0xffffff00UL) == 0) { \
+        (w) = 0; \
+    } else { \
+        (w) = (((f) & 0x80) << 24) | \
+              ((((f) & 0x7f) + SP_BIAS) << 23) | (((f) >> 8) & 0x7fffffUL); \
+    } \
+} while (0)
+
+static ma_ffp dp_to_ffp(double x)
+{
+    unsigned long hi, lo, m, rem, s;
+    long e;
+
+    hi = (unsigned long)__HI(x);
+    lo = (unsigned long)__LO(x);
+    s = (hi >> 24) & 0x80;
+    e = (long)((hi >> 20) & 0x7ff) - DP_BIAS;
+    if (e < -1) return 0;
+    if (e > 127) {
+        if (e == 0x7ff - DP_BIAS && ((hi & 0xfffff) | lo)) return 0;	/* NaN */
+        return MA_FFP_MAX | s;
+    }
+
+    /* keep 24 bits of the 53 and round the 29 below */
+    m = 0x800000UL | ((hi & 0xfffffUL) << 3) | (lo >> 29);
+    rem = lo & 0x1fffffffUL;
+    if (rem > 0x10000000UL || (rem == 0x10000000UL && (m & 1))) {
+        if (++m == 0x1000000UL) {
+            m = 0x800000UL;
+            e++;
+        }
+    }
+    if (e < 0) return 0;
+    if (e > 127) return MA_FFP_MAX | s;
+    return (m << 8) | s | (unsigned long)e;
+}
+
+static double ffp_to_dp(ma_ffp f)
+{
+    double x;
+
+    x = 0.0;
+    if (f & 0xffffff00UL) {
+        __HI(x) = (int)(((f & 0x80) << 24) |
+                        (((f & 0x7f) + DP_BIAS) << 20) |
+                        ((f >> 11) & 0xfffffUL));
+        __LO(x) = (int)((f >> 8) << 29);
+    }
+    return x;
+}
+
+/****** ma.lib/ma_ffp_from_float *********************************************
+*
+*   NAME	
+* 	ma_ffp_from_float -- Convert IEEE 754 values to Motorola FFP. (V1.0)
+*
+*   SYNOPSIS
+*	ma_ffp result = ma_ffp_from_float(float x);
+*	  D0                                D0
+*	ma_ffp ma_ffp_from_float(float x);
+*
+*   FUNCTION
+*	Convert an IEEE 754 single to Motorola Fast Floating Point. FFP
+*	and single precision share a 24-bit mantissa, so the conversion
+*	is exact within the FFP range of 2^-65 to 2^63.
+*	ma_ffp_from_double() converts a double, rounding the mantissa to
+*	nearest even. ma_ffp_to_float() and ma_ffp_to_double() convert
+*	back, and are always exact.
+*
+*   INPUTS
+*	x - Value to convert.
+*
+*   RESULT
+*	result - x in FFP format. Values below the FFP range give 0,
+*	        values above it and infinities give +-MA_FFP_MAX, and NaN
+*	        gives 0, since FFP has no NaN or infinity.
+*
+*   EXAMPLE
+*	ma_ffp f = ma_ffp_from_float(1.0f);
+*
+*   NOTES
+*	These need neither mathffp.library nor an FPU.
+*
+*   SEE ALSO
+*	ma_ieee_to_ffp_v(), ma_ffp_add(), amiga/ffp.h
+*
+******************************************************************************/
+
+ma_ffp ma_ffp_from_float(float x)
+{
+    unsigned long w;
+    ma_ffp f;
+
+    w = (unsigned long)__SP(x);
+    SP_TO_FFP(w, f);
+    return f;
+}
+
+ma_ffp ma_ffp_from_double(double x)
+{
+    return dp_to_ffp(x);
+}
+
+float ma_ffp_to_float(ma_ffp f)
+{
+    float x;
+    unsigned long w;
+
+    FFP_TO_SP(f, w);
+    __SP(x) = (int)w;
+    return x;
+}
+
+double ma_ffp_to_double(ma_ffp f)
+{
+    return ffp_to_dp(f);
+}
+
+/****** ma.lib/ma_ieee_to_ffp_v **********************************************
+*
+*   NAME	
+* 	ma_ieee_to_ffp_v -- Convert arrays between IEEE 754 and FFP. (V1.0)
+*
+*   SYNOPSIS
+*	ma_ieee_to_ffp_v(ma_ffp *dst, const float *src, unsigned long n);
+*	                  A0               A1                D0
+*	void ma_ieee_to_ffp_v(ma_ffp *dst, const float *src, unsigned long n);
+*
+*   FUNCTION
+*	Convert n IEEE 754 singles to FFP. ma_ffp_to_ieee_v() converts
+*	the other way; ma_ieeedp_to_ffp_v() and ma_ffp_to_ieeedp_v() do
+*	the same for arrays of doubles. Each element is converted as by
+*	ma_ffp_from_float() and friends.
+*
+*   INPUTS
+*	dst - Array of n results.
+*	src - Array of n values to convert.
+*	n   - Number of elements.
+*
+*   RESULT
+*	None.
+*
+*   EXAMPLE
+*	ma_ieee_to_ffp_v(ffp_vertices, vertices, 3 * count);
+*
+*   NOTES
+*	The single-precision conversions only move bits, so they run at
+*	close to memory speed and may work in place (dst == src).
+*
+*   SEE ALSO
+*	ma_ffp_from_float(), amiga/ffp.h
+*
+******************************************************************************/
+
+void ma_ieee_to_ffp_v(ma_ffp *dst, const float *src, unsigned long n)
+{
+    const unsigned long *s;
+    unsigned long w, f;
+
+    s = (const unsigned long *)src;
+    while (n--) {
+        w = *s++;
+        SP_TO_FFP(w, f);
+        *dst++ = f;
+    }
+}
+
+void ma_ffp_to_ieee_v(float *dst, const ma_ffp *src, unsigned long n)
+{
+    unsigned long *d;
+    unsigned long w, f;
+
+    d = (unsigned long *)dst;
+    while (n--) {
+        f = *src++;
+        FFP_TO_SP(f, w);
+        *d++ = w;
+    }
+}
+
+void ma_ieeedp_to_ffp_v(ma_ffp *dst, const double *src, unsigned long n)
+{
+    while (n--) {
+        *dst++ = dp_to_ffp(*src++);
+    }
+}
+
+void ma_ffp_to_ieeedp_v(double *dst, const ma_ffp *src, unsigned long n)
+{
+    while (n--) {
+        *dst++ = ffp_to_dp(*src++);
+    }
+}
@@ -0,0 +1,296 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * ffp_arith - Portable Motorola FFP arithmetic
+ *
+ * Integer-only add, subtract, multiply, divide and compare on FFP
+ * words. The mantissas are worked on left-aligned in 32 bits, which
+ * leaves at least seven guard bits below the 24 that are kept, and
+ * every result is rounded to nearest even. FFP has no infinities, NaNs or
+ * denormals: overflow saturates to +-MA_FFP_MAX and underflow gives 0.
+ */
+
+#include <amiga/ffp.h>
+#include "include/internal/bits.h"
+
+/* Shared fixed-point kernels - see fixed.c */
+extern void __fix_umul(unsigned long a, unsigned long b,
+                       unsigned long *hi, unsigned long *lo);
+extern unsigned long __fix_udiv(unsigned long hi, unsigned long lo,
+                                unsigned long d, unsigned long *rem);
+
+#define MANT(f) ((f) & 0xffffff00UL)
+#define SIGN(f) ((f) & 0x80UL)
+#define EXPO(f) ((long)((f) & 0x7fUL))
+
+/*
+ * pack - Round the normalised 32-bit mantissa m (bit 31 set) to 24
+ * bits, sticky being non-zero if any bits below m were lost, and
+ * build the FFP word.
+ */
+static ma_ffp pack(unsigned long m, int sticky, long e, unsigned long s)
+{
+    unsigned long g;
+
+    g = m & 0xff;
+    m &= 0xffffff00UL;
+    if (g > 0x80 || (g == 0x80 && (sticky || (m & 0x100)))) {
+        m += 0x100;
+        if (m == 0) {			/* carried out of bit 31 */
+            m = 0x80000000UL;
+            e++;
+        }
+    }
+    if (e > 127) return MA_FFP_MAX | s;
+    if (e < 0) return 0;
+    return m | s | (unsigned long)e;
+}
+
+/****** ma.lib/ma_ffp_add ****************************************************
+*
+*   NAME	
+* 	ma_ffp_add -- Add two FFP values. (V1.0)
+*
+*   SYNOPSIS
+*	ma_ffp result = ma_ffp_add(ma_ffp a, ma_ffp b);
+*	  D0                         D0        D1
+*	ma_ffp ma_ffp_add(ma_ffp a, ma_ffp b);
+*
+*   FUNCTION
+*	Add two Motorola FFP values in integer arithmetic, rounding the
+*	result to nearest even. ma_ffp_sub() subtracts b from a.
+*
+*   INPUTS
+*	a - First operand.
+*	b - Second operand.
+*
+*   RESULT
+*	result - a+b in FFP format. Overflow saturates to +-MA_FFP_MAX;
+*	        results below the FFP range give 0.
+*
+*   EXAMPLE
+*	ma_ffp two = ma_ffp_add(MA_FFP_ONE, MA_FFP_ONE);
+*
+*   NOTES
+*	Works on any host and needs no mathffp.library, so FFP code can
+*	be tested away from the Amiga.
+*
+*   SEE ALSO
+*	ma_ffp_sub(), ma_ffp_mul(), ma_ffp_div(), ma_ffp_cmp(),
+*	amiga/ffp.h
+*
+******************************************************************************/
+
+ma_ffp ma_ffp_add(ma_ffp a, ma_ffp b)
+{
+    unsigned long ma, mb, t, s;
+    long ea, eb, d;
+    int sticky;
+
+    if (MANT(b) == 0) return a;
+    if (MANT(a) == 0) return b;
+
+    /* make a the larger in magnitude */
+    ea = EXPO(a);
+    eb = EXPO(b);
+    if (eb > ea || (eb == ea && MANT(b) > MANT(a))) {
+        t = a; a = b; b = t;
+        d = ea; ea = eb; eb = d;
+    }
+    s = SIGN(a);
+
+    /* one bit of headroom for the carry; the rest are guard bits */
+    ma = MANT(a) >> 1;
+    mb = MANT(b) >> 1;
+    d = ea - eb;
+    sticky = 0;
+    if (d > 31) {
+        sticky = 1;
+        mb = 0;
+    } else if (d > 0) {
+        sticky = (mb & ((1UL << d) - 1)) != 0;
+        mb >>= d;
+    }
+
+    if (SIGN(a) == SIGN(b)) {
+        ma += mb;
+        if (ma & 0x80000000UL) {
+            sticky |= (int)(ma & 1);
+            ma >>= 1;
+            ea++;
+        }
+    } else {
+        /* a lost sticky bit of b makes the difference a shade smaller */
+        ma = ma - mb - (unsigned long)sticky;
+        if (ma == 0) return 0;
+        d = __ma_clz32(ma) - 1;
+        ma <<= d;
+        ea -= d;
+    }
+    return pack(ma << 1, sticky, ea, s);
+}
+
+ma_ffp ma_ffp_sub(ma_ffp a, ma_ffp b)
+{
+    return ma_ffp_add(a, ma_ffp_neg(b));
+}
+
+ma_ffp ma_ffp_neg(ma_ffp a)
+{
+    return MANT(a) ? a ^ 0x80UL : 0;
+}
+
+/****** ma.lib/ma_ffp_mul ****************************************************
+*
+*   NAME	
+* 	ma_ffp_mul -- Multiply two FFP values. (V1.0)
+*
+*   SYNOPSIS
+*	ma_ffp result = ma_ffp_mul(ma_ffp a, ma_ffp b);
+*	  D0                         D0        D1
+*	ma_ffp ma_ffp_mul(ma_ffp a, ma_ffp b);
+*
+*   FUNCTION
+*	Multiply two Motorola FFP values. The 48-bit mantissa product is
+*	formed exactly from 16x16 bit multiplies and rounded to nearest
+*	even.
+*
+*   INPUTS
+*	a - First factor.
+*	b - Second factor.
+*
+*   RESULT
+*	result - a*b in FFP format. Overflow saturates to +-MA_FFP_MAX;
+*	        results below the FFP range give 0.
+*
+*   EXAMPLE
+*	ma_ffp sq = ma_ffp_mul(f, f);
+*
+*   NOTES
+*	Correctly rounded.
+*
+*   SEE ALSO
+*	ma_ffp_div(), ma_ffp_add(), amiga/ffp.h
+*
+******************************************************************************/
+
+ma_ffp ma_ffp_mul(ma_ffp a, ma_ffp b)
+{
+    unsigned long hi, lo, s;
+    long e;
+
+    s = SIGN(a) ^ SIGN(b);
+    if (MANT(a) == 0 || MANT(b) == 0) return 0;
+
+    e = EXPO(a) + EXPO(b) - 64;
+    __fix_umul(MANT(a), MANT(b), &hi, &lo);
+    if (!(hi & 0x80000000UL)) {
+        hi = (hi << 1) | (lo >> 31);
+        lo <<= 1;
+        e--;
+    }
+    return pack(hi, lo != 0, e, s);
+}
+
+/****** ma.lib/ma_ffp_div ****************************************************
+*
+*   NAME	
+* 	ma_ffp_div -- Divide two FFP values. (V1.0)
+*
+*   SYNOPSIS
+*	ma_ffp result = ma_ffp_div(ma_ffp a, ma_ffp b);
+*	  D0                         D0        D1
+*	ma_ffp ma_ffp_div(ma_ffp a, ma_ffp b);
+*
+*   FUNCTION
+*	Divide two Motorola FFP values with a shift-and-subtract
+*	division of the mantissas, rounding to nearest even.
+*
+*   INPUTS
+*	a - Dividend.
+*	b - Divisor.
+*
+*   RESULT
+*	result - a/b in FFP format. Division by zero saturates to
+*	        +-MA_FFP_MAX by the sign of a (0/0 gives 0), as does
+*	        overflow; results below the FFP range give 0.
+*
+*   EXAMPLE
+*	ma_ffp third = ma_ffp_div(MA_FFP_ONE, three);
+*
+*   NOTES
+*	Correctly rounded.
+*
+*   SEE ALSO
+*	ma_ffp_mul(), amiga/ffp.h
+*
+******************************************************************************/
+
+ma_ffp ma_ffp_div(ma_ffp a, ma_ffp b)
+{
+    unsigned long ma, mb, hi, lo, q, rem, s;
+    long e;
+
+    s = SIGN(a) ^ SIGN(b);
+    ma = MANT(a);
+    mb = MANT(b);
+    if (ma == 0) return 0;
+    if (mb == 0) return MA_FFP_MAX | SIGN(a);
+
+    /* quotient of the mantissas in [2**31, 2**32) */
+    e = EXPO(a) - EXPO(b) + 64;
+    if (ma >= mb) {
+        hi = ma >> 1;
+        lo = ma << 31;
+        e++;
+    } else {
+        hi = ma;
+        lo = 0;
+    }
+    q = __fix_udiv(hi, lo, mb, &rem);
+    return pack(q, rem != 0, e, s);
+}
+
+/****** ma.lib/ma_ffp_cmp ****************************************************
+*
+*   NAME	
+* 	ma_ffp_cmp -- Compare two FFP values. (V1.0)
+*
+*   SYNOPSIS
+*	int result = ma_ffp_cmp(ma_ffp a, ma_ffp b);
+*	 D0                      D0        D1
+*	int ma_ffp_cmp(ma_ffp a, ma_ffp b);
+*
+*   FUNCTION
+*	Compare two Motorola FFP values numerically.
+*
+*   INPUTS
+*	a - First value.
+*	b - Second value.
+*
+*   RESULT
+*	result - -1 if a < b, 0 if a == b and 1 if a > b.
+*
+*   EXAMPLE
+*	if (ma_ffp_cmp(f, MA_FFP_ZERO) < 0) f = ma_ffp_neg(f);
+*
+*   NOTES
+*	Any word with a zero mantissa compares equal to 0.
+*
+*   SEE ALSO
+*	ma_ffp_sub(), amiga/ffp.h
+*
+******************************************************************************/
+
+int ma_ffp_cmp(ma_ffp a, ma_ffp b)
+{
+    long ka, kb;
+
+    /* exponent above mantissa orders FFP magnitudes like integers */
+    ka = MANT(a) ? (long)((a & 0x7fUL) << 24 | a >> 8) : 0;
+    kb = MANT(b) ? (long)((b & 0x7fUL) << 24 | b >> 8) : 0;
+    if (ka && SIGN(a)) ka = -ka;
+    if (kb && SIGN(b)) kb = -kb;
+    return (ka > kb) - (ka < kb);
+}
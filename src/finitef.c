@@ -51,10 +51,6 @@
 * 
 ******************************************************************************/
 
-/* Helper macros for accessing high/low parts of float */
-/* SAS/C uses big-endian, so high word is first */
-#define __HI(x) *(int*)&x
-
 int finitef(float x)
 {
     int hx; 
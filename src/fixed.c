@@ -0,0 +1,271 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * fixed - Fixed-point conversions and arithmetic
+ *
+ * Q16.16 and Q1.30 values are plain longs. Products are formed with
+ * 16x16 bit multiplies, which the 68000 has as MULU, so nothing here
+ * needs an FPU or a 32-bit multiply instruction.
+ */
+
+#include <math.h>
+#include <amiga/fixed.h>
+
+/* 16x16->32 multiply, which the 68000 has as a single MULU */
+#define MULU(a,b) ((unsigned long)(unsigned short)(a)*(unsigned short)(b))
+
+/*
+ * __fix_umul - Full 32x32->64 bit unsigned product.
+ */
+void __fix_umul(unsigned long a, unsigned long b,
+                unsigned long *hi, unsigned long *lo)
+{
+    unsigned long p00, p01, p10, mid;
+
+    p00 = MULU(a, b);
+    p01 = MULU(a, b>>16);
+    p10 = MULU(a>>16, b);
+    mid = (p00>>16) + (p01&0xffff) + (p10&0xffff);
+    *lo = (mid<<16) | (p00&0xffff);
+    *hi = MULU(a>>16, b>>16) + (p01>>16) + (p10>>16) + (mid>>16);
+}
+
+/*
+ * __fix_mulshift - Return a*b/2**sh rounded to nearest, saturated to
+ * 32 bits. sh must be 1..31.
+ */
+long __fix_mulshift(long a, long b, int sh)
+{
+    unsigned long ua, ub, hi, lo, r;
+    int neg;
+
+    neg = (a < 0) != (b < 0);
+    ua = (a < 0) ? 0UL-(unsigned long)a : (unsigned long)a;
+    ub = (b < 0) ? 0UL-(unsigned long)b : (unsigned long)b;
+    __fix_umul(ua, ub, &hi, &lo);
+
+    /* round the magnitude, so that results are symmetric about 0 */
+    r = 1UL << (sh-1);
+    lo += r;
+    hi += (lo < r);
+    if (hi >> (sh-1)) {
+        return neg ? MA_Q16_MIN : MA_Q16_MAX;
+    }
+    lo = (hi << (32-sh)) | (lo >> sh);
+    return neg ? -(long)lo : (long)lo;
+}
+
+/*
+ * __fix_udiv - Return the 32-bit quotient of [hi,lo] / d and store the
+ * remainder. hi must be less than d.
+ */
+unsigned long __fix_udiv(unsigned long hi, unsigned long lo,
+                         unsigned long d, unsigned long *rem)
+{
+    unsigned long q, c;
+    int i;
+
+    q = 0;
+    for (i = 0; i < 32; i++) {
+        c = hi & 0x80000000UL;
+        hi = (hi << 1) | (lo >> 31);
+        lo <<= 1;
+        q <<= 1;
+        if (c || hi >= d) {
+            hi -= d;
+            q |= 1;
+        }
+    }
+    *rem = hi;
+    return q;
+}
+
+/*
+ * to_fixed - Round x * scale to the nearest long, saturating.
+ */
+static long to_fixed(double x, double scale)
+{
+    x *= scale;
+    if (x != x) return 0;
+    if (x >= 2147483647.0) return MA_Q16_MAX;
+    if (x <= -2147483648.0) return MA_Q16_MIN;
+    return (long)floor(x + 0.5);
+}
+
+/****** ma.lib/ma_q16_from_double ********************************************
+*
+*   NAME	
+* 	ma_q16_from_double -- Convert double to Q16.16 fixed point. (V1.0)
+*
+*   SYNOPSIS
+*	ma_q16 result = ma_q16_from_double(double x);
+*	  D0                                 D0
+*	ma_q16 ma_q16_from_double(double x);
+*
+*   FUNCTION
+*	Convert x to Q16.16 format, rounding to the nearest representable
+*	value. The companion functions ma_q16_to_double(),
+*	ma_q16_from_float(), ma_q16_to_float() and the ma_q30_*()
+*	versions convert the other ways and to and from Q1.30.
+*
+*   INPUTS
+*	x - Value to convert.
+*
+*   RESULT
+*	result - x in Q16.16. Saturates to MA_Q16_MAX or MA_Q16_MIN when
+*	        x is out of range; NaN converts to 0.
+*
+*   EXAMPLE
+*	ma_q16 half = ma_q16_from_double(0.5);
+*
+*   NOTES
+*	The conversions use the floating-point library; the rest of the
+*	fixed-point functions do not.
+*
+*   SEE ALSO
+*	ma_q16_to_double(), ma_q30_from_double(), amiga/fixed.h
+*
+******************************************************************************/
+
+ma_q16 ma_q16_from_double(double x)
+{
+    return to_fixed(x, 65536.0);
+}
+
+double ma_q16_to_double(ma_q16 x)
+{
+    return (double)x * (1.0/65536.0);
+}
+
+ma_q16 ma_q16_from_float(float x)
+{
+    return to_fixed((double)x, 65536.0);
+}
+
+float ma_q16_to_float(ma_q16 x)
+{
+    return (float)((double)x * (1.0/65536.0));
+}
+
+ma_q30 ma_q30_from_double(double x)
+{
+    return to_fixed(x, 1073741824.0);
+}
+
+double ma_q30_to_double(ma_q30 x)
+{
+    return (double)x * (1.0/1073741824.0);
+}
+
+ma_q30 ma_q30_from_float(float x)
+{
+    return to_fixed((double)x, 1073741824.0);
+}
+
+float ma_q30_to_float(ma_q30 x)
+{
+    return (float)((double)x * (1.0/1073741824.0));
+}
+
+/****** ma.lib/ma_q16_mul ****************************************************
+*
+*   NAME	
+* 	ma_q16_mul -- Multiply two fixed-point values. (V1.0)
+*
+*   SYNOPSIS
+*	ma_q16 result = ma_q16_mul(ma_q16 a, ma_q16 b);
+*	  D0                         D0        D1
+*	ma_q16 ma_q16_mul(ma_q16 a, ma_q16 b);
+*
+*   FUNCTION
+*	Multiply two Q16.16 values. The full 64-bit product is formed
+*	from four 16x16 bit multiplies and rounded to nearest.
+*	ma_q30_mul() does the same for Q1.30 values.
+*
+*   INPUTS
+*	a - First factor.
+*	b - Second factor.
+*
+*   RESULT
+*	result - a*b, saturated to MA_Q16_MAX or MA_Q16_MIN.
+*
+*   EXAMPLE
+*	ma_q16 area = ma_q16_mul(w, h);
+*
+*   NOTES
+*	Exact to within half a unit in the last place.
+*
+*   SEE ALSO
+*	ma_q16_div(), ma_q30_mul(), amiga/fixed.h
+*
+******************************************************************************/
+
+ma_q16 ma_q16_mul(ma_q16 a, ma_q16 b)
+{
+    return __fix_mulshift(a, b, 16);
+}
+
+ma_q30 ma_q30_mul(ma_q30 a, ma_q30 b)
+{
+    return __fix_mulshift(a, b, 30);
+}
+
+/****** ma.lib/ma_q16_div ****************************************************
+*
+*   NAME	
+* 	ma_q16_div -- Divide two fixed-point values. (V1.0)
+*
+*   SYNOPSIS
+*	ma_q16 result = ma_q16_div(ma_q16 a, ma_q16 b);
+*	  D0                         D0        D1
+*	ma_q16 ma_q16_div(ma_q16 a, ma_q16 b);
+*
+*   FUNCTION
+*	Divide two Q16.16 values with a shift-and-subtract division,
+*	rounding the quotient to nearest.
+*
+*   INPUTS
+*	a - Dividend.
+*	b - Divisor.
+*
+*   RESULT
+*	result - a/b, saturated to MA_Q16_MAX or MA_Q16_MIN. Division by
+*	        zero saturates by the sign of a (0/0 gives 0).
+*
+*   EXAMPLE
+*	ma_q16 ratio = ma_q16_div(MA_Q16_ONE, MA_Q16_FROM_INT(3));
+*
+*   NOTES
+*	Exact to within half a unit in the last place.
+*
+*   SEE ALSO
+*	ma_q16_mul(), amiga/fixed.h
+*
+******************************************************************************/
+
+ma_q16 ma_q16_div(ma_q16 a, ma_q16 b)
+{
+    unsigned long ua, ub, q, rem;
+    int neg;
+
+    neg = (a < 0) != (b < 0);
+    ua = (a < 0) ? 0UL-(unsigned long)a : (unsigned long)a;
+    ub = (b < 0) ? 0UL-(unsigned long)b : (unsigned long)b;
+
+    if (ub == 0) {
+        if (ua == 0) return 0;
+        return (a < 0) ? MA_Q16_MIN : MA_Q16_MAX;
+    }
+    if ((ua >> 16) >= ub) {
+        return neg ? MA_Q16_MIN : MA_Q16_MAX;
+    }
+
+    q = __fix_udiv(ua >> 16, ua << 16, ub, &rem);
+    if (rem >= ub - rem) q++;		/* round to nearest */
+
+    if (neg) {
+        return (q > 0x80000000UL) ? MA_Q16_MIN : -(long)q;
+    }
+    return (q > 0x7fffffffUL) ? MA_Q16_MAX : (long)q;
+}
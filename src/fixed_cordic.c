@@ -0,0 +1,443 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * fixed_cordic - Fixed-point trigonometry by CORDIC
+ *
+ * Rotation and vectoring CORDIC in Q1.30 radians, using only shifts
+ * and adds in the iterations. The few multiplies, in the range
+ * reduction and the final corrections, are built from 16x16 bit MULUs.
+ */
+
+#include <amiga/fixed.h>
+
+/* Shared fixed-point kernels - see fixed.c */
+extern void __fix_umul(unsigned long a, unsigned long b,
+                       unsigned long *hi, unsigned long *lo);
+extern long __fix_mulshift(long a, long b, int sh);
+
+#define CORDIC_N 31
+#define ROTATE_N 17
+
+/* v / 2**i, rounded */
+#define RSHIFT(v,i) (((v) + ((1L << (i)) >> 1)) >> (i))
+
+/* atan(2**-i) in Q1.30 */
+static const long atantab[CORDIC_N] = {
+    843314857L, 497837829L, 263043837L, 133525159L,
+    67021687L, 33543516L, 16775851L, 8388437L,
+    4194283L, 2097149L, 1048576L, 524288L,
+    262144L, 131072L, 65536L, 32768L,
+    16384L, 8192L, 4096L, 2048L,
+    1024L, 512L, 256L, 128L,
+    64L, 32L, 16L, 8L,
+    4L, 2L, 1L
+};
+
+static const long
+cordic_k   = 652032874L,	/* prod 1/sqrt(1+2**-2i), Q1.30 */
+twoopi     = 683565276L,	/* 2/pi, Q1.30 */
+pio2_hi    = 1686629713L,	/* pi/2, Q1.30 ... */
+pio2_lo    = 280256794L,	/* ... and the next 32 bits */
+pi_q29     = 1686629713L,	/* pi, Q2.29 */
+invpi_q31  = 683565276L,	/* 1/pi, Q0.31 */
+pi_q16     = 205887L;		/* pi, Q16.16 */
+
+/*
+ * rotate - sin and cos of z in Q1.30, for |z| <= pi/4 (and a little
+ * more).
+ *
+ * Only ROTATE_N iterations are run. The angle left over is then below
+ * 2**-16, small enough that a first-order rotation by it is good to
+ * 2**-33, and costs two multiplies instead of fourteen iterations.
+ */
+static void rotate(long z, long *s, long *c)
+{
+    long x, y, t;
+    int i;
+
+    x = cordic_k;
+    y = 0;
+    for (i = 0; i < ROTATE_N; i++) {
+        if (z >= 0) {
+            t = x - RSHIFT(y, i);
+            y += RSHIFT(x, i);
+            z -= atantab[i];
+        } else {
+            t = x + RSHIFT(y, i);
+            y -= RSHIFT(x, i);
+            z += atantab[i];
+        }
+        x = t;
+    }
+    *s = y + __fix_mulshift(x, z, 30);
+    *c = x - __fix_mulshift(y, z, 30);
+}
+
+/*
+ * vector - Angle of (ax,ay) in Q1.30 radians, 0..pi/2, and its length
+ * in the units of the inputs, saturated to MA_Q16_MAX.
+ */
+static long vector(unsigned long ax, unsigned long ay, long *len)
+{
+    unsigned long x, m, hi, lo;
+    long y, z, t;
+    int i, sh;
+
+    m = (ax > ay) ? ax : ay;
+    if (m == 0) {
+        *len = 0;
+        return 0;
+    }
+
+    /* scale the larger input into [2**29, 2**30) */
+    sh = 0;
+    while (m < 0x20000000UL) {
+        m <<= 1;
+        sh++;
+    }
+    while (m >= 0x40000000UL) {
+        m >>= 1;
+        sh--;
+    }
+    if (sh >= 0) {
+        ax <<= sh;
+        ay <<= sh;
+    } else {
+        ax = (ax + (1UL << (-sh-1))) >> -sh;
+        ay = (ay + (1UL << (-sh-1))) >> -sh;
+    }
+
+    /* x grows by 1/K to at most 2.4 * 2**30, so it is kept unsigned */
+    x = ax;
+    y = (long)ay;
+    z = 0;
+    for (i = 0; i < CORDIC_N; i++) {
+        t = (long)((x + ((1UL << i) >> 1)) >> i);
+        if (y >= 0) {
+            x += (unsigned long)RSHIFT(y, i);
+            y -= t;
+            z += atantab[i];
+        } else {
+            x -= (unsigned long)RSHIFT(y, i);
+            y += t;
+            z -= atantab[i];
+        }
+    }
+
+    /* remove the CORDIC gain and the scaling */
+    __fix_umul(x, (unsigned long)cordic_k, &hi, &lo);
+    lo += 0x20000000UL;
+    hi += (lo < 0x20000000UL);
+    x = (hi << 2) | (lo >> 30);
+    if (sh > 0) {
+        x = (x + (1UL << (sh-1))) >> sh;
+    } else if (sh < 0) {
+        x = (x > (0x7fffffffUL >> -sh)) ? 0x7fffffffUL : x << -sh;
+    }
+    *len = (long)x;
+    return z;
+}
+
+/* quadrant n of an angle reduced to r: (sin, cos) from (s, c) of r */
+static void quadrant(int n, long s, long c, long *ps, long *pc)
+{
+    switch (n & 3) {
+    case 0: *ps = s;  *pc = c;  break;
+    case 1: *ps = c;  *pc = -s; break;
+    case 2: *ps = -s; *pc = -c; break;
+    default: *ps = -c; *pc = s; break;
+    }
+}
+
+/****** ma.lib/ma_q16_sincos *************************************************
+*
+*   NAME	
+* 	ma_q16_sincos -- Fixed-point sine and cosine. (V1.0)
+*
+*   SYNOPSIS
+*	ma_q16_sincos(ma_q16 a, ma_q16 *s, ma_q16 *c);
+*	               D0         A0         A1
+*	void ma_q16_sincos(ma_q16 a, ma_q16 *s, ma_q16 *c);
+*
+*   FUNCTION
+*	Compute the sine and cosine of the angle a, in Q16.16 radians,
+*	with one CORDIC rotation. The angle is first reduced modulo pi/2
+*	against a 62-bit value of pi/2, so large arguments keep their
+*	accuracy. ma_q16_sin() and ma_q16_cos() return one of the two.
+*
+*   INPUTS
+*	a - Angle in radians, Q16.16.
+*	s - Where to store the sine (may be NULL).
+*	c - Where to store the cosine (may be NULL).
+*
+*   RESULT
+*	The sine and cosine of a in Q16.16, within one unit in the last
+*	place.
+*
+*   EXAMPLE
+*	ma_q16 s, c;
+*	ma_q16_sincos(MA_Q16_PI / 6, &s, &c);
+*
+*   NOTES
+*	Uses no floating point and no 32-bit multiply instruction, so it
+*	suits a 68000 without an FPU. The rotation runs 17 iterations and
+*	finishes with a first-order correction for the angle left over.
+*
+*   SEE ALSO
+*	ma_q16_sin(), ma_q16_cos(), ma_q30_sincospi(), sincos(),
+*	amiga/fixed.h
+*
+******************************************************************************/
+
+void ma_q16_sincos(ma_q16 a, ma_q16 *s, ma_q16 *c)
+{
+    unsigned long hi, lo, m, r;
+    long n, sr, cr, sv, cv;
+
+    /* n = nearest integer to a*2/pi */
+    n = __fix_mulshift(a, twoopi, 30);
+    n = (n + 0x8000L) >> 16;
+
+    /* r = a - n*pi/2 in Q1.30, exact modulo 2**32 */
+    m = (n < 0) ? 0UL-(unsigned long)n : (unsigned long)n;
+    __fix_umul(m, (unsigned long)pio2_lo, &hi, &lo);
+    r = m * (unsigned long)pio2_hi + hi;
+    if (n < 0) r = 0UL - r;
+    r = ((unsigned long)a << 14) - r;
+
+    rotate((long)r, &sr, &cr);
+    quadrant((int)n, sr, cr, &sv, &cv);
+    if (s) *s = (sv + 0x2000L) >> 14;
+    if (c) *c = (cv + 0x2000L) >> 14;
+}
+
+ma_q16 ma_q16_sin(ma_q16 a)
+{
+    ma_q16 s;
+
+    ma_q16_sincos(a, &s, (ma_q16 *)0);
+    return s;
+}
+
+ma_q16 ma_q16_cos(ma_q16 a)
+{
+    ma_q16 c;
+
+    ma_q16_sincos(a, (ma_q16 *)0, &c);
+    return c;
+}
+
+/****** ma.lib/ma_q16_atan2 **************************************************
+*
+*   NAME	
+* 	ma_q16_atan2 -- Fixed-point arc tangent of y/x. (V1.0)
+*
+*   SYNOPSIS
+*	ma_q16 result = ma_q16_atan2(ma_q16 y, ma_q16 x);
+*	  D0                           D0        D1
+*	ma_q16 ma_q16_atan2(ma_q16 y, ma_q16 x);
+*
+*   FUNCTION
+*	Compute the angle of the point (x, y) with a vectoring CORDIC,
+*	using the signs of both arguments to choose the quadrant.
+*
+*   INPUTS
+*	y - Ordinate, Q16.16.
+*	x - Abscissa, Q16.16.
+*
+*   RESULT
+*	result - Angle in radians in [-pi, pi], Q16.16. Returns 0 for
+*	        (0, 0).
+*
+*   EXAMPLE
+*	ma_q16 a = ma_q16_atan2(MA_Q16_ONE, -MA_Q16_ONE);
+*
+*   NOTES
+*	Only the ratio of y and x matters, so any fixed-point format may
+*	be passed as long as both use the same one.
+*
+*   SEE ALSO
+*	ma_q16_hypot(), ma_q30_atan2pi(), atan2(), amiga/fixed.h
+*
+******************************************************************************/
+
+ma_q16 ma_q16_atan2(ma_q16 y, ma_q16 x)
+{
+    unsigned long ax, ay;
+    long len, t;
+
+    ax = (x < 0) ? 0UL-(unsigned long)x : (unsigned long)x;
+    ay = (y < 0) ? 0UL-(unsigned long)y : (unsigned long)y;
+    t = (vector(ax, ay, &len) + 0x2000L) >> 14;
+    if (x < 0) t = pi_q16 - t;
+    return (y < 0) ? -t : t;
+}
+
+/****** ma.lib/ma_q16_hypot **************************************************
+*
+*   NAME	
+* 	ma_q16_hypot -- Fixed-point Euclidean distance. (V1.0)
+*
+*   SYNOPSIS
+*	ma_q16 result = ma_q16_hypot(ma_q16 x, ma_q16 y);
+*	  D0                           D0        D1
+*	ma_q16 ma_q16_hypot(ma_q16 x, ma_q16 y);
+*
+*   FUNCTION
+*	Compute sqrt(x*x + y*y) with a vectoring CORDIC. No squares are
+*	formed, so there is no intermediate overflow. ma_q30_hypot()
+*	is the same function for Q1.30 values.
+*
+*   INPUTS
+*	x - First side, Q16.16.
+*	y - Second side, Q16.16.
+*
+*   RESULT
+*	result - Length of the hypotenuse, saturated to MA_Q16_MAX.
+*
+*   EXAMPLE
+*	ma_q16 d = ma_q16_hypot(MA_Q16_FROM_INT(3), MA_Q16_FROM_INT(4));
+*
+*   NOTES
+*	Accurate to about 2**-28 relative, so within one unit in the last
+*	place for results below 2**28 units.
+*
+*   SEE ALSO
+*	ma_q16_atan2(), ma_q16_sqrt(), hypot(), amiga/fixed.h
+*
+******************************************************************************/
+
+ma_q16 ma_q16_hypot(ma_q16 x, ma_q16 y)
+{
+    unsigned long ax, ay;
+    long len;
+
+    ax = (x < 0) ? 0UL-(unsigned long)x : (unsigned long)x;
+    ay = (y < 0) ? 0UL-(unsigned long)y : (unsigned long)y;
+    vector(ax, ay, &len);
+    return len;
+}
+
+ma_q30 ma_q30_hypot(ma_q30 x, ma_q30 y)
+{
+    return ma_q16_hypot(x, y);
+}
+
+/****** ma.lib/ma_q30_sincospi ***********************************************
+*
+*   NAME	
+* 	ma_q30_sincospi -- Fixed-point sine and cosine of a*pi. (V1.0)
+*
+*   SYNOPSIS
+*	ma_q30_sincospi(ma_q30 a, ma_q30 *s, ma_q30 *c);
+*	                 D0         A0         A1
+*	void ma_q30_sincospi(ma_q30 a, ma_q30 *s, ma_q30 *c);
+*
+*   FUNCTION
+*	Compute sin(a*pi) and cos(a*pi) in Q1.30. The angle is measured
+*	in half turns, so the Q1.30 range [-2, 2) covers two full turns
+*	and range reduction is exact. ma_q30_sinpi() and ma_q30_cospi()
+*	return one of the two.
+*
+*   INPUTS
+*	a - Angle in half turns, Q1.30.
+*	s - Where to store the sine (may be NULL).
+*	c - Where to store the cosine (may be NULL).
+*
+*   RESULT
+*	The sine and cosine in Q1.30, within 8 units of 2**-30. Integer
+*	and half-integer angles give exact results.
+*
+*   EXAMPLE
+*	ma_q30 s, c;
+*	ma_q30_sincospi(MA_Q30_HALF / 2, &s, &c);
+*
+*   NOTES
+*	Half turns suit phase accumulators: the angle wraps for free
+*	when it overflows.
+*
+*   SEE ALSO
+*	ma_q30_sinpi(), ma_q30_cospi(), ma_q16_sincos(), amiga/fixed.h
+*
+******************************************************************************/
+
+void ma_q30_sincospi(ma_q30 a, ma_q30 *s, ma_q30 *c)
+{
+    unsigned long u;
+    long r, sr, cr, sv, cv;
+
+    /* nearest quarter turn n, and the rest r in [-1/4, 1/4) */
+    u = (unsigned long)a + 0x10000000UL;
+    r = (long)((unsigned long)a - (u & 0xe0000000UL));
+    if (r == 0) {
+        sr = 0;
+        cr = MA_Q30_ONE;
+    } else {
+        rotate(__fix_mulshift(r, pi_q29, 29), &sr, &cr);
+    }
+    quadrant((int)(u >> 29), sr, cr, &sv, &cv);
+    if (s) *s = sv;
+    if (c) *c = cv;
+}
+
+ma_q30 ma_q30_sinpi(ma_q30 a)
+{
+    ma_q30 s;
+
+    ma_q30_sincospi(a, &s, (ma_q30 *)0);
+    return s;
+}
+
+ma_q30 ma_q30_cospi(ma_q30 a)
+{
+    ma_q30 c;
+
+    ma_q30_sincospi(a, (ma_q30 *)0, &c);
+    return c;
+}
+
+/****** ma.lib/ma_q30_atan2pi ************************************************
+*
+*   NAME	
+* 	ma_q30_atan2pi -- Fixed-point arc tangent of y/x in half turns. (V1.0)
+*
+*   SYNOPSIS
+*	ma_q30 result = ma_q30_atan2pi(ma_q30 y, ma_q30 x);
+*	  D0                             D0        D1
+*	ma_q30 ma_q30_atan2pi(ma_q30 y, ma_q30 x);
+*
+*   FUNCTION
+*	Compute atan2(y, x) / pi, the angle of the point (x, y) in half
+*	turns, with a vectoring CORDIC.
+*
+*   INPUTS
+*	y - Ordinate.
+*	x - Abscissa, in the same format as y.
+*
+*   RESULT
+*	result - Angle in half turns in [-1, 1], Q1.30, within 4 units
+*	        of 2**-30. Returns 0 for (0, 0).
+*
+*   EXAMPLE
+*	ma_q30 a = ma_q30_atan2pi(MA_Q30_ONE, MA_Q30_ONE);
+*
+*   NOTES
+*	The inverse of ma_q30_sincospi().
+*
+*   SEE ALSO
+*	ma_q30_sincospi(), ma_q16_atan2(), amiga/fixed.h
+*
+******************************************************************************/
+
+ma_q30 ma_q30_atan2pi(ma_q30 y, ma_q30 x)
+{
+    unsigned long ax, ay;
+    long len, t;
+
+    ax = (x < 0) ? 0UL-(unsigned long)x : (unsigned long)x;
+    ay = (y < 0) ? 0UL-(unsigned long)y : (unsigned long)y;
+    t = __fix_mulshift(vector(ax, ay, &len), invpi_q31, 31);
+    if (x < 0) t = MA_Q30_ONE - t;
+    return (y < 0) ? -t : t;
+}
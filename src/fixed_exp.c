@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * fixed_exp - Fixed-point base-2 exponential and logarithm
+ *
+ * Both work on a Q1.30 mantissa with fixed-point minimax polynomials,
+ * so a Q16.16 or Q1.30 result only needs a final shift.
+ */
+
+#include <amiga/fixed.h>
+
+/* Shared fixed-point kernels - see fixed.c */
+extern long __fix_mulshift(long a, long b, int sh);
+extern unsigned long __fix_udiv(unsigned long hi, unsigned long lo,
+                                unsigned long d, unsigned long *rem);
+
+/* (2**f - 1)/f on [0,1), Q1.30, error below 0.07 units of 2**-30 */
+static const long exp2_c[7] = {
+    744261123L, 257941120L, 59598189L, 10322874L,
+    1441452L, 153922L, 23144L
+};
+
+/* log2((1+s)/(1-s))/(2s) in s*s for |s| <= 3-2*sqrt(2), Q1.30 */
+static const long log2_c[4] = {
+    1549082000L, 516362850L, 309551523L, 233138380L
+};
+
+static const unsigned long
+sqrt2_q30 = 1518500250UL;	/* sqrt(2), Q1.30 */
+
+/*
+ * exp2_frac - 2**f in Q1.30 for 0 <= f < 1 in Q1.30. The result lies
+ * in [2**30, 2**31).
+ */
+static unsigned long exp2_frac(long f)
+{
+    long p;
+    int i;
+
+    p = exp2_c[6];
+    for (i = 5; i >= 0; i--) {
+        p = exp2_c[i] + __fix_mulshift(f, p, 30);
+    }
+    return (unsigned long)MA_Q30_ONE + (unsigned long)__fix_mulshift(f, p, 30);
+}
+
+/*
+ * log2_norm - log2 of the positive x, as e + *frac with *frac a Q1.30
+ * value in [-1/2, 1/2]. q is the number of fraction bits of x.
+ */
+static long log2_norm(unsigned long x, int q, long *frac)
+{
+    unsigned long m, num, den, rem;
+    long s, z, p;
+    int b, i, neg;
+
+    /* m = x scaled into [1, 2), Q1.30 */
+    b = 30;
+    m = x;
+    while (m < 0x40000000UL) {
+        m <<= 1;
+        b--;
+    }
+
+    /* s = (m-1)/(m+1), or (m/2-1)/(m/2+1) above sqrt(2) */
+    if (m > sqrt2_q30) {
+        num = 0x80000000UL - m;
+        den = m + 0x80000000UL;
+        neg = 1;
+        b++;
+    } else {
+        num = m - 0x40000000UL;
+        den = m + 0x40000000UL;
+        neg = 0;
+    }
+    s = (long)__fix_udiv(num >> 2, num << 30, den, &rem);
+    if (rem >= den - rem) s++;
+    if (neg) s = -s;
+
+    z = __fix_mulshift(s, s, 30);
+    p = log2_c[3];
+    for (i = 2; i >= 0; i--) {
+        p = log2_c[i] + __fix_mulshift(z, p, 30);
+    }
+    *frac = __fix_mulshift(s, p, 29);
+    return (long)b - q;
+}
+
+/****** ma.lib/ma_q16_exp2 ***************************************************
+*
+*   NAME	
+* 	ma_q16_exp2 -- Fixed-point base-2 exponential. (V1.0)
+*
+*   SYNOPSIS
+*	ma_q16 result = ma_q16_exp2(ma_q16 x);
+*	  D0                          D0
+*	ma_q16 ma_q16_exp2(ma_q16 x);
+*
+*   FUNCTION
+*	Compute 2 raised to the power x. The integer part of x becomes a
+*	shift; the fraction goes through a degree 7 polynomial evaluated
+*	in Q1.30. ma_q30_exp2() does the same for Q1.30 values.
+*
+*   INPUTS
+*	x - Exponent, Q16.16.
+*
+*   RESULT
+*	result - 2^x in Q16.16, to about 2**-28 relative (one unit
+*	        in the last place below 2^14). Saturates to MA_Q16_MAX for x >= 15 and rounds to 0 for
+*	        x below -17.
+*
+*   EXAMPLE
+*	ma_q16 r = ma_q16_exp2(MA_Q16_HALF);
+*
+*   NOTES
+*	Scale by ma_q16_mul() with log2(e) or log2(10) for the other
+*	bases.
+*
+*   SEE ALSO
+*	ma_q16_log2(), exp2(), amiga/fixed.h
+*
+******************************************************************************/
+
+ma_q16 ma_q16_exp2(ma_q16 x)
+{
+    unsigned long p;
+    long n;
+    int sh;
+
+    n = x >> 16;
+    if (n >= 15) return MA_Q16_MAX;
+    if (n < -17) return 0;
+
+    p = exp2_frac((x & 0xffffL) << 14);
+    sh = 14 - (int)n;
+    if (sh == 0) return (p > 0x7fffffffUL) ? MA_Q16_MAX : (ma_q16)p;
+    return (ma_q16)((p + (1UL << (sh-1))) >> sh);
+}
+
+ma_q30 ma_q30_exp2(ma_q30 x)
+{
+    unsigned long p;
+    long n;
+
+    n = x >> 30;
+    if (n >= 1) return MA_Q30_MAX;
+
+    p = exp2_frac(x & 0x3fffffffL);
+    if (n == 0) return (p > 0x7fffffffUL) ? MA_Q30_MAX : (ma_q30)p;
+    return (ma_q30)((p + (1UL << (-n-1))) >> -n);
+}
+
+/****** ma.lib/ma_q16_log2 ***************************************************
+*
+*   NAME	
+* 	ma_q16_log2 -- Fixed-point base-2 logarithm. (V1.0)
+*
+*   SYNOPSIS
+*	ma_q16 result = ma_q16_log2(ma_q16 x);
+*	  D0                          D0
+*	ma_q16 ma_q16_log2(ma_q16 x);
+*
+*   FUNCTION
+*	Compute the base-2 logarithm of x. The exponent comes from
+*	normalising x; the mantissa m in [1/sqrt(2), sqrt(2)) goes through
+*	an odd polynomial in s = (m-1)/(m+1). ma_q30_log2() does the
+*	same for Q1.30 values.
+*
+*   INPUTS
+*	x - Argument, Q16.16.
+*
+*   RESULT
+*	result - log2(x) in Q16.16, within one unit in the last place.
+*	        Returns MA_Q16_MIN for x <= 0.
+*
+*   EXAMPLE
+*	ma_q16 r = ma_q16_log2(MA_Q16_FROM_INT(10));
+*
+*   NOTES
+*	ma_q30_log2() is within 3 units of 2**-30 and saturates to
+*	MA_Q30_MIN when the logarithm is below -2.
+*
+*   SEE ALSO
+*	ma_q16_exp2(), log2(), amiga/fixed.h
+*
+******************************************************************************/
+
+ma_q16 ma_q16_log2(ma_q16 x)
+{
+    long e, f;
+
+    if (x <= 0) return MA_Q16_MIN;
+    e = log2_norm((unsigned long)x, 16, &f);
+    return (e << 16) + ((f + 0x2000L) >> 14);
+}
+
+ma_q30 ma_q30_log2(ma_q30 x)
+{
+    long e, f;
+
+    if (x <= 0) return MA_Q30_MIN;
+    e = log2_norm((unsigned long)x, 30, &f);
+    if (e < -2 || (e == -2 && f < 0)) return MA_Q30_MIN;
+    return (long)((unsigned long)e << 30) + f;
+}
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * fixed_sqrt - Fixed-point square root
+ */
+
+#include <amiga/fixed.h>
+
+/*
+ * isqrt64 - Square root of the 64-bit value [hi,lo], rounded to the
+ * nearest integer. hi must be below 2**30.
+ *
+ * Digit-by-digit, one result bit per step. The partial remainder can
+ * need 34 bits in the last steps, so its top bits are carried apart.
+ */
+static unsigned long isqrt64(unsigned long hi, unsigned long lo)
+{
+    unsigned long root, rem, trial, top, ttop;
+    int i;
+
+    root = 0;
+    rem = 0;
+    for (i = 0; i < 32; i++) {
+        top = rem >> 30;
+        rem = (rem << 2) | (hi >> 30);
+        hi = (hi << 2) | (lo >> 30);
+        lo <<= 2;
+
+        trial = (root << 2) | 1;
+        ttop = root >> 30;
+        root <<= 1;
+        if (top > ttop || (top == ttop && rem >= trial)) {
+            rem -= trial;
+            root |= 1;
+        }
+    }
+
+    /* x - r*r > r means x > (r + 1/2)**2 */
+    if (rem > root) root++;
+    return root;
+}
+
+/****** ma.lib/ma_q16_sqrt ***************************************************
+*
+*   NAME	
+* 	ma_q16_sqrt -- Fixed-point square root. (V1.0)
+*
+*   SYNOPSIS
+*	ma_q16 result = ma_q16_sqrt(ma_q16 x);
+*	  D0                          D0
+*	ma_q16 ma_q16_sqrt(ma_q16 x);
+*
+*   FUNCTION
+*	Compute the square root of a Q16.16 value by the digit-by-digit
+*	method on the 48-bit value x * 2**16, using only shifts,
+*	compares and subtracts. ma_q30_sqrt() does the same for Q1.30
+*	values.
+*
+*   INPUTS
+*	x - Value, Q16.16.
+*
+*   RESULT
+*	result - Square root of x, correctly rounded. Returns 0 for
+*	        negative x.
+*
+*   EXAMPLE
+*	ma_q16 r = ma_q16_sqrt(MA_Q16_FROM_INT(2));
+*
+*   NOTES
+*	Exact to within half a unit in the last place.
+*
+*   SEE ALSO
+*	ma_q16_hypot(), sqrt(), amiga/fixed.h
+*
+******************************************************************************/
+
+ma_q16 ma_q16_sqrt(ma_q16 x)
+{
+    if (x <= 0) return 0;
+    return (ma_q16)isqrt64((unsigned long)x >> 16, (unsigned long)x << 16);
+}
+
+ma_q30 ma_q30_sqrt(ma_q30 x)
+{
+    if (x <= 0) return 0;
+    return (ma_q30)isqrt64((unsigned long)x >> 2, (unsigned long)x << 30);
+}
@@ -9,6 +9,8 @@
 #include <math.h>
 #include "include/internal/m99_math.h"
 
+#undef fmin
+
 /****** ma.lib/fmin *********************************************************
 * 
 *   NAME	
@@ -17,11 +17,7 @@
 
 #include <math.h>
 #include "include/internal/m99_math.h"
-
-/* Helper macros for accessing high/low parts of double */
-/* SAS/C uses big-endian, so high word is first */
-#define __HI(x) *(int*)&x
-#define __LO(x) *(1+(int*)&x)
+#include "include/internal/bits.h"
 
 static const double one = 1.0, Zero[] = {0.0, -0.0,};
 
@@ -52,18 +48,20 @@ static double __ieee754_fmod(double x, double y)
     /* determine ix = ilogb(x) */
     if(hx<0x00100000) {	/* subnormal x */
         if(hx==0) {
-            for (ix = -1043, i=lx; i>0; i<<=1) ix -=1;
+            ix = -1043 - __ma_clz32(lx);
         } else {
-            for (ix = -1022,i=(hx<<11); i>0; i<<=1) ix -=1;
+            i = hx<<11;
+            ix = -1022 - __ma_clz32(i);
         }
     } else ix = (hx>>20)-1023;
 
     /* determine iy = ilogb(y) */
     if(hy<0x00100000) {	/* subnormal y */
         if(hy==0) {
-            for (iy = -1043, i=ly; i>0; i<<=1) iy -=1;
+            iy = -1043 - __ma_clz32(ly);
         } else {
-            for (iy = -1022,i=(hy<<11); i>0; i<<=1) iy -=1;
+            i = hy<<11;
+            iy = -1022 - __ma_clz32(i);
         }
     } else iy = (hy>>20)-1023;
 
@@ -110,9 +108,16 @@ static double __ieee754_fmod(double x, double y)
     /* convert back to floating value and restore the sign */
     if((hx|lx)==0) 			/* return sign(x)*0 */
         return Zero[(unsigned)sx>>31];	
-    while(hx<0x00100000) {		/* normalize x */
-        hx = hx+hx+(lx>>31); lx = lx+lx;
-        iy -= 1;
+    if(hx<0x00100000) {		/* normalize x */
+        n = (hx!=0) ? __ma_clz32(hx)-11 : 21+__ma_clz32(lx);
+        if(n<32) {
+            hx = (hx<<n)|(lx>>(32-n));
+            lx <<= n;
+        } else {
+            hx = lx<<(n-32);
+            lx = 0;
+        }
+        iy -= n;
     }
     if(iy>= -1022) {	/* normalize output */
         hx = ((hx-0x00100000)|((iy+1023)<<20));
@@ -9,6 +9,8 @@
 #include <math.h>
 #include "include/internal/m99_math.h"
 
+#undef fpclassify
+
 /****** ma.lib/fpclassify **************************************************
 * 
 *   NAME	
@@ -21,8 +23,9 @@
 *
 *   FUNCTION
 *	Classify the floating-point value x into one of the standard categories.
-*	This returns a constant indicating the type of value. This implementation
-*	uses high-precision algorithms for maximum accuracy.
+*	This returns a constant indicating the type of value, read from the
+*	exponent and significand bits, so doubles below DBL_MIN (not FLT_MIN)
+*	are the subnormals.
 * 
 *   INPUTS
 *	x - Input value. Range is [-∞, +∞].
@@ -46,10 +49,14 @@
 
 int fpclassify(double x)
 {
-    if (isnan(x)) return FP_NAN;
-    if (isinf(x)) return FP_INFINITE;
-    if (x == 0.0) return FP_ZERO;
-    if (x < 1.175494e-38 && x > -1.175494e-38) return FP_SUBNORMAL;
+    unsigned int hx, lx;
+
+    hx = __HI(x) & 0x7fffffff;
+    lx = __LO(x);
+    if (hx >= 0x7ff00000)                   /* exponent all ones */
+        return (hx > 0x7ff00000 || lx != 0) ? FP_NAN : FP_INFINITE;
+    if (hx < 0x00100000)                    /* exponent zero */
+        return (hx | lx) ? FP_SUBNORMAL : FP_ZERO;
     return FP_NORMAL;
 }
 
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * double ma_fsum(const double *x, unsigned long n)
+ * Return the correctly rounded sum of an array
+ *
+ * Method :
+ *	Shewchuk, "Adaptive Precision Floating-Point Arithmetic and Fast
+ *	Robust Geometric Predicates" (1997), as in Python's math.fsum().
+ *	The running sum is kept exactly as a short list of partials that
+ *	do not overlap, each at least 2**53 times smaller than the next,
+ *	so there are never more than about 40 of them. Each term is added
+ *	with two-sums that move the rounding errors down the list. The
+ *	partials are then added from the top, with a final correction
+ *	for ties so that the result is correctly rounded.
+ *
+ *	If a partial overflows although every term is finite, the sum is
+ *	redone with the exact accumulator, which has the range for it.
+ */
+
+#include <math.h>
+#include <amiga/sum.h>
+#include "include/internal/m99_math.h"
+
+#define NUM_PARTIALS 48
+
+static double exact_sum(const double *x, unsigned long n)
+{
+    ma_sumacc acc;
+
+    ma_sumacc_init(&acc);
+    ma_sumacc_addv(&acc, x, n);
+    return ma_sumacc_result(&acc);
+}
+
+/****** ma.lib/ma_fsum *******************************************************
+*
+*   NAME	
+* 	ma_fsum -- Correctly rounded sum of an array. (V1.0)
+*
+*   SYNOPSIS
+*	double result = ma_fsum(const double *x, unsigned long n);
+*	  D0		              A0                D0
+*	double ma_fsum(const double *x, unsigned long n);
+*
+*   FUNCTION
+*	Add n doubles as if in infinite precision and round the total
+*	once. The result does not depend on the order of the terms, and
+*	cancellation cannot lose any of them.
+*
+*   INPUTS
+*	x - Array of values.
+*	n - Number of values.
+*
+*   RESULT
+*	result - The correctly rounded sum; +0 for n = 0. +-Infinity if
+*	        the sum overflows. If the array holds infinities or NaNs,
+*	        their sum (NaN if there are infinities of both signs).
+*
+*   EXAMPLE
+*	double v[3] = { 1e100, 1.0, -1e100 };
+*	double s = ma_fsum(v, 3);
+*
+*   NOTES
+*	ma.lib extension. Costs a few times a plain loop for typical
+*	data. For long arrays ma_sumacc_addv(), which gives the same
+*	result, is usually faster, and for sums split between tasks a
+*	ma_sumacc per task and ma_sumacc_merge() are needed. Sets errno
+*	to ERANGE if the sum overflows.
+*
+*   SEE ALSO
+*	ma_sumacc_init(), amiga/sum.h
+*
+******************************************************************************/
+
+double ma_fsum(const double *x, unsigned long n)
+{
+    double p[NUM_PARTIALS];
+    double special, v, y, t, hi, lo, yr;
+    unsigned long k;
+    int i, j, m;
+
+    special = 0.0;
+    m = 0;
+    for (k = 0; k < n; k++) {
+        v = x[k];
+        if ((__HI(v) & 0x7ff00000) == 0x7ff00000) {	/* Inf or NaN */
+            special += v;
+            continue;
+        }
+        for (i = j = 0; j < m; j++) {
+            y = p[j];
+            if (fabs(v) < fabs(y)) {
+                t = v; v = y; y = t;
+            }
+            hi = v+y;
+            lo = y-(hi-v);
+            if (lo != 0.0) p[i++] = lo;
+            v = hi;
+        }
+        if (v-v != 0.0 || i == NUM_PARTIALS) return exact_sum(x, n);
+        m = i;
+        if (v != 0.0) p[m++] = v;
+    }
+    if (special != 0.0 || special != special) return special;
+
+    hi = 0.0;
+    if (m > 0) {
+        hi = p[--m];
+        /* add from the top until the sum is inexact */
+        lo = 0.0;
+        while (m > 0) {
+            v = hi;
+            y = p[--m];
+            hi = v+y;
+            yr = hi-v;
+            lo = y-yr;
+            if (lo != 0.0) break;
+        }
+        /* a half-way lo decides the rounding by the sign below it */
+        if (m > 0 && ((lo < 0.0 && p[m-1] < 0.0) ||
+                      (lo > 0.0 && p[m-1] > 0.0))) {
+            y = lo*2.0;
+            v = hi+y;
+            yr = v-hi;
+            if (y == yr) hi = v;
+        }
+    }
+    return hi;
+}
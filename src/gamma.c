@@ -45,7 +45,8 @@
 *
 *   NOTES
 *	This function is C89 compliant and provides IEEE 754 accuracy.
-*	Uses global signgam variable for sign information.
+*	Uses global signgam variable for sign information. The sign is
+*	also kept in the calling task's ma_ctx.
 * 
 *   SEE ALSO
 *	tgamma(), lgamma(), gamma_r(), math.h
@@ -60,5 +61,10 @@ double gamma_r(double x, int *signgamp);
 
 double gamma(double x)
 {
-    return gamma_r(x, &signgam);
+    ma_ctx *ctx = ma_ctx_current();
+    double y;
+
+    y = gamma_r(x, &ctx->signgam);
+    signgam = ctx->signgam;
+    return y;
 }
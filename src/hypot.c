@@ -1,30 +1,34 @@
 /*
  * hypot.c - Euclidean distance function
- * 
+ *
  * Copyright (c) 2025 amigazen project
  * SPDX-License-Identifier: BSD-2-Clause
- * 
- * This file implements the C99 hypot() function using AmigaOS math libraries
- * when available, falling back to standard implementation otherwise.
+ *
+ * This file implements the C99 hypot() function and its array forms.
+ *
+ * Method :
+ *	As fdlibm's e_hypot.c. Arguments beyond 2**+-500 are scaled by
+ *	2**-+600, or 2**1022 for subnormals, by adjusting the exponent
+ *	field, which is exact and needs no division. sqrt(a*a+b*b) is then
+ *	evaluated with a and b split into high and low parts so that the
+ *	squares are formed without rounding error:
+ *	1. if a > 2b, with t1 = a truncated to its top 21 bits, t2 = a-t1,
+ *		hypot = sqrt(t1*t1-(-b*b-t2*(a+t1)))
+ *	2. otherwise, with y1 = b truncated, y2 = b-y1, t1 = 2a truncated,
+ *	   t2 = 2a-t1 and w = a-b,
+ *		hypot = sqrt(t1*y1-(-w*w-(t1*y2+t2*b)))
+ *	The error is less than 1 ulp.
  */
 
 #include <math.h>
 #include <errno.h>
 #include <float.h>
+#include <complex.h>
 
-#include <amiga/math.h>
-
-/*
- * hypot - Euclidean distance
- * 
- * Returns the square root of x^2 + y^2, computed in a way that
- * avoids overflow and underflow.
- * Domain: (-infinity, +infinity) for both x and y
- * Range: [0, +infinity)
- */
+#include "include/internal/m99_math.h"
 
 /****** ma.lib/hypot ********************************************************
-* 
+*
 *   NAME	
 * 	hypot -- Return Euclidean distance sqrt(x² + y²). (V1.0)
 *
@@ -36,89 +40,155 @@
 *   FUNCTION
 *	Compute the Euclidean distance sqrt(x² + y²). This is the length of the
 *	hypotenuse of a right triangle with sides x and y. This implementation
-*	avoids overflow and underflow by scaling the computation.
-* 
+*	avoids overflow and underflow by scaling the computation by powers
+*	of 2, so it is correct across the whole exponent range.
+*
 *   INPUTS
 *	x - First value.
 *	y - Second value.
-*	
+*
 *   RESULT
 *	result - Euclidean distance sqrt(x² + y²). Returns +Infinity if either
-*	        argument is ±Infinity, returns NaN if either argument is NaN.
-* 
+*	        argument is ±Infinity, even if the other is NaN, and NaN if
+*	        either argument is NaN otherwise.
+*
 *   EXAMPLE
 *	double x = 3.0, y = 4.0;
-*	double result = hypot(x, y);  
+*	double result = hypot(x, y);
 *
 *   NOTES
 *	This function is C89 compliant and provides IEEE 754 accuracy.
-*	Handles overflow and underflow conditions correctly.
-* 
+*	The error is less than 1 ulp. Sets errno to ERANGE if the result
+*	overflows.
+*
 *   SEE ALSO
-*	sqrt(), pow(), math.h
-* 
+*	ma_hypot3(), ma_hypot_v(), ma_vnorm(), sqrt(), math.h
+*
 ******************************************************************************/
 
 double hypot(double x, double y)
 {
-    double result;
-    double abs_x, abs_y, max_val, min_val;
-    
-    /* Check for special values */
-    if (x != x || y != y) {  /* Either is NaN */
-        return NAN;
-    }
-    
-    if (x == INFINITY || x == -INFINITY || 
-        y == INFINITY || y == -INFINITY) {
-        return INFINITY;
-    }
-    
-    /* Get absolute values */
-    abs_x = fabs(x);
-    abs_y = fabs(y);
-    
-    /* Find maximum and minimum */
-    if (abs_x > abs_y) {
-        max_val = abs_x;
-        min_val = abs_y;
+    double a, b, t1, t2, y1, y2, w;
+    int j, k, ha, hb;
+
+    ha = __HI(x)&0x7fffffff;
+    hb = __HI(y)&0x7fffffff;
+    if (hb > ha) {
+        a = y; b = x; j = ha; ha = hb; hb = j;
     } else {
-        max_val = abs_y;
-        min_val = abs_x;
+        a = x; b = y;
     }
-    
-    /* Handle zero case */
-    if (max_val == 0.0) {
-        return 0.0;
+    __HI(a) = ha;				/* a <- |a| */
+    __HI(b) = hb;				/* b <- |b| */
+    if ((ha-hb) > 0x3c00000) return a+b;	/* a/b > 2**60 */
+    k = 0;
+    if (ha > 0x5f300000) {			/* a > 2**500 */
+        if (ha >= 0x7ff00000) {			/* Inf or NaN */
+            w = a+b;				/* for sNaN */
+            if (((ha&0xfffff)|__LO(a)) == 0) w = a;
+            if (((hb^0x7ff00000)|__LO(b)) == 0) w = b;
+            return w;
+        }
+        /* scale a and b by 2**-600 */
+        ha -= 0x25800000; hb -= 0x25800000; k += 600;
+        __HI(a) = ha;
+        __HI(b) = hb;
     }
-    
-#ifdef __AMIGA__
-    /* Use AmigaOS math library if available */
-    if (m99_has_trans()) {
-        /* hypot(x,y) = sqrt(x^2 + y^2) */
-        result = amiga_ieee_sqrt(x*x + y*y);
-        if (m99_get_error() == M99_ERR_NONE) {
-            return result;
+    if (hb < 0x20b00000) {			/* b < 2**-500 */
+        if (hb <= 0x000fffff) {			/* subnormal b or 0 */
+            if ((hb|(__LO(b))) == 0) return a;
+            t1 = 0;
+            __HI(t1) = 0x7fd00000;		/* t1 = 2**1022 */
+            b *= t1;
+            a *= t1;
+            k -= 1022;
+            ha = __HI(a);
+            hb = __HI(b);
+            if (hb > ha) {
+                t1 = a; a = b; b = t1; j = ha; ha = hb; hb = j;
+            }
+        } else {				/* scale a and b by 2**600 */
+            ha += 0x25800000;
+            hb += 0x25800000;
+            k -= 600;
+            __HI(a) = ha;
+            __HI(b) = hb;
         }
     }
-#endif
-    
-    /* Standard implementation with overflow protection */
-    if (max_val > DBL_MAX / 2.0) {
-        /* Scale down to avoid overflow */
-        double scale = 1.0 / max_val;
-        double scaled_x = x * scale;
-        double scaled_y = y * scale;
-        result = max_val * sqrt(scaled_x * scaled_x + scaled_y * scaled_y);
+    /* medium size a and b */
+    w = a-b;
+    if (w > b) {
+        t1 = 0;
+        __HI(t1) = ha;
+        t2 = a-t1;
+        w = sqrt(t1*t1-(b*(-b)-t2*(a+t1)));
     } else {
-        /* Normal case */
-        result = sqrt(x*x + y*y);
+        a = a+a;
+        y1 = 0;
+        __HI(y1) = hb;
+        y2 = b-y1;
+        t1 = 0;
+        __HI(t1) = ha+0x00100000;
+        t2 = a-t1;
+        w = sqrt(t1*y1-(w*(-w)-(t1*y2+t2*b)));
     }
-    
-    /* Check for overflow */
-    if (result == INFINITY) {
-        errno = ERANGE;
+    if (k != 0) {
+        t1 = 1.0;
+        __HI(t1) += (k<<20);
+        w *= t1;
+        if (k > 0 && w > DBL_MAX) __ma_seterr(ERANGE);
     }
-    
-    return result;
+    return w;
+}
+
+/****** ma.lib/ma_hypot_v ***************************************************
+*
+*   NAME	
+* 	ma_hypot_v -- hypot() and cabs() of arrays. (V1.0)
+*
+*   SYNOPSIS
+*	ma_hypot_v(double *dst, const double *x, const double *y,
+*	            A0           A1                A2
+*	           unsigned long n);
+*	                         D0
+*	void ma_hypot_v(double *dst, const double *x, const double *y,
+*	                unsigned long n);
+*	void ma_cabs_v(double *dst, const complex_t *z, unsigned long n);
+*
+*   FUNCTION
+*	Store hypot(x[i], y[i]), or the modulus of z[i], in dst[i] for n
+*	elements. The results are those of hypot(), scaled by powers of
+*	2 without any division, so they are correct for any exponents.
+*
+*   INPUTS
+*	dst - Array for the results; may be the same as x or y.
+*	x   - First values.
+*	y   - Second values.
+*	z   - Complex values for ma_cabs_v().
+*	n   - Number of elements.
+*
+*   RESULT
+*	None.
+*
+*   EXAMPLE
+*	ma_hypot_v(mag, re, im, count);
+*
+*   NOTES
+*	ma.lib extension. Sets errno to ERANGE if any result overflows.
+*
+*   SEE ALSO
+*	hypot(), cabs(), ma_vnorm(), math.h, complex.h
+*
+******************************************************************************/
+
+void ma_hypot_v(double *dst, const double *x, const double *y, unsigned long n)
+{
+    while (n-- > 0)
+        *dst++ = hypot(*x++, *y++);
+}
+
+void ma_cabs_v(double *dst, const complex_t *z, unsigned long n)
+{
+    for (; n > 0; n--, z++)
+        *dst++ = hypot(z->re, z->im);
 }
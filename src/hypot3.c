@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * double ma_hypot3(double x, double y, double z)
+ * Return sqrt(x*x+y*y+z*z)
+ *
+ * Method :
+ *	As hypot(). With a the largest of |x|, |y| and |z|, all three
+ *	are scaled by 2**-+600 if a lies beyond 2**+-500, or by 2**1022
+ *	if a is subnormal. This is exact and leaves the sum of squares
+ *	far from overflow, and any square small enough to underflow far
+ *	below the last place of the result.
+ *	The square of a is formed exactly by splitting a into t1, its top
+ *	21 bits, and t2 = a-t1, and the two smaller squares, which carry
+ *	less weight, are added to its low part first.
+ */
+
+#include <math.h>
+#include <errno.h>
+#include <float.h>
+#include "include/internal/m99_math.h"
+
+static const double
+two600  = 4.14951556888099295851e+180, /* 2**600 */
+twom600 = 2.40991986510288411774e-181; /* 2**-600 */
+
+/****** ma.lib/ma_hypot3 ****************************************************
+*
+*   NAME	
+* 	ma_hypot3 -- Return Euclidean norm of a 3-vector. (V1.0)
+*
+*   SYNOPSIS
+*	double result = ma_hypot3(double x, double y, double z);
+*	  D0		          D0        D1        D2
+*	double ma_hypot3(double x, double y, double z);
+*
+*   FUNCTION
+*	Compute sqrt(x² + y² + z²), the length of the vector (x, y, z),
+*	without undue overflow or underflow, as hypot() does for two
+*	values. This is the norm3d() of other libraries.
+*
+*   INPUTS
+*	x, y, z - Components of the vector.
+*
+*   RESULT
+*	result - The Euclidean norm. Returns +Infinity if any argument is
+*	        ±Infinity, even if another is NaN, and NaN if any argument
+*	        is NaN otherwise.
+*
+*   EXAMPLE
+*	double len = ma_hypot3(1.0, 2.0, 2.0);
+*
+*   NOTES
+*	ma.lib extension. The error is about 1 ulp. Sets errno to ERANGE
+*	if the result overflows.
+*
+*   SEE ALSO
+*	hypot(), ma_vnorm(), math.h
+*
+******************************************************************************/
+
+double ma_hypot3(double x, double y, double z)
+{
+    double a, b, c, t, t1, t2, w;
+    int hx, hy, hz, ha, k;
+
+    hx = __HI(x)&0x7fffffff;
+    hy = __HI(y)&0x7fffffff;
+    hz = __HI(z)&0x7fffffff;
+    if (hx >= 0x7ff00000 || hy >= 0x7ff00000 || hz >= 0x7ff00000) {
+        /* an infinity wins over a NaN, as in hypot() */
+        if (((hx^0x7ff00000)|__LO(x)) == 0) return fabs(x);
+        if (((hy^0x7ff00000)|__LO(y)) == 0) return fabs(y);
+        if (((hz^0x7ff00000)|__LO(z)) == 0) return fabs(z);
+        return x+y+z;				/* NaN */
+    }
+
+    a = fabs(x);
+    b = fabs(y);
+    c = fabs(z);
+    if (b > a) { t = a; a = b; b = t; }
+    if (c > a) { t = a; a = c; c = t; }
+    if (a == 0.0) return a;
+
+    k = 0;
+    ha = __HI(a);
+    if (ha > 0x5f300000) {			/* a > 2**500 */
+        a *= twom600; b *= twom600; c *= twom600;
+        k = 600;
+    } else if (ha < 0x20b00000) {		/* a < 2**-500 */
+        if (ha <= 0x000fffff) {			/* subnormal */
+            t1 = 0;
+            __HI(t1) = 0x7fd00000;		/* t1 = 2**1022 */
+            k = -1022;
+        } else {
+            t1 = two600;
+            k = -600;
+        }
+        a *= t1; b *= t1; c *= t1;
+    }
+
+    t1 = 0;
+    __HI(t1) = __HI(a);
+    t2 = a-t1;
+    w = sqrt(t1*t1+(t2*(a+t1)+(c*c+b*b)));
+    if (k != 0) {
+        t1 = 1.0;
+        __HI(t1) += (k<<20);
+        w *= t1;
+        if (k > 0 && w > DBL_MAX) __ma_seterr(ERANGE);
+    }
+    return w;
+}
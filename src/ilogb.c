@@ -18,11 +18,7 @@
 
 #include <math.h>
 #include "include/internal/m99_math.h"
-
-/* Helper macros for accessing high/low parts of double */
-/* SAS/C uses big-endian, so high word is first */
-#define __HI(x) *(int*)&x
-#define __LO(x) *(1+(int*)&x)
+#include "include/internal/bits.h"
 
 /****** ma.lib/ilogb ********************************************************
 * 
@@ -71,9 +67,10 @@ int ilogb(double x)
             return 0x80000001;	/* ilogb(0) = 0x80000001 */
         else			/* subnormal x */
             if(hx==0) {
-                for (ix = -1043; lx>0; lx<<=1) ix -=1;
+                ix = -1043 - __ma_clz32(lx);
             } else {
-                for (ix = -1022,hx<<=11; hx>0; hx<<=1) ix -=1;
+                hx <<= 11;
+                ix = -1022 - __ma_clz32(hx);
             }
         return ix;
     }
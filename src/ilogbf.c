@@ -18,6 +18,7 @@
 
 #include <math.h>
 #include "include/internal/m99_math.h"
+#include "include/internal/bits.h"
 
 /****** ma.lib/ilogbf ********************************************************
 * 
@@ -54,10 +55,6 @@
 * 
 ******************************************************************************/
 
-/* Helper macros for accessing high/low parts of float */
-/* SAS/C uses big-endian, so high word is first */
-#define __HI(x) *(int*)&x
-
 int ilogbf(float x)
 {
     int hx, ix;
@@ -66,12 +63,13 @@ int ilogbf(float x)
     if(hx<0x00800000) {
         if(hx==0) 
             return 0x80000001;	/* ilogbf(0) = 0x80000001 */
-        else			/* subnormal x */
-            for (ix = -126; hx>0; hx<<=1) ix -=1;
+        else {			/* subnormal x */
+            hx <<= 8;
+            ix = -126 - __ma_clz32(hx);
+        }
         return ix;
     }
     else if (hx<0x7f800000) return (hx>>23)-127;
     else return 0x7fffffff;
 }
 
-
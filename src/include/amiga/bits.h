@@ -0,0 +1,42 @@
+/*
+ * amiga/bits.h - Bit manipulation for ma.lib
+ *
+ * Copyright (c) 2025 amigazen project
+ * All rights reserved.
+ *
+ * Bit counts, scans, byte swaps, rotates and bit reversal on 32-bit
+ * words and on unsigned_long_long_t, without loops over the bits.
+ */
+
+#ifndef _AMIGA_BITS_H
+#define _AMIGA_BITS_H
+
+#include "internal/longlong.h"
+
+/* Leading and trailing zero bits: 32 or 64 for 0 */
+int ma_clz32(unsigned long x);
+int ma_ctz32(unsigned long x);
+int ma_clz64(unsigned_long_long_t x);
+int ma_ctz64(unsigned_long_long_t x);
+
+/* Number of set bits, and its lowest bit */
+int ma_popcount32(unsigned long x);
+int ma_parity32(unsigned long x);
+int ma_popcount64(unsigned_long_long_t x);
+int ma_parity64(unsigned_long_long_t x);
+
+/* Byte order reversal */
+unsigned long ma_bswap32(unsigned long x);
+unsigned_long_long_t ma_bswap64(unsigned_long_long_t x);
+
+/* Rotates; n is taken modulo the width */
+unsigned long ma_rotl32(unsigned long x, int n);
+unsigned long ma_rotr32(unsigned long x, int n);
+unsigned_long_long_t ma_rotl64(unsigned_long_long_t x, int n);
+unsigned_long_long_t ma_rotr64(unsigned_long_long_t x, int n);
+
+/* Bit order reversal */
+unsigned long ma_bitrev32(unsigned long x);
+unsigned_long_long_t ma_bitrev64(unsigned_long_long_t x);
+
+#endif /* _AMIGA_BITS_H */
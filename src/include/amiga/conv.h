@@ -0,0 +1,31 @@
+/*
+ * amiga/conv.h - Exact decimal conversions for ma.lib
+ *
+ * Copyright (c) 2025 amigazen project
+ * All rights reserved.
+ *
+ * Conversions between doubles and strings that are exact both ways:
+ * ma_dtoa() writes the fewest digits that read back to the same
+ * double, and ma_strtod() reads any string to the nearest double, so
+ * that ma_strtod(ma_dtoa(x)) == x for every finite x.
+ */
+
+#ifndef _AMIGA_CONV_H
+#define _AMIGA_CONV_H
+
+/* Room for any result of ma_dtoa() or ma_dtoa_hex(), with the NUL */
+#define MA_DTOA_BUFSIZE    32
+
+/* Shortest decimal form, as "0.1", "1e+100" or "-2.5e-07" */
+int ma_dtoa(double x, char *buf);
+
+/* The shortest digits alone: |x| is digits*10**exp10 */
+int ma_dtoa_digits(double x, char *digits, int *exp10);
+
+/* Exact hexadecimal form, as "0x1.8p+1" */
+int ma_dtoa_hex(double x, char *buf);
+
+/* Correctly rounded decimal or hexadecimal input */
+double ma_strtod(const char *s, char **endptr);
+
+#endif /* _AMIGA_CONV_H */
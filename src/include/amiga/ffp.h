@@ -0,0 +1,47 @@
+/*
+ * amiga/ffp.h - Motorola Fast Floating Point support for ma.lib
+ *
+ * Copyright (c) 2025 amigazen project
+ * All rights reserved.
+ *
+ * Conversions between Motorola FFP and IEEE 754, and a portable
+ * integer implementation of the basic FFP operations. None of these
+ * need mathffp.library, so FFP data can be handled on any host.
+ */
+
+#ifndef _AMIGA_FFP_H
+#define _AMIGA_FFP_H
+
+/*
+ * An FFP value is a 32-bit word: a 24-bit normalised mantissa in bits
+ * 31-8, the sign in bit 7 and an excess-64 exponent in bits 6-0. The
+ * value is (mantissa / 2**24) * 2**(exponent - 64); zero is all zeros.
+ */
+typedef unsigned long ma_ffp;
+
+#define MA_FFP_ZERO        0x00000000UL
+#define MA_FFP_ONE         0x80000041UL
+#define MA_FFP_MAX         0xFFFFFF7FUL    /* 9.22337e18 */
+#define MA_FFP_MIN         0x80000000UL    /* 2.71051e-20, smallest non-zero */
+
+/* Scalar conversions */
+ma_ffp ma_ffp_from_float(float x);
+ma_ffp ma_ffp_from_double(double x);
+float ma_ffp_to_float(ma_ffp x);
+double ma_ffp_to_double(ma_ffp x);
+
+/* Bulk conversions; the single-precision ones may work in place */
+void ma_ieee_to_ffp_v(ma_ffp *dst, const float *src, unsigned long n);
+void ma_ffp_to_ieee_v(float *dst, const ma_ffp *src, unsigned long n);
+void ma_ieeedp_to_ffp_v(ma_ffp *dst, const double *src, unsigned long n);
+void ma_ffp_to_ieeedp_v(double *dst, const ma_ffp *src, unsigned long n);
+
+/* Arithmetic, rounded to nearest; overflow saturates to +-MA_FFP_MAX */
+ma_ffp ma_ffp_add(ma_ffp a, ma_ffp b);
+ma_ffp ma_ffp_sub(ma_ffp a, ma_ffp b);
+ma_ffp ma_ffp_mul(ma_ffp a, ma_ffp b);
+ma_ffp ma_ffp_div(ma_ffp a, ma_ffp b);
+ma_ffp ma_ffp_neg(ma_ffp a);
+int ma_ffp_cmp(ma_ffp a, ma_ffp b);
+
+#endif /* _AMIGA_FFP_H */
@@ -0,0 +1,69 @@
+/*
+ * amiga/fixed.h - Fixed-point math for ma.lib
+ *
+ * Copyright (c) 2025 amigazen project
+ * All rights reserved.
+ *
+ * Integer-only fixed-point arithmetic and elementary functions for
+ * machines without an FPU. Nothing here calls the floating-point
+ * library except the conversions to and from double and float.
+ */
+
+#ifndef _AMIGA_FIXED_H
+#define _AMIGA_FIXED_H
+
+/* Fixed-point formats */
+typedef long ma_q16;    /* Q16.16: sign, 15 integer bits, 16 fraction bits */
+typedef long ma_q30;    /* Q1.30: sign, 1 integer bit, 30 fraction bits */
+
+#define MA_Q16_ONE         0x00010000L
+#define MA_Q16_HALF        0x00008000L
+#define MA_Q16_PI          0x0003243FL     /* 3.14159 */
+#define MA_Q16_MAX         0x7FFFFFFFL
+#define MA_Q16_MIN         (-0x7FFFFFFFL-1)
+
+#define MA_Q30_ONE         0x40000000L
+#define MA_Q30_HALF        0x20000000L
+#define MA_Q30_MAX         0x7FFFFFFFL
+#define MA_Q30_MIN         (-0x7FFFFFFFL-1)
+
+/* Integer <-> fixed-point (no rounding or saturation) */
+#define MA_Q16_FROM_INT(i) ((ma_q16)(i) << 16)
+#define MA_Q16_TO_INT(x)   ((long)(x) >> 16)
+
+/* Conversions, rounded to nearest and saturating */
+ma_q16 ma_q16_from_double(double x);
+double ma_q16_to_double(ma_q16 x);
+ma_q16 ma_q16_from_float(float x);
+float ma_q16_to_float(ma_q16 x);
+ma_q30 ma_q30_from_double(double x);
+double ma_q30_to_double(ma_q30 x);
+ma_q30 ma_q30_from_float(float x);
+float ma_q30_to_float(ma_q30 x);
+
+/* Arithmetic, rounded to nearest and saturating */
+ma_q16 ma_q16_mul(ma_q16 a, ma_q16 b);
+ma_q16 ma_q16_div(ma_q16 a, ma_q16 b);
+ma_q30 ma_q30_mul(ma_q30 a, ma_q30 b);
+
+/* Q16.16 functions; angles in radians */
+ma_q16 ma_q16_sin(ma_q16 a);
+ma_q16 ma_q16_cos(ma_q16 a);
+void ma_q16_sincos(ma_q16 a, ma_q16 *s, ma_q16 *c);
+ma_q16 ma_q16_atan2(ma_q16 y, ma_q16 x);
+ma_q16 ma_q16_hypot(ma_q16 x, ma_q16 y);
+ma_q16 ma_q16_sqrt(ma_q16 x);
+ma_q16 ma_q16_exp2(ma_q16 x);
+ma_q16 ma_q16_log2(ma_q16 x);
+
+/* Q1.30 functions; angles in half turns (a * pi radians) */
+ma_q30 ma_q30_sinpi(ma_q30 a);
+ma_q30 ma_q30_cospi(ma_q30 a);
+void ma_q30_sincospi(ma_q30 a, ma_q30 *s, ma_q30 *c);
+ma_q30 ma_q30_atan2pi(ma_q30 y, ma_q30 x);
+ma_q30 ma_q30_hypot(ma_q30 x, ma_q30 y);
+ma_q30 ma_q30_sqrt(ma_q30 x);
+ma_q30 ma_q30_exp2(ma_q30 x);
+ma_q30 ma_q30_log2(ma_q30 x);
+
+#endif /* _AMIGA_FIXED_H */
@@ -0,0 +1,43 @@
+/*
+ * amiga/intmath.h - Exact integer math for ma.lib
+ *
+ * Copyright (c) 2025 amigazen project
+ * All rights reserved.
+ *
+ * Roots, logarithms, gcd and modular arithmetic on 32-bit values and
+ * unsigned_long_long_t, exact over the whole range and without any
+ * floating point.
+ */
+
+#ifndef _AMIGA_INTMATH_H
+#define _AMIGA_INTMATH_H
+
+#include "internal/longlong.h"
+
+/* floor(sqrt(x)) and floor(cbrt(x)) */
+unsigned long ma_isqrt32(unsigned long x);
+unsigned long ma_icbrt32(unsigned long x);
+unsigned long ma_isqrt64(unsigned_long_long_t x);
+unsigned long ma_icbrt64(unsigned_long_long_t x);
+
+/* floor(log2(x)) and floor(log10(x)), or -1 for 0 */
+int ma_ilog2_32(unsigned long x);
+int ma_ilog10_32(unsigned long x);
+int ma_ilog2_64(unsigned_long_long_t x);
+int ma_ilog10_64(unsigned_long_long_t x);
+
+/* Greatest common divisor and least common multiple */
+unsigned long ma_gcd32(unsigned long a, unsigned long b);
+unsigned long ma_lcm32(unsigned long a, unsigned long b);
+unsigned_long_long_t ma_gcd64(unsigned_long_long_t a, unsigned_long_long_t b);
+unsigned_long_long_t ma_lcm64(unsigned_long_long_t a, unsigned_long_long_t b);
+
+/* a*b mod m and b**e mod m, for any m != 0 */
+unsigned long ma_mulmod32(unsigned long a, unsigned long b, unsigned long m);
+unsigned long ma_powmod32(unsigned long b, unsigned long e, unsigned long m);
+unsigned_long_long_t ma_mulmod64(unsigned_long_long_t a, unsigned_long_long_t b,
+                                 unsigned_long_long_t m);
+unsigned_long_long_t ma_powmod64(unsigned_long_long_t b, unsigned_long_long_t e,
+                                 unsigned_long_long_t m);
+
+#endif /* _AMIGA_INTMATH_H */
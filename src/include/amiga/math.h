@@ -77,6 +77,56 @@ const char *m99_get_error_string(m99_math_error_t error);
 /* Clear error state */
 void m99_clear_error(void);
 
+/* Reentrant math context
+ *
+ * A ma_ctx holds the state that would otherwise be global to ma.lib.
+ * Each task may install its own context with ma_ctx_install(); tasks
+ * that never do so share the library default context.
+ */
+
+/* Accuracy modes */
+#define MA_ACC_DEFAULT     0       /* Library default paths */
+#define MA_ACC_FAST        1       /* Prefer speed where a choice exists */
+#define MA_ACC_STRICT      2       /* Prefer accuracy where a choice exists */
+
+/* Sticky exception flags */
+#define MA_FE_INVALID      0x01
+#define MA_FE_DIVBYZERO    0x02
+#define MA_FE_OVERFLOW     0x04
+#define MA_FE_UNDERFLOW    0x08
+#define MA_FE_INEXACT      0x10
+#define MA_FE_ALL_EXCEPT   0x1f
+
+typedef struct ma_ctx {
+    m99_math_error_t error;         /* Last error recorded */
+    unsigned long except;           /* Sticky MA_FE_* flags */
+    m99_math_type_t math_type;      /* Backend selection */
+    int optimization;               /* M99_OPT_* flags */
+    int accuracy;                   /* MA_ACC_* mode */
+    int signgam;                    /* Sign of the last gamma result */
+
+    /* Last trig argument reduction, reused by sin/cos/tan (see sin.c) */
+    int pio2_memo;                  /* Nonzero to keep the memo */
+    unsigned long pio2_key[2];      /* Bits of the last reduced argument */
+    double pio2_y[2];               /* Its reduction, head and tail */
+    int pio2_n;                     /* Its quadrant */
+    unsigned long pio2_hits;        /* Reductions answered from the memo */
+    unsigned long pio2_misses;      /* Reductions computed */
+} ma_ctx;
+
+/* Context management */
+void ma_ctx_init(ma_ctx *ctx);
+int ma_ctx_install(ma_ctx *ctx, ma_ctx **previous);
+ma_ctx *ma_ctx_current(void);
+
+/* Exception flags */
+int ma_ctx_testexcept(const ma_ctx *ctx, unsigned long excepts);
+void ma_ctx_clearexcept(ma_ctx *ctx, unsigned long excepts);
+
+/* Context-taking entry points */
+double ma_lgamma_r(ma_ctx *ctx, double x);
+double ma_tgamma_r(ma_ctx *ctx, double x);
+
 /* Math function wrappers that use AmigaOS libraries */
 double amiga_acos(double x);
 double amiga_asin(double x);
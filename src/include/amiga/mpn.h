@@ -0,0 +1,54 @@
+/*
+ * amiga/mpn.h - Multi-precision natural numbers for ma.lib
+ *
+ * Copyright (c) 2025 amigazen project
+ * All rights reserved.
+ *
+ * Arithmetic on unsigned numbers held as arrays of 32-bit limbs,
+ * least significant limb first, in storage supplied by the caller.
+ * Nothing here allocates memory. Sizes are limb counts and must be
+ * at least 1 unless noted.
+ */
+
+#ifndef _AMIGA_MPN_H
+#define _AMIGA_MPN_H
+
+#include "internal/longlong.h"
+
+/* Scratch limbs ma_mpn_mul() needs for Karatsuba when bn limbs is the shorter operand */
+#define MA_MPN_MUL_TMP(bn)    (8*(bn) + 256)
+
+/* r = a+b and r = a-b; return the carry or borrow. r may be a; an >= bn >= 0 */
+unsigned long ma_mpn_add_n(unsigned long *r, const unsigned long *a,
+                           const unsigned long *b, int n);
+unsigned long ma_mpn_sub_n(unsigned long *r, const unsigned long *a,
+                           const unsigned long *b, int n);
+unsigned long ma_mpn_add(unsigned long *r, const unsigned long *a, int an,
+                         const unsigned long *b, int bn);
+unsigned long ma_mpn_sub(unsigned long *r, const unsigned long *a, int an,
+                         const unsigned long *b, int bn);
+
+/* <0, 0 or >0 as a <, = or > b */
+int ma_mpn_cmp(const unsigned long *a, const unsigned long *b, int n);
+
+/* r = a*m and r += a*m; return the limb carried out */
+unsigned long ma_mpn_mul_1(unsigned long *r, const unsigned long *a, int n,
+                           unsigned long m);
+unsigned long ma_mpn_addmul_1(unsigned long *r, const unsigned long *a, int n,
+                              unsigned long m);
+
+/* r[an+bn] = a*b, an >= bn; tmp is NULL or MA_MPN_MUL_TMP(bn) limbs */
+void ma_mpn_mul(unsigned long *r, const unsigned long *a, int an,
+                const unsigned long *b, int bn, unsigned long *tmp);
+
+/* q = a/d; returns a mod d. q may be a */
+unsigned long ma_mpn_divrem_1(unsigned long *q, const unsigned long *a, int n,
+                              unsigned long d);
+
+/* Full and high products of single words */
+void ma_umul64x128(unsigned_long_long_t a, unsigned_long_long_t b,
+                   unsigned_long_long_t *hi, unsigned_long_long_t *lo);
+unsigned_long_long_t ma_mulhi64(unsigned_long_long_t a, unsigned_long_long_t b);
+unsigned long ma_mulhi32(unsigned long a, unsigned long b);
+
+#endif /* _AMIGA_MPN_H */
@@ -0,0 +1,38 @@
+/*
+ * amiga/reduce.h - Array reductions for ma.lib
+ *
+ * Copyright (c) 2025 amigazen project
+ * All rights reserved.
+ *
+ * Minimum, maximum, dot product and sum of squares of double and
+ * float arrays in one call, rather than one fmin() or fmax() call per
+ * element. NaNs are treated as missing data, as fmin() and fmax() do.
+ */
+
+#ifndef _AMIGA_REDUCE_H
+#define _AMIGA_REDUCE_H
+
+/* Extremes, ignoring NaNs; NaN only if every element is a NaN */
+double ma_vmin(const double *x, unsigned long n);
+double ma_vmax(const double *x, unsigned long n);
+long ma_vargmin(const double *x, unsigned long n);
+long ma_vargmax(const double *x, unsigned long n);
+void ma_vminmax(const double *x, unsigned long n, double *min, double *max);
+
+float ma_vminf(const float *x, unsigned long n);
+float ma_vmaxf(const float *x, unsigned long n);
+long ma_vargminf(const float *x, unsigned long n);
+long ma_vargmaxf(const float *x, unsigned long n);
+void ma_vminmaxf(const float *x, unsigned long n, float *min, float *max);
+
+/* Dot product, sum of squares and Euclidean norm */
+double ma_vdot(const double *x, const double *y, unsigned long n);
+double ma_vsumsq(const double *x, unsigned long n, double *scale);
+double ma_vnorm(const double *x, unsigned long n);
+
+/* The float forms accumulate in double and cannot overflow */
+double ma_vdotf(const float *x, const float *y, unsigned long n);
+double ma_vsumsqf(const float *x, unsigned long n);
+float ma_vnormf(const float *x, unsigned long n);
+
+#endif /* _AMIGA_REDUCE_H */
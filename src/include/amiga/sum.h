@@ -0,0 +1,40 @@
+/*
+ * amiga/sum.h - Exact and reproducible summation for ma.lib
+ *
+ * Copyright (c) 2025 amigazen project
+ * All rights reserved.
+ *
+ * Sums of double arrays that are correctly rounded, and so do not
+ * depend on the order of the terms or on how the work was split
+ * between tasks.
+ */
+
+#ifndef _AMIGA_SUM_H
+#define _AMIGA_SUM_H
+
+/*
+ * A ma_sumacc holds a running sum exactly, as a fixed-point number
+ * wide enough for every double: 24-bit digits in longs, so that the
+ * carries can wait for over a hundred additions. Accumulators filled
+ * by separate tasks can be merged, and the result does not depend on
+ * how the terms were shared out.
+ */
+#define MA_SUMACC_LIMBS    90
+
+typedef struct ma_sumacc {
+    long limb[MA_SUMACC_LIMBS];     /* Digits, least significant first */
+    unsigned long pending;          /* Additions since the last carry pass */
+    double special;                 /* Sum of the infinities and NaNs seen */
+} ma_sumacc;
+
+/* Correctly rounded sum of an array */
+double ma_fsum(const double *x, unsigned long n);
+
+/* Exact accumulator */
+void ma_sumacc_init(ma_sumacc *acc);
+void ma_sumacc_add(ma_sumacc *acc, double x);
+void ma_sumacc_addv(ma_sumacc *acc, const double *x, unsigned long n);
+void ma_sumacc_merge(ma_sumacc *acc, const ma_sumacc *other);
+double ma_sumacc_result(ma_sumacc *acc);
+
+#endif /* _AMIGA_SUM_H */
@@ -0,0 +1,680 @@
+/*
+ * amiga/tmath.h - Inline C++ kernels for ma.lib
+ *
+ * Copyright (c) 2025 amigazen project
+ * All rights reserved.
+ *
+ * The sin, cos and exp kernels of ma.lib as inline C++, templated on
+ * precision and accuracy tier, so that a loop calling them compiles
+ * to straight-line code with no call, no argument passing and the
+ * coefficients folded into immediates. Only arguments beyond
+ * 2**19*pi/2 leave the inline code, for the out-of-line reduction.
+ *
+ *	ma_kernel<T, Tier>::sin(x), ::cos(x), ::exp(x), ::sincos(x, &s, &c)
+ *	ma::sin(x), ma::cos(x), ma::exp(x), ma::sincos(x, &s, &c)
+ *	ma_complex<T>, ma::exp(z)
+ *
+ * T is float or double. Tier is ma_exact or ma_fast:
+ *
+ *	ma_kernel<double, ma_exact> is sin(), cos() and exp() bit for
+ *	bit, and ma_kernel<float, ma_exact> is the same rounded to float,
+ *	as (float)sin(x) gives.
+ *
+ *	ma_kernel<double, ma_fast> makes one step of the reduction by
+ *	pi/2 where sin() may make three. Below 3pi/4 it is sin() and
+ *	cos(); beyond, results can be a few ulp off, and close to a
+ *	multiple of pi/2 most of the bits of a result near zero are
+ *	lost. exp() has nothing to give up and is the same in both tiers.
+ *
+ *	ma_kernel<float, ma_fast> works in float throughout, with the
+ *	kernels csinf() and cexpf() use (kernelf.c), and gives their
+ *	results bit for bit. Float arithmetic is cheaper than double in
+ *	the software floating point of ma.lib and maieee.lib.
+ *
+ * ma:: is the exact tier, except that ma::exp() of a ma_complex<float>
+ * is cexpf(). ma_complex<T> has the layout of complex_t and
+ * float_complex.
+ *
+ * The results match the library only when the program is compiled
+ * with the same floating point options as ma.lib was (MATH=, and no
+ * fused multiply-add). The header is written to the C++ of SAS/C 6,
+ * which has templates but no namespaces, so ma is a class.
+ */
+
+#ifndef _AMIGA_TMATH_H
+#define _AMIGA_TMATH_H
+
+#ifndef __cplusplus
+#error amiga/tmath.h is a C++ header
+#endif
+
+extern "C" {
+int __ieee754_rem_pio2(double x, double *y);
+}
+
+/* An explicit specialization takes template<> in ISO C++, not in SAS/C */
+#ifdef __SASC
+#define __MA_SPECIAL
+#else
+#define __MA_SPECIAL template<>
+#endif
+
+#ifdef __GNUC__
+#define __MA_INLINE inline __attribute__((__always_inline__))
+#else
+#define __MA_INLINE inline
+#endif
+
+/* Word order of a double: big-endian on the 68k */
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define __MA_HW 1
+#else
+#define __MA_HW 0
+#endif
+
+class ma_exact {};
+class ma_fast {};
+
+/*
+ * Bit access, as __HI() and __LO() in the C kernels
+ */
+class __ma_bits {
+public:
+    static __MA_INLINE int hi(double x)
+    {
+        union { double d; int w[2]; } u;
+        u.d = x;
+        return u.w[__MA_HW];
+    }
+    static __MA_INLINE int lo(double x)
+    {
+        union { double d; int w[2]; } u;
+        u.d = x;
+        return u.w[1-__MA_HW];
+    }
+    static __MA_INLINE double make(int hi, int lo)
+    {
+        union { double d; int w[2]; } u;
+        u.w[__MA_HW] = hi;
+        u.w[1-__MA_HW] = lo;
+        return u.d;
+    }
+    static __MA_INLINE double addexp(double x, int k)
+    {
+        union { double d; int w[2]; } u;
+        u.d = x;
+        u.w[__MA_HW] += k << 20;
+        return u.d;
+    }
+    static __MA_INLINE int word(float x)
+    {
+        union { float f; int w; } u;
+        u.f = x;
+        return u.w;
+    }
+    static __MA_INLINE float addexp(float x, int k)
+    {
+        union { float f; int w; } u;
+        u.f = x;
+        u.w += k << 23;
+        return u.f;
+    }
+};
+
+/*
+ * c[0] + z*(c[1] + z*(... + z*c[N-1])), unrolled when it is compiled
+ */
+template <class T, int N>
+class __ma_poly {
+public:
+    static __MA_INLINE T eval(const T *c, T z)
+    {
+        return c[0] + z*__ma_poly<T, N-1>::eval(c+1, z);
+    }
+};
+
+__MA_SPECIAL class __ma_poly<double, 1> {
+public:
+    static __MA_INLINE double eval(const double *c, double) { return c[0]; }
+};
+
+__MA_SPECIAL class __ma_poly<float, 1> {
+public:
+    static __MA_INLINE float eval(const float *c, float) { return c[0]; }
+};
+
+/* sin.c */
+static const double __ma_tm_S[] = {
+    -1.66666666666666324348e-01,        /* 0xBFC55555, 0x55555549 */
+     8.33333333332248946124e-03,        /* 0x3F811111, 0x1110F8A6 */
+    -1.98412698298579493134e-04,        /* 0xBF2A01A0, 0x19C161D5 */
+     2.75573137070700676789e-06,        /* 0x3EC71DE3, 0x57B1FE7D */
+    -2.50507602534068634195e-08,        /* 0xBE5AE5E6, 0x8A2B9CEB */
+     1.58969099521155010221e-10,        /* 0x3DE5D93A, 0x5ACFD57C */
+};
+
+static const double __ma_tm_C[] = {
+     4.16666666666666019037e-02,        /* 0x3FA55555, 0x5555554C */
+    -1.38888888888741095749e-03,        /* 0xBF56C16C, 0x16C15177 */
+     2.48015872894767294178e-05,        /* 0x3EFA01A0, 0x19CB1590 */
+    -2.75573143513906633035e-07,        /* 0xBE927E4F, 0x809C52AD */
+     2.08757232129817482790e-09,        /* 0x3E21EE9E, 0xBDB4B1C4 */
+    -1.13596475577881948265e-11,        /* 0xBDA8FAE9, 0xBE8838D4 */
+};
+
+static const double __ma_tm_pio2[] = {
+     6.36619772367581382433e-01,        /* invpio2 0x3FE45F30, 0x6DC9C883 */
+     1.57079632673412561417e+00,        /* pio2_1  0x3FF921FB, 0x54400000 */
+     6.07710050650619224932e-11,        /* pio2_1t 0x3DD0B461, 0x1A626331 */
+     6.07710050630396597660e-11,        /* pio2_2  0x3DD0B461, 0x1A600000 */
+     2.02226624879595063154e-21,        /* pio2_2t 0x3BA3198A, 0x2E037073 */
+     2.02226624871116645580e-21,        /* pio2_3  0x3BA3198A, 0x2E000000 */
+     8.47842766036889956997e-32,        /* pio2_3t 0x397B839A, 0x252049C1 */
+};
+
+static const int __ma_tm_npio2_hw[] = {
+    0x3FF921FB, 0x400921FB, 0x4012D97C, 0x401921FB, 0x401F6A7A, 0x4022D97C,
+    0x4025FDBB, 0x402921FB, 0x402C463A, 0x402F6A7A, 0x4031475C, 0x4032D97C,
+    0x40346B9C, 0x4035FDBB, 0x40378FDB, 0x403921FB, 0x403AB41B, 0x403C463A,
+    0x403DD85A, 0x403F6A7A, 0x40407E4C, 0x4041475C, 0x4042106C, 0x4042D97C,
+    0x4043A28C, 0x40446B9C, 0x404534AC, 0x4045FDBB, 0x4046C6CB, 0x40478FDB,
+    0x404858EB, 0x404921FB,
+};
+
+/* exp.c */
+static const double __ma_tm_P[] = {
+     1.66666666666666019037e-01,        /* 0x3FC55555, 0x5555553E */
+    -2.77777777770155933842e-03,        /* 0xBF66C16C, 0x16BEBD93 */
+     6.61375632143793436117e-05,        /* 0x3F11566A, 0xAF25DE2C */
+    -1.65339022054652515390e-06,        /* 0xBEBBBD41, 0xC5D26BF1 */
+     4.13813679705723846039e-08,        /* 0x3E663769, 0x72BEA4D0 */
+};
+
+static const double __ma_tm_ln2[] = {
+     6.93147180369123816490e-01,        /* ln2HI 0x3fe62e42, 0xfee00000 */
+    -6.93147180369123816490e-01,
+     1.90821492927058770002e-10,        /* ln2LO 0x3dea39ef, 0x35793c76 */
+    -1.90821492927058770002e-10,
+};
+
+/* kernelf.c */
+static const float __ma_tm_Sf[] = {
+    -1.6666667163e-01f, 8.3333337680e-03f, -1.9841270114e-04f,
+     2.7557319973e-06f, -2.5052108385e-08f,
+};
+
+static const float __ma_tm_Cf[] = {
+     4.1666667908e-02f, -1.3888889225e-03f, 2.4801587642e-05f,
+    -2.7557319223e-07f, 2.0876756588e-09f,
+};
+
+static const float __ma_tm_Pf[] = {
+     1.6666667163e-01f, -2.7777778450e-03f, 6.6137559770e-05f,
+    -1.6533901999e-06f, 4.1381369442e-08f,
+};
+
+static const float __ma_tm_ln2f[] = {
+     6.9314575195e-01f, -6.9314575195e-01f,     /* ln2HI */
+     1.4286067653e-06f, -1.4286067653e-06f,     /* ln2LO */
+};
+
+template <class T, class Tier> class ma_kernel;
+
+/*
+ * Double, as sin.c, cos.c and exp.c
+ */
+__MA_SPECIAL class ma_kernel<double, ma_exact> {
+public:
+    static __MA_INLINE double ksin(double x, double y, int iy)
+    {
+        double z, r, v;
+
+        if ((__ma_bits::hi(x)&0x7fffffff) < 0x3e400000)   /* |x| < 2**-27 */
+            if ((int)x == 0) return x;                  /* inexact */
+        z = x*x;
+        v = z*x;
+        r = __ma_poly<double, 5>::eval(__ma_tm_S+1, z);
+        if (iy == 0) return x+v*(__ma_tm_S[0]+z*r);
+        return x-((z*(0.5*y-v*r)-y)-v*__ma_tm_S[0]);
+    }
+
+    static __MA_INLINE double kcos(double x, double y)
+    {
+        double hz, z, r, qx;
+        int ix;
+
+        ix = __ma_bits::hi(x)&0x7fffffff;
+        if (ix < 0x3e400000)
+            if ((int)x == 0) return 1.0;
+        z = x*x;
+        r = z*__ma_poly<double, 6>::eval(__ma_tm_C, z);
+        if (ix < 0x3FD33333)                            /* |x| < 0.3 */
+            return 1.0-(0.5*z-(z*r-x*y));
+        if (ix > 0x3fe90000) qx = 0.28125;
+        else qx = __ma_bits::make(ix-0x00200000, 0);    /* x/4 */
+        hz = 0.5*z-qx;
+        return (1.0-qx)-(hz-(z*r-x*y));
+    }
+
+    /* x = n*pi/2 + y[0] + y[1], for finite x; as rem_pio2() */
+    static __MA_INLINE int rem_pio2(double x, double *y, int steps)
+    {
+        double z, w, t, r, fn;
+        int i, j, n, hx, ix;
+
+        hx = __ma_bits::hi(x);
+        ix = hx&0x7fffffff;
+        if (ix <= 0x3fe921fb) {         /* |x| ~<= pi/4 */
+            y[0] = x;
+            y[1] = 0.0;
+            return 0;
+        }
+        if (ix < 0x4002d97c) {          /* |x| < 3pi/4, n = +-1 */
+            if (hx > 0) {
+                z = x-__ma_tm_pio2[1];
+                if (ix != 0x3ff921fb) {
+                    y[0] = z-__ma_tm_pio2[2];
+                    y[1] = (z-y[0])-__ma_tm_pio2[2];
+                } else {
+                    z -= __ma_tm_pio2[3];
+                    y[0] = z-__ma_tm_pio2[4];
+                    y[1] = (z-y[0])-__ma_tm_pio2[4];
+                }
+                return 1;
+            }
+            z = x+__ma_tm_pio2[1];
+            if (ix != 0x3ff921fb) {
+                y[0] = z+__ma_tm_pio2[2];
+                y[1] = (z-y[0])+__ma_tm_pio2[2];
+            } else {
+                z += __ma_tm_pio2[3];
+                y[0] = z+__ma_tm_pio2[4];
+                y[1] = (z-y[0])+__ma_tm_pio2[4];
+            }
+            return -1;
+        }
+        if (ix > 0x413921fb)            /* |x| > 2**19*(pi/2) */
+            return __ieee754_rem_pio2(x, y);
+        t = (hx < 0) ? -x : x;
+        n = (int)(t*__ma_tm_pio2[0]+0.5);
+        fn = (double)n;
+        r = t-fn*__ma_tm_pio2[1];
+        w = fn*__ma_tm_pio2[2];
+        y[0] = r-w;
+        if (steps > 1 && (n >= 32 || ix == __ma_tm_npio2_hw[n-1])) {
+            j = ix>>20;
+            i = j-((__ma_bits::hi(y[0])>>20)&0x7ff);
+            if (i > 16) {
+                t = r;
+                w = fn*__ma_tm_pio2[3];
+                r = t-w;
+                w = fn*__ma_tm_pio2[4]-((t-r)-w);
+                y[0] = r-w;
+                i = j-((__ma_bits::hi(y[0])>>20)&0x7ff);
+                if (i > 49) {
+                    t = r;
+                    w = fn*__ma_tm_pio2[5];
+                    r = t-w;
+                    w = fn*__ma_tm_pio2[6]-((t-r)-w);
+                    y[0] = r-w;
+                }
+            }
+        }
+        y[1] = (r-y[0])-w;
+        if (hx < 0) { y[0] = -y[0]; y[1] = -y[1]; return -n; }
+        return n;
+    }
+
+    static __MA_INLINE double sin_r(double x, int steps)
+    {
+        double y[2];
+        int ix;
+
+        ix = __ma_bits::hi(x)&0x7fffffff;
+        if (ix <= 0x3fe921fb) return ksin(x, 0.0, 0);
+        if (ix >= 0x7ff00000) return x-x;
+        switch (rem_pio2(x, y, steps)&3) {
+            case 0: return  ksin(y[0], y[1], 1);
+            case 1: return  kcos(y[0], y[1]);
+            case 2: return -ksin(y[0], y[1], 1);
+            default: return -kcos(y[0], y[1]);
+        }
+    }
+
+    static __MA_INLINE double cos_r(double x, int steps)
+    {
+        double y[2];
+        int ix;
+
+        ix = __ma_bits::hi(x)&0x7fffffff;
+        if (ix <= 0x3fe921fb) return kcos(x, 0.0);
+        if (ix >= 0x7ff00000) return x-x;
+        switch (rem_pio2(x, y, steps)&3) {
+            case 0: return  kcos(y[0], y[1]);
+            case 1: return -ksin(y[0], y[1], 1);
+            case 2: return -kcos(y[0], y[1]);
+            default: return  ksin(y[0], y[1], 1);
+        }
+    }
+
+    static __MA_INLINE void sincos_r(double x, double *s, double *c, int steps)
+    {
+        double y[2], ks, kc;
+        int ix;
+
+        ix = __ma_bits::hi(x)&0x7fffffff;
+        if (ix <= 0x3fe921fb) {
+            *s = ksin(x, 0.0, 0);
+            *c = kcos(x, 0.0);
+            return;
+        }
+        if (ix >= 0x7ff00000) { *s = *c = x-x; return; }
+        ix = rem_pio2(x, y, steps);
+        ks = ksin(y[0], y[1], 1);
+        kc = kcos(y[0], y[1]);
+        switch (ix&3) {
+            case 0: *s =  ks; *c =  kc; break;
+            case 1: *s =  kc; *c = -ks; break;
+            case 2: *s = -ks; *c = -kc; break;
+            default: *s = -kc; *c =  ks; break;
+        }
+    }
+
+    static __MA_INLINE double sin(double x) { return sin_r(x, 3); }
+    static __MA_INLINE double cos(double x) { return cos_r(x, 3); }
+    static __MA_INLINE void sincos(double x, double *s, double *c)
+    {
+        sincos_r(x, s, c, 3);
+    }
+
+    static __MA_INLINE double exp(double x)
+    {
+        double y, hi, lo, c, t;
+        int k, xsb;
+        unsigned int hx;
+
+        hx = (unsigned int)__ma_bits::hi(x);
+        xsb = (hx>>31)&1;
+        hx &= 0x7fffffff;
+        if (hx >= 0x40862E42) {                         /* |x| >= 709.78 */
+            if (hx >= 0x7ff00000) {
+                if (((hx&0xfffff)|__ma_bits::lo(x)) != 0) return x+x;
+                return (xsb == 0) ? x : 0.0;
+            }
+            if (x > 7.09782712893383973096e+02) return 1.0e+300*1.0e+300;
+            if (x < -7.45133219101941108420e+02)
+                return 9.33263618503218878990e-302*9.33263618503218878990e-302;
+        }
+        k = 0;
+        hi = lo = 0.0;
+        if (hx > 0x3fd62e42) {                          /* |x| > 0.5 ln2 */
+            if (hx < 0x3FF0A2B2) {                      /* |x| < 1.5 ln2 */
+                hi = x-__ma_tm_ln2[xsb];
+                lo = __ma_tm_ln2[2+xsb];
+                k = 1-xsb-xsb;
+            } else {
+                k = (int)(1.44269504088896338700e+00*x+(xsb ? -0.5 : 0.5));
+                t = k;
+                hi = x-t*__ma_tm_ln2[0];
+                lo = t*__ma_tm_ln2[2];
+            }
+            x = hi-lo;
+        } else if (hx < 0x3e300000) {                   /* |x| < 2**-28 */
+            if (1.0e+300+x > 1.0) return 1.0+x;
+        }
+        t = x*x;
+        c = x-t*__ma_poly<double, 5>::eval(__ma_tm_P, t);
+        if (k == 0) return 1.0-((x*c)/(c-2.0)-x);
+        y = 1.0-((lo-(x*c)/(2.0-c))-hi);
+        if (k >= -1021) return __ma_bits::addexp(y, k);
+        return __ma_bits::addexp(y, k+1000)*9.33263618503218878990e-302;
+    }
+
+    static __MA_INLINE double exp_max() { return 709.0; }
+};
+
+__MA_SPECIAL class ma_kernel<double, ma_fast> {
+public:
+    static __MA_INLINE double sin(double x)
+    {
+        return ma_kernel<double, ma_exact>::sin_r(x, 1);
+    }
+    static __MA_INLINE double cos(double x)
+    {
+        return ma_kernel<double, ma_exact>::cos_r(x, 1);
+    }
+    static __MA_INLINE void sincos(double x, double *s, double *c)
+    {
+        ma_kernel<double, ma_exact>::sincos_r(x, s, c, 1);
+    }
+    static __MA_INLINE double exp(double x)
+    {
+        return ma_kernel<double, ma_exact>::exp(x);
+    }
+    static __MA_INLINE double exp_max() { return 709.0; }
+};
+
+/*
+ * Float rounded from double
+ */
+__MA_SPECIAL class ma_kernel<float, ma_exact> {
+public:
+    static __MA_INLINE float sin(float x)
+    {
+        return (float)ma_kernel<double, ma_exact>::sin(x);
+    }
+    static __MA_INLINE float cos(float x)
+    {
+        return (float)ma_kernel<double, ma_exact>::cos(x);
+    }
+    static __MA_INLINE void sincos(float x, float *s, float *c)
+    {
+        double ds, dc;
+
+        ma_kernel<double, ma_exact>::sincos(x, &ds, &dc);
+        *s = (float)ds;
+        *c = (float)dc;
+    }
+    static __MA_INLINE float exp(float x)
+    {
+        return (float)ma_kernel<double, ma_exact>::exp(x);
+    }
+    static __MA_INLINE float exp_max() { return 88.0f; }
+};
+
+/*
+ * Float throughout, as __kernel_sincosf() and __kernel_expf()
+ */
+__MA_SPECIAL class ma_kernel<float, ma_fast> {
+public:
+    static __MA_INLINE void sincos(float x, float *s, float *c)
+    {
+        double y[2];
+        float z, sn, cs;
+        int ix, n;
+
+        ix = __ma_bits::word(x)&0x7fffffff;
+        if (ix >= 0x7f800000) { *s = *c = x-x; return; }
+        n = 0;
+        if (ix > 0x3f490fd8) {                          /* |x| > pi/4 */
+            n = ma_kernel<double, ma_exact>::rem_pio2((double)x, y, 3);
+            x = (float)(y[0]+y[1]);
+        } else if (ix < 0x39800000) {                   /* |x| < 2**-12 */
+            *s = x;
+            *c = 1.0f;
+            return;
+        }
+        z = x*x;
+        sn = x+x*z*__ma_poly<float, 5>::eval(__ma_tm_Sf, z);
+        cs = 1.0f-0.5f*z+z*z*__ma_poly<float, 5>::eval(__ma_tm_Cf, z);
+        switch (n&3) {
+            case 0: *s =  sn; *c =  cs; break;
+            case 1: *s =  cs; *c = -sn; break;
+            case 2: *s = -sn; *c = -cs; break;
+            default: *s = -cs; *c =  sn; break;
+        }
+    }
+
+    static __MA_INLINE float sin(float x)
+    {
+        float s, c;
+
+        sincos(x, &s, &c);
+        return s;
+    }
+
+    static __MA_INLINE float cos(float x)
+    {
+        float s, c;
+
+        sincos(x, &s, &c);
+        return c;
+    }
+
+    static __MA_INLINE float exp(float x)
+    {
+        float y, hi, lo, c, t;
+        int k, xsb, hx;
+
+        k = 0;
+        hi = lo = 0.0f;
+        hx = __ma_bits::word(x);
+        xsb = (hx>>31)&1;
+        hx &= 0x7fffffff;
+        if (hx >= 0x42b17218) {                         /* |x| >= 88.72 */
+            if (hx > 0x7f800000) return x+x;
+            if (hx == 0x7f800000) return (xsb == 0) ? x : 0.0f;
+            if (x > 8.8721679688e+01f) return 1.0e+30f*1.0e+30f;
+            if (x < -1.0397208405e+02f)
+                return 7.8886090522e-31f*7.8886090522e-31f;
+        }
+        if (hx > 0x3eb17218) {                          /* |x| > 0.5 ln2 */
+            if (hx < 0x3F851592) {                      /* |x| < 1.5 ln2 */
+                hi = x-__ma_tm_ln2f[xsb];
+                lo = __ma_tm_ln2f[2+xsb];
+                k = 1-xsb-xsb;
+            } else {
+                k = (int)(1.4426950216e+00f*x+((xsb == 0) ? 0.5f : -0.5f));
+                t = (float)k;
+                hi = x-t*__ma_tm_ln2f[0];
+                lo = t*__ma_tm_ln2f[2];
+            }
+            x = hi-lo;
+        } else if (hx < 0x31800000) {                   /* |x| < 2**-28 */
+            if (1.0e+30f+x > 1.0f) return 1.0f+x;
+        }
+        t = x*x;
+        c = x-t*__ma_poly<float, 5>::eval(__ma_tm_Pf, t);
+        if (k == 0) return 1.0f-((x*c)/(c-2.0f)-x);
+        y = 1.0f-((lo-(x*c)/(2.0f-c))-hi);
+        if (k >= -125) return __ma_bits::addexp(y, k);
+        return __ma_bits::addexp(y, k+100)*7.8886090522e-31f;
+    }
+
+    static __MA_INLINE float exp_max() { return 88.0f; }
+};
+
+/*
+ * Complex numbers of either precision, laid out as complex_t and
+ * float_complex
+ */
+template <class T>
+class ma_complex {
+public:
+    T re, im;
+
+    ma_complex() {}
+    ma_complex(T r, T i = 0) { re = r; im = i; }
+
+    friend ma_complex<T> operator+(ma_complex<T> a, ma_complex<T> b)
+    {
+        return ma_complex<T>(a.re+b.re, a.im+b.im);
+    }
+    friend ma_complex<T> operator-(ma_complex<T> a, ma_complex<T> b)
+    {
+        return ma_complex<T>(a.re-b.re, a.im-b.im);
+    }
+    friend ma_complex<T> operator-(ma_complex<T> a)
+    {
+        return ma_complex<T>(-a.re, -a.im);
+    }
+    friend ma_complex<T> operator*(ma_complex<T> a, ma_complex<T> b)
+    {
+        return ma_complex<T>(a.re*b.re-a.im*b.im, a.re*b.im+a.im*b.re);
+    }
+};
+
+/* exp(z) as cexpf(): exp(re) is split in two where it alone overflows */
+template <class T, class Tier>
+__MA_INLINE ma_complex<T> ma_cexp(ma_complex<T> z, Tier)
+{
+    ma_complex<T> w;
+    T e, s, c, m;
+
+    if (z.im == 0) {
+        w.re = ma_kernel<T, Tier>::exp(z.re);
+        w.im = z.im;
+        return w;
+    }
+    ma_kernel<T, Tier>::sincos(z.im, &s, &c);
+    m = ma_kernel<T, Tier>::exp_max();
+    if (z.re > m && z.re < m+m) {
+        e = ma_kernel<T, Tier>::exp((T)0.5*z.re);
+        w.re = (e*c)*e;
+        w.im = (e*s)*e;
+    } else {
+        e = ma_kernel<T, Tier>::exp(z.re);
+        w.re = e*c;
+        w.im = e*s;
+    }
+    return w;
+}
+
+/*
+ * Shorthand for the exact tier: ma::sin(x) and so on
+ */
+class ma {
+public:
+    static __MA_INLINE double sin(double x)
+    {
+        return ma_kernel<double, ma_exact>::sin(x);
+    }
+    static __MA_INLINE float sin(float x)
+    {
+        return ma_kernel<float, ma_exact>::sin(x);
+    }
+    static __MA_INLINE double cos(double x)
+    {
+        return ma_kernel<double, ma_exact>::cos(x);
+    }
+    static __MA_INLINE float cos(float x)
+    {
+        return ma_kernel<float, ma_exact>::cos(x);
+    }
+    static __MA_INLINE void sincos(double x, double *s, double *c)
+    {
+        ma_kernel<double, ma_exact>::sincos(x, s, c);
+    }
+    static __MA_INLINE void sincos(float x, float *s, float *c)
+    {
+        ma_kernel<float, ma_exact>::sincos(x, s, c);
+    }
+    static __MA_INLINE double exp(double x)
+    {
+        return ma_kernel<double, ma_exact>::exp(x);
+    }
+    static __MA_INLINE float exp(float x)
+    {
+        return ma_kernel<float, ma_exact>::exp(x);
+    }
+    static __MA_INLINE ma_complex<double> exp(ma_complex<double> z)
+    {
+        return ma_cexp(z, ma_exact());
+    }
+    static __MA_INLINE ma_complex<float> exp(ma_complex<float> z)
+    {
+        return ma_cexp(z, ma_fast());
+    }
+};
+
+#endif /* _AMIGA_TMATH_H */
@@ -0,0 +1,52 @@
+/*
+ * amiga/vround.h - Array rounding and integer conversion for ma.lib
+ *
+ * Copyright (c) 2025 amigazen project
+ * All rights reserved.
+ *
+ * floor(), ceil(), trunc(), round() and rint() over whole double and
+ * float arrays, and conversion of sample buffers to 8, 16, 32 and
+ * 64-bit integers with saturation and optional TPDF dither, in one
+ * call per buffer rather than one per element.
+ */
+
+#ifndef _AMIGA_VROUND_H
+#define _AMIGA_VROUND_H
+
+#include "internal/longlong.h"
+
+/* Round each element to an integral value; dst may be x */
+void ma_vfloor(double *dst, const double *x, unsigned long n);
+void ma_vceil(double *dst, const double *x, unsigned long n);
+void ma_vtrunc(double *dst, const double *x, unsigned long n);
+void ma_vround(double *dst, const double *x, unsigned long n);
+void ma_vrint(double *dst, const double *x, unsigned long n);
+
+void ma_vfloorf(float *dst, const float *x, unsigned long n);
+void ma_vceilf(float *dst, const float *x, unsigned long n);
+void ma_vtruncf(float *dst, const float *x, unsigned long n);
+void ma_vroundf(float *dst, const float *x, unsigned long n);
+void ma_vrintf(float *dst, const float *x, unsigned long n);
+
+/*
+ * dst = x*scale rounded to nearest and clamped to the integer type;
+ * NaN gives 0. dither is NULL, or the seed of the triangular (TPDF)
+ * dither of +-1 step added before rounding, updated for the next call.
+ */
+void ma_vcvt_s8(signed char *dst, const double *x, unsigned long n,
+                double scale, unsigned long *dither);
+void ma_vcvt_s16(short *dst, const double *x, unsigned long n,
+                 double scale, unsigned long *dither);
+void ma_vcvt_s32(long *dst, const double *x, unsigned long n,
+                 double scale, unsigned long *dither);
+void ma_vcvt_s64(long_long_t *dst, const double *x, unsigned long n,
+                 double scale, unsigned long *dither);
+
+void ma_vcvtf_s8(signed char *dst, const float *x, unsigned long n,
+                 float scale, unsigned long *dither);
+void ma_vcvtf_s16(short *dst, const float *x, unsigned long n,
+                  float scale, unsigned long *dither);
+void ma_vcvtf_s32(long *dst, const float *x, unsigned long n,
+                  float scale, unsigned long *dither);
+
+#endif /* _AMIGA_VROUND_H */
@@ -67,7 +67,7 @@ typedef complex_long_double long_double_complex;
 #define CMPLXL(real, imag)  ((struct complex_long_double){real, imag})
 
 /* Helper macros for struct-based complex numbers */
-/* Note: creal and cimag are implemented as functions, not macros */
+/* Note: creal, cimag and the arithmetic below are functions with inline forms */
 
 /* C99-compatible complex number creation functions */
 /* Note: These are implemented as macros for C89 compatibility */
@@ -112,8 +112,15 @@ complex_t clog_c99(complex_t z);
 #define clog clog_c99
 #endif
 complex_t cpow(complex_t z, complex_t w);
+complex_t cpowi(complex_t z, long n);
 complex_t csqrt(complex_t z);
 
+/* Arithmetic */
+complex_t cadd(complex_t a, complex_t b);
+complex_t csub(complex_t a, complex_t b);
+complex_t cmul(complex_t a, complex_t b);
+complex_t cdiv(complex_t a, complex_t b);
+
 /* Utility Functions */
 double cmod(complex_t z);
 complex_t cneg(complex_t z);
@@ -122,6 +129,9 @@ complex_t cscale(complex_t z, double scale);
 /* Projection and Classification */
 complex_t cproj(complex_t z);
 
+/* Array form of cabs() (ma.lib extension) */
+void ma_cabs_v(double *dst, const complex_t *z, unsigned long n);
+
 /* Float variants */
 float cabsf(float_complex z);
 float cargf(float_complex z);
@@ -166,6 +176,52 @@ long_double_complex cpowl(long_double_complex z, long_double_complex w);
 long_double_complex csqrtl(long_double_complex z);
 long_double_complex cprojl(long_double_complex z);
 
+/*
+ * Inline forms of creal(), cimag(), cadd(), csub() and cneg(), which
+ * are too small to be worth a call. As in math.h, (creal)(z) reaches
+ * the library function and MA_NO_INLINE turns the macros off.
+ */
+#if !defined(MA_NO_INLINE) && !defined(__cplusplus)
+
+static __inline double __ma_creal(complex_t z)
+{
+    return z.re;
+}
+
+static __inline double __ma_cimag(complex_t z)
+{
+    return z.im;
+}
+
+static __inline complex_t __ma_cadd(complex_t a, complex_t b)
+{
+    a.re += b.re;
+    a.im += b.im;
+    return a;
+}
+
+static __inline complex_t __ma_csub(complex_t a, complex_t b)
+{
+    a.re -= b.re;
+    a.im -= b.im;
+    return a;
+}
+
+static __inline complex_t __ma_cneg(complex_t z)
+{
+    z.re = -z.re;
+    z.im = -z.im;
+    return z;
+}
+
+#define creal(z)        __ma_creal(z)
+#define cimag(z)        __ma_cimag(z)
+#define cadd(a, b)      __ma_cadd(a, b)
+#define csub(a, b)      __ma_csub(a, b)
+#define cneg(z)         __ma_cneg(z)
+
+#endif /* !MA_NO_INLINE */
+
 #ifdef __cplusplus
     }
 #endif
@@ -0,0 +1,24 @@
+#ifndef MA_BITS_H
+#define MA_BITS_H
+
+/*
+ * Bit scans for the library's own kernels, on 32-bit words. With GCC
+ * these are the builtins, which become BFFFO on a 68020 or better and
+ * LZCNT, TZCNT or POPCNT on hosts that have them; otherwise they call
+ * the table-driven versions in bits.c. The builtin forms evaluate x
+ * more than once, so pass a plain variable.
+ */
+
+#include <amiga/bits.h>
+
+#ifdef __GNUC__
+#define __ma_clz32(x)      ((x) ? __builtin_clz((unsigned int)(x)) : 32)
+#define __ma_ctz32(x)      ((x) ? __builtin_ctz((unsigned int)(x)) : 32)
+#define __ma_popcount32(x) __builtin_popcount((unsigned int)(x))
+#else
+#define __ma_clz32(x)      ma_clz32(x)
+#define __ma_ctz32(x)      ma_ctz32(x)
+#define __ma_popcount32(x) ma_popcount32(x)
+#endif
+
+#endif /* MA_BITS_H */
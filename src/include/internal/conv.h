@@ -0,0 +1,48 @@
+#ifndef MA_CONV_H
+#define MA_CONV_H
+
+/*
+ * Shared kernels for the decimal conversions, ma_dtoa() and
+ * ma_strtod(). See convkernel.c.
+ *
+ * 64-bit quantities are unsigned_long_long_t and big integers are
+ * arrays of 32-bit limbs, so nothing here needs a compiler with a
+ * native 64-bit type.
+ */
+
+#include "longlong.h"
+
+/* Powers of ten with a 128-bit significand, 10**MA_POW10_MIN and up */
+#define MA_POW10_MIN    (-342)
+#define MA_POW10_MAX    340
+
+extern const unsigned long __ma_pow10_tab[][4];
+
+/* floor(q*log2(10)): 10**q is the table entry times 2**(that-127) */
+#define __ma_pow10_exp(q)   (((152170L+65536L)*(long)(q))>>16)
+
+/* Full 128-bit product of two 64-bit values */
+void __ma_umul64(const unsigned_long_long_t *a, const unsigned_long_long_t *b,
+                 unsigned_long_long_t *hi, unsigned_long_long_t *lo);
+
+/*
+ * Unsigned big integers, least significant limb first. The size
+ * covers the exact comparisons of the slow paths: 769 decimal digits
+ * against a double's halfway point scaled by up to 5**1111.
+ */
+#define MA_BIG_LIMBS    90
+
+typedef struct {
+    int n;                              /* Limbs in use */
+    unsigned long d[MA_BIG_LIMBS];      /* Limbs, least significant first */
+} ma_big_t;
+
+void __ma_big_set(ma_big_t *b, unsigned long hi, unsigned long lo);
+void __ma_big_muladd(ma_big_t *b, unsigned long m, unsigned long a);
+void __ma_big_mulpow5(ma_big_t *b, int k);
+void __ma_big_shl(ma_big_t *b, int k);
+void __ma_big_add(ma_big_t *a, const ma_big_t *b);
+void __ma_big_sub(ma_big_t *a, const ma_big_t *b);
+int __ma_big_cmp(const ma_big_t *a, const ma_big_t *b);
+
+#endif /* MA_CONV_H */
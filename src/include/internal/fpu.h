@@ -0,0 +1,107 @@
+#ifndef MA_FPU_H
+#define MA_FPU_H
+
+/*
+ * FPU primitives for the ma881.lib and ma040.lib builds.
+ *
+ * MA_FPU is defined when the compiler generates 68881 code: SAS/C with
+ * MATH=68881, or GCC with -m68881 and up. The 68040 runs FABS, FSQRT
+ * and the arithmetic in hardware but traps FINT, FINTRZ, FGETEXP,
+ * FSCALE and every transcendental to software emulation, which costs
+ * far more than the C kernels; MA_FPU_FULL is defined only for the
+ * 68881/68882, where FINT and FINTRZ are worth using.
+ *
+ * The FPU keeps intermediates in extended precision, so the kernels
+ * that round by adding and subtracting 2**52 would see the sum come
+ * back exact. STRICT_ASSIGN stores such a sum through memory, which
+ * rounds it to its declared type; without an FPU it is plain
+ * assignment.
+ *
+ * SAS/C has no inline assembler, so there the primitives are the
+ * register-argument stubs in fpu.a; GCC expands them inline.
+ */
+
+#if defined(_M68881) || defined(__HAVE_68881__)
+#define MA_FPU
+#if !defined(_M68040) && !defined(_M68060) && \
+    !defined(__mc68040__) && !defined(__mc68060__)
+#define MA_FPU_FULL
+#endif
+#endif
+
+#ifdef MA_FPU
+
+#define STRICT_ASSIGN(type, lval, rval) do { \
+    volatile type __lval;                   \
+    __lval = (rval);                        \
+    (lval) = __lval;                        \
+} while (0)
+
+#ifdef __GNUC__
+
+static __inline double __ma_fpu_fabs(double x)
+{
+    double r;
+    __asm__("fabs%.x %1,%0" : "=f" (r) : "f" (x));
+    return r;
+}
+
+#if defined(__mc68040__) || defined(__mc68060__)
+static __inline double __ma_fpu_sqrt(double x)
+{
+    double r;
+    __asm__("fdsqrt%.x %1,%0" : "=f" (r) : "f" (x));
+    return r;
+}
+#else
+/* Round the root to double in the FPU, not once to extended and again on store */
+static __inline double __ma_fpu_sqrt(double x)
+{
+    double r;
+    unsigned long cr, t;
+    __asm__("fmove%.l %!,%1\n\t"
+            "move%.l %1,%2\n\t"
+            "and%.l #0x30,%2\n\t"
+            "or%.l #0x80,%2\n\t"
+            "fmove%.l %2,%!\n\t"
+            "fsqrt%.x %3,%0\n\t"
+            "fmove%.l %1,%!"
+            : "=&f" (r), "=&d" (cr), "=&d" (t) : "f" (x));
+    return r;
+}
+#endif
+
+#ifdef MA_FPU_FULL
+static __inline double __ma_fpu_int(double x)
+{
+    double r;
+    __asm__("fint%.x %1,%0" : "=f" (r) : "f" (x));
+    return r;
+}
+
+static __inline double __ma_fpu_intrz(double x)
+{
+    double r;
+    __asm__("fintrz%.x %1,%0" : "=f" (r) : "f" (x));
+    return r;
+}
+#endif
+
+#else /* SAS/C */
+
+double __asm __ma_fpu_fabs(register __fp0 double x);
+double __asm __ma_fpu_sqrt(register __fp0 double x);
+#ifdef MA_FPU_FULL
+double __asm __ma_fpu_int(register __fp0 double x);
+double __asm __ma_fpu_intrz(register __fp0 double x);
+#endif
+
+#endif /* __GNUC__ */
+
+#else /* !MA_FPU */
+
+#define STRICT_ASSIGN(type, lval, rval) ((lval) = (rval))
+
+#endif /* MA_FPU */
+
+#endif /* MA_FPU_H */
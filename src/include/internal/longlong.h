@@ -55,6 +55,12 @@ long_long_t strtoll(const char *str, char **endptr, int base);
 long_long_t atoll(const char *str);
 unsigned_long_long_t strtoull(const char *str, char **endptr, int base);
 
+/* Room for any result of lltoa() or ulltoa(): 64 binary digits, a sign and the NUL */
+#define LONG_LONG_BUFSIZE 66
+
+char *lltoa(long_long_t value, char *buf, int radix);
+char *ulltoa(unsigned_long_long_t value, char *buf, int radix);
+
 /* Conversion functions */
 long long_long_to_long(long_long_t value);
 unsigned long long_long_to_ulong(long_long_t value);
@@ -96,5 +102,40 @@ int long_long_popcount(long_long_t value);
 /* Division function */
 lldiv_t lldiv(long_long_t numer, long_long_t denom);
 
+/*
+ * Division by invariant integers: a divider set up once for a divisor
+ * turns each later division into a multiply-high and a shift. The
+ * magic number is 0 for a power of 2; 'more' holds the shift and
+ * flags.
+ */
+typedef struct {
+    unsigned_long_long_t magic; /* Multiplier bits, or 0 for a shift */
+    unsigned char more;         /* Shift and flags */
+} ma_lldivider;
+
+typedef struct {
+    unsigned_long_long_t magic;
+    unsigned char more;
+} ma_ulldivider;
+
+typedef struct {
+    long magic;
+    unsigned char more;
+} ma_ldivider;
+
+typedef struct {
+    unsigned long magic;
+    unsigned char more;
+} ma_uldivider;
+
+int ma_lldiv_init(ma_lldivider *d, long_long_t divisor);
+long_long_t ma_lldiv_apply(const ma_lldivider *d, long_long_t x);
+int ma_ulldiv_init(ma_ulldivider *d, unsigned_long_long_t divisor);
+unsigned_long_long_t ma_ulldiv_apply(const ma_ulldivider *d, unsigned_long_long_t x);
+int ma_ldiv_init(ma_ldivider *d, long divisor);
+long ma_ldiv_apply(const ma_ldivider *d, long x);
+int ma_uldiv_init(ma_uldivider *d, unsigned long divisor);
+unsigned long ma_uldiv_apply(const ma_uldivider *d, unsigned long x);
+
 #endif /* LONG_LONG_H */
 
@@ -130,6 +130,24 @@
 #define TANH_MAXARG 16
 #define SQRT_MAXDOUBLE 1.304380e19
 
+/*
+ * Zeros shared by the kernels (consts.c). They are variables rather
+ * than constants so that x/__ma_zero is evaluated at run time, raising
+ * the divide-by-zero or invalid exception instead of being folded.
+ */
+extern double __ma_zero;
+extern float __ma_zerof;
+
+/*
+ * MA_SMALL selects the size profile built as masmall.lib: loops are
+ * not unrolled and optional caches are left out.
+ */
+#ifdef MA_SMALL
+#ifndef MA_NO_TRIG_MEMO
+#define MA_NO_TRIG_MEMO
+#endif
+#endif
+
 /*
  * Boolean constants
  */
@@ -194,4 +212,19 @@ struct exception {
  */
 extern int matherr(struct exception *e);
 
+/*
+ * Error reporting - sets errno and records the error and the matching
+ * exception flag in the calling task's ma_ctx (see ma_ctx.c)
+ */
+extern void __ma_seterr(int err);
+extern void __ma_setrange(double r);
+extern void __ma_ctx_raise(ma_ctx *ctx, int err, double r);
+
+/*
+ * The calling task's installed ma_ctx, or NULL, and the number of
+ * contexts installed by all tasks (see ma_ctx.c)
+ */
+extern ma_ctx *__ma_ctx_own(void);
+extern int __ma_ctx_installed;
+
 #endif /* _INTERNAL_MATH_H */
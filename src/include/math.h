@@ -119,6 +119,7 @@
 #endif
 
 /* Global variables for gamma functions */
+/* Shared by all tasks; the calling task's ma_ctx also keeps a copy */
 extern int signgam;
 
 /* Math error handling (SVID/LSB compatibility) */
@@ -225,6 +226,34 @@ long_long_t llrint(double x);
 /* C99 Function declarations - Power and Root */
 double cbrt(double x);
 double hypot(double x, double y);
+double rsqrt(double x);
+
+/* Euclidean norms (ma.lib extension) */
+double ma_hypot3(double x, double y, double z);
+void ma_hypot_v(double *dst, const double *x, const double *y,
+                unsigned long n);
+
+/* C23 Function declarations - Integer Powers and Roots */
+double pown(double x, long n);
+double rootn(double x, long n);
+double compoundn(double x, long n);
+double powi(double x, int n);
+
+/* C23 Function declarations - Trigonometric functions of pi*x */
+double sinpi(double x);
+double cospi(double x);
+double tanpi(double x);
+double asinpi(double x);
+double acospi(double x);
+double atanpi(double x);
+
+/* Trigonometric functions in degrees (ma.lib extension) */
+double ma_sind(double x);
+double ma_cosd(double x);
+double ma_tand(double x);
+double ma_asind(double x);
+double ma_acosd(double x);
+double ma_atand(double x);
 
 /* C99 Function declarations - Floating-Point Manipulation */
 double copysign(double x, double y);
@@ -247,6 +276,16 @@ int fpclassify(double x);
 double erf(double x);
 double erfc(double x);
 
+/* Inverse error functions and the normal distribution (ma.lib extension) */
+double ma_erfinv(double x);
+double ma_erfcinv(double x);
+double ma_normcdf(double x);
+double ma_ndtri(double p);
+void ma_erfinv_v(double *dst, const double *src, unsigned long n);
+void ma_erfcinv_v(double *dst, const double *src, unsigned long n);
+void ma_normcdf_v(double *dst, const double *src, unsigned long n);
+void ma_ndtri_v(double *dst, const double *src, unsigned long n);
+
 /* POSIX.1 Function declarations - Gamma Functions */
 double tgamma(double x);
 double lgamma(double x);
@@ -261,6 +300,10 @@ double y0(double x);
 double y1(double x);
 double yn(int n, double x);
 
+/* Bessel Functions - J and Y of the same order evaluated together */
+void ma_j0y0(double x, double *j, double *y);
+void ma_j1y1(double x, double *j, double *y);
+
 /* IEEE 754 Function declarations - Min/Max */
 double fmin(double x, double y);
 double fmax(double x, double y);
@@ -292,6 +335,7 @@ long lrintf(float x);
 long_long_t llrintf(float x);
 float cbrtf(float x);
 float hypotf(float x, float y);
+float rsqrtf(float x);
 float copysignf(float x, float y);
 float nextafterf(float x, float y);
 float nexttowardf(float x, long double y);
@@ -372,6 +416,95 @@ long double fmaxl(long double x, long double y);
 long double fdiml(long double x, long double y);
 long double fmal(long double x, long double y, long double z);
 
+/*
+ * Inline forms of the trivial functions
+ *
+ * fabs(), copysign(), signbit(), isnan(), isinf(), finite(),
+ * fpclassify(), fmin() and fmax() expand to code on the bit pattern
+ * rather than a library call. The library functions remain: (fabs)(x)
+ * or &fabs still reach them, and defining MA_NO_INLINE before math.h
+ * is included turns the macros off.
+ */
+#if !defined(MA_NO_INLINE) && !defined(__cplusplus)
+
+#define __MA_HI(x)      (*(unsigned long *)&(x))
+#define __MA_LO(x)      (*(1+(unsigned long *)&(x)))
+
+static __inline double __ma_fabs(double x)
+{
+    __MA_HI(x) &= 0x7fffffffUL;
+    return x;
+}
+
+static __inline double __ma_copysign(double x, double y)
+{
+    __MA_HI(x) = (__MA_HI(x) & 0x7fffffffUL) | (__MA_HI(y) & 0x80000000UL);
+    return x;
+}
+
+static __inline int __ma_signbit(double x)
+{
+    return (int)(__MA_HI(x) >> 31);
+}
+
+static __inline int __ma_isnan(double x)
+{
+    return ((__MA_HI(x) & 0x7fffffffUL) | (__MA_LO(x) != 0)) > 0x7ff00000UL;
+}
+
+static __inline int __ma_isinf(double x)
+{
+    return (__MA_HI(x) & 0x7fffffffUL) == 0x7ff00000UL && __MA_LO(x) == 0;
+}
+
+static __inline int __ma_finite(double x)
+{
+    return (__MA_HI(x) & 0x7fffffffUL) < 0x7ff00000UL;
+}
+
+static __inline int __ma_fpclassify(double x)
+{
+    unsigned long hx = __MA_HI(x) & 0x7fffffffUL, lx = __MA_LO(x);
+
+    if (hx >= 0x7ff00000UL)
+        return (hx > 0x7ff00000UL || lx != 0) ? FP_NAN : FP_INFINITE;
+    if (hx < 0x00100000UL)
+        return (hx | lx) ? FP_SUBNORMAL : FP_ZERO;
+    return FP_NORMAL;
+}
+
+static __inline double __ma_fmin(double x, double y)
+{
+    if (__ma_isnan(x)) return y;
+    if (__ma_isnan(y)) return x;
+    if (x < y) return x;
+    if (y < x) return y;
+    return __ma_signbit(x) ? x : y;     /* -0 before +0 */
+}
+
+static __inline double __ma_fmax(double x, double y)
+{
+    if (__ma_isnan(x)) return y;
+    if (__ma_isnan(y)) return x;
+    if (x > y) return x;
+    if (y > x) return y;
+    return __ma_signbit(x) ? y : x;     /* +0 before -0 */
+}
+
+#ifndef fabs
+#define fabs(x)             __ma_fabs(x)
+#endif
+#define copysign(x, y)      __ma_copysign(x, y)
+#define signbit(x)          __ma_signbit(x)
+#define isnan(x)            __ma_isnan(x)
+#define isinf(x)            __ma_isinf(x)
+#define finite(x)           __ma_finite(x)
+#define fpclassify(x)       __ma_fpclassify(x)
+#define fmin(x, y)          __ma_fmin(x, y)
+#define fmax(x, y)          __ma_fmax(x, y)
+
+#endif /* !MA_NO_INLINE */
+
 /* Include complex.h for complex number functions */
 #include <complex.h>
 
@@ -0,0 +1,139 @@
+/*
+ * tgmath.h - Type-generic math for ma.lib
+ *
+ * Copyright (c) 2025 amigazen project
+ * All rights reserved.
+ *
+ * Each generic name picks the float, double or long double function
+ * from the type of its arguments, so float code stays in the float
+ * kernels instead of being promoted to double. The choice is made at
+ * compile time and the arguments are evaluated once.
+ *
+ * A C11 compiler selects with _Generic, as C99 specifies: integer
+ * arguments go to the double function, and a complex argument to a
+ * real name goes to the complex function (exp of a float_complex is
+ * cexpf()), with carg(), conj() and cproj() generic as well.
+ *
+ * SAS/C has neither _Generic nor typeof, so there the choice is made
+ * on sizeof(), which the compiler folds to one call. Two differences
+ * follow. A 32-bit integer has the size of a float, so cast integer
+ * arguments to double. The result of the expression has type double
+ * even when the float function computed it. Complex arguments do not
+ * dispatch in this scheme; call cexpf() and the like directly.
+ *
+ * Names with no float or long double variant in ma.lib stay double
+ * for real arguments. These are sin, exp, pow and the other C89
+ * functions, and also cbrt, erf, erfc, expm1, fdim, fma, hypot,
+ * lgamma, remainder, remquo, rint and tgamma. math.h declares all
+ * three precisions of those, but only the double one is built.
+ * fabs, copysign, fmin and fmax are exact in every precision and keep
+ * the inline double forms from math.h.
+ */
+
+#ifndef _MA_TGMATH_H
+#define _MA_TGMATH_H
+
+#include <math.h>
+#include <complex.h>
+
+#ifndef __cplusplus
+
+/* creal() and cimag() of any complex type */
+#undef creal
+#undef cimag
+#define creal(z)        ((z).re)
+#define cimag(z)        ((z).im)
+
+#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+
+/* t selects among the real functions f, d and l, then args are applied */
+#define __MA_TGR(t, f, d, l, args) \
+    _Generic((t), float: f, long double: l, default: d) args
+
+/* A zero of the type an argument contributes: integers count as double */
+#define __MA_TGV(x) \
+    _Generic((x), float: 0.0f, long double: 0.0L, default: 0.0)
+#define __MA_TG2(x, y)      (__MA_TGV(x) + __MA_TGV(y))
+
+/* ... and among the complex functions cf, cd and cl as well */
+#define __MA_TGC(t, f, d, l, cf, cd, cl, args) \
+    _Generic((t), float: f, long double: l, \
+             complex_float: cf, complex_double: cd, \
+             complex_long_double: cl, default: d) args
+
+#else /* SAS/C */
+
+#define __MA_TGL(t) \
+    (sizeof(long double) != sizeof(double) && sizeof(t) == sizeof(long double))
+
+#define __MA_TGR(t, f, d, l, args) \
+    (sizeof(t) == sizeof(float) ? f args : __MA_TGL(t) ? l args : d args)
+
+#define __MA_TGC(t, f, d, l, cf, cd, cl, args) \
+    __MA_TGR(t, f, d, l, args)
+
+#define __MA_TG2(x, y)      ((x) + (y))
+
+#endif
+
+/* Real functions with float and long double variants */
+#define lround(x)       __MA_TGR(x, lroundf, lround, lroundl, (x))
+#define llround(x)      __MA_TGR(x, llroundf, llround, llroundl, (x))
+#define lrint(x)        __MA_TGR(x, lrintf, lrint, lrintl, (x))
+#define llrint(x)       __MA_TGR(x, llrintf, llrint, llrintl, (x))
+#define nearbyint(x)    __MA_TGR(x, nearbyintf, nearbyint, nearbyintl, (x))
+#define trunc(x)        __MA_TGR(x, truncf, trunc, truncl, (x))
+#define round(x)        __MA_TGR(x, roundf, round, roundl, (x))
+#define exp2(x)         __MA_TGR(x, exp2f, exp2, exp2l, (x))
+#define log1p(x)        __MA_TGR(x, log1pf, log1p, log1pl, (x))
+#define log2(x)         __MA_TGR(x, log2f, log2, log2l, (x))
+#define logb(x)         __MA_TGR(x, logbf, logb, logbl, (x))
+#define ilogb(x)        __MA_TGR(x, ilogbf, ilogb, ilogbl, (x))
+#define scalbn(x, n)    __MA_TGR(x, scalbnf, scalbn, scalbnl, (x, n))
+#define scalbln(x, n)   __MA_TGR(x, scalblnf, scalbln, scalblnl, (x, n))
+#define nexttoward(x, y) \
+    __MA_TGR(x, nexttowardf, nexttoward, nexttowardl, (x, y))
+
+/* Two real arguments, selected by their common type */
+#define nextafter(x, y) \
+    __MA_TGR(__MA_TG2(x, y), nextafterf, nextafter, nextafterl, (x, y))
+
+/* Real and complex: all three precisions of each */
+#define acosh(x) \
+    __MA_TGC(x, acoshf, acosh, acoshl, cacoshf, cacosh, cacoshl, (x))
+#define asinh(x) \
+    __MA_TGC(x, asinhf, asinh, asinhl, casinhf, casinh, casinhl, (x))
+#define atanh(x) \
+    __MA_TGC(x, atanhf, atanh, atanhl, catanhf, catanh, catanhl, (x))
+
+#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+
+/* Real functions that are double only, generic over the complex types */
+#define sin(x)      __MA_TGC(x, sin, sin, sin, csinf, csin, csinl, (x))
+#define cos(x)      __MA_TGC(x, cos, cos, cos, ccosf, ccos, ccosl, (x))
+#define tan(x)      __MA_TGC(x, tan, tan, tan, ctanf, ctan, ctanl, (x))
+#define asin(x)     __MA_TGC(x, asin, asin, asin, casinf, casin, casinl, (x))
+#define acos(x)     __MA_TGC(x, acos, acos, acos, cacosf, cacos, cacosl, (x))
+#define atan(x)     __MA_TGC(x, atan, atan, atan, catanf, catan, catanl, (x))
+#define sinh(x)     __MA_TGC(x, sinh, sinh, sinh, csinhf, csinh, csinhl, (x))
+#define cosh(x)     __MA_TGC(x, cosh, cosh, cosh, ccoshf, ccosh, ccoshl, (x))
+#define tanh(x)     __MA_TGC(x, tanh, tanh, tanh, ctanhf, ctanh, ctanhl, (x))
+#define exp(x)      __MA_TGC(x, exp, exp, exp, cexpf, cexp, cexpl, (x))
+#define log(x)      __MA_TGC(x, log, log, log, clogf, clog, clogl, (x))
+#define sqrt(x)     __MA_TGC(x, sqrt, sqrt, sqrt, csqrtf, csqrt, csqrtl, (x))
+#define pow(x, y)   __MA_TGC(x, pow, pow, pow, cpowf, cpow, cpowl, (x, y))
+
+/* fabs of a complex value is its modulus */
+#undef fabs
+#define fabs(x)     __MA_TGC(x, fabs, fabs, fabs, cabsf, cabs, cabsl, (x))
+
+/* Complex-only names */
+#define carg(z)     __MA_TGC(z, carg, carg, carg, cargf, carg, cargl, (z))
+#define conj(z)     __MA_TGC(z, conj, conj, conj, conjf, conj, conjl, (z))
+#define cproj(z)    __MA_TGC(z, cproj, cproj, cproj, cprojf, cproj, cprojl, (z))
+
+#endif /* C11 */
+
+#endif /* !__cplusplus */
+
+#endif /* _MA_TGMATH_H */
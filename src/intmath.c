@@ -0,0 +1,583 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Exact integer roots, logarithms, gcd and modular arithmetic
+ *
+ * Method :
+ *	isqrt and icbrt take an upper bound from a 256-entry table of
+ *	ceil(16*sqrt(t+1)) or ceil(32*cbrt(t+1)), indexed by the top
+ *	bits of x, and refine it with integer Newton steps
+ *	    y = (y + x/y)/2,   y = (2*y + x/(y*y))/3
+ *	which never go below the floor of the root; they stop as soon
+ *	as x/y (x/(y*y)) is no smaller than y. The 64-bit forms seed
+ *	from the 32-bit root of the top 32 bits, close enough that one
+ *	step and a multiply-back correction give the exact root. ilog2 is a leading zero count and ilog10 corrects
+ *	ilog2*log10(2) against a table of powers of ten. gcd is Stein's
+ *	binary algorithm: strip common factors of 2, then subtract and
+ *	strip again. mulmod forms the full double-width product and
+ *	reduces it, so nothing overflows for any modulus; powmod is
+ *	square-and-multiply on top of it.
+ *	Nothing here goes through floating point, so every result is
+ *	exact, including above 2**53.
+ */
+
+#include <errno.h>
+#include <amiga/intmath.h>
+#include "include/internal/conv.h"
+#include "include/internal/bits.h"
+
+/* Shared fixed-point kernels - see fixed.c */
+extern void __fix_umul(unsigned long a, unsigned long b,
+                       unsigned long *hi, unsigned long *lo);
+extern unsigned long __fix_udiv(unsigned long hi, unsigned long lo,
+                                unsigned long d, unsigned long *rem);
+
+/* ceil(16*sqrt(t+1))-1 */
+static const unsigned char sqrt_tab[256] = {
+     15,  22,  27,  31,  35,  39,  42,  45,  47,  50,  53,  55,  57,  59,  61,  63,
+     65,  67,  69,  71,  73,  75,  76,  78,  79,  81,  83,  84,  86,  87,  89,  90,
+     91,  93,  94,  95,  97,  98,  99, 101, 102, 103, 104, 106, 107, 108, 109, 110,
+    111, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+    128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+    143, 144, 145, 146, 147, 148, 149, 150, 150, 151, 152, 153, 154, 155, 155, 156,
+    157, 158, 159, 159, 160, 161, 162, 163, 163, 164, 165, 166, 167, 167, 168, 169,
+    170, 170, 171, 172, 173, 173, 174, 175, 175, 176, 177, 178, 178, 179, 180, 181,
+    181, 182, 183, 183, 184, 185, 185, 186, 187, 187, 188, 189, 189, 190, 191, 191,
+    192, 193, 193, 194, 195, 195, 196, 197, 197, 198, 199, 199, 200, 201, 201, 202,
+    203, 203, 204, 204, 205, 206, 206, 207, 207, 208, 209, 209, 210, 211, 211, 212,
+    212, 213, 214, 214, 215, 215, 216, 217, 217, 218, 218, 219, 219, 220, 221, 221,
+    222, 222, 223, 223, 224, 225, 225, 226, 226, 227, 227, 228, 229, 229, 230, 230,
+    231, 231, 232, 232, 233, 234, 234, 235, 235, 236, 236, 237, 237, 238, 238, 239,
+    239, 240, 241, 241, 242, 242, 243, 243, 244, 244, 245, 245, 246, 246, 247, 247,
+    248, 248, 249, 249, 250, 250, 251, 251, 252, 252, 253, 253, 254, 254, 255, 255
+};
+
+/* ceil(32*cbrt(t+1))-1 */
+static const unsigned char cbrt_tab[256] = {
+     31,  40,  46,  50,  54,  58,  61,  63,  66,  68,  71,  73,  75,  77,  78,  80,
+     82,  83,  85,  86,  88,  89,  91,  92,  93,  94,  95,  97,  98,  99, 100, 101,
+    102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 112, 113, 114, 115, 116,
+    117, 117, 118, 119, 120, 120, 121, 122, 123, 123, 124, 125, 125, 126, 127, 127,
+    128, 129, 129, 130, 131, 131, 132, 133, 133, 134, 134, 135, 136, 136, 137, 137,
+    138, 139, 139, 140, 140, 141, 141, 142, 142, 143, 143, 144, 144, 145, 146, 146,
+    147, 147, 148, 148, 149, 149, 150, 150, 150, 151, 151, 152, 152, 153, 153, 154,
+    154, 155, 155, 156, 156, 156, 157, 157, 158, 158, 159, 159, 159, 160, 160, 161,
+    161, 162, 162, 162, 163, 163, 164, 164, 164, 165, 165, 166, 166, 166, 167, 167,
+    168, 168, 168, 169, 169, 170, 170, 170, 171, 171, 171, 172, 172, 172, 173, 173,
+    174, 174, 174, 175, 175, 175, 176, 176, 176, 177, 177, 177, 178, 178, 178, 179,
+    179, 180, 180, 180, 181, 181, 181, 182, 182, 182, 182, 183, 183, 183, 184, 184,
+    184, 185, 185, 185, 186, 186, 186, 187, 187, 187, 188, 188, 188, 188, 189, 189,
+    189, 190, 190, 190, 191, 191, 191, 191, 192, 192, 192, 193, 193, 193, 194, 194,
+    194, 194, 195, 195, 195, 196, 196, 196, 196, 197, 197, 197, 198, 198, 198, 198,
+    199, 199, 199, 199, 200, 200, 200, 201, 201, 201, 201, 202, 202, 202, 202, 203
+};
+
+static const unsigned long pow10_32[10] = {
+    1UL, 10UL, 100UL, 1000UL, 10000UL, 100000UL, 1000000UL,
+    10000000UL, 100000000UL, 1000000000UL
+};
+
+/* 10**0 to 10**19, high word first */
+static const unsigned long pow10_64[20][2] = {
+    { 0x00000000UL, 0x00000001UL }, { 0x00000000UL, 0x0000000AUL },
+    { 0x00000000UL, 0x00000064UL }, { 0x00000000UL, 0x000003E8UL },
+    { 0x00000000UL, 0x00002710UL }, { 0x00000000UL, 0x000186A0UL },
+    { 0x00000000UL, 0x000F4240UL }, { 0x00000000UL, 0x00989680UL },
+    { 0x00000000UL, 0x05F5E100UL }, { 0x00000000UL, 0x3B9ACA00UL },
+    { 0x00000002UL, 0x540BE400UL }, { 0x00000017UL, 0x4876E800UL },
+    { 0x000000E8UL, 0xD4A51000UL }, { 0x00000918UL, 0x4E72A000UL },
+    { 0x00005AF3UL, 0x107A4000UL }, { 0x00038D7EUL, 0xA4C68000UL },
+    { 0x002386F2UL, 0x6FC10000UL }, { 0x01634578UL, 0x5D8A0000UL },
+    { 0x0DE0B6B3UL, 0xA7640000UL }, { 0x8AC72304UL, 0x89E80000UL }
+};
+
+/* a < b for 64-bit values */
+#define LT64(a, b)  ((a).hi < (b).hi || ((a).hi == (b).hi && (a).lo < (b).lo))
+
+/* q = n/d for a 32-bit d != 0; returns the remainder */
+static unsigned long udiv64_32(const unsigned_long_long_t *n, unsigned long d,
+                               unsigned_long_long_t *q)
+{
+    unsigned long hi, r;
+
+    hi = n->hi;
+    q->hi = hi / d;
+    q->lo = __fix_udiv(hi % d, n->lo, d, &r);
+    return r;
+}
+
+/* x >> s for 0 <= s < 64 */
+static void shr64(unsigned_long_long_t *x, int s)
+{
+    if (s >= 32) {
+        x->lo = x->hi >> (s - 32);
+        x->hi = 0;
+    } else if (s > 0) {
+        x->lo = (x->lo >> s) | (x->hi << (32 - s));
+        x->hi >>= s;
+    }
+}
+
+/* a -= b */
+static void sub64(unsigned_long_long_t *a, const unsigned_long_long_t *b)
+{
+    a->hi -= b->hi + (a->lo < b->lo);
+    a->lo -= b->lo;
+}
+
+/* y*y*y > x, for 0 < y < 2**32 */
+static int cube_gt(unsigned long y, const unsigned_long_long_t *x)
+{
+    unsigned long sh, sl, h, l, t;
+
+    __fix_umul(y, y, &sh, &sl);
+    if (sh > 0xFFFFFFFFUL / y) return 1;
+    __fix_umul(sl, y, &h, &l);
+    t = h + sh*y;
+    if (t < h) return 1;
+    return t > x->hi || (t == x->hi && l > x->lo);
+}
+
+/* r = (hi:lo) mod m, by shift and subtract from the top set bit */
+static void mod128(const unsigned_long_long_t *hi, const unsigned_long_long_t *lo,
+                   const unsigned_long_long_t *m, unsigned_long_long_t *r)
+{
+    unsigned long w[4], c;
+    int i, b;
+
+    w[0] = hi->hi;
+    w[1] = hi->lo;
+    w[2] = lo->hi;
+    w[3] = lo->lo;
+    r->hi = r->lo = 0;
+    for (i = 0; i < 4 && w[i] == 0; i++)
+        ;
+    if (i == 4) return;
+    b = 31 - __ma_clz32(w[i]);
+    for (; i < 4; i++, b = 31) {
+        for (; b >= 0; b--) {
+            c = r->hi & 0x80000000UL;
+            r->hi = (r->hi << 1) | (r->lo >> 31);
+            r->lo = (r->lo << 1) | ((w[i] >> b) & 1);
+            if (c || !LT64(*r, *m)) sub64(r, m);
+        }
+    }
+}
+
+/****** ma.lib/ma_isqrt32 ***************************************************
+*
+*   NAME	
+* 	ma_isqrt32 -- Integer square or cube root. (V1.0)
+*
+*   SYNOPSIS
+*	unsigned long r = ma_isqrt32(unsigned long x);
+*	 D0			      D0
+*	unsigned long ma_isqrt32(unsigned long x);
+*	unsigned long ma_icbrt32(unsigned long x);
+*	unsigned long ma_isqrt64(unsigned_long_long_t x);
+*	unsigned long ma_icbrt64(unsigned_long_long_t x);
+*
+*   FUNCTION
+*	Compute floor(sqrt(x)) or floor(cbrt(x)) exactly, without
+*	going through floating point. The result r is the largest
+*	integer with r*r <= x (r*r*r <= x).
+*
+*   INPUTS
+*	x - Any value.
+*
+*   RESULT
+*	r - The integer root. It fits 16 bits (11 for the cube root)
+*	    for a 32-bit x and 32 bits (22) for a 64-bit x.
+*
+*   EXAMPLE
+*	unsigned long r = ma_isqrt32(0xFFFFFFFFUL);    (65535)
+*	unsigned long c = ma_icbrt32(1000000UL);       (100)
+*
+*   NOTES
+*	ma.lib extension. sqrt() of a double is exact only below 2**53
+*	and needs the FPU or a software float; these need neither.
+*
+*   SEE ALSO
+*	ma_ilog2_32(), sqrt(), cbrt(), amiga/intmath.h
+*
+******************************************************************************/
+
+unsigned long ma_isqrt32(unsigned long x)
+{
+    unsigned long y, q;
+    int l, s;
+
+    if (x == 0) return 0;
+    l = 32 - __ma_clz32(x);
+    s = (l > 8) ? ((l - 7) & ~1) : 0;
+    y = ((((unsigned long)sqrt_tab[x >> s] + 1) << (s >> 1)) + 15) >> 4;
+    for (;;) {
+        q = x / y;
+        if (q >= y) return y;
+        y = q + ((y - q) >> 1);
+    }
+}
+
+unsigned long ma_icbrt32(unsigned long x)
+{
+    unsigned long y, q;
+    int l, s;
+
+    if (x == 0) return 0;
+    l = 32 - __ma_clz32(x);
+    s = (l > 8) ? 3*((l - 6)/3) : 0;
+    y = ((((unsigned long)cbrt_tab[x >> s] + 1) << (s/3)) + 31) >> 5;
+    for (;;) {
+        q = x / (y*y);
+        if (q >= y) return y;
+        y = (2*y + q)/3;
+    }
+}
+
+unsigned long ma_isqrt64(unsigned_long_long_t x)
+{
+    unsigned_long_long_t q;
+    unsigned long y, c, hi, lo;
+    int s;
+
+    if (x.hi == 0) return ma_isqrt32(x.lo);
+
+    /* root of the top 31 or 32 bits, rounded up and scaled back */
+    s = (33 - __ma_clz32(x.hi)) & ~1;
+    q = x;
+    shr64(&q, s);
+    c = ma_isqrt32(q.lo) + 1;
+    y = (c > 0xFFFFUL && s == 32) ? 0xFFFFFFFFUL : c << (s >> 1);
+
+    /* the seed is within 2**(s/2) of the root; one step leaves y at most 1 over */
+    udiv64_32(&x, y, &q);
+    if (q.hi != 0 || q.lo >= y) return y;
+    y = q.lo + ((y - q.lo) >> 1);
+    __fix_umul(y, y, &hi, &lo);
+    if (hi > x.hi || (hi == x.hi && lo > x.lo)) y--;
+    return y;
+}
+
+unsigned long ma_icbrt64(unsigned_long_long_t x)
+{
+    unsigned_long_long_t q;
+    unsigned long y;
+    int s;
+
+    if (x.hi == 0) return ma_icbrt32(x.lo);
+
+    s = 3*((34 - __ma_clz32(x.hi))/3);
+    q = x;
+    shr64(&q, s);
+    y = (ma_icbrt32(q.lo) + 1) << (s/3);
+
+    /* one step leaves y at most 3 over the root */
+    udiv64_32(&x, y, &q);
+    udiv64_32(&q, y, &q);
+    if (q.hi != 0 || q.lo >= y) return y;
+    y = (2*y + q.lo)/3;
+    while (cube_gt(y, &x)) y--;
+    return y;
+}
+
+/****** ma.lib/ma_ilog2_32 **************************************************
+*
+*   NAME	
+* 	ma_ilog2_32 -- Integer base 2 or base 10 logarithm. (V1.0)
+*
+*   SYNOPSIS
+*	int e = ma_ilog2_32(unsigned long x);
+*	 D0		     D0
+*	int ma_ilog2_32(unsigned long x);
+*	int ma_ilog10_32(unsigned long x);
+*	int ma_ilog2_64(unsigned_long_long_t x);
+*	int ma_ilog10_64(unsigned_long_long_t x);
+*
+*   FUNCTION
+*	Compute floor(log2(x)) or floor(log10(x)) exactly: the
+*	position of the top set bit, or one less than the number of
+*	decimal digits.
+*
+*   INPUTS
+*	x - Any value.
+*
+*   RESULT
+*	e - The logarithm, or -1 if x is 0.
+*
+*   EXAMPLE
+*	int bits = ma_ilog2_32(1000UL) + 1;       (10)
+*	int digits = ma_ilog10_32(1000UL) + 1;    (4)
+*
+*   NOTES
+*	ma.lib extension. Unlike (int)log10((double)x), exact at every
+*	power of ten.
+*
+*   SEE ALSO
+*	ma_clz32(), ilogb(), amiga/intmath.h
+*
+******************************************************************************/
+
+int ma_ilog2_32(unsigned long x)
+{
+    return 31 - __ma_clz32(x);
+}
+
+int ma_ilog10_32(unsigned long x)
+{
+    int t;
+
+    if (x == 0) return -1;
+    t = ((32 - __ma_clz32(x))*1233) >> 12;    /* 1233/4096 ~ log10(2) */
+    return t - (x < pow10_32[t]);
+}
+
+int ma_ilog2_64(unsigned_long_long_t x)
+{
+    if (x.hi != 0) return 63 - __ma_clz32(x.hi);
+    return 31 - __ma_clz32(x.lo);
+}
+
+int ma_ilog10_64(unsigned_long_long_t x)
+{
+    int t;
+
+    if (x.hi == 0) return ma_ilog10_32(x.lo);
+    t = ((64 - __ma_clz32(x.hi))*1233) >> 12;
+    return t - (x.hi < pow10_64[t][0] ||
+                (x.hi == pow10_64[t][0] && x.lo < pow10_64[t][1]));
+}
+
+/****** ma.lib/ma_gcd32 *****************************************************
+*
+*   NAME	
+* 	ma_gcd32 -- Greatest common divisor or least common multiple. (V1.0)
+*
+*   SYNOPSIS
+*	unsigned long g = ma_gcd32(unsigned long a, unsigned long b);
+*	 D0			    D0		    D1
+*	unsigned long ma_gcd32(unsigned long a, unsigned long b);
+*	unsigned long ma_lcm32(unsigned long a, unsigned long b);
+*	unsigned_long_long_t ma_gcd64(unsigned_long_long_t a,
+*	                              unsigned_long_long_t b);
+*	unsigned_long_long_t ma_lcm64(unsigned_long_long_t a,
+*	                              unsigned_long_long_t b);
+*
+*   FUNCTION
+*	Compute the largest value that divides both a and b, or the
+*	smallest that both a and b divide.
+*
+*   INPUTS
+*	a, b - Any values.
+*
+*   RESULT
+*	g - gcd(a, 0) is a; lcm(a, 0) is 0. If the lcm does not fit,
+*	    the result is 0 and errno is set to ERANGE.
+*
+*   EXAMPLE
+*	unsigned long g = ma_gcd32(1071UL, 462UL);    (21)
+*	unsigned long l = ma_lcm32(4UL, 6UL);         (12)
+*
+*   NOTES
+*	ma.lib extension. Stein's binary algorithm: shifts and
+*	subtractions only, with no division.
+*
+*   SEE ALSO
+*	ma_mulmod32(), amiga/intmath.h
+*
+******************************************************************************/
+
+unsigned long ma_gcd32(unsigned long a, unsigned long b)
+{
+    unsigned long t;
+    int k;
+
+    if (a == 0) return b;
+    if (b == 0) return a;
+    t = a | b;
+    k = __ma_ctz32(t);
+    a >>= __ma_ctz32(a);
+    do {
+        b >>= __ma_ctz32(b);
+        if (a > b) {
+            t = a; a = b; b = t;
+        }
+        b -= a;
+    } while (b != 0);
+    return a << k;
+}
+
+unsigned long ma_lcm32(unsigned long a, unsigned long b)
+{
+    unsigned long hi, lo;
+
+    if (a == 0 || b == 0) return 0;
+    __fix_umul(a / ma_gcd32(a, b), b, &hi, &lo);
+    if (hi != 0) {
+        errno = ERANGE;
+        return 0;
+    }
+    return lo;
+}
+
+unsigned_long_long_t ma_gcd64(unsigned_long_long_t a, unsigned_long_long_t b)
+{
+    unsigned_long_long_t t;
+    int k;
+
+    if ((a.hi | a.lo) == 0) return b;
+    if ((b.hi | b.lo) == 0) return a;
+    t.hi = a.hi | b.hi;
+    t.lo = a.lo | b.lo;
+    k = ma_ctz64(t);
+    shr64(&a, ma_ctz64(a));
+    do {
+        shr64(&b, ma_ctz64(b));
+        if (LT64(b, a)) {
+            t = a; a = b; b = t;
+        }
+        sub64(&b, &a);
+    } while ((b.hi | b.lo) != 0);
+    if (k >= 32) {
+        a.hi = a.lo << (k - 32);
+        a.lo = 0;
+    } else if (k > 0) {
+        a.hi = (a.hi << k) | (a.lo >> (32 - k));
+        a.lo <<= k;
+    }
+    return a;
+}
+
+unsigned_long_long_t ma_lcm64(unsigned_long_long_t a, unsigned_long_long_t b)
+{
+    ma_ulldivider d;
+    unsigned_long_long_t hi, lo;
+
+    lo.hi = lo.lo = 0;
+    if ((a.hi | a.lo) == 0 || (b.hi | b.lo) == 0) return lo;
+    ma_ulldiv_init(&d, ma_gcd64(a, b));
+    a = ma_ulldiv_apply(&d, a);
+    __ma_umul64(&a, &b, &hi, &lo);
+    if ((hi.hi | hi.lo) != 0) {
+        errno = ERANGE;
+        lo.hi = lo.lo = 0;
+    }
+    return lo;
+}
+
+/****** ma.lib/ma_mulmod32 **************************************************
+*
+*   NAME	
+* 	ma_mulmod32 -- Modular multiply or power without overflow. (V1.0)
+*
+*   SYNOPSIS
+*	unsigned long r = ma_mulmod32(unsigned long a, unsigned long b,
+*	 D0			       D0		D1
+*	                              unsigned long m);
+*	                              D2
+*	unsigned long ma_mulmod32(unsigned long a, unsigned long b,
+*	                          unsigned long m);
+*	unsigned long ma_powmod32(unsigned long b, unsigned long e,
+*	                          unsigned long m);
+*	unsigned_long_long_t ma_mulmod64(unsigned_long_long_t a,
+*	                   unsigned_long_long_t b, unsigned_long_long_t m);
+*	unsigned_long_long_t ma_powmod64(unsigned_long_long_t b,
+*	                   unsigned_long_long_t e, unsigned_long_long_t m);
+*
+*   FUNCTION
+*	Compute a*b mod m, or b**e mod m, for any a, b and m. The
+*	product is formed at double width, so the result is right even
+*	when a*b does not fit.
+*
+*   INPUTS
+*	a, b - Factors, or the base.
+*	e - Exponent; b**0 is 1 (mod m).
+*	m - Modulus.
+*
+*   RESULT
+*	r - The residue, 0 to m-1. If m is 0, the result is 0 and
+*	    errno is set to EDOM.
+*
+*   EXAMPLE
+*	unsigned long r = ma_powmod32(2UL, 1000000UL, 1000000007UL);
+*
+*   NOTES
+*	ma.lib extension. For hashing, modular inverses and primality
+*	tests. The 64-bit forms reduce bit by bit and are much slower
+*	than the 32-bit ones.
+*
+*   SEE ALSO
+*	ma_gcd32(), ma_uldiv_init(), amiga/intmath.h
+*
+******************************************************************************/
+
+unsigned long ma_mulmod32(unsigned long a, unsigned long b, unsigned long m)
+{
+    unsigned long hi, lo, r;
+
+    if (m == 0) {
+        errno = EDOM;
+        return 0;
+    }
+    __fix_umul(a, b, &hi, &lo);
+    __fix_udiv(hi % m, lo, m, &r);
+    return r;
+}
+
+unsigned long ma_powmod32(unsigned long b, unsigned long e, unsigned long m)
+{
+    unsigned long r;
+
+    if (m == 0) {
+        errno = EDOM;
+        return 0;
+    }
+    r = 1 % m;
+    b %= m;
+    while (e != 0) {
+        if (e & 1) r = ma_mulmod32(r, b, m);
+        e >>= 1;
+        if (e != 0) b = ma_mulmod32(b, b, m);
+    }
+    return r;
+}
+
+unsigned_long_long_t ma_mulmod64(unsigned_long_long_t a, unsigned_long_long_t b,
+                                 unsigned_long_long_t m)
+{
+    unsigned_long_long_t hi, lo, r;
+
+    if ((m.hi | m.lo) == 0) {
+        errno = EDOM;
+        r.hi = r.lo = 0;
+        return r;
+    }
+    __ma_umul64(&a, &b, &hi, &lo);
+    mod128(&hi, &lo, &m, &r);
+    return r;
+}
+
+unsigned_long_long_t ma_powmod64(unsigned_long_long_t b, unsigned_long_long_t e,
+                                 unsigned_long_long_t m)
+{
+    unsigned_long_long_t r, zero;
+    int i;
+
+    zero.hi = zero.lo = 0;
+    if ((m.hi | m.lo) == 0) {
+        errno = EDOM;
+        return zero;
+    }
+    r.hi = 0;
+    r.lo = 1;
+    mod128(&zero, &r, &m, &r);
+    mod128(&zero, &b, &m, &b);
+
+    /* left to right over the bits of e */
+    for (i = ma_ilog2_64(e); i >= 0; i--) {
+        r = ma_mulmod64(r, r, m);
+        if (((i >= 32 ? e.hi >> (i - 32) : e.lo >> i) & 1) != 0)
+            r = ma_mulmod64(r, b, m);
+    }
+    return r;
+}
@@ -10,6 +10,8 @@
 #include <math.h>
 #include "include/internal/m99_math.h"
 
+#undef isinf
+
 /****** ma.lib/isinf ********************************************************
 * 
 *   NAME	
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * void ma_j0y0(double x, double *j, double *y)
+ * Bessel functions of the first and second kind of order zero,
+ * evaluated together.
+ */
+
+#include <math.h>
+#include "include/internal/m99_math.h"
+
+/* Shared Bessel kernels - see bessel.c */
+extern void __bessel_j0y0_asym(double x, double *j, double *y);
+extern double __bessel_y0_small(double x, double j0x);
+
+static const double one = 1.0;
+
+/****** ma.lib/ma_j0y0 ******************************************************
+* 
+*   NAME	
+* 	ma_j0y0 -- Return Bessel functions J0(x) and Y0(x) together. (V1.0)
+*
+*   SYNOPSIS
+*	ma_j0y0(double x, double *j, double *y);
+*	          D0         A0         A1
+*	void ma_j0y0(double x, double *j, double *y);
+*
+*   FUNCTION
+*	Compute the Bessel functions of the first and second kind of order
+*	zero for the same argument. For x >= 2 both results come from a
+*	single evaluation of the asymptotic P0/Q0 approximations, a single
+*	sin/cos argument reduction and a single sqrt, so the pair costs
+*	little more than one of j0() or y0() alone.
+* 
+*   INPUTS
+*	x - Input value.
+*	j - Pointer to store J0(x).
+*	y - Pointer to store Y0(x).
+*	
+*   RESULT
+*	None. *j is set exactly as j0(x) would return and *y exactly as
+*	y0(x) would return, including the special cases: *y is -Infinity
+*	for x = 0 and NaN for x < 0 or NaN.
+* 
+*   EXAMPLE
+*	double j, y;
+*	ma_j0y0(10.0, &j, &y);
+*
+*   NOTES
+*	Cylindrical wave solvers normally need J and Y together; this
+*	avoids paying for the shared work twice.
+* 
+*   SEE ALSO
+*	j0(), y0(), ma_j1y1(), math.h
+* 
+******************************************************************************/
+
+void ma_j0y0(double x, double *j, double *y)
+{
+    int hx, ix, lx;
+
+    hx = __HI(x);
+    ix = 0x7fffffff&hx;
+    lx = __LO(x);
+    if(ix>=0x7ff00000) {	/* NaN or Inf */
+        *j = one/(x*x);
+        *y = one/(x+x*x);
+        return;
+    }
+    if((ix|lx)==0) {
+        *j = one;
+        *y = -one/__ma_zero;
+        return;
+    }
+    if(hx<0) {
+        *j = j0(x);
+        *y = __ma_zero/__ma_zero;
+        return;
+    }
+    if(ix >= 0x40000000) {	/* x >= 2.0 */
+        __bessel_j0y0_asym(x, j, y);
+        return;
+    }
+    *j = j0(x);
+    *y = __bessel_y0_small(x, *j);
+}
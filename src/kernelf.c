@@ -0,0 +1,577 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Based on fdlibm/e_expf.c, e_logf.c, s_atanf.c, e_atan2f.c, s_asinhf.c
+ * and e_sqrtf.c
+ * Conversion to float by Ian Lance Taylor, Cygnus Support, ian@cygnus.com.
+ * Copyright (C) 1993 by Sun Microsystems, Inc. All rights reserved.
+ *
+ * Developed at SunSoft, a Sun Microsystems, Inc. business.
+ * Permission to use, copy, modify, and distribute this
+ * software is freely granted, provided that this notice
+ * is preserved.
+ *
+ * Float kernels shared by the float complex functions (cexpf, csinf,
+ * catanhf, ...). Everything here is evaluated in float arithmetic so
+ * that the float_complex family never widens its work to double. The
+ * one exception is the sin/cos argument reduction for |x| > pi/4,
+ * which uses the double __ieee754_rem_pio2 so that the reduced
+ * argument is accurate to the last float bit.
+ */
+
+#include <math.h>
+#include "include/internal/m99_math.h"
+#include "include/internal/bits.h"
+
+extern int __ieee754_rem_pio2(double x, double *y);
+
+float __kernel_expf(float x);
+float __kernel_logf(float x);
+float __kernel_log1pf(float x);
+float __kernel_asinhf(float x);
+float __kernel_atanf(float x);
+float __kernel_sqrtf(float x);
+
+static const float
+one      = 1.0f,
+half     = 0.5f,
+two      = 2.0f,
+huge     = 1.0e+30f,
+twom100  = 7.8886090522e-31f,	/* 2**-100   0x0d800000 */
+two25    = 3.3554432000e+07f,	/* 0x4c000000 */
+o_threshold = 8.8721679688e+01f,	/* 0x42b17180 */
+u_threshold = -1.0397208405e+02f,	/* 0xc2cff1b5 */
+ln2HI[2] = { 6.9314575195e-01f,	/* 0x3f317200 */
+            -6.9314575195e-01f },	/* 0xbf317200 */
+ln2LO[2] = { 1.4286067653e-06f,	/* 0x35bfbe8e */
+            -1.4286067653e-06f },	/* 0xb5bfbe8e */
+invln2   = 1.4426950216e+00f,	/* 0x3fb8aa3b */
+P1 =  1.6666667163e-01f,	/* 0x3e2aaaab */
+P2 = -2.7777778450e-03f,	/* 0xbb360b61 */
+P3 =  6.6137559770e-05f,	/* 0x388ab355 */
+P4 = -1.6533901999e-06f,	/* 0xb5ddea0e */
+P5 =  4.1381369442e-08f,	/* 0x3331bb4c */
+ln2_hi = 6.9313812256e-01f,	/* 0x3f317180 */
+ln2_lo = 9.0580006145e-06f,	/* 0x3717f7d1 */
+ln2    = 6.9314718246e-01f,	/* 0x3f317218 */
+Lg1 = 6.6666668653e-01f,	/* 3F2AAAAB */
+Lg2 = 4.0000000596e-01f,	/* 3ECCCCCD */
+Lg3 = 2.8571429849e-01f,	/* 3E924925 */
+Lg4 = 2.2222198546e-01f,	/* 3E638E29 */
+Lg5 = 1.8183572590e-01f,	/* 3E3A3325 */
+Lg6 = 1.5313838422e-01f,	/* 3E1CD04F */
+Lg7 = 1.4798198640e-01f;	/* 3E178897 */
+
+static const float atanhi[] = {
+  4.6364760399e-01f, /* atan(0.5)hi 0x3eed6338 */
+  7.8539812565e-01f, /* atan(1.0)hi 0x3f490fda */
+  9.8279368877e-01f, /* atan(1.5)hi 0x3f7b985e */
+  1.5707962513e+00f, /* atan(inf)hi 0x3fc90fda */
+};
+
+static const float atanlo[] = {
+  5.0121582440e-09f, /* atan(0.5)lo 0x31ac3769 */
+  3.7748947079e-08f, /* atan(1.0)lo 0x33222168 */
+  3.4473217170e-08f, /* atan(1.5)lo 0x33140fb4 */
+  7.5497894159e-08f, /* atan(inf)lo 0x33a22168 */
+};
+
+static const float aT[] = {
+  3.3333334327e-01f, /* 0x3eaaaaaa */
+ -2.0000000298e-01f, /* 0xbe4ccccd */
+  1.4285714924e-01f, /* 0x3e124925 */
+ -1.1111110449e-01f, /* 0xbde38e38 */
+  9.0908870101e-02f, /* 0x3dba2e6e */
+ -7.6918758452e-02f, /* 0xbd9d8795 */
+  6.6610731184e-02f, /* 0x3d886b35 */
+ -5.8335702866e-02f, /* 0xbd6ef16b */
+  4.9768779427e-02f, /* 0x3d4bda59 */
+ -3.6531571299e-02f, /* 0xbd15a221 */
+  1.6285819933e-02f, /* 0x3c8569d7 */
+};
+
+static const float
+pi_o_2  = 1.5707963705e+00f,	/* 0x3fc90fdb */
+pi      = 3.1415927410e+00f,	/* 0x40490fdb */
+pi_lo   = -8.7422776573e-08f;	/* 0xb3bbbd2e */
+
+/*
+ * Taylor coefficients for sin and cos on [-pi/4, pi/4]. Truncating
+ * after x**11 and x**12 leaves an error below 2**-28 relative.
+ */
+static const float
+S1 = -1.6666667163e-01f,	/* -1/3!  */
+S2 =  8.3333337680e-03f,	/*  1/5!  */
+S3 = -1.9841270114e-04f,	/* -1/7!  */
+S4 =  2.7557319973e-06f,	/*  1/9!  */
+S5 = -2.5052108385e-08f,	/* -1/11! */
+C1 =  4.1666667908e-02f,	/*  1/4!  */
+C2 = -1.3888889225e-03f,	/* -1/6!  */
+C3 =  2.4801587642e-05f,	/*  1/8!  */
+C4 = -2.7557319223e-07f,	/* -1/10! */
+C5 =  2.0876756588e-09f;	/*  1/12! */
+
+static float absf(float x)
+{
+    __HI(x) &= 0x7fffffff;
+    return x;
+}
+
+/*
+ * __kernel_expf(x)
+ * Return exp(x) in float, following fdlibm e_exp.c: reduce
+ * x = k*ln2 + r with |r| <= 0.5*ln2, approximate exp(r) with the
+ * Remez polynomial of e_exp.c and scale by 2**k.
+ */
+float __kernel_expf(float x)
+{
+    float y, hi, lo, c, t;
+    int k, xsb;
+    int hx;
+
+    k = 0;
+    hi = lo = __ma_zerof;
+    hx = __HI(x);
+    xsb = (hx>>31)&1;		/* sign bit of x */
+    hx &= 0x7fffffff;		/* high word of |x| */
+
+    /* filter out non-finite argument */
+    if(hx >= 0x42b17218) {		/* if |x|>=88.721... */
+        if(hx>0x7f800000)
+            return x+x;		/* NaN */
+        if(hx==0x7f800000)
+            return (xsb==0)? x:0.0f;	/* exp(+-inf)={inf,0} */
+        if(x > o_threshold) return huge*huge; /* overflow */
+        if(x < u_threshold) return twom100*twom100; /* underflow */
+    }
+
+    /* argument reduction */
+    if(hx > 0x3eb17218) {		/* if  |x| > 0.5 ln2 */
+        if(hx < 0x3F851592) {	/* and |x| < 1.5 ln2 */
+            hi = x-ln2HI[xsb]; lo=ln2LO[xsb]; k = 1-xsb-xsb;
+        } else {
+            k  = (int)(invln2*x+((xsb==0)?half:-half));
+            t  = k;
+            hi = x - t*ln2HI[0];	/* t*ln2HI is exact here */
+            lo = t*ln2LO[0];
+        }
+        x  = hi - lo;
+    }
+    else if(hx < 0x31800000) {	/* when |x|<2**-28 */
+        if(huge+x>one) return one+x;/* trigger inexact */
+    }
+
+    /* x is now in primary range */
+    t  = x*x;
+    c  = x - t*(P1+t*(P2+t*(P3+t*(P4+t*P5))));
+    if(k==0) return one-((x*c)/(c-two)-x);
+    else     y = one-((lo-(x*c)/(two-c))-hi);
+    if(k >= -125) {
+        hx = __HI(y);
+        __HI(y) = hx+(k<<23);	/* add k to y's exponent */
+        return y;
+    } else {
+        hx = __HI(y);
+        __HI(y) = hx+((k+100)<<23);	/* add k to y's exponent */
+        return y*twom100;
+    }
+}
+
+/*
+ * __kernel_logf(x)
+ * Return log(x) in float, following fdlibm e_log.c: reduce
+ * x = 2**k * (1+f) with sqrt(2)/2 < 1+f < sqrt(2) and approximate
+ * log(1+f) = f - f*f/2 + s*(f*f/2 + R), s = f/(2+f).
+ */
+float __kernel_logf(float x)
+{
+    float hfsq, f, s, z, R, w, t1, t2, dk;
+    int k, ix, i, j;
+
+    ix = __HI(x);
+
+    k = 0;
+    if(ix < 0x00800000) {		/* x < 2**-126  */
+        if((ix&0x7fffffff)==0)
+            return -two25/__ma_zerof;	/* log(+-0)=-inf */
+        if(ix<0) return (x-x)/__ma_zerof;	/* log(-#) = NaN */
+        k -= 25; x *= two25;	/* subnormal number, scale up x */
+        ix = __HI(x);
+    }
+    if(ix >= 0x7f800000) return x+x;
+    k += (ix>>23)-127;
+    ix &= 0x007fffff;
+    i = (ix+(0x95f64<<3))&0x800000;
+    __HI(x) = ix|(i^0x3f800000);	/* normalize x or x/2 */
+    k += (i>>23);
+    f = x-one;
+    if((0x007fffff&(15+ix))<16) {	/* |f| < 2**-20 */
+        if(f==__ma_zerof) {
+            if(k==0) return __ma_zerof;
+            dk = (float)k;
+            return dk*ln2_hi+dk*ln2_lo;
+        }
+        R = f*f*(half-0.33333333333333333f*f);
+        if(k==0) return f-R;
+        dk = (float)k;
+        return dk*ln2_hi-((R-dk*ln2_lo)-f);
+    }
+    s = f/(two+f);
+    dk = (float)k;
+    z = s*s;
+    i = ix-(0x6147a<<3);
+    w = z*z;
+    j = (0x6b851<<3)-ix;
+    t1 = w*(Lg2+w*(Lg4+w*Lg6));
+    t2 = z*(Lg1+w*(Lg3+w*(Lg5+w*Lg7)));
+    i |= j;
+    R = t2+t1;
+    if(i>0) {
+        hfsq = half*f*f;
+        if(k==0) return f-(hfsq-s*(hfsq+R));
+        return dk*ln2_hi-((hfsq-(s*(hfsq+R)+dk*ln2_lo))-f);
+    } else {
+        if(k==0) return f-s*(f-R);
+        return dk*ln2_hi-((s*(f-R)-dk*ln2_lo)-f);
+    }
+}
+
+/*
+ * __kernel_log1pf(x)
+ * Return log(1+x) in float. With u = 1+x rounded and c the rounding
+ * error committed in forming u, log1p(x) = log(u) + c/u.
+ */
+float __kernel_log1pf(float x)
+{
+    float u, c;
+
+    u = one+x;
+    if(u==one) return x;
+    if(u>two) c = one-(u-x);
+    else      c = x-(u-one);
+    return __kernel_logf(u)+c/u;
+}
+
+/*
+ * __kernel_asinhf(x)
+ * Return asinh(x) in float, following fdlibm s_asinh.c.
+ */
+float __kernel_asinhf(float x)
+{
+    float t, w;
+    int hx, ix;
+
+    hx = __HI(x);
+    ix = hx&0x7fffffff;
+    if(ix>=0x7f800000) return x+x;	/* x is inf or NaN */
+    if(ix< 0x31800000) {		/* |x|<2**-28 */
+        if(huge+x>one) return x;	/* return x inexact except 0 */
+    }
+    if(ix>0x4d800000) {		/* |x| > 2**28 */
+        w = __kernel_logf(absf(x))+ln2;
+    } else if(ix>0x40000000) {	/* 2**28 > |x| > 2.0 */
+        t = absf(x);
+        w = __kernel_logf(two*t+one/(__kernel_sqrtf(x*x+one)+t));
+    } else {			/* 2.0 > |x| > 2**-28 */
+        t = x*x;
+        w = __kernel_log1pf(absf(x)+t/(one+__kernel_sqrtf(one+t)));
+    }
+    return (hx>0)? w: -w;
+}
+
+/*
+ * __kernel_sincosf(x, s, c)
+ * Store sin(x) and cos(x) in *s and *c. The polynomials are float
+ * Taylor series on [-pi/4, pi/4]; larger arguments are first reduced
+ * by a multiple of pi/2.
+ */
+void __kernel_sincosf(float x, float *s, float *c)
+{
+    double y[2];
+    float z, sn, cs;
+    int ix, n;
+
+    ix = __HI(x)&0x7fffffff;
+    if(ix >= 0x7f800000) {		/* sin(Inf or NaN) is NaN */
+        *s = *c = x-x;
+        return;
+    }
+    n = 0;
+    if(ix > 0x3f490fd8) {		/* |x| > pi/4 */
+        n = __ieee754_rem_pio2((double)x, y);
+        x = (float)(y[0]+y[1]);
+    } else if(ix < 0x39800000) {	/* |x| < 2**-12 */
+        *s = x;
+        *c = one;
+        return;
+    }
+    z  = x*x;
+    sn = x+x*z*(S1+z*(S2+z*(S3+z*(S4+z*S5))));
+    cs = one-half*z+z*z*(C1+z*(C2+z*(C3+z*(C4+z*C5))));
+    switch(n&3) {
+        case 0:  *s =  sn; *c =  cs; break;
+        case 1:  *s =  cs; *c = -sn; break;
+        case 2:  *s = -sn; *c = -cs; break;
+        default: *s = -cs; *c =  sn; break;
+    }
+}
+
+/*
+ * __kernel_atanf(x)
+ * Return atan(x) in float, following fdlibm s_atan.c: reduce to
+ * |x| < 7/16 against atan(0.5), atan(1), atan(1.5) and atan(inf),
+ * then sum the odd series in two halves.
+ */
+float __kernel_atanf(float x)
+{
+    float w, s1, s2, z;
+    int ix, hx, id;
+
+    hx = __HI(x);
+    ix = hx&0x7fffffff;
+    if(ix>=0x4c000000) {		/* if |x| >= 2^25 */
+        if(ix>0x7f800000)
+            return x+x;		/* NaN */
+        if(hx>0) return  atanhi[3]+atanlo[3];
+        else     return -atanhi[3]-atanlo[3];
+    }
+    if(ix < 0x3ee00000) {		/* |x| < 0.4375 */
+        if(ix < 0x31000000) {	/* |x| < 2^-29 */
+            if(huge+x>one) return x;	/* raise inexact */
+        }
+        id = -1;
+    } else {
+        x = absf(x);
+        if(ix < 0x3f980000) {		/* |x| < 1.1875 */
+            if(ix < 0x3f300000) {	/* 7/16 <=|x|<11/16 */
+                id = 0; x = (2.0f*x-one)/(2.0f+x);
+            } else {			/* 11/16<=|x|< 19/16 */
+                id = 1; x  = (x-one)/(x+one);
+            }
+        } else {
+            if(ix < 0x401c0000) {	/* |x| < 2.4375 */
+                id = 2; x  = (x-1.5f)/(one+1.5f*x);
+            } else {			/* 2.4375 <= |x| < 2^25 */
+                id = 3; x  = -1.0f/x;
+            }
+        }
+    }
+    /* end of argument reduction */
+    z = x*x;
+    w = z*z;
+    /* break sum from i=0 to 10 aT[i]z**(i+1) into odd and even poly */
+    s1 = z*(aT[0]+w*(aT[2]+w*(aT[4]+w*(aT[6]+w*(aT[8]+w*aT[10])))));
+    s2 = w*(aT[1]+w*(aT[3]+w*(aT[5]+w*(aT[7]+w*aT[9]))));
+    if(id<0) return x - x*(s1+s2);
+    z = atanhi[id] - ((x*(s1+s2) - atanlo[id]) - x);
+    return (hx<0)? -z:z;
+}
+
+/*
+ * __kernel_atan2f(y, x)
+ * Return atan2(y, x) in float, following fdlibm e_atan2.c.
+ */
+float __kernel_atan2f(float y, float x)
+{
+    float z;
+    int k, m, hx, hy, ix, iy;
+
+    hx = __HI(x);
+    ix = hx&0x7fffffff;
+    hy = __HI(y);
+    iy = hy&0x7fffffff;
+    if((ix>0x7f800000)||(iy>0x7f800000))	/* x or y is NaN */
+        return x+y;
+    if(hx==0x3f800000) return __kernel_atanf(y);	/* x=1.0 */
+    m = ((hy>>31)&1)|((hx>>30)&2);	/* 2*sign(x)+sign(y) */
+
+    /* when y = 0 */
+    if(iy==0) {
+        switch(m) {
+            case 0:
+            case 1: return y;		/* atan(+-0,+anything)=+-0 */
+            case 2: return  pi+twom100;	/* atan(+0,-anything) = pi */
+            case 3: return -pi-twom100;	/* atan(-0,-anything) =-pi */
+        }
+    }
+    /* when x = 0 */
+    if(ix==0) return (hy<0)?  -pi_o_2-twom100: pi_o_2+twom100;
+
+    /* when x is INF */
+    if(ix==0x7f800000) {
+        if(iy==0x7f800000) {
+            switch(m) {
+                case 0: return  0.25f*pi+twom100;	/* atan(+INF,+INF) */
+                case 1: return -0.25f*pi-twom100;	/* atan(-INF,+INF) */
+                case 2: return  0.75f*pi+twom100;	/*atan(+INF,-INF)*/
+                case 3: return -0.75f*pi-twom100;	/*atan(-INF,-INF)*/
+            }
+        } else {
+            switch(m) {
+                case 0: return  __ma_zerof;		/* atan(+...,+INF) */
+                case 1: return -__ma_zerof;		/* atan(-...,+INF) */
+                case 2: return  pi+twom100;	/* atan(+...,-INF) */
+                case 3: return -pi-twom100;	/* atan(-...,-INF) */
+            }
+        }
+    }
+    /* when y is INF */
+    if(iy==0x7f800000) return (hy<0)? -pi_o_2-twom100: pi_o_2+twom100;
+
+    /* compute y/x */
+    k = (iy-ix)>>23;
+    if(k > 60) z=pi_o_2+0.5f*pi_lo;	/* |y/x| >  2**60 */
+    else if(hx<0&&k<-60) z=0.0f;	/* |y|/x < -2**60 */
+    else z=__kernel_atanf(absf(y/x));	/* safe to do y/x */
+    switch (m) {
+        case 0: return       z;	/* atan(+,+) */
+        case 1: return      -z;	/* atan(-,+) */
+        case 2: return  pi-(z-pi_lo);	/* atan(+,-) */
+        default:			/* case 3 */
+                return  (z-pi_lo)-pi;	/* atan(-,-) */
+    }
+}
+
+/*
+ * __kernel_sqrtf(x)
+ * Return correctly rounded sqrt(x), following fdlibm e_sqrt.c:
+ * the result is generated one bit at a time in integer arithmetic.
+ */
+float __kernel_sqrtf(float x)
+{
+    float z;
+    int sign = (int)0x80000000;
+    int ix, s, q, m, t, i;
+    unsigned int r;
+
+    ix = __HI(x);
+
+    /* take care of Inf and NaN */
+    if((ix&0x7f800000)==0x7f800000) {
+        return x*x+x;		/* sqrt(NaN)=NaN, sqrt(+inf)=+inf
+                                   sqrt(-inf)=sNaN */
+    }
+    /* take care of zero */
+    if(ix<=0) {
+        if((ix&(~sign))==0) return x;	/* sqrt(+-0) = +-0 */
+        else if(ix<0)
+            return (x-x)/(x-x);		/* sqrt(-ve) = sNaN */
+    }
+    /* normalize x */
+    m = (ix>>23);
+    if(m==0) {				/* subnormal x */
+        i = __ma_clz32(ix)-8;
+        ix <<= i;
+        m -= i-1;
+    }
+    m -= 127;	/* unbias exponent */
+    ix = (ix&0x007fffff)|0x00800000;
+    if(m&1)	/* odd m, double x to make it even */
+        ix += ix;
+    m >>= 1;	/* m = [m/2] */
+
+    /* generate sqrt(x) bit by bit */
+    ix += ix;
+    q = s = 0;		/* q = sqrt(x) */
+    r = 0x01000000;	/* r = moving bit from right to left */
+
+    while(r!=0) {
+        t = s+r;
+        if(t<=ix) {
+            s    = t+r;
+            ix  -= t;
+            q   += r;
+        }
+        ix += ix;
+        r>>=1;
+    }
+
+    /* use floating add to find out rounding direction */
+    if(ix!=0) {
+        z = one-1.0e-30f;	/* trigger inexact flag */
+        if(z>=one) {
+            z = one+1.0e-30f;
+            if(z>one)
+                q += 2;
+            else
+                q += (q&1);
+        }
+    }
+    ix = (q>>1)+0x3f000000;
+    ix += (m <<23);
+    __HI(z) = ix;
+    return z;
+}
+
+/*
+ * __kernel_hypotf(x, y)
+ * Return sqrt(x*x+y*y) in float without undue overflow or underflow,
+ * by scaling both arguments into a safe range first.
+ */
+float __kernel_hypotf(float x, float y)
+{
+    float a, b, t, scale;
+    int ha, hb;
+
+    a = absf(x);
+    b = absf(y);
+    if(b > a) { t = a; a = b; b = t; }
+    ha = __HI(a);
+    hb = __HI(b);
+    if(ha >= 0x7f800000) {		/* Inf or NaN */
+        if(ha==0x7f800000) return a;	/* hypot(inf,nan) = inf */
+        if(hb==0x7f800000) return b;
+        return a+b;
+    }
+    if(hb==0) return a;
+    if(ha-hb > 0x0d000000) return a+b;	/* a/b > 2**26 */
+    scale = one;
+    if(ha > 0x5f000000) {		/* a > 2**63 */
+        scale = 1.8446744074e+19f;	/* 2**64 */
+        a *= 5.4210108624e-20f;	/* 2**-64 */
+        b *= 5.4210108624e-20f;
+    } else if(ha < 0x20000000) {	/* a < 2**-63 */
+        scale = 5.4210108624e-20f;
+        a *= 1.8446744074e+19f;
+        b *= 1.8446744074e+19f;
+    }
+    return scale*__kernel_sqrtf(a*a+b*b);
+}
+
+/*
+ * __kernel_sinhcoshf(x, sh, ch)
+ * Store sinh(x) and cosh(x) in *sh and *ch. Below |x| = 1 the Taylor
+ * series is used to avoid the cancellation in (e - 1/e)/2.
+ */
+void __kernel_sinhcoshf(float x, float *sh, float *ch)
+{
+    float ax, z, e;
+    int ix;
+
+    ix = __HI(x)&0x7fffffff;
+    if(ix >= 0x7f800000) {		/* Inf or NaN */
+        *sh = x;
+        *ch = x*x;
+        return;
+    }
+    ax = absf(x);
+    if(ix < 0x3f800000) {		/* |x| < 1 */
+        z = x*x;
+        *sh = x+x*z*(1.6666667163e-01f+z*(8.3333337680e-03f+
+              z*(1.9841270114e-04f+z*2.7557319973e-06f)));
+        *ch = one+half*z+z*z*(4.1666667908e-02f+z*(1.3888889225e-03f+
+              z*(2.4801587642e-05f+z*2.7557319223e-07f)));
+        return;
+    }
+    if(ix < 0x42b17180) {		/* |x| < 88.72 */
+        e = __kernel_expf(ax);
+        *ch = half*(e+one/e);
+        *sh = half*(e-one/e);
+    } else {				/* exp(|x|) overflows; split it */
+        e = __kernel_expf(half*ax);
+        *ch = (half*e)*e;
+        *sh = *ch;
+    }
+    if(x < __ma_zerof) *sh = -*sh;
+}
@@ -45,7 +45,7 @@ double lgamma_r(double x, int *signgamp);
 *	result - Log gamma of x. Returns +Infinity if x is 0 or negative
 *	        integer, NaN if x is NaN, +Infinity if x is +Infinity.
 *	        The sign of the gamma function is stored in the global
-*	        variable signgam.
+*	        variable signgam and in the calling task's ma_ctx.
 * 
 *   EXAMPLE
 *	double x = 5.0;
@@ -57,11 +57,66 @@ double lgamma_r(double x, int *signgamp);
 *	is stored in the global variable signgam.
 * 
 *   SEE ALSO
-*	tgamma(), gamma(), lgamma_r(), signgam, math.h
+*	tgamma(), gamma(), lgamma_r(), ma_lgamma_r(), signgam, math.h
 * 
 ******************************************************************************/
 
 double lgamma(double x)
 {
-    return lgamma_r(x, &signgam);
-}
\ No newline at end of file
+    ma_ctx *ctx = ma_ctx_current();
+    double y;
+
+    y = lgamma_r(x, &ctx->signgam);
+    signgam = ctx->signgam;
+    return y;
+}
+
+/****** ma.lib/ma_lgamma_r ***************************************************
+* 
+*   NAME	
+* 	ma_lgamma_r -- Return logarithm of gamma function (context). (V1.0)
+*
+*   SYNOPSIS
+*	double result = ma_lgamma_r(ma_ctx *ctx, double x);
+*	  D0		             A0          D0
+*	double ma_lgamma_r(ma_ctx *ctx, double x);
+*
+*   FUNCTION
+*	Compute the natural logarithm of the absolute value of the gamma
+*	function of x, as lgamma(), but store the sign of gamma(x) in
+*	ctx->signgam instead of the global variable signgam.
+* 
+*   INPUTS
+*	ctx - Math context to receive the sign and any error.
+*	x   - Input value.
+*	
+*   RESULT
+*	result - Log gamma of x, as lgamma(). At a pole the MA_FE_DIVBYZERO
+*	        flag is raised in ctx.
+* 
+*   EXAMPLE
+*	ma_ctx ctx;
+*	ma_ctx_init(&ctx);
+*	r = ma_lgamma_r(&ctx, -2.5);
+*	sign = ctx.signgam;
+*
+*   NOTES
+*	Writes only to ctx, never to signgam or errno, so it may be called
+*	from several tasks at once as long as each passes its own context.
+* 
+*   SEE ALSO
+*	lgamma(), lgamma_r(), ma_tgamma_r(), ma_ctx_init(), math.h
+* 
+******************************************************************************/
+
+double ma_lgamma_r(ma_ctx *ctx, double x)
+{
+    double y;
+
+    y = lgamma_r(x, &ctx->signgam);
+    if(!finite(y)&&finite(x)) {
+        ctx->error = M99_ERR_RANGE;
+        ctx->except |= MA_FE_DIVBYZERO;
+    }
+    return y;
+}
@@ -97,8 +97,6 @@ w4  = -5.95187557450339963135e-04, /* 0xBF4380CB, 0x8C0FE741 */
 w5  =  8.36339918996282139126e-04, /* 0x3F4B67BA, 0x4CDAD5D1 */
 w6  = -1.63092934096575273989e-03; /* 0xBF5AB89D, 0x0B9E43E4 */
 
-static double zero=  0.00000000000000000000e+00;
-
 static double sin_pi(double x)
 {
     double y, z;
@@ -106,7 +104,7 @@ static double sin_pi(double x)
 
     ix = 0x7fffffff&__HI(x);
 
-    if(ix<0x3fd00000) return __kernel_sin(pi*x,zero,0);
+    if(ix<0x3fd00000) return __kernel_sin(pi*x,__ma_zero,0);
     y = -x;		/* x is assume negative */
 
     /*
@@ -120,7 +118,7 @@ static double sin_pi(double x)
         n   = (int) (y*4.0);
     } else {
         if(ix>=0x43400000) {
-            y = zero; n = 0;                 /* y must be even */
+            y = __ma_zero; n = 0;                 /* y must be even */
         } else {
             if(ix<0x43300000) z = y+two52;	/* exact */
             n   = __LO(z)&1;        /* lower word of z */
@@ -129,14 +127,14 @@ static double sin_pi(double x)
         }
     }
     switch (n) {
-        case 0:   y =  __kernel_sin(pi*y,zero,0); break;
+        case 0:   y =  __kernel_sin(pi*y,__ma_zero,0); break;
         case 1:   
-        case 2:   y =  __kernel_cos(pi*(0.5-y),zero); break;
+        case 2:   y =  __kernel_cos(pi*(0.5-y),__ma_zero); break;
         case 3:  
-        case 4:   y =  __kernel_sin(pi*(one-y),zero,0); break;
+        case 4:   y =  __kernel_sin(pi*(one-y),__ma_zero,0); break;
         case 5:
-        case 6:   y = -__kernel_cos(pi*(y-1.5),zero); break;
-        default:  y =  __kernel_sin(pi*(y-2.0),zero,0); break;
+        case 6:   y = -__kernel_cos(pi*(y-1.5),__ma_zero); break;
+        default:  y =  __kernel_sin(pi*(y-2.0),__ma_zero,0); break;
     }
     return -y;
 }
@@ -191,7 +189,7 @@ double lgamma_r(double x, int *signgamp)
     *signgamp = 1;
     ix = hx&0x7fffffff;
     if(ix>=0x7ff00000) return x*x;
-    if((ix|lx)==0) return one/zero;
+    if((ix|lx)==0) return one/__ma_zero;
     if(ix<0x3b900000) {	/* |x|<2**-70, return -log(|x|) */
         if(hx<0) {
             *signgamp = -1;
@@ -200,11 +198,11 @@ double lgamma_r(double x, int *signgamp)
     }
     if(hx<0) {
         if(ix>=0x43300000) 	/* |x|>=2**52, must be -integer */
-            return one/zero;
+            return one/__ma_zero;
         t = sin_pi(x);
-        if(t==zero) return one/zero; /* -integer */
+        if(t==__ma_zero) return one/__ma_zero; /* -integer */
         nadj = __ieee754_log(pi/fabs(t*x));
-        if(t<zero) *signgamp = -1;
+        if(t<__ma_zero) *signgamp = -1;
         x = -x;
     }
 
@@ -218,7 +216,7 @@ double lgamma_r(double x, int *signgamp)
             else if(ix>=0x3FCDA661) {y= x-(tc-one); i=1;}
             else {y = x; i=2;}
         } else {
-            r = zero;
+            r = __ma_zero;
             if(ix>=0x3FFBB4C3) {y=2.0-x;i=0;} /* [1.7316,2] */
             else if(ix>=0x3FF3B4C4) {y=x-tc;i=1;} /* [1.23,1.73] */
             else {y=x-one;i=2;}
@@ -246,7 +244,7 @@ double lgamma_r(double x, int *signgamp)
     }
     else if(ix<0x40200000) { 			/* x < 8.0 */
         i = (int)x;
-        t = zero;
+        t = __ma_zero;
         y = x-(double)i;
         p = y*(s0+y*(s1+y*(s2+y*(s3+y*(s4+y*(s5+y*s6))))));
         q = one+y*(r1+y*(r2+y*(r3+y*(r4+y*(r5+y*r6)))));
@@ -9,18 +9,29 @@
 #include <limits.h>
 #include "include/internal/m99_math.h"
 #include "include/internal/longlong.h"
+#include "include/internal/fpu.h"
 
 /*
  * llrint(x)
  * Return x rounded to integral value according to the prevailing
  * rounding mode.
  * Method:
- *      Using floating addition.
+ *      For |x| < 2**51, x + 1.5*2**52 rounds x to an integer and
+ *      leaves it, biased by 0x4338000000000000, in the bits of the
+ *      sum. Between 2**51 and 2**52 adding and subtracting 2**52
+ *      rounds off the half; above that x is an integer and its
+ *      significand is shifted into place. Out of range values
+ *      saturate and NaN gives 0.
  * Exception:
  *      Inexact flag raised if x not equal to llrint(x).
  */
 
-static const double huge = 1.0e300;
+static const double
+magic = 6.75539944105574400000e+15,    /* 0x43380000, 0x00000000 */
+TWO52[2] = {
+     4.50359962737049600000e+15,        /* 0x43300000, 0x00000000 */
+    -4.50359962737049600000e+15,        /* 0xC3300000, 0x00000000 */
+};
 
 /****** ma.lib/llrint *******************************************************
 * 
@@ -42,8 +53,9 @@ static const double huge = 1.0e300;
 *	x - Input value. Range is [-∞, +∞].
 *	
 *   RESULT
-*	result - Nearest long long integer to x. Returns 0 if x is ±0, returns
-*	        NaN if x is NaN, returns ±Infinity if x is ±Infinity.
+*	result - Nearest long long integer to x. Values beyond the range
+*	        of long_long_t saturate to its minimum or maximum; NaN
+*	        gives 0.
 * 
 *   EXAMPLE
 *	double x = 3.7;
@@ -60,59 +72,48 @@ static const double huge = 1.0e300;
 
 long_long_t llrint(double x)
 {
-    int i0,i1,j0;
-    unsigned i,j;
-    i0 =  __HI(x);
-    i1 =  __LO(x);
+    long_long_t r;
+    double t;
+    int i0,j0,sx;
+    unsigned long m0,m1;
+
+    i0 = __HI(x);
+    sx = (i0>>31)&1;
     j0 = ((i0>>20)&0x7ff)-0x3ff;
-    if(j0<20) {
-        if(j0<0) {
-            if(huge+x>0.0) {        /* raise inexact if x != 0 */
-                if(j0==-1) return x>0.0?long_to_long_long(1):long_to_long_long(-1);
-                else return long_to_long_long(0);
-            }
-        } else {
-            i = (0x000fffff)>>j0;
-            if(((i0&i)|i1)==0) return long_to_long_long((long)x); /* x is integral */
-            if(huge+x>0.0) {        /* raise inexact flag */
-                if(i0>0) x += 0.5;
-                else x -= 0.5;
-                i0 = __HI(x);
-                i1 = __LO(x);
-                i0 &= (~i);
-                i1 = 0;
-            }
-        }
-    } else if (j0>51) {
-        if(j0==0x400) return long_to_long_long(0);   /* inf or NaN */
-        else return long_to_long_long((long)x);              /* x is integral */
-    } else {
-        i = ((unsigned)(0xffffffff))>>(j0-20);
-        if((i1&i)==0) return long_to_long_long((long)x);     /* x is integral */
-        if(huge+x>0.0) {            /* raise inexact flag */
-            if(i0>0) {
-                if(j0==20) i0+=1;
-                else {
-                    j = i1+(1<<(52-j0));
-                    if(j<i1) i0 +=1 ;       /* got a carry */
-                    i1=j;
-                }
-            } else {
-                if(j0==20) i0-=1;
-                else {
-                    j = i1 - (1<<(52-j0));
-                    if(j>i1) i0 -=1;        /* got a borrow */
-                    i1 = j;
-                }
-            }
+    if(j0<51) {                         /* |x| < 2**51 */
+        t = x+magic;
+        r.hi = __HI(t)-0x43380000;
+        r.lo = __LO(t);
+        return r;
+    }
+    if(j0>=63) {                        /* |x| >= 2**63, inf or NaN */
+        if(j0==0x400&&((i0&0x000fffff)|__LO(x))!=0) {
+            r.hi = r.lo = 0;
+            return r;
         }
+        return handle_overflow(sx);
+    }
+    if(j0==51) {                        /* round off the half */
+        STRICT_ASSIGN(double,t,x+TWO52[sx]);
+        x = t-TWO52[sx];
+        i0 = __HI(x);
+        j0 = ((i0>>20)&0x7ff)-0x3ff;
+    }
+    m0 = (i0&0x000fffff)|0x00100000;
+    m1 = __LO(x);
+    j0 -= 52;
+    if(j0>0) {
+        m0 = (m0<<j0)|(m1>>(32-j0));
+        m1 <<= j0;
+    } else if(j0<0) {                   /* 2**51 <= |x| < 2**52 */
+        m1 = (m1>>1)|(m0<<31);
+        m0 >>= 1;
+    }
+    if(sx) {                            /* negate */
+        m1 = ~m1+1;
+        m0 = ~m0+(m1==0);
     }
-    __HI(x) = i0;
-    __LO(x) = i1;
-    
-    /* Convert to long_long_t, checking for overflow */
-    if (x > (double)LONG_MAX) return get_long_long_max();
-    if (x < (double)LONG_MIN) return get_long_long_min();
-    
-    return long_to_long_long((long)x);
+    r.hi = m0;
+    r.lo = m1;
+    return r;
 }
@@ -12,16 +12,15 @@
 
 /*
  * llround(x)
- * Return x rounded to integral value according to the prevailing
- * rounding mode.
+ * Return x rounded to the nearest integer, halfway cases away
+ * from zero.
  * Method:
- *      Using floating addition.
+ *      round(x) is exact, so converting it with llrint() adds no
+ *      second rounding.
  * Exception:
  *      Inexact flag raised if x not equal to llround(x).
  */
 
-static const double huge = 1.0e300;
-
 /****** ma.lib/llround ******************************************************
 * 
 *   NAME	
@@ -41,8 +40,9 @@ static const double huge = 1.0e300;
 *	x - Input value. Range is [-∞, +∞].
 *	
 *   RESULT
-*	result - Nearest long long integer to x. Returns 0 if x is ±0, returns
-*	        NaN if x is NaN, returns ±Infinity if x is ±Infinity.
+*	result - Nearest long long integer to x. Values beyond the range
+*	        of long_long_t saturate to its minimum or maximum; NaN
+*	        gives 0.
 * 
 *   EXAMPLE
 *	double x = 3.7;
@@ -59,60 +59,5 @@ static const double huge = 1.0e300;
 
 long_long_t llround(double x)
 {
-    int i0,i1,j0;
-    unsigned i,j;
-    long_long_t result;
-    i0 =  __HI(x);
-    i1 =  __LO(x);
-    j0 = ((i0>>20)&0x7ff)-0x3ff;
-    if(j0<20) {
-        if(j0<0) {
-            if(huge+x>0.0) {        /* raise inexact if x != 0 */
-                if(j0==-1) return x>0.0?long_to_long_long(1):long_to_long_long(-1);
-                else return long_to_long_long(0);
-            }
-        } else {
-            i = (0x000fffff)>>j0;
-            if(((i0&i)|i1)==0) return long_to_long_long((long)x); /* x is integral */
-            if(huge+x>0.0) {        /* raise inexact flag */
-                if(i0>0) x += 0.5;
-                else x -= 0.5;
-                i0 = __HI(x);
-                i1 = __LO(x);
-                i0 &= (~i);
-                i1 = 0;
-            }
-        }
-    } else if (j0>51) {
-        if(j0==0x400) return long_to_long_long(0);   /* inf or NaN */
-        else return long_to_long_long((long)x);              /* x is integral */
-    } else {
-        i = ((unsigned)(0xffffffff))>>(j0-20);
-        if((i1&i)==0) return long_to_long_long((long)x);     /* x is integral */
-        if(huge+x>0.0) {            /* raise inexact flag */
-            if(i0>0) {
-                if(j0==20) i0+=1;
-                else {
-                    j = i1+(1<<(52-j0));
-                    if(j<i1) i0 +=1 ;       /* got a carry */
-                    i1=j;
-                }
-            } else {
-                if(j0==20) i0-=1;
-                else {
-                    j = i1 - (1<<(52-j0));
-                    if(j>i1) i0 -=1;        /* got a borrow */
-                    i1 = j;
-                }
-            }
-        }
-    }
-    __HI(x) = i0;
-    __LO(x) = i1;
-    
-    /* Convert to long_long_t, checking for overflow */
-    if (x > (double)LONG_MAX) return get_long_long_max();
-    if (x < (double)LONG_MIN) return get_long_long_min();
-    
-    return long_to_long_long((long)x);
+    return llrint(round(x));
 }
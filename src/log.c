@@ -30,8 +30,6 @@ Lg5 = 1.818357216161805012e-01,  /* 3FC74664 96CB03DE */
 Lg6 = 1.531383769920937332e-01,  /* 3FC39A09 D078C69F */
 Lg7 = 1.479819860511658591e-01;  /* 3FC2F112 DF3E5244 */
 
-static double zero   =  0.0;
-
 static double __ieee754_log(double x)
 {
     double hfsq, f, s, z, R, w, t1, t2, dk;
@@ -44,8 +42,8 @@ static double __ieee754_log(double x)
     k=0;
     if (hx < 0x00100000) {			/* x < 2**-1022  */
         if (((hx&0x7fffffff)|lx)==0) 
-            return -two54/zero;		/* log(+-0)=-inf */
-        if (hx<0) return (x-x)/zero;	/* log(-#) = NaN */
+            return -two54/__ma_zero;		/* log(+-0)=-inf */
+        if (hx<0) return (x-x)/__ma_zero;	/* log(-#) = NaN */
         k -= 54; x *= two54; /* subnormal number, scale up x */
         hx = __HI(x);		/* high word of x */
     } 
@@ -57,7 +55,7 @@ static double __ieee754_log(double x)
     k += (i>>20);
     f = x-1.0;
     if((0x000fffff&(2+hx))<3) {	/* |f| < 2**-20 */
-        if(f==zero) if(k==0) return zero;  else {dk=(double)k;
+        if(f==__ma_zero) if(k==0) return __ma_zero;  else {dk=(double)k;
                      return dk*ln2_hi+dk*ln2_lo;}
         R = f*f*(0.5-0.33333333333333333*f);
         if(k==0) return f-R; else {dk=(double)k;
@@ -122,7 +120,7 @@ double log(double x)
 {
     /* Handle special cases first */
     if (x <= 0.0) {
-        errno = EDOM;
+        __ma_seterr(EDOM);
         if (x == 0.0) {
             return -INFINITY;
         } else {
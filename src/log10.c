@@ -25,8 +25,6 @@ ivln10     =  4.34294481903251816668e-01, /* 0x3FDBCB7B, 0x1526E50E */
 log10_2hi  =  3.01029995663611771306e-01, /* 0x3FD34413, 0x509F6000 */
 log10_2lo  =  3.69423907715893078616e-13; /* 0x3D59FEF3, 0x11F12B36 */
 
-static double zero   =  0.0;
-
 /****** ma.lib/log10 **********************************************************
 * 
 *   NAME	
@@ -74,8 +72,8 @@ static double __ieee754_log10(double x)
     k=0;
     if (hx < 0x00100000) {                  /* x < 2**-1022  */
         if (((hx&0x7fffffff)|lx)==0)
-            return -two54/zero;             /* log(+-0)=-inf */
-        if (hx<0) return (x-x)/zero;        /* log(-#) = NaN */
+            return -two54/__ma_zero;             /* log(+-0)=-inf */
+        if (hx<0) return (x-x)/__ma_zero;        /* log(-#) = NaN */
         k -= 54; x *= two54; /* subnormal number, scale up x */
         hx = __HI(x);                /* high word of x */
     }
@@ -93,7 +91,7 @@ double log10(double x)
 {
     /* Handle special cases first */
     if (x <= 0.0) {
-        errno = EDOM;
+        __ma_seterr(EDOM);
         if (x == 0.0) {
             return -INFINITY;
         } else {
@@ -53,7 +53,7 @@ double log2(double x)
 {
     /* Handle special cases first */
     if (x <= 0.0) {
-        errno = EDOM;
+        __ma_seterr(EDOM);
         if (x == 0.0) {
             return -INFINITY;
         } else {
@@ -18,10 +18,6 @@
 #include <math.h>
 #include "include/internal/m99_math.h"
 
-/* Helper macros for accessing high/low parts of float */
-/* SAS/C uses big-endian, so high word is first */
-#define __HI(x) *(int*)&x
-
 /****** ma.lib/logbf *********************************************************
 * 
 *   NAME	
@@ -69,4 +65,3 @@ float logbf(float x)
         return (float) (ix-127); 
 }
 
-
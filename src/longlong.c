@@ -1,4 +1,6 @@
 #include "include/internal/longlong.h"
+#include "include/internal/bits.h"
+#include <amiga/mpn.h>
 #include <limits.h>
 #include <errno.h>
 #include <ctype.h>
@@ -379,9 +381,9 @@ long_long_t long_long_sub(long_long_t a, long_long_t b)
 *	long_long_t long_long_mul(long_long_t a, long_long_t b);
 *
 *   FUNCTION
-*	Multiply two long_long_t values using long multiplication algorithm.
-*	This performs complete 64-bit multiplication for 64-bit integer
-*	emulation on AmigaOS with SAS/C.
+*	Multiply two long_long_t values. The full 128-bit product of the
+*	magnitudes is formed, so every overflow is detected, including
+*	those that only the high parts of both operands produce.
 * 
 *   INPUTS
 *	a - First long_long_t value (multiplicand).
@@ -400,18 +402,16 @@ long_long_t long_long_sub(long_long_t a, long_long_t b)
 *	Handles overflow by returning maximum/minimum values.
 * 
 *   SEE ALSO
-*	long_long_t, longlong.h
+*	long_long_t, longlong.h, ma_umul64x128()
 * 
 ******************************************************************************/
 
-/* Complete 64-bit multiplication using long multiplication algorithm */
+/* 64-bit multiplication with overflow detection from the full product */
 long_long_t long_long_mul(long_long_t a, long_long_t b)
 {
-    long_long_t result = {0, 0}, max_value;
+    unsigned_long_long_t ua, ub, hi, lo;
+    long_long_t result;
     int negative = 0;
-    unsigned long a0, a1, b0, b1;
-    unsigned long p0, p1, p2, p3;
-    unsigned long mid_sum1, mid_sum2;
     
     /* Handle signed multiplication by working with absolute values */
     if (LONG_LONG_IS_NEGATIVE(a)) {
@@ -422,44 +422,25 @@ long_long_t long_long_mul(long_long_t a, long_long_t b)
         b = long_long_negate(b);
         negative = !negative;
     }
-    
-    /* --- Start of simplified multiplication core --- */
-    
-    /* This part calculates the 64-bit result of a.lo * b.lo */
-    a0 = a.lo & 0xFFFF;
-    a1 = a.lo >> 16;
-    b0 = b.lo & 0xFFFF;
-    b1 = b.lo >> 16;
-    
-    p0 = a0 * b0;
-    p1 = a0 * b1;
-    p2 = a1 * b0;
-    p3 = a1 * b1;
-    
-    mid_sum1 = p1 + p2;
-    mid_sum2 = (p0 >> 16) + (mid_sum1 & 0xFFFF);
-    
-    result.lo = (p0 & 0xFFFF) | (mid_sum2 << 16);
-    result.hi = p3 + (mid_sum1 >> 16) + (mid_sum2 >> 16);
-    
-    /* Add the cross-products. These only affect the high 32 bits. */
-    /* (The a.hi * b.hi term would be shifted out of a 64-bit result) */
-    result.hi += a.lo * b.hi;
-    result.hi += a.hi * b.lo;
-    
-    /* --- End of simplified core --- */
-    
-    /* Check for overflow */
-    if (result.hi > 0x7FFFFFFF) {
+    ua.hi = a.hi;
+    ua.lo = a.lo;
+    ub.hi = b.hi;
+    ub.lo = b.lo;
+    
+    /* 128-bit product of the magnitudes */
+    ma_umul64x128(ua, ub, &hi, &lo);
+    
+    /*
+     * Overflow if anything reaches the upper half or bit 63. A
+     * magnitude of exactly 2**63 is LONG_LONG_MIN when negative,
+     * which is what handle_overflow() returns.
+     */
+    if (hi.hi != 0 || hi.lo != 0 || lo.hi > 0x7FFFFFFF) {
         return handle_overflow(negative);
     }
     
-    /* Additional overflow check for the exact LONG_LONG_MAX case */
-    max_value = get_long_long_max();
-    if (long_long_eq(result, max_value) && negative) {
-        /* This would overflow to LONG_LONG_MIN + 1, which is invalid */
-        return handle_overflow(negative);
-    }
+    result.hi = lo.hi;
+    result.lo = lo.lo;
     
     /* Apply sign if needed */
     if (negative) {
@@ -599,130 +580,87 @@ long_long_t long_long_mod(long_long_t a, long_long_t b)
 
 void long_long_divmod(long_long_t a, long_long_t b, long_long_t *quotient, long_long_t *remainder)
 {
-    long_long_t result = {0, 0};
-    int negative_quotient = 0;
-    int negative_remainder = 0; /* Track remainder sign separately */
     long_long_t zero = {0, 0};
-    int shift;
-    long_long_t shifted_divisor;
-    long_long_t dividend;
-    long_long_t final_remainder;
-    long_long_t long_long_min_value, long_long_max_value, one, neg_one;
+    unsigned long nh, nl, dh, dl, qh, ql, rh, rl, top;
+    int negative_quotient = 0;
+    int negative_remainder = 0; /* The remainder has the sign of 'a' */
+    int i;
     
     /* Handle division by zero */
-    {
-        if (long_long_eq(b, zero)) {
-            /* Set errno to indicate division by zero */
-            errno = EDOM;
-            *quotient = zero;
-            *remainder = zero;
-            return;
-        }
-        
-        /* Handle division of zero */
-        if (long_long_eq(a, zero)) {
-            *quotient = zero;
-            *remainder = zero;
-            return;
-        }
-    }
-    
-    /* Handle signed division by working with absolute values */
-    if (LONG_LONG_IS_NEGATIVE(a)) {
-        /* SPECIAL CASE for LONG_LONG_MIN, which cannot be negated */
-        long_long_min_value = get_long_long_min();
-        if (long_long_eq(a, long_long_min_value)) {
-            /* If b is 1 or -1, the result is trivial */
-            one = long_to_long_long(1);
-            neg_one = long_to_long_long(-1);
-            if (long_long_eq(b, one)) {
-                *quotient = long_long_min_value;
-                *remainder = long_to_long_long(0);
-                return;
-            }
-            if (long_long_eq(b, neg_one)) {
-                /* LONG_LONG_MIN / -1 = LONG_LONG_MAX (technically overflows, clamp to MAX) */
-                long_long_max_value = get_long_long_max();
-                *quotient = long_long_max_value;
-                *remainder = long_to_long_long(0);
-                errno = ERANGE;
-                return;
-            }
-            /* For other divisors, we can handle this by adjusting the calculation */
-            /* This is a simplified approach - in practice, you might want more robust handling */
-        }
-        
-        a = long_long_negate(a);
-        negative_quotient = !negative_quotient;
-        negative_remainder = 1; /* The remainder will have the sign of 'a' */
-    }
-    if (LONG_LONG_IS_NEGATIVE(b)) {
-        b = long_long_negate(b);
-        negative_quotient = !negative_quotient;
+    if (long_long_eq(b, zero)) {
+        /* Set errno to indicate division by zero */
+        errno = EDOM;
+        *quotient = zero;
+        *remainder = zero;
+        return;
     }
     
-    /* If divisor is larger than dividend, result is 0 */
-    if (long_long_lt(a, b)) {
-        *quotient = result;
-        *remainder = a;  /* Remainder is the dividend */
-        /* Apply sign to remainder if needed */
-        if (negative_remainder) {
-            *remainder = long_long_negate(*remainder);
-        }
+    /* LONG_LONG_MIN / -1 overflows: clamp to LONG_LONG_MAX */
+    if (a.hi == LONG_LONG_MIN_HI && a.lo == LONG_LONG_MIN_LO &&
+        b.hi == 0xFFFFFFFFUL && b.lo == 0xFFFFFFFFUL) {
+        *quotient = get_long_long_max();
+        *remainder = zero;
+        errno = ERANGE;
         return;
     }
     
-    /* Find the highest bit position where divisor can be shifted */
-    shift = 0;
-    shifted_divisor = b;
-    
-    /* Shift divisor left until it's larger than dividend */
-    while (long_long_lt(shifted_divisor, a) && shift < 63) {
-        shifted_divisor = long_long_shl(shifted_divisor, 1);
-        shift++;
+    /*
+     * Work on the magnitudes as unsigned values, so that the magnitude
+     * of LONG_LONG_MIN, 2**63, needs no special case.
+     */
+    nh = a.hi;
+    nl = a.lo;
+    if (LONG_LONG_IS_NEGATIVE(a)) {
+        nh = ~nh + (nl == 0);
+        nl = ~nl + 1;
+        negative_quotient = 1;
+        negative_remainder = 1;
     }
-    
-    /* If we shifted too far, back up one position */
-    if (long_long_gt(shifted_divisor, a)) {
-        shifted_divisor = long_long_shr(shifted_divisor, 1);
-        shift--;
+    dh = b.hi;
+    dl = b.lo;
+    if (LONG_LONG_IS_NEGATIVE(b)) {
+        dh = ~dh + (dl == 0);
+        dl = ~dl + 1;
+        negative_quotient = !negative_quotient;
     }
     
-    /* Perform long division */
-    dividend = a;
-    
-    while (shift >= 0) {
-        if (long_long_ge(dividend, shifted_divisor)) {
-            dividend = long_long_sub(dividend, shifted_divisor);
-            /* Set the appropriate bit in the result based on shift value */
-            if (shift >= 32) {
-                result.hi |= (1UL << (shift - 32));
-            } else {
-                result.lo |= (1UL << shift);
+    if ((nh | dh) == 0) {
+        /* Both fit in 32 bits */
+        qh = rh = 0;
+        ql = nl / dl;
+        rl = nl - ql * dl;
+    } else {
+        /* Shift-and-subtract long division, one quotient bit per step */
+        qh = nh;
+        ql = nl;
+        rh = rl = 0;
+        for (i = 0; i < 64; i++) {
+            top = rh & 0x80000000UL;
+            rh = (rh << 1) | (rl >> 31);
+            rl = (rl << 1) | (qh >> 31);
+            qh = (qh << 1) | (ql >> 31);
+            ql <<= 1;
+            if (top || rh > dh || (rh == dh && rl >= dl)) {
+                rh -= dh + (rl < dl);
+                rl -= dl;
+                ql |= 1;
             }
         }
-        
-        /* Shift divisor right for next iteration */
-        shifted_divisor = long_long_shr(shifted_divisor, 1);
-        shift--;
     }
     
-    /* Apply sign to quotient if needed */
+    /* Apply the signs */
     if (negative_quotient) {
-        result = long_long_negate(result);
+        qh = ~qh + (ql == 0);
+        ql = ~ql + 1;
     }
-    
-    /* The final dividend value is the unsigned remainder */
-    final_remainder = dividend;
-    
-    /* Apply sign to remainder if needed */
     if (negative_remainder) {
-        final_remainder = long_long_negate(final_remainder);
+        rh = ~rh + (rl == 0);
+        rl = ~rl + 1;
     }
-    
-    /* Set results */
-    *quotient = result;
-    *remainder = final_remainder;
+    quotient->hi = qh;
+    quotient->lo = ql;
+    remainder->hi = rh;
+    remainder->lo = rl;
 }
 
 /****** ma.lib/long_long_shl ************************************************
@@ -1467,39 +1405,18 @@ int long_long_is_positive(long_long_t value)
 *
 *   NOTES
 *	This function is C89 compliant and provides IEEE 754 accuracy.
-*	Loop-based implementation - consider table-based for performance.
+*	No loop over the bits; see ma_clz32() for the 32-bit forms.
 * 
 *   SEE ALSO
-*	long_long_t, longlong.h
+*	ma_clz64(), long_long_t, longlong.h
 * 
 ******************************************************************************/
 
 /* Count leading zeros in 64-bit value */
-/* Note: This loop-based implementation is clear and maintainable but not optimal for performance */
-/* For critical performance paths, consider table-based or parallel-bit algorithms */
 int long_long_clz(long_long_t value)
 {
-    int count = 0;
-    
-    if (value.hi == 0) {
-        count += 32;
-        if (value.lo == 0) {
-            return 64;
-        }
-        /* Count leading zeros in low part */
-        while ((value.lo & 0x80000000) == 0) {
-            count++;
-            value.lo <<= 1;
-        }
-    } else {
-        /* Count leading zeros in high part */
-        while ((value.hi & 0x80000000) == 0) {
-            count++;
-            value.hi <<= 1;
-        }
-    }
-    
-    return count;
+    if (value.hi != 0) return __ma_clz32(value.hi);
+    return 32 + __ma_clz32(value.lo);
 }
 
 /****** ma.lib/long_long_ctz ************************************************
@@ -1529,39 +1446,18 @@ int long_long_clz(long_long_t value)
 *
 *   NOTES
 *	This function is C89 compliant and provides IEEE 754 accuracy.
-*	Loop-based implementation - consider table-based for performance.
+*	No loop over the bits; see ma_clz32() for the 32-bit forms.
 * 
 *   SEE ALSO
-*	long_long_t, longlong.h
+*	ma_ctz64(), long_long_t, longlong.h
 * 
 ******************************************************************************/
 
 /* Count trailing zeros in 64-bit value */
-/* Note: This loop-based implementation is clear and maintainable but not optimal for performance */
-/* For critical performance paths, consider table-based or parallel-bit algorithms */
 int long_long_ctz(long_long_t value)
 {
-    int count = 0;
-    
-    if (value.lo == 0) {
-        count += 32;
-        if (value.hi == 0) {
-            return 64;
-        }
-        /* Count trailing zeros in high part */
-        while ((value.hi & 1) == 0) {
-            count++;
-            value.hi >>= 1;
-        }
-    } else {
-        /* Count trailing zeros in low part */
-        while ((value.lo & 1) == 0) {
-            count++;
-            value.lo >>= 1;
-        }
-    }
-    
-    return count;
+    if (value.lo != 0) return __ma_ctz32(value.lo);
+    return 32 + __ma_ctz32(value.hi);
 }
 
 /****** ma.lib/long_long_popcount *******************************************
@@ -1591,33 +1487,17 @@ int long_long_ctz(long_long_t value)
 *
 *   NOTES
 *	This function is C89 compliant and provides IEEE 754 accuracy.
-*	Loop-based implementation - consider table-based for performance.
+*	No loop over the bits; see ma_clz32() for the 32-bit forms.
 * 
 *   SEE ALSO
-*	long_long_t, longlong.h
+*	ma_popcount64(), long_long_t, longlong.h
 * 
 ******************************************************************************/
 
 /* Population count (number of set bits) in 64-bit value */
-/* Note: This loop-based implementation is clear and maintainable but not optimal for performance */
-/* For critical performance paths, consider table-based or parallel-bit algorithms */
 int long_long_popcount(long_long_t value)
 {
-    int count = 0;
-    
-    /* Count bits in high part */
-    while (value.hi != 0) {
-        count += value.hi & 1;
-        value.hi >>= 1;
-    }
-    
-    /* Count bits in low part */
-    while (value.lo != 0) {
-        count += value.lo & 1;
-        value.lo >>= 1;
-    }
-    
-    return count;
+    return __ma_popcount32(value.hi) + __ma_popcount32(value.lo);
 }
 
 /****** ma.lib/get_long_long_max ********************************************
@@ -1705,6 +1585,215 @@ long_long_t get_long_long_min(void)
     return result;
 }
 
+/*
+ * Text conversion helpers. Digits are gathered a block at a time in a
+ * 32-bit word, up to nine decimal digits, and each block is folded
+ * into the 64-bit value with one multiply-add, or one shift for bases
+ * 2, 8 and 16. Formatting splits the value into groups of four
+ * decimal digits with divisions small enough for a 32 by 16-bit
+ * divide, and writes two digits at a time from a table.
+ */
+
+static const char ll_digits[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+
+static const char ll_pairs[201] =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+    "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+/* 64-bit product of two 32-bit values, from 16-bit halves */
+static void ll_mul32(unsigned long a, unsigned long b,
+                     unsigned long *hi, unsigned long *lo)
+{
+    unsigned long a0, a1, b0, b1, p0, p1, p2, mid;
+
+    a0 = a & 0xFFFF;
+    a1 = a >> 16;
+    b0 = b & 0xFFFF;
+    b1 = b >> 16;
+    p0 = a0 * b0;
+    p1 = a0 * b1;
+    p2 = a1 * b0;
+    mid = (p0 >> 16) + (p1 & 0xFFFF) + (p2 & 0xFFFF);
+    *lo = (p0 & 0xFFFF) | (mid << 16);
+    *hi = a1 * b1 + (p1 >> 16) + (p2 >> 16) + (mid >> 16);
+}
+
+/* Divide hi:lo by d < 65536 in place and return the remainder */
+static unsigned long ll_divsmall(unsigned long *hi, unsigned long *lo,
+                                 unsigned long d)
+{
+    unsigned long r, q1, q0, t;
+
+    r = 0;
+    if (*hi) {
+        t = *hi >> 16;
+        q1 = t / d;
+        r = t - q1 * d;
+        t = (r << 16) | (*hi & 0xFFFF);
+        q0 = t / d;
+        r = t - q0 * d;
+        *hi = (q1 << 16) | q0;
+    }
+    t = (r << 16) | (*lo >> 16);
+    q1 = t / d;
+    r = t - q1 * d;
+    t = (r << 16) | (*lo & 0xFFFF);
+    q0 = t / d;
+    r = t - q0 * d;
+    *lo = (q1 << 16) | q0;
+    return r;
+}
+
+/* Value of the digit c in any base up to 36, or 36 if none */
+static int ll_digit(int c)
+{
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'z') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'Z') return c - 'A' + 10;
+    return 36;
+}
+
+/*
+ * ll_scan - Parse an optionally signed integer in base 0 or 2 to 36,
+ * as strtoull() does, into the magnitude *r and the sign *negative.
+ * Returns 1 if the magnitude overflowed 64 bits, and sets *end to the
+ * first character not used, or str if there was no number.
+ */
+static int ll_scan(const char *str, const char **end, int base,
+                   unsigned_long_long_t *r, int *negative)
+{
+    const char *s = str;
+    unsigned long chunk, mult, limit, hi, lo, h2, l2;
+    int d, shift, bits, ovf;
+
+    r->hi = r->lo = 0;
+    *negative = 0;
+    *end = str;
+    ovf = 0;
+
+    while (isspace((unsigned char)*s)) s++;
+    if (*s == '+' || *s == '-') {
+        *negative = (*s == '-');
+        s++;
+    }
+
+    /* 0x for base 16 and 0b for base 2, if a digit follows */
+    if ((base == 0 || base == 16) && s[0] == '0' &&
+        (s[1] == 'x' || s[1] == 'X') && ll_digit(s[2]) < 16) {
+        base = 16;
+        s += 2;
+    } else if ((base == 0 || base == 2) && s[0] == '0' &&
+               (s[1] == 'b' || s[1] == 'B') && ll_digit(s[2]) < 2) {
+        base = 2;
+        s += 2;
+    } else if (base == 0) {
+        base = (s[0] == '0') ? 8 : 10;
+    }
+    if (base < 2 || base > 36 || ll_digit(*s) >= base) return 0;
+
+    shift = (base == 2) ? 1 : (base == 8) ? 3 : (base == 16) ? 4 : 0;
+    limit = 0xFFFFFFFFUL / base;
+    for (;;) {
+        /* a block of digits in one word */
+        chunk = 0;
+        mult = 1;
+        bits = 0;
+        if (shift) {
+            while (bits + shift <= 32 && (d = ll_digit(*s)) < base) {
+                chunk = (chunk << shift) | d;
+                bits += shift;
+                s++;
+            }
+            if (bits == 0) break;
+        } else {
+            while (mult <= limit && (d = ll_digit(*s)) < base) {
+                chunk = chunk * base + d;
+                mult *= base;
+                s++;
+            }
+            if (mult == 1) break;
+        }
+        if (ovf) continue;
+
+        /* fold it in: r = r*base**n + chunk */
+        if (shift) {
+            if (bits == 32) {
+                if (r->hi) ovf = 1;
+                r->hi = r->lo;
+                r->lo = chunk;
+            } else {
+                if (r->hi >> (32 - bits)) ovf = 1;
+                r->hi = (r->hi << bits) | (r->lo >> (32 - bits));
+                r->lo = (r->lo << bits) | chunk;
+            }
+        } else {
+            ll_mul32(r->lo, mult, &hi, &lo);
+            ll_mul32(r->hi, mult, &h2, &l2);
+            lo += chunk;
+            hi += (lo < chunk);
+            hi += l2;
+            if (h2 || hi < l2) ovf = 1;
+            r->hi = hi;
+            r->lo = lo;
+        }
+    }
+    *end = s;
+    return ovf;
+}
+
+/*
+ * ll_format - Write the digits of hi:lo in radix 2 to 36 backwards,
+ * ending at p, and return the first digit.
+ */
+static char *ll_format(unsigned long hi, unsigned long lo, char *p, int radix)
+{
+    unsigned long r;
+    int shift, i;
+
+    if (radix == 10) {
+        /* four digits at a time while more than four remain */
+        while (hi || lo >= 10000) {
+            r = ll_divsmall(&hi, &lo, 10000);
+            i = (int)(r % 100) * 2;
+            *--p = ll_pairs[i + 1];
+            *--p = ll_pairs[i];
+            i = (int)(r / 100) * 2;
+            *--p = ll_pairs[i + 1];
+            *--p = ll_pairs[i];
+        }
+        while (lo >= 100) {
+            i = (int)(lo % 100) * 2;
+            lo /= 100;
+            *--p = ll_pairs[i + 1];
+            *--p = ll_pairs[i];
+        }
+        if (lo >= 10) {
+            i = (int)lo * 2;
+            *--p = ll_pairs[i + 1];
+            *--p = ll_pairs[i];
+        } else {
+            *--p = ll_digits[lo];
+        }
+        return p;
+    }
+
+    shift = (radix == 2) ? 1 : (radix == 4) ? 2 : (radix == 8) ? 3 :
+            (radix == 16) ? 4 : (radix == 32) ? 5 : 0;
+    if (shift) {
+        do {
+            *--p = ll_digits[lo & (radix - 1)];
+            lo = (lo >> shift) | (hi << (32 - shift));
+            hi >>= shift;
+        } while (hi | lo);
+    } else {
+        do {
+            *--p = ll_digits[ll_divsmall(&hi, &lo, radix)];
+        } while (hi | lo);
+    }
+    return p;
+}
+
 /****** ma.lib/atoll ********************************************************
 * 
 *   NAME	
@@ -1742,75 +1831,7 @@ long_long_t get_long_long_min(void)
 /* Convert string to long long (atoll equivalent) */
 long_long_t atoll(const char *str)
 {
-    char *endptr;
-    long_long_t result = {0, 0};
-    const char *start = str;
-    int negative = 0;
-    int valid_digits = 0;
-    long_long_t max_value = get_long_long_max();
-    long_long_t zero = {0, 0};
-    long_long_t base_value = {0, 10};
-    long_long_t temp;
-    
-    /* Skip leading whitespace */
-    while (isspace((unsigned char)*str)) {
-        str++;
-    }
-    
-    /* Handle sign */
-    if (*str == '+') {
-        str++;
-    } else if (*str == '-') {
-        negative = 1;
-        str++;
-    }
-    
-    /* Process digits (base 10 only for atoll) */
-    while (*str && isdigit((unsigned char)*str)) {
-        int digit = *str - '0';
-        
-        /* Check for overflow before multiplying */
-        if (long_long_gt(result, max_value)) {
-            /* Overflow - return maximum value */
-            result = max_value;
-            errno = ERANGE;
-            break;
-        }
-        
-        /* Multiply by 10 */
-        temp = result;
-        result = long_long_mul(result, base_value);
-        
-        /* Check for overflow after multiplication */
-        if (long_long_lt(result, temp)) {
-            /* Overflow occurred */
-            result = max_value;
-            errno = ERANGE;
-            break;
-        }
-        
-        /* Add digit */
-        temp = long_to_long_long(digit);
-        result = long_long_add(result, temp);
-        
-        /* Check for overflow after addition */
-        if (long_long_lt(result, temp)) {
-            /* Overflow occurred */
-            result = max_value;
-            errno = ERANGE;
-            break;
-        }
-        
-        valid_digits = 1;
-        str++;
-    }
-    
-    /* Apply sign if negative */
-    if (negative) {
-        result = long_long_negate(result);
-    }
-    
-    return result;
+    return strtoll(str, (char **)0, 10);
 }
 
 /* Helper function to convert long_long_t to unsigned_long_long_t */
@@ -1920,7 +1941,9 @@ long_long_t unsigned_long_long_to_long_long(unsigned_long_long_t value)
 *	base - Numeric base (2-36, or 0 for auto-detect).
 *	
 *   RESULT
-*	result - Converted unsigned_long_long_t value. Returns 0 on error.
+*	result - Converted unsigned_long_long_t value. Returns 0 if there
+*	         is no number, with *endptr set to str. A negative number
+*	         is negated modulo 2**64, as by strtoull().
 * 
 *   EXAMPLE
 *	const char *str = "1234567890";
@@ -1928,8 +1951,10 @@ long_long_t unsigned_long_long_to_long_long(unsigned_long_long_t value)
 *	unsigned_long_long_t result = strtoull(str, &end, 10);  
 *
 *   NOTES
-*	This function is C89 compliant and provides IEEE 754 accuracy.
-*	Sets errno to ERANGE on overflow.
+*	Digits are gathered nine at a time in a 32-bit word and folded
+*	into the result with one 64-bit multiply-add per block, or one
+*	shift in bases 2, 8 and 16. Sets errno to ERANGE and returns
+*	the largest value on overflow.
 * 
 *   SEE ALSO
 *	unsigned_long_long_t, longlong.h
@@ -1939,120 +1964,190 @@ long_long_t unsigned_long_long_to_long_long(unsigned_long_long_t value)
 /* Convert string to unsigned long long */
 unsigned_long_long_t strtoull(const char *str, char **endptr, int base)
 {
-    long_long_t result = {0, 0};
-    const char *start = str;
-    int negative = 0;
-    int valid_digits = 0;
-    long_long_t max_value = get_long_long_max();
-    long_long_t zero = {0, 0};
-    long_long_t base_value;
-    long_long_t temp;
-    
-    /* Skip leading whitespace */
-    while (isspace((unsigned char)*str)) {
-        str++;
-    }
-    
-    /* Handle sign */
-    if (*str == '+') {
-        str++;
-    } else if (*str == '-') {
-        negative = 1;
-        str++;
-    }
-    
-    /* Validate base */
-    if (base == 0) {
-        /* Auto-detect base */
-        if (*str == '0') {
-            str++;
-            if (*str == 'x' || *str == 'X') {
-                base = 16;
-                str++;
-            } else if (*str == 'b' || *str == 'B') {
-                base = 2;
-                str++;
-            } else {
-                base = 8;
-            }
-        } else {
-            base = 10;
-        }
-    }
-    
-    if (base < 2 || base > 36) {
-        if (endptr) *endptr = (char *)start;
-        return long_long_to_unsigned_long_long(zero);
+    unsigned_long_long_t result;
+    const char *end;
+    int negative;
+
+    if (ll_scan(str, &end, base, &result, &negative)) {
+        result.hi = 0xFFFFFFFFUL;
+        result.lo = 0xFFFFFFFFUL;
+        errno = ERANGE;
+    } else if (negative) {
+        /* As strtoull(): the negation is taken modulo 2**64 */
+        result.hi = ~result.hi + (result.lo == 0);
+        result.lo = ~result.lo + 1;
     }
-    
-    /* Convert base to our long long representation */
-    base_value = long_to_long_long(base);
-    
-    /* Process digits */
-    while (*str) {
-        int digit;
-        
-        if (isdigit((unsigned char)*str)) {
-            digit = *str - '0';
-        } else if (isalpha((unsigned char)*str)) {
-            digit = tolower((unsigned char)*str) - 'a' + 10;
-        } else {
-            break;  /* Invalid character */
-        }
-        
-        if (digit >= base) {
-            break;  /* Digit not valid for this base */
-        }
-        
-        /* Check for overflow before multiplying */
-        if (long_long_gt(result, max_value)) {
-            /* Overflow - return maximum value */
-            result = max_value;
-            errno = ERANGE;
-            break;
-        }
-        
-        /* Multiply by base */
-        temp = result;
-        result = long_long_mul(result, base_value);
-        
-        /* Check for overflow after multiplication */
-        if (long_long_lt(result, temp)) {
-            /* Overflow occurred */
-            result = max_value;
-            errno = ERANGE;
-            break;
-        }
-        
-        /* Add digit */
-        temp = long_to_long_long(digit);
-        result = long_long_add(result, temp);
-        
-        /* Check for overflow after addition */
-        if (long_long_lt(result, temp)) {
-            /* Overflow occurred */
-            result = max_value;
+    if (endptr) *endptr = (char *)end;
+    return result;
+}
+
+/****** ma.lib/strtoll ******************************************************
+* 
+*   NAME	
+* 	strtoll -- Convert string to long_long_t. (V1.0)
+*
+*   SYNOPSIS
+*	long_long_t result = strtoll(const char *str, char **endptr, int base);
+*	  D0		   A0
+*	long_long_t strtoll(const char *str, char **endptr, int base);
+*
+*   FUNCTION
+*	Convert a string to long_long_t value with specified base. This is
+*	equivalent to strtoll() but returns long_long_t for 64-bit integer
+*	emulation on AmigaOS with SAS/C. Leading white space and an
+*	optional sign are skipped; base 0 takes a "0x" prefix as base 16,
+*	"0b" as base 2, a leading 0 as base 8 and anything else as base 10.
+* 
+*   INPUTS
+*	str - String to convert.
+*	endptr - Pointer to store end of conversion, or NULL.
+*	base - Numeric base (2-36, or 0 for auto-detect).
+*	
+*   RESULT
+*	result - Converted long_long_t value. Returns 0 if there is no
+*	         number, with *endptr set to str.
+* 
+*   EXAMPLE
+*	char *end;
+*	long_long_t result = strtoll("-0x7fffffffffffffff", &end, 0);  
+*
+*   NOTES
+*	Digits are gathered nine at a time in a 32-bit word and folded
+*	into the result with one 64-bit multiply-add per block. Sets
+*	errno to ERANGE and returns LONG_LONG_MAX or LONG_LONG_MIN on
+*	overflow.
+* 
+*   SEE ALSO
+*	strtoull(), atoll(), lltoa(), long_long_t, longlong.h
+* 
+******************************************************************************/
+
+long_long_t strtoll(const char *str, char **endptr, int base)
+{
+    unsigned_long_long_t u;
+    long_long_t result;
+    const char *end;
+    int negative, ovf;
+
+    ovf = ll_scan(str, &end, base, &u, &negative);
+    if (endptr) *endptr = (char *)end;
+
+    /* the magnitude allowed is 2**63-1, or 2**63 if negative */
+    if (ovf || u.hi > 0x7FFFFFFFUL) {
+        if (!negative || ovf || u.hi != 0x80000000UL || u.lo != 0) {
             errno = ERANGE;
-            break;
+            return handle_overflow(negative);
         }
-        
-        valid_digits = 1;
-        str++;
     }
-    
-    /* Set endptr */
-    if (endptr) {
-        if (valid_digits) {
-            *endptr = (char *)str;
-        } else {
-            *endptr = (char *)start;
-        }
+    if (negative) {
+        u.hi = ~u.hi + (u.lo == 0);
+        u.lo = ~u.lo + 1;
     }
-    
-    /* For unsigned, we ignore the sign and just return the absolute value */
-    /* This matches the behavior of standard strtoull */
-    
-    return long_long_to_unsigned_long_long(result);
+    result.hi = u.hi;
+    result.lo = u.lo;
+    return result;
+}
+
+/****** ma.lib/ulltoa *******************************************************
+* 
+*   NAME	
+* 	ulltoa -- Convert unsigned_long_long_t to a string. (V1.0)
+*
+*   SYNOPSIS
+*	char *result = ulltoa(unsigned_long_long_t value, char *buf, int radix);
+*	  D0		                     D0           A0        D1
+*	char *ulltoa(unsigned_long_long_t value, char *buf, int radix);
+*
+*   FUNCTION
+*	Write the digits of value in the given radix to buf, lower case
+*	and without leading zeros or prefix, and add a NUL.
+* 
+*   INPUTS
+*	value - Value to convert.
+*	buf - Buffer of at least LONG_LONG_BUFSIZE chars.
+*	radix - Base of the digits, 2 to 36.
+*	
+*   RESULT
+*	result - buf, or NULL if radix is out of range.
+* 
+*   EXAMPLE
+*	char buf[LONG_LONG_BUFSIZE];
+*	unsigned_long_long_t x = {0xFFFFFFFF, 0xFFFFFFFF};
+*	ulltoa(x, buf, 10);
+*	buf is "18446744073709551615".
+*
+*   NOTES
+*	Decimal digits are made four at a time by 32 by 16-bit
+*	divisions and written two at a time from a table; radixes 2, 4,
+*	8, 16 and 32 need only shifts.
+* 
+*   SEE ALSO
+*	lltoa(), strtoull(), unsigned_long_long_t, longlong.h
+* 
+******************************************************************************/
+
+char *ulltoa(unsigned_long_long_t value, char *buf, int radix)
+{
+    char tmp[LONG_LONG_BUFSIZE];
+    char *p, *q;
+
+    if (radix < 2 || radix > 36) return (char *)0;
+    p = ll_format(value.hi, value.lo, tmp + sizeof(tmp), radix);
+    for (q = buf; p < tmp + sizeof(tmp); ) *q++ = *p++;
+    *q = '\0';
+    return buf;
+}
+
+/****** ma.lib/lltoa ********************************************************
+* 
+*   NAME	
+* 	lltoa -- Convert long_long_t to a string. (V1.0)
+*
+*   SYNOPSIS
+*	char *result = lltoa(long_long_t value, char *buf, int radix);
+*	  D0		            D0           A0        D1
+*	char *lltoa(long_long_t value, char *buf, int radix);
+*
+*   FUNCTION
+*	Write value in the given radix to buf, as ulltoa() does. In
+*	radix 10 a negative value is written with a minus sign; in other
+*	radixes its two's complement bits are written, as by ulltoa().
+* 
+*   INPUTS
+*	value - Value to convert.
+*	buf - Buffer of at least LONG_LONG_BUFSIZE chars.
+*	radix - Base of the digits, 2 to 36.
+*	
+*   RESULT
+*	result - buf, or NULL if radix is out of range.
+* 
+*   EXAMPLE
+*	char buf[LONG_LONG_BUFSIZE];
+*	lltoa(long_to_long_long(-42), buf, 10);
+*	buf is "-42".
+*
+*   NOTES
+*	LONG_LONG_MIN is written correctly, as "-9223372036854775808".
+* 
+*   SEE ALSO
+*	ulltoa(), strtoll(), long_long_t, longlong.h
+* 
+******************************************************************************/
+
+char *lltoa(long_long_t value, char *buf, int radix)
+{
+    unsigned_long_long_t u;
+
+    u.hi = value.hi;
+    u.lo = value.lo;
+    if (radix == 10 && LONG_LONG_IS_NEGATIVE(value)) {
+        /* the magnitude, which for LONG_LONG_MIN is 2**63 unsigned */
+        u.hi = ~u.hi + (u.lo == 0);
+        u.lo = ~u.lo + 1;
+        buf[0] = '-';
+        return (ulltoa(u, buf + 1, 10)) ? buf : (char *)0;
+    }
+    return ulltoa(u, buf, radix);
 }
 
 /****** ma.lib/lldiv ********************************************************
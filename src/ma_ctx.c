@@ -0,0 +1,381 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * ma_ctx - Reentrant math context
+ *
+ * Holds the state that ma.lib would otherwise keep in globals: last
+ * error, sticky exception flags, backend selection, accuracy mode and
+ * the sign of the last gamma result. A task installs its own context
+ * with ma_ctx_install(); every other task shares the default context.
+ * An installed context can also carry the task's trig reduction memo.
+ */
+
+#include <math.h>
+#include "include/internal/m99_math.h"
+
+#include <exec/tasks.h>
+#include <proto/exec.h>
+
+/* Number of tasks that may have a context installed at once */
+#define MA_CTX_SLOTS 16
+
+/*
+ * Installed contexts, keyed by task. A slot is only ever written by
+ * the task that owns it, so lookups need no locking: a task can only
+ * match its own slot, and it is not changing that slot while it is
+ * looking it up. Claiming a free slot is done under Forbid().
+ */
+static struct {
+    struct Task *task;
+    ma_ctx *ctx;
+} ctx_slots[MA_CTX_SLOTS];
+
+/*
+ * Number of slots in use. While it is 0, which is the usual case, code
+ * that only acts on an installed context need not look one up.
+ */
+int __ma_ctx_installed = 0;
+
+static ma_ctx default_ctx = {
+    M99_ERR_NONE,
+    0,
+    M99_MATH_AUTO,
+    M99_OPT_FPU | M99_OPT_IEEE,
+    MA_ACC_DEFAULT,
+    0,
+    0,
+    { 0xffffffffUL, 0xffffffffUL },
+    { 0.0, 0.0 },
+    0,
+    0,
+    0
+};
+
+/****** ma.lib/ma_ctx_init ***************************************************
+*
+*   NAME	
+* 	ma_ctx_init -- Initialize a math context to library defaults. (V1.0)
+*
+*   SYNOPSIS
+*	ma_ctx_init(ma_ctx *ctx);
+*	             A0
+*	void ma_ctx_init(ma_ctx *ctx);
+*
+*   FUNCTION
+*	Set every field of ctx to the library defaults: no error, no
+*	exception flags raised, automatic backend selection, FPU and IEEE
+*	optimization flags, default accuracy and a gamma sign of 0. The
+*	trig reduction memo is switched off and emptied, and its counters
+*	are zeroed.
+*
+*   INPUTS
+*	ctx - Context to initialize.
+*
+*   RESULT
+*	None.
+*
+*   EXAMPLE
+*	ma_ctx ctx;
+*	ma_ctx_init(&ctx);
+*	ma_ctx_install(&ctx, NULL);
+*
+*   NOTES
+*	A context must be initialized before it is installed or passed to
+*	a context-taking entry point.
+*
+*   SEE ALSO
+*	ma_ctx_install(), ma_ctx_current(), math.h
+*
+******************************************************************************/
+
+void ma_ctx_init(ma_ctx *ctx)
+{
+    ctx->error = M99_ERR_NONE;
+    ctx->except = 0;
+    ctx->math_type = M99_MATH_AUTO;
+    ctx->optimization = M99_OPT_FPU | M99_OPT_IEEE;
+    ctx->accuracy = MA_ACC_DEFAULT;
+    ctx->signgam = 0;
+    ctx->pio2_memo = 0;
+    ctx->pio2_key[0] = 0xffffffffUL;	/* a NaN, which is never memoized */
+    ctx->pio2_key[1] = 0xffffffffUL;
+    ctx->pio2_y[0] = 0.0;
+    ctx->pio2_y[1] = 0.0;
+    ctx->pio2_n = 0;
+    ctx->pio2_hits = 0;
+    ctx->pio2_misses = 0;
+}
+
+/****** ma.lib/ma_ctx_install ************************************************
+*
+*   NAME	
+* 	ma_ctx_install -- Install a math context for the calling task. (V1.0)
+*
+*   SYNOPSIS
+*	int ok = ma_ctx_install(ma_ctx *ctx, ma_ctx **previous);
+*	 D0                      A0            A1
+*	int ma_ctx_install(ma_ctx *ctx, ma_ctx **previous);
+*
+*   FUNCTION
+*	Make ctx the context used by every ma.lib function called from the
+*	calling task. Errors, exception flags, the gamma sign and the
+*	m99_*() backend settings are then kept in ctx instead of the
+*	shared default context, so tasks that each install their own
+*	context never write to common state. If its pio2_memo field is
+*	set, an installed context also remembers the last argument that
+*	sin(), cos() or tan() reduced modulo pi/2, so calls on the same
+*	angle reduce it only once.
+*
+*   INPUTS
+*	ctx      - Context to install, or NULL to remove the calling
+*	           task's context and return to the shared default.
+*	previous - Receives the context that was installed for the
+*	           calling task, or NULL if none was. May be NULL.
+*
+*   RESULT
+*	ok - 1, or 0 if all context slots are in use. Nothing is
+*	     installed then, and *previous is set to NULL.
+*
+*   EXAMPLE
+*	ma_ctx ctx, *old;
+*	ma_ctx_init(&ctx);
+*	if (!ma_ctx_install(&ctx, &old)) ...
+*	...
+*	ma_ctx_install(old, NULL);
+*
+*   NOTES
+*	The context must stay valid until it is removed. A task must
+*	remove its context before it exits. At most 16 tasks may have a
+*	context installed at the same time. Removing a context, or
+*	replacing one the task already has, always succeeds.
+*
+*   SEE ALSO
+*	ma_ctx_init(), ma_ctx_current(), math.h
+*
+******************************************************************************/
+
+int ma_ctx_install(ma_ctx *ctx, ma_ctx **previous)
+{
+    struct Task *me = FindTask(NULL);
+    int i, ok = 0;
+
+    if (previous) *previous = NULL;
+
+    for (i = 0; i < MA_CTX_SLOTS; i++) {
+        if (ctx_slots[i].task == me) {
+            if (previous) *previous = ctx_slots[i].ctx;
+            if (ctx) {
+                ctx_slots[i].ctx = ctx;
+            } else {
+                Forbid();
+                ctx_slots[i].task = NULL;
+                ctx_slots[i].ctx = NULL;
+                __ma_ctx_installed--;
+                Permit();
+            }
+            return 1;
+        }
+    }
+
+    if (ctx == NULL) {
+        return 1;
+    }
+
+    Forbid();
+    for (i = 0; i < MA_CTX_SLOTS; i++) {
+        if (ctx_slots[i].task == NULL) {
+            ctx_slots[i].ctx = ctx;
+            ctx_slots[i].task = me;
+            __ma_ctx_installed++;
+            ok = 1;
+            break;
+        }
+    }
+    Permit();
+
+    return ok;
+}
+
+/****** ma.lib/ma_ctx_current ************************************************
+*
+*   NAME	
+* 	ma_ctx_current -- Return the calling task's math context. (V1.0)
+*
+*   SYNOPSIS
+*	ma_ctx *ctx = ma_ctx_current(void);
+*	  D0
+*	ma_ctx *ma_ctx_current(void);
+*
+*   FUNCTION
+*	Return the context installed for the calling task with
+*	ma_ctx_install(), or the shared default context if the task has
+*	not installed one.
+*
+*   INPUTS
+*	None.
+*
+*   RESULT
+*	ctx - The calling task's context. Never NULL.
+*
+*   EXAMPLE
+*	if (ma_ctx_testexcept(ma_ctx_current(), MA_FE_INVALID)) {
+*	    printf("Invalid operation\n");
+*	}
+*
+*   NOTES
+*	Takes no locks.
+*
+*   SEE ALSO
+*	ma_ctx_install(), ma_ctx_testexcept(), math.h
+*
+******************************************************************************/
+
+ma_ctx *ma_ctx_current(void)
+{
+    struct Task *me = FindTask(NULL);
+    int i;
+
+    for (i = 0; i < MA_CTX_SLOTS; i++) {
+        if (ctx_slots[i].task == me) {
+            return ctx_slots[i].ctx;
+        }
+    }
+    return &default_ctx;
+}
+
+/****** ma.lib/ma_ctx_testexcept *********************************************
+*
+*   NAME	
+* 	ma_ctx_testexcept -- Test exception flags of a math context. (V1.0)
+*
+*   SYNOPSIS
+*	int result = ma_ctx_testexcept(const ma_ctx *ctx,
+*	  D0                                       A0
+*	                               unsigned long excepts);
+*	                                             D0
+*	int ma_ctx_testexcept(const ma_ctx *ctx, unsigned long excepts);
+*
+*   FUNCTION
+*	Return the subset of excepts that is currently raised in ctx.
+*
+*   INPUTS
+*	ctx     - Context to test.
+*	excepts - Bitwise OR of MA_FE_* flags.
+*
+*   RESULT
+*	result - Bitwise OR of the flags in excepts that are raised.
+*
+*   EXAMPLE
+*	ma_ctx_clearexcept(&ctx, MA_FE_ALL_EXCEPT);
+*	r = ma_tgamma_r(&ctx, x);
+*	if (ma_ctx_testexcept(&ctx, MA_FE_OVERFLOW)) ...
+*
+*   NOTES
+*	Flags are sticky: they stay raised until cleared.
+*
+*   SEE ALSO
+*	ma_ctx_clearexcept(), ma_ctx_current(), math.h
+*
+******************************************************************************/
+
+int ma_ctx_testexcept(const ma_ctx *ctx, unsigned long excepts)
+{
+    return (int)(ctx->except & excepts & MA_FE_ALL_EXCEPT);
+}
+
+/****** ma.lib/ma_ctx_clearexcept ********************************************
+*
+*   NAME	
+* 	ma_ctx_clearexcept -- Clear exception flags of a math context. (V1.0)
+*
+*   SYNOPSIS
+*	ma_ctx_clearexcept(ma_ctx *ctx, unsigned long excepts);
+*	                    A0                        D0
+*	void ma_ctx_clearexcept(ma_ctx *ctx, unsigned long excepts);
+*
+*   FUNCTION
+*	Clear the flags in excepts in ctx. If every flag is cleared the
+*	recorded error is reset to M99_ERR_NONE as well.
+*
+*   INPUTS
+*	ctx     - Context to modify.
+*	excepts - Bitwise OR of MA_FE_* flags.
+*
+*   RESULT
+*	None.
+*
+*   EXAMPLE
+*	ma_ctx_clearexcept(ma_ctx_current(), MA_FE_ALL_EXCEPT);
+*
+*   NOTES
+*	None.
+*
+*   SEE ALSO
+*	ma_ctx_testexcept(), m99_clear_error(), math.h
+*
+******************************************************************************/
+
+void ma_ctx_clearexcept(ma_ctx *ctx, unsigned long excepts)
+{
+    ctx->except &= ~excepts;
+    if ((ctx->except & MA_FE_ALL_EXCEPT) == 0) {
+        ctx->error = M99_ERR_NONE;
+    }
+}
+
+/*
+ * __ma_ctx_own - Return the context installed for the calling task, or
+ * NULL if it has none. State that must not be shared between tasks,
+ * such as the trig reduction memo, is only kept in an installed context.
+ */
+ma_ctx *__ma_ctx_own(void)
+{
+    struct Task *me = FindTask(NULL);
+    int i;
+
+    for (i = 0; i < MA_CTX_SLOTS; i++) {
+        if (ctx_slots[i].task == me) {
+            return ctx_slots[i].ctx;
+        }
+    }
+    return NULL;
+}
+
+/*
+ * __ma_ctx_raise - Record an errno value in a context without touching
+ * errno itself. For ERANGE, r is the result being returned: one of
+ * magnitude below 1 is an underflow, anything else an overflow or a
+ * pole. Used by the context-taking entry points.
+ */
+void __ma_ctx_raise(ma_ctx *ctx, int err, double r)
+{
+    if (err == EDOM) {
+        ctx->error = M99_ERR_DOMAIN;
+        ctx->except |= MA_FE_INVALID;
+    } else if (err == ERANGE) {
+        ctx->error = M99_ERR_RANGE;
+        ctx->except |= (fabs(r) < 1.0) ? MA_FE_UNDERFLOW : MA_FE_OVERFLOW;
+    }
+}
+
+/*
+ * __ma_seterr - Set errno and record the error in the calling task's
+ * context. Used in place of a bare errno assignment for domain errors,
+ * overflows and poles.
+ */
+void __ma_seterr(int err)
+{
+    errno = err;
+    __ma_ctx_raise(ma_ctx_current(), err, HUGE_VAL);
+}
+
+/*
+ * __ma_setrange - Set errno to ERANGE for the result r, which may have
+ * underflowed, and raise the matching flag in the calling task's context.
+ */
+void __ma_setrange(double r)
+{
+    errno = ERANGE;
+    __ma_ctx_raise(ma_ctx_current(), ERANGE, r);
+}
@@ -0,0 +1,536 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Multi-precision natural numbers on arrays of 32-bit limbs
+ *
+ * Method :
+ *	The add, subtract and multiply-by-limb loops are the schoolbook
+ *	ones, one limb and one carry at a time. ma_mpn_mul() multiplies
+ *	balanced operands by Karatsuba's method: with a = a1*B**m + a0
+ *	and b = b1*B**m + b0,
+ *	    a*b = z2*B**2m + (z0 + z2 - (a0-a1)*(b0-b1))*B**m + z0
+ *	where z0 = a0*b0 and z2 = a1*b1, so three half-size products
+ *	replace four. The differences are formed as magnitudes with a
+ *	sign, so no limb ever needs a carry bit. Below the threshold,
+ *	and without scratch space, it is the schoolbook product.
+ *	Unbalanced operands are cut into square blocks.
+ *	ma_mpn_divrem_1() divides two limbs by one with a precomputed
+ *	reciprocal (Moller and Granlund, "Improved division by
+ *	invariant integers", 2011): two multiplies and two corrections
+ *	per limb instead of a bit-serial division.
+ */
+
+#include <errno.h>
+#include <amiga/mpn.h>
+#include "include/internal/conv.h"
+#include "include/internal/bits.h"
+
+/*
+ * Operand size, in limbs, from which Karatsuba beats the schoolbook
+ * product. The 68000's 16-bit multiplier makes a limb product cost
+ * four MULUs, which favours Karatsuba early. Build with
+ * DEF MA_MPN_KARATSUBA_THRESHOLD=n to retune; n must be at least 4.
+ */
+#ifndef MA_MPN_KARATSUBA_THRESHOLD
+#define MA_MPN_KARATSUBA_THRESHOLD 16
+#endif
+
+/* Shared fixed-point kernels - see fixed.c */
+extern void __fix_umul(unsigned long a, unsigned long b,
+                       unsigned long *hi, unsigned long *lo);
+extern unsigned long __fix_udiv(unsigned long hi, unsigned long lo,
+                                unsigned long d, unsigned long *rem);
+
+/****** ma.lib/ma_mpn_add ***************************************************
+*
+*   NAME	
+* 	ma_mpn_add -- Add or subtract multi-precision numbers. (V1.0)
+*
+*   SYNOPSIS
+*	unsigned long c = ma_mpn_add(unsigned long *r,
+*	 D0			      A0
+*	    const unsigned long *a, int an, const unsigned long *b, int bn);
+*	    A1                      D0      A2                      D1
+*	unsigned long ma_mpn_add(unsigned long *r, const unsigned long *a,
+*	                         int an, const unsigned long *b, int bn);
+*	unsigned long ma_mpn_sub(unsigned long *r, const unsigned long *a,
+*	                         int an, const unsigned long *b, int bn);
+*	unsigned long ma_mpn_add_n(unsigned long *r, const unsigned long *a,
+*	                           const unsigned long *b, int n);
+*	unsigned long ma_mpn_sub_n(unsigned long *r, const unsigned long *a,
+*	                           const unsigned long *b, int n);
+*	int ma_mpn_cmp(const unsigned long *a, const unsigned long *b,
+*	               int n);
+*
+*   FUNCTION
+*	Set r to a+b or a-b, where a has an limbs and b has bn <= an
+*	(the _n forms take n limbs of each), and return the carry or
+*	borrow out of the top limb. ma_mpn_cmp() compares two numbers
+*	of n limbs.
+*
+*   INPUTS
+*	r - Result, an (n) limbs. It may be the same array as a or b.
+*	a, b - Operands, least significant limb first.
+*	an, bn, n - Limb counts.
+*
+*   RESULT
+*	c - 0 or 1. For ma_mpn_cmp(), <0, 0 or >0 as a <, = or > b.
+*
+*   EXAMPLE
+*	unsigned long a[2] = { 0xFFFFFFFFUL, 0 }, one = 1;
+*	ma_mpn_add(a, a, 2, &one, 1);    (a = { 0, 1 })
+*
+*   NOTES
+*	ma.lib extension. A borrow of 1 means a < b and r holds
+*	a-b+2**(32*an).
+*
+*   SEE ALSO
+*	ma_mpn_mul(), amiga/mpn.h
+*
+******************************************************************************/
+
+unsigned long ma_mpn_add_n(unsigned long *r, const unsigned long *a,
+                           const unsigned long *b, int n)
+{
+    unsigned long s, t, c;
+    int i;
+
+    c = 0;
+    for (i = 0; i < n; i++) {
+        s = a[i] + c;
+        c = (s < c);
+        t = s + b[i];
+        c += (t < s);
+        r[i] = t;
+    }
+    return c;
+}
+
+unsigned long ma_mpn_sub_n(unsigned long *r, const unsigned long *a,
+                           const unsigned long *b, int n)
+{
+    unsigned long s, t, c;
+    int i;
+
+    c = 0;
+    for (i = 0; i < n; i++) {
+        s = a[i] - b[i];
+        t = s - c;
+        c = (a[i] < b[i]) + (s < c);
+        r[i] = t;
+    }
+    return c;
+}
+
+unsigned long ma_mpn_add(unsigned long *r, const unsigned long *a, int an,
+                         const unsigned long *b, int bn)
+{
+    unsigned long s, c;
+    int i;
+
+    c = ma_mpn_add_n(r, a, b, bn);
+    for (i = bn; i < an; i++) {
+        s = a[i] + c;
+        c = (s < c);
+        r[i] = s;
+    }
+    return c;
+}
+
+unsigned long ma_mpn_sub(unsigned long *r, const unsigned long *a, int an,
+                         const unsigned long *b, int bn)
+{
+    unsigned long s, c;
+    int i;
+
+    c = ma_mpn_sub_n(r, a, b, bn);
+    for (i = bn; i < an; i++) {
+        s = a[i] - c;
+        c = (a[i] < c);
+        r[i] = s;
+    }
+    return c;
+}
+
+int ma_mpn_cmp(const unsigned long *a, const unsigned long *b, int n)
+{
+    while (--n >= 0) {
+        if (a[n] != b[n]) return (a[n] > b[n]) ? 1 : -1;
+    }
+    return 0;
+}
+
+/****** ma.lib/ma_mpn_mul_1 *************************************************
+*
+*   NAME	
+* 	ma_mpn_mul_1 -- Multiply a multi-precision number by a limb. (V1.0)
+*
+*   SYNOPSIS
+*	unsigned long c = ma_mpn_mul_1(unsigned long *r,
+*	 D0				A0
+*	    const unsigned long *a, int n, unsigned long m);
+*	    A1                      D0     D1
+*	unsigned long ma_mpn_mul_1(unsigned long *r, const unsigned long *a,
+*	                           int n, unsigned long m);
+*	unsigned long ma_mpn_addmul_1(unsigned long *r,
+*	                              const unsigned long *a, int n,
+*	                              unsigned long m);
+*
+*   FUNCTION
+*	Set r to a*m (mul_1) or add a*m to r (addmul_1), over n limbs,
+*	and return the limb carried out of the top.
+*
+*   INPUTS
+*	r - Result, n limbs. For ma_mpn_mul_1() it may be a.
+*	a - Multiplicand, n limbs.
+*	n - Limb count.
+*	m - Multiplier.
+*
+*   RESULT
+*	c - The top limb of the (n+1)-limb result.
+*
+*   EXAMPLE
+*	d[n] = ma_mpn_mul_1(d, d, n, 1000000000UL);
+*
+*   NOTES
+*	ma.lib extension. addmul_1 is the inner loop of the schoolbook
+*	product and of most bignum code.
+*
+*   SEE ALSO
+*	ma_mpn_mul(), ma_mpn_divrem_1(), amiga/mpn.h
+*
+******************************************************************************/
+
+unsigned long ma_mpn_mul_1(unsigned long *r, const unsigned long *a, int n,
+                           unsigned long m)
+{
+    unsigned long hi, lo, c;
+    int i;
+
+    c = 0;
+    for (i = 0; i < n; i++) {
+        __fix_umul(a[i], m, &hi, &lo);
+        lo += c;
+        c = hi + (lo < c);
+        r[i] = lo;
+    }
+    return c;
+}
+
+unsigned long ma_mpn_addmul_1(unsigned long *r, const unsigned long *a, int n,
+                              unsigned long m)
+{
+    unsigned long hi, lo, t, c;
+    int i;
+
+    c = 0;
+    for (i = 0; i < n; i++) {
+        __fix_umul(a[i], m, &hi, &lo);
+        lo += c;
+        hi += (lo < c);
+        t = r[i] + lo;
+        hi += (t < lo);
+        r[i] = t;
+        c = hi;
+    }
+    return c;
+}
+
+/* r[an+bn] = a*b by rows */
+static void mul_basecase(unsigned long *r, const unsigned long *a, int an,
+                         const unsigned long *b, int bn)
+{
+    int j;
+
+    r[an] = ma_mpn_mul_1(r, a, an, b[0]);
+    for (j = 1; j < bn; j++)
+        r[an+j] = ma_mpn_addmul_1(r+j, a, an, b[j]);
+}
+
+/* r[xn] = |x - y| for xn >= yn >= 0; returns 1 if x < y */
+static int absdiff(unsigned long *r, const unsigned long *x, int xn,
+                   const unsigned long *y, int yn)
+{
+    int i;
+
+    for (i = xn-1; i >= yn; i--) {
+        if (x[i] != 0) break;
+    }
+    if (i < yn && ma_mpn_cmp(x, y, yn) < 0) {
+        ma_mpn_sub_n(r, y, x, yn);
+        for (i = yn; i < xn; i++) r[i] = 0;
+        return 1;
+    }
+    ma_mpn_sub(r, x, xn, y, yn);
+    return 0;
+}
+
+/*
+ * kara - r[2n] = a*b for n limbs each. tmp holds the differences,
+ * their product and the middle term (6m+1 limbs, m = ceil(n/2)), then
+ * what the recursion needs.
+ */
+static void kara(unsigned long *r, const unsigned long *a,
+                 const unsigned long *b, int n, unsigned long *tmp)
+{
+    unsigned long *t, *u, *tu, *w;
+    int m, h, neg;
+
+    if (n < MA_MPN_KARATSUBA_THRESHOLD) {
+        mul_basecase(r, a, n, b, n);
+        return;
+    }
+    m = (n+1) >> 1;
+    h = n - m;
+    t = tmp;
+    u = t + m;
+    tu = u + m;
+    w = tu + 2*m;
+    tmp = w + 2*m + 1;
+
+    neg = absdiff(t, a, m, a+m, h);
+    neg ^= absdiff(u, b, m, b+m, h);
+    kara(r, a, b, m, tmp);                  /* z0 */
+    kara(r+2*m, a+m, b+m, h, tmp);          /* z2 */
+    kara(tu, t, u, m, tmp);                 /* |a0-a1|*|b0-b1| */
+
+    /* middle = z0 + z2 -+ tu, added in at B**m */
+    w[2*m] = ma_mpn_add(w, r, 2*m, r+2*m, 2*h);
+    if (neg)
+        w[2*m] += ma_mpn_add_n(w, w, tu, 2*m);
+    else
+        w[2*m] -= ma_mpn_sub_n(w, w, tu, 2*m);
+    ma_mpn_add(r+m, r+m, 2*n-m, w, 2*m+1);
+}
+
+/****** ma.lib/ma_mpn_mul ***************************************************
+*
+*   NAME	
+* 	ma_mpn_mul -- Multiply multi-precision numbers. (V1.0)
+*
+*   SYNOPSIS
+*	ma_mpn_mul(unsigned long *r, const unsigned long *a, int an,
+*	           A0                A1                      D0
+*	           const unsigned long *b, int bn, unsigned long *tmp);
+*	           A2                      D1      A3
+*	void ma_mpn_mul(unsigned long *r, const unsigned long *a, int an,
+*	                const unsigned long *b, int bn, unsigned long *tmp);
+*
+*   FUNCTION
+*	Set r to the full product a*b, an+bn limbs. Operands of at
+*	least MA_MPN_KARATSUBA_THRESHOLD limbs are multiplied by
+*	Karatsuba's method when scratch space is given, which takes
+*	time proportional to bn**1.58 rather than bn**2 for each
+*	bn-limb block of a.
+*
+*   INPUTS
+*	r - Result, an+bn limbs; it must not overlap a or b.
+*	a - Longer operand, an limbs.
+*	b - Shorter operand, bn limbs, 1 <= bn <= an.
+*	tmp - NULL for the schoolbook product, or MA_MPN_MUL_TMP(bn)
+*	      limbs of scratch.
+*
+*   RESULT
+*	None.
+*
+*   EXAMPLE
+*	unsigned long r[64], tmp[MA_MPN_MUL_TMP(32)];
+*	ma_mpn_mul(r, a, 32, b, 32, tmp);
+*
+*   NOTES
+*	ma.lib extension. The scratch is the caller's so that nothing
+*	is allocated and a small task stack is not overrun.
+*
+*   SEE ALSO
+*	ma_mpn_mul_1(), ma_umul64x128(), amiga/mpn.h
+*
+******************************************************************************/
+
+void ma_mpn_mul(unsigned long *r, const unsigned long *a, int an,
+                const unsigned long *b, int bn, unsigned long *tmp)
+{
+    unsigned long c;
+    int i;
+
+    if (tmp == 0 || bn < MA_MPN_KARATSUBA_THRESHOLD) {
+        mul_basecase(r, a, an, b, bn);
+        return;
+    }
+
+    /* square blocks of bn limbs, then the schoolbook for the rest */
+    kara(r, a, b, bn, tmp);
+    for (i = bn; i + bn <= an; i += bn) {
+        kara(tmp, a+i, b, bn, tmp + 2*bn);
+        c = ma_mpn_add_n(r+i, r+i, tmp, bn);
+        ma_mpn_add(r+i+bn, tmp+bn, bn, &c, 1);
+    }
+    if (i < an) {
+        mul_basecase(tmp, b, bn, a+i, an-i);
+        c = ma_mpn_add_n(r+i, r+i, tmp, bn);
+        ma_mpn_add(r+i+bn, tmp+bn, an-i, &c, 1);
+    }
+}
+
+/* Two limbs u1:u0 by a normalised d with reciprocal v; u1 < d */
+static unsigned long div_preinv(unsigned long u1, unsigned long u0,
+                                unsigned long d, unsigned long v,
+                                unsigned long *rem)
+{
+    unsigned long q1, q0, r, hi, lo;
+
+    __fix_umul(v, u1, &q1, &q0);
+    q0 += u0;
+    q1 += u1 + 1 + (q0 < u0);
+    __fix_umul(q1, d, &hi, &lo);
+    r = u0 - lo;
+    if (r > q0) {
+        q1--;
+        r += d;
+    }
+    if (r >= d) {
+        q1++;
+        r -= d;
+    }
+    *rem = r;
+    return q1;
+}
+
+/****** ma.lib/ma_mpn_divrem_1 **********************************************
+*
+*   NAME	
+* 	ma_mpn_divrem_1 -- Divide a multi-precision number by a limb. (V1.0)
+*
+*   SYNOPSIS
+*	unsigned long rem = ma_mpn_divrem_1(unsigned long *q,
+*	 D0				     A0
+*	    const unsigned long *a, int n, unsigned long d);
+*	    A1                      D0     D1
+*	unsigned long ma_mpn_divrem_1(unsigned long *q,
+*	                              const unsigned long *a, int n,
+*	                              unsigned long d);
+*
+*   FUNCTION
+*	Set q to floor(a/d) and return a mod d. Radix conversion is
+*	repeated division by 10**9 this way.
+*
+*   INPUTS
+*	q - Quotient, n limbs. It may be a.
+*	a - Dividend, n limbs.
+*	n - Limb count.
+*	d - Divisor.
+*
+*   RESULT
+*	rem - The remainder. If d is 0, q is left alone, the result is
+*	    0 and errno is set to EDOM.
+*
+*   EXAMPLE
+*	while (n > 0) {
+*	    digits9 = ma_mpn_divrem_1(a, a, n, 1000000000UL);
+*	    if (a[n-1] == 0) n--;
+*	}
+*
+*   NOTES
+*	ma.lib extension. One bit-serial division sets up a reciprocal
+*	of d; each limb after that costs two multiplies.
+*
+*   SEE ALSO
+*	ma_mpn_mul_1(), ma_uldiv_init(), amiga/mpn.h
+*
+******************************************************************************/
+
+unsigned long ma_mpn_divrem_1(unsigned long *q, const unsigned long *a, int n,
+                              unsigned long d)
+{
+    unsigned long v, r, lo;
+    int s, i;
+
+    if (d == 0) {
+        errno = EDOM;
+        return 0;
+    }
+    if (n <= 0) return 0;
+
+    /* normalise d, and a with it, and work out v = (B*B-1)/d - B */
+    s = __ma_clz32(d);
+    d <<= s;
+    v = __fix_udiv(~d, 0xFFFFFFFFUL, d, &r);
+
+    if (s == 0) {
+        r = 0;
+        for (i = n-1; i >= 0; i--)
+            q[i] = div_preinv(r, a[i], d, v, &r);
+        return r;
+    }
+    r = a[n-1] >> (32-s);
+    for (i = n-1; i > 0; i--) {
+        lo = (a[i] << s) | (a[i-1] >> (32-s));
+        q[i] = div_preinv(r, lo, d, v, &r);
+    }
+    q[0] = div_preinv(r, a[0] << s, d, v, &r);
+    return r >> s;
+}
+
+/****** ma.lib/ma_umul64x128 ************************************************
+*
+*   NAME	
+* 	ma_umul64x128 -- Full or high product of 64- or 32-bit values. (V1.0)
+*
+*   SYNOPSIS
+*	ma_umul64x128(unsigned_long_long_t a, unsigned_long_long_t b,
+*	              D0/D1                   D2/D3
+*	              unsigned_long_long_t *hi, unsigned_long_long_t *lo);
+*	              A0                        A1
+*	void ma_umul64x128(unsigned_long_long_t a, unsigned_long_long_t b,
+*	                   unsigned_long_long_t *hi,
+*	                   unsigned_long_long_t *lo);
+*	unsigned_long_long_t ma_mulhi64(unsigned_long_long_t a,
+*	                                unsigned_long_long_t b);
+*	unsigned long ma_mulhi32(unsigned long a, unsigned long b);
+*
+*   FUNCTION
+*	Form the exact product of two unsigned values at twice their
+*	width. ma_umul64x128() returns both halves; the mulhi forms
+*	return only the upper half, which is what fixed-point scaling
+*	and division by a reciprocal need.
+*
+*   INPUTS
+*	a, b - Factors.
+*	hi, lo - Upper and lower 64 bits of the 128-bit product.
+*
+*   RESULT
+*	For the mulhi forms, floor(a*b / 2**64) or floor(a*b / 2**32).
+*
+*   EXAMPLE
+*	ma_umul64x128(x, y, &hi, &lo);
+*	if (hi.hi | hi.lo) ... x*y overflows 64 bits
+*
+*   NOTES
+*	ma.lib extension. long_long_mul() uses this to detect overflow.
+*
+*   SEE ALSO
+*	ma_mpn_mul(), long_long_mul(), amiga/mpn.h
+*
+******************************************************************************/
+
+void ma_umul64x128(unsigned_long_long_t a, unsigned_long_long_t b,
+                   unsigned_long_long_t *hi, unsigned_long_long_t *lo)
+{
+    __ma_umul64(&a, &b, hi, lo);
+}
+
+unsigned_long_long_t ma_mulhi64(unsigned_long_long_t a, unsigned_long_long_t b)
+{
+    unsigned_long_long_t hi, lo;
+
+    __ma_umul64(&a, &b, &hi, &lo);
+    return hi;
+}
+
+unsigned long ma_mulhi32(unsigned long a, unsigned long b)
+{
+    unsigned long hi, lo;
+
+    __fix_umul(a, b, &hi, &lo);
+    return hi;
+}
@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * double ma_ndtri(double p)
+ * Return the quantile of the standard normal distribution
+ *
+ * Method :
+ *	Wichura's algorithm AS241 (PPND16), Applied Statistics 37 (1988):
+ *	a rational approximation in q = p-1/2 for |q| <= 0.425, and in
+ *	sqrt(-log(r)), r = min(p,1-p), in the two tails. Its results are
+ *	good to about 7 ulps; ma_ndtri() improves on them with the Newton
+ *	step of __kernel_erfinv(), taken in erf space where the residual
+ *	is available without cancellation.
+ */
+
+#include <math.h>
+#include <errno.h>
+#include "include/internal/m99_math.h"
+
+static const double
+one    = 1.0,
+two    = 2.0,
+sqrt2  = 1.41421356237309514547e+00, /* 0x3FF6A09E, 0x667F3BCD */
+split1 = 0.425,
+split2 = 5.0,
+const1 = 0.180625,
+const2 = 1.6,
+	/* coefficients for |q| <= 0.425 */
+a0 = 3.3871328727963666080e+00,
+a1 = 1.3314166789178437745e+02,
+a2 = 1.9715909503065514427e+03,
+a3 = 1.3731693765509461125e+04,
+a4 = 4.5921953931549871457e+04,
+a5 = 6.7265770927008700853e+04,
+a6 = 3.3430575583588128105e+04,
+a7 = 2.5090809287301226727e+03,
+b1 = 4.2313330701600911252e+01,
+b2 = 6.8718700749205790830e+02,
+b3 = 5.3941960214247511077e+03,
+b4 = 2.1213794301586595867e+04,
+b5 = 3.9307895800092710610e+04,
+b6 = 2.8729085735721942674e+04,
+b7 = 5.2264952788528545610e+03,
+	/* coefficients for sqrt(-log(r)) <= 5 */
+c0 = 1.42343711074968357734e+00,
+c1 = 4.63033784615654529590e+00,
+c2 = 5.76949722146069140550e+00,
+c3 = 3.64784832476320460504e+00,
+c4 = 1.27045825245236838258e+00,
+c5 = 2.41780725177450611770e-01,
+c6 = 2.27238449892691845833e-02,
+c7 = 7.74545014278341407640e-04,
+d1 = 2.05319162663775882187e+00,
+d2 = 1.67638483018380384940e+00,
+d3 = 6.89767334985100004550e-01,
+d4 = 1.48103976427480074590e-01,
+d5 = 1.51986665636164571966e-02,
+d6 = 5.47593808499534494600e-04,
+d7 = 1.05075007164441684324e-09,
+	/* coefficients for sqrt(-log(r)) > 5 */
+e0 = 6.65790464350110377720e+00,
+e1 = 5.46378491116411436990e+00,
+e2 = 1.78482653991729133580e+00,
+e3 = 2.96560571828504891230e-01,
+e4 = 2.65321895265761230930e-02,
+e5 = 1.24266094738807843860e-03,
+e6 = 2.71155556874348757815e-05,
+e7 = 2.01033439929228813265e-07,
+f1 = 5.99832206555887937690e-01,
+f2 = 1.36929880922735805310e-01,
+f3 = 1.48753612908506148525e-02,
+f4 = 7.86869131145613259100e-04,
+f5 = 1.84631831751005468180e-05,
+f6 = 1.42151175831644588870e-07,
+f7 = 2.04426310338993978564e-15;
+
+/* Inverse error function kernel - see erfinv.c */
+extern double __kernel_erfinv(double q, double t);
+
+/*
+ * __kernel_ppnd_tail - The tail of __kernel_ppnd(), given q and
+ * s = -log(r) rather than r, for callers that cannot form r exactly.
+ */
+double __kernel_ppnd_tail(double q, double s)
+{
+    double r, z;
+
+    r = sqrt(s);
+    if (r <= split2) {
+        r -= const2;
+        z = (((((((c7*r+c6)*r+c5)*r+c4)*r+c3)*r+c2)*r+c1)*r+c0)/
+            (((((((d7*r+d6)*r+d5)*r+d4)*r+d3)*r+d2)*r+d1)*r+one);
+    } else {
+        r -= split2;
+        z = (((((((e7*r+e6)*r+e5)*r+e4)*r+e3)*r+e2)*r+e1)*r+e0)/
+            (((((((f7*r+f6)*r+f5)*r+f4)*r+f3)*r+f2)*r+f1)*r+one);
+    }
+    return (q < 0.0) ? -z : z;
+}
+
+/*
+ * __kernel_ppnd - Normal quantile of p by AS241, given q = p-1/2 and
+ * r = min(p,1-p) > 0. r is only used when |q| > 0.425.
+ */
+double __kernel_ppnd(double q, double r)
+{
+    if (fabs(q) <= split1) {
+        r = const1-q*q;
+        return q*(((((((a7*r+a6)*r+a5)*r+a4)*r+a3)*r+a2)*r+a1)*r+a0)/
+                 (((((((b7*r+b6)*r+b5)*r+b4)*r+b3)*r+b2)*r+b1)*r+one);
+    }
+    return __kernel_ppnd_tail(q, -log(r));
+}
+
+/****** ma.lib/ma_ndtri ******************************************************
+*
+*   NAME	
+* 	ma_ndtri -- Quantile of the standard normal distribution. (V1.0)
+*
+*   SYNOPSIS
+*	double result = ma_ndtri(double p);
+*	  D0		       D0
+*	double ma_ndtri(double p);
+*	void ma_ndtri_v(double *dst, const double *src, unsigned long n);
+*
+*   FUNCTION
+*	Return the x for which ma_normcdf(x) is p, using Wichura's
+*	rational approximation AS241 directly rather than iterating on
+*	erf(). ma_ndtri_v() does the same for n values from src,
+*	storing the results in dst, which may be the same array.
+*
+*   INPUTS
+*	p - Probability, in [0,1].
+*
+*   RESULT
+*	result - The normal quantile of p. -Infinity for p = 0 and
+*	        +Infinity for p = 1. Returns NaN for p outside [0,1].
+*
+*   EXAMPLE
+*	double z = ma_ndtri(0.975);
+*
+*   NOTES
+*	ma.lib extension, named after the Cephes function. Accurate to
+*	within 3 ulps for p down to 1e-305, and to about 5 below that.
+*	Sets errno to EDOM outside [0,1] and ERANGE at 0 and 1.
+*
+*   SEE ALSO
+*	ma_normcdf(), ma_erfinv(), ma_erfcinv(), math.h
+*
+******************************************************************************/
+
+double ma_ndtri(double p)
+{
+    double q;
+
+    if (!(p > 0.0 && p < one)) {
+        if (p == 0.0 || p == one) {
+            __ma_seterr(ERANGE);
+            return (p == 0.0) ? -one/__ma_zero : one/__ma_zero;
+        }
+        if (p == p) __ma_seterr(EDOM);
+        return (p-p)/(p-p);
+    }
+    q = p-0.5;
+    return sqrt2*__kernel_erfinv(q, (q < 0.0) ? p+p : two-(p+p));
+}
+
+void ma_ndtri_v(double *dst, const double *src, unsigned long n)
+{
+    while (n--) {
+        *dst++ = ma_ndtri(*src++);
+    }
+}
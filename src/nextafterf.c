@@ -18,10 +18,6 @@
 #include <math.h>
 #include "include/internal/m99_math.h"
 
-/* Helper macros for accessing high/low parts of float */
-/* SAS/C uses big-endian, so high word is first */
-#define __HI(x) *(int*)&x
-
 /****** ma.lib/nextafterf ****************************************************
 * 
 *   NAME	
@@ -103,4 +99,3 @@ float nextafterf(float x, float y)
     return x;
 }
 
-
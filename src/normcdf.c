@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * double ma_normcdf(double x)
+ * Return the standard normal distribution function
+ *
+ * Method :
+ *	normcdf(x) = erfc(-x/sqrt(2))/2. Rounding z = -x/sqrt(2) would
+ *	cost about 2*z*z ulps in the lower tail, so z is formed as a
+ *	double-double h+l and the low part is applied to erfc(h) by its
+ *	derivative, -2/sqrt(pi)*exp(-h*h).
+ */
+
+#include <math.h>
+#include "include/internal/m99_math.h"
+
+/* Shared kernel - see pown.c */
+extern void __kernel_mul12(double a, double b, double *hi, double *lo);
+
+static const double
+one      =  1.0,
+half     =  0.5,
+sqrth    =  7.07106781186547572737e-01, /* 0x3FE6A09E, 0x667F3BCD */
+sqrth_lo = -4.83364665672645672553e-17, /* 0xBC8BDD34, 0x13B26456 */
+rsqrtpi  =  5.64189583547756279280e-01; /* 0x3FE20DD7, 0x50429B6D */
+
+/****** ma.lib/ma_normcdf ****************************************************
+*
+*   NAME	
+* 	ma_normcdf -- Standard normal distribution function. (V1.0)
+*
+*   SYNOPSIS
+*	double result = ma_normcdf(double x);
+*	  D0		         D0
+*	double ma_normcdf(double x);
+*	void ma_normcdf_v(double *dst, const double *src, unsigned long n);
+*
+*   FUNCTION
+*	Return the probability that a standard normal variate is at most
+*	x. ma_normcdf_v() does the same for n values from src, storing
+*	the results in dst, which may be the same array.
+*
+*   INPUTS
+*	x - Input value.
+*
+*   RESULT
+*	result - The normal distribution function at x, in [0,1].
+*
+*   EXAMPLE
+*	double p = ma_normcdf(-1.96);
+*
+*   NOTES
+*	ma.lib extension. Keeps its relative accuracy through the lower
+*	tail, down to the underflow of the result near x = -38.
+*
+*   SEE ALSO
+*	ma_ndtri(), erfc(), math.h
+*
+******************************************************************************/
+
+double ma_normcdf(double x)
+{
+    double h, l, p;
+
+    if (x != x) return x+x;
+    if (x < -40.0) return 0.0;
+    if (x > 40.0) return one;
+
+    __kernel_mul12(-x, sqrth, &h, &l);
+    l -= x*sqrth_lo;
+    p = half*erfc(h);
+    if (h > 0.0) p -= l*rsqrtpi*exp(-h*h);
+    return p;
+}
+
+void ma_normcdf_v(double *dst, const double *src, unsigned long n)
+{
+    while (n--) {
+        *dst++ = ma_normcdf(*src++);
+    }
+}
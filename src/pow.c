@@ -17,10 +17,8 @@
 #include <math.h>
 #include "include/internal/m99_math.h"
 
-/* Helper macros for accessing high/low parts of double */
-/* SAS/C uses big-endian, so high word is first */
-#define __HI(x) *(int*)&x
-#define __LO(x) *(1+(int*)&x)
+/* Shared integer power - see pown.c */
+extern double __ieee754_pown(double x, long n);
 
 static const double
 bp[] = {1.0, 1.5,},
@@ -111,6 +109,16 @@ static double __ieee754_pow(double x, double y)
         }
     }
 
+    /*
+     * |y| <= 4 integral: binary powering takes at most two double-double
+     * multiplies (three with the reciprocal), fewer soft-float operations
+     * than the log/exp path below. Beyond that pown() costs more.
+     */
+    if(iy<0x40140000) {		/* |y| < 5 */
+        n = (int)y;
+        if((double)n==y) return __ieee754_pown(x,(long)n);
+    }
+
     ax   = fabs(x);
     /* special value of x */
     if(lx==0) {
@@ -267,7 +275,8 @@ static double __ieee754_pow(double x, double y)
 *   FUNCTION
 *	Compute x raised to the power of y. This is equivalent to x^y.
 *	This implementation uses high-precision algorithms from fdlibm for
-*	maximum accuracy.
+*	maximum accuracy. Integral y with |y| <= 4 is handed to pown(),
+*	which is both cheaper and more accurate there.
 * 
 *   INPUTS
 *	x - Base value.
@@ -285,7 +294,7 @@ static double __ieee754_pow(double x, double y)
 *	This function is C89 compliant and provides IEEE 754 accuracy.
 * 
 *   SEE ALSO
-*	sqrt(), cbrt(), exp(), log(), math.h
+*	pown(), sqrt(), cbrt(), exp(), log(), math.h
 * 
 ******************************************************************************/
 
@@ -294,4 +303,3 @@ double pow(double x, double y)
     return __ieee754_pow(x, y);
 }
 
-
@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * double powi(double x, int n)
+ * Return x raised to the integer power n
+ */
+
+#include <math.h>
+#include "include/internal/m99_math.h"
+
+/* Shared integer power - see pown.c */
+extern double __ieee754_pown(double x, long n);
+
+/****** ma.lib/powi *********************************************************
+*
+*   NAME	
+* 	powi -- Return x raised to an int power. (V1.0)
+*
+*   SYNOPSIS
+*	double result = powi(double x, int n);
+*	  D0		   D0        D0
+*	double powi(double x, int n);
+*
+*   FUNCTION
+*	Compute x raised to the integer power n. This is pown() with an
+*	int exponent, for code that uses the common powi() name.
+*
+*   INPUTS
+*	x - Base value.
+*	n - Integer exponent.
+*
+*   RESULT
+*	result - x^n, as pown().
+*
+*   EXAMPLE
+*	double r = powi(2.0, -3);
+*
+*   NOTES
+*	Uses binary exponentiation in double-double precision.
+*
+*   SEE ALSO
+*	pown(), pow(), cpowi(), math.h
+*
+******************************************************************************/
+
+double powi(double x, int n)
+{
+    return __ieee754_pown(x, (long)n);
+}
@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * double pown(double x, long n)
+ * Return x raised to the integer power n
+ */
+
+#include <math.h>
+#include "include/internal/m99_math.h"
+
+static const double
+one    = 1.0,
+split  = 134217729.0,		/* 2**27+1, Veltkamp splitter */
+two400 = 2.58224987808690858966e+120,	/* 0x58F00000, 0x00000000 */
+twom400= 3.87259191484931827282e-121;	/* 0x26F00000, 0x00000000 */
+
+/*
+ * __kernel_mul12 - Exact product a*b = *hi + *lo (Dekker, no fused
+ * multiply-add). Valid while |a|,|b| stay well inside the normal range.
+ */
+void __kernel_mul12(double a, double b, double *hi, double *lo)
+{
+    double p, ah, al, bh, bl;
+
+    p = split*a; ah = (a-p)+p; al = a-ah;
+    p = split*b; bh = (b-p)+p; bl = b-bh;
+    p = a*b;
+    *hi = p;
+    *lo = (((ah*bh-p)+ah*bl)+al*bh)+al*bl;
+}
+
+/*
+ * __kernel_mul22 - Double-double product (ah+al)*(bh+bl), about 2**-104
+ * relative.
+ */
+void __kernel_mul22(double ah, double al, double bh, double bl,
+                  double *hi, double *lo)
+{
+    double ph, pl, s;
+
+    __kernel_mul12(ah, bh, &ph, &pl);
+    pl += ah*bl + al*bh;
+    s = ph+pl;
+    *lo = pl-(s-ph);
+    *hi = s;
+}
+
+/*
+ * __kernel_pown - Compute (xh+xl)**n for finite, non-zero xh and n > 0.
+ * The base may carry a low-order part xl, as compoundn() needs.
+ *
+ * Binary exponentiation in double-double arithmetic, on the mantissa
+ * of the base so that no intermediate can overflow or underflow. The
+ * result is returned as (hi + *lo) * 2**(*e) with 2**-400 <= |hi| <= 1,
+ * and carries a relative error of about n * 2**-104, so rounding hi+lo
+ * once gives a nearly correctly rounded power.
+ */
+double __kernel_pown(double xh, double xl, unsigned long n, double *lo, double *e)
+{
+    double bh, bl, rh, rl;
+    double be, re;
+    int k, first;
+
+    bh = frexp(xh, &k);
+    bl = ldexp(xl, -k);
+    be = (double)k;
+    rh = one; rl = 0.0; re = 0.0;
+    first = 1;
+
+    for (;;) {
+        if (n & 1) {
+            if (first) {		/* 1*b needs no multiply */
+                rh = bh; rl = bl; re = be;
+                first = 0;
+            } else {
+                __kernel_mul22(rh, rl, bh, bl, &rh, &rl);
+                re += be;
+                if (fabs(rh) < twom400) {
+                    rh *= two400; rl *= two400; re -= 400.0;
+                }
+            }
+        }
+        n >>= 1;
+        if (n == 0) break;
+        __kernel_mul22(bh, bl, bh, bl, &bh, &bl);
+        be += be;
+        if (bh < twom400) {
+            bh *= two400; bl *= two400; be -= 400.0;
+        }
+    }
+
+    *lo = rl;
+    *e = re;
+    return rh;
+}
+
+/*
+ * __kernel_pown_finish - Scale (hi+lo)*2**e, or its reciprocal when inv
+ * is set, into a double. Overflow and underflow are left to scalbn().
+ */
+double __kernel_pown_finish(double hi, double lo, double e, int inv)
+{
+    double q, ph, pl, r;
+
+    if (inv) {
+        /* one Newton correction of 1/hi against the full hi+lo */
+        q = one/hi;
+        __kernel_mul12(q, hi, &ph, &pl);
+        r = ((one-ph)-pl)-q*lo;
+        hi = q;
+        lo = q*r;
+        e = -e;
+    }
+    if (e > 4000.0) e = 4000.0;
+    else if (e < -4000.0) e = -4000.0;
+    return scalbn(hi+lo, (int)e);
+}
+
+/*
+ * __ieee754_pown - pown() without the public wrapper, shared with pow()
+ * and powi().
+ */
+double __ieee754_pown(double x, long n)
+{
+    double hi, lo, e;
+    unsigned long k;
+    int odd;
+
+    if (n == 0) return one;		/* x**0 = 1, even for NaN */
+    if (x != x) return x+x;		/* NaN */
+
+    odd = (int)(n & 1);
+    k = (n < 0) ? 0UL-(unsigned long)n : (unsigned long)n;
+
+    /* +-0 and +-inf: only the sign of x and the parity of n matter */
+    if (x == 0.0 || x-x != 0.0) {
+        if (n > 0) return odd ? x : x*x;
+        return odd ? one/x : one/(x*x);
+    }
+
+    hi = __kernel_pown(x, 0.0, k, &lo, &e);
+    return __kernel_pown_finish(hi, lo, e, n < 0);
+}
+
+/****** ma.lib/pown *********************************************************
+*
+*   NAME	
+* 	pown -- Return x raised to an integer power. (V1.0)
+*
+*   SYNOPSIS
+*	double result = pown(double x, long n);
+*	  D0		   D0        D0
+*	double pown(double x, long n);
+*
+*   FUNCTION
+*	Compute x raised to the integer power n by binary exponentiation
+*	instead of through log() and exp(). Only about 2*log2(|n|)
+*	multiplies are needed, and they are carried out in double-double
+*	precision so the result is nearly correctly rounded.
+*
+*   INPUTS
+*	x - Base value.
+*	n - Integer exponent.
+*
+*   RESULT
+*	result - x^n. Returns 1.0 if n is 0 (even for NaN x), +-Infinity
+*	        for a zero x and negative n, and +-Infinity or +-0.0 when
+*	        the result overflows or underflows.
+*
+*   EXAMPLE
+*	double r = pown(1.5, 10);
+*
+*   NOTES
+*	C23 declares n as long long. ma.lib has no native long long type
+*	under SAS/C, so n is a long.
+*
+*	Each step is a double-double multiply of about 9 multiplies and
+*	16 adds; |n| takes log2(|n|) squarings plus one step for each
+*	further 1 bit, and a negative n one more for the reciprocal.
+*	Counting soft-float calls, n = 3 or 4 costs about 35 adds and 18
+*	multiplies, against 52 adds, 35 multiplies and 2 divides for
+*	pow() with a non-integral y; n = 7 costs about as much as pow()
+*	and n = 63 about 2.5 times as much. pow() therefore only hands
+*	|y| <= 4 to pown(); call pown() directly where its near-correct
+*	rounding matters more than speed.
+*
+*   SEE ALSO
+*	pow(), powi(), rootn(), compoundn(), cpowi(), math.h
+*
+******************************************************************************/
+
+double pown(double x, long n)
+{
+    return __ieee754_pown(x, n);
+}
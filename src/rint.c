@@ -14,18 +14,14 @@
  * Return x rounded to integral value according to the prevailing
  * rounding mode.
  * Method:
- *	Using floating addition.
+ *	Using floating addition; FINT on the 68881 build.
  * Exception:
  *	Inexact flag raised if x not equal to rint(x).
  */
 
 #include <math.h>
 #include "include/internal/m99_math.h"
-
-/* Helper macros for accessing high/low parts of double */
-/* SAS/C uses big-endian, so high word is first */
-#define __HI(x) *(int*)&x
-#define __LO(x) *(1+(int*)&x)
+#include "include/internal/fpu.h"
 
 static const double TWO52[2]={
   4.50359962737049600000e+15, /* 0x43300000, 0x00000000 */
@@ -69,6 +65,9 @@ static const double TWO52[2]={
 
 double rint(double x)
 {
+#ifdef MA_FPU_FULL
+	return __ma_fpu_int(x);
+#else
 	int i0,j0,sx;
 	unsigned i,i1;
 	double w,t;
@@ -83,7 +82,7 @@ double rint(double x)
 		i0 &= 0xfffe0000;
 		i0 |= ((i1|-i1)>>12)&0x80000;
 		__HI(x)=i0;
-	        w = TWO52[sx]+x;
+	        STRICT_ASSIGN(double,w,TWO52[sx]+x);
 	        t =  w-TWO52[sx];
 	        i0 = __HI(t);
 	        __HI(t) = (i0&0x7fffffff)|(sx<<31);
@@ -108,6 +107,7 @@ double rint(double x)
 	}
 	__HI(x) = i0;
 	__LO(x) = i1;
-	w = TWO52[sx]+x;
+	STRICT_ASSIGN(double,w,TWO52[sx]+x);
 	return w-TWO52[sx];
+#endif
 }
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * double rootn(double x, long n)
+ * Return the n-th root of x
+ */
+
+#include <math.h>
+#include "include/internal/m99_math.h"
+
+/* Shared integer power kernels - see pown.c */
+extern void __kernel_mul12(double a, double b, double *hi, double *lo);
+extern double __kernel_pown(double xh, double xl, unsigned long n, double *lo, double *e);
+
+static const double one = 1.0;
+
+/****** ma.lib/rootn ********************************************************
+*
+*   NAME	
+* 	rootn -- Return the n-th root of x. (V1.0)
+*
+*   SYNOPSIS
+*	double result = rootn(double x, long n);
+*	  D0		    D0        D0
+*	double rootn(double x, long n);
+*
+*   FUNCTION
+*	Compute x raised to the power 1/n. A first estimate from pow() is
+*	refined with one Newton step, using pown() in double-double
+*	precision to measure how far its n-th power is from x. For odd n
+*	the root of a negative x is the negative real root.
+*
+*   INPUTS
+*	x - Input value.
+*	n - Root to take. Must not be 0.
+*
+*   RESULT
+*	result - The n-th root of x. Returns NaN if n is 0 or if x is
+*	        negative and n is even, +-Infinity for a zero x and
+*	        negative n.
+*
+*   EXAMPLE
+*	double r = rootn(-27.0, 3);
+*
+*   NOTES
+*	Sets errno to EDOM for the NaN cases. C23 declares n as long long;
+*	ma.lib uses long, as for pown().
+*
+*   SEE ALSO
+*	pown(), cbrt(), sqrt(), pow(), math.h
+*
+******************************************************************************/
+
+double rootn(double x, long n)
+{
+    double ax, y, hi, lo, e, mx, ph, pl, t, d;
+    unsigned long k;
+    int ex, odd;
+
+    if (n == 0 || (x < 0.0 && (n & 1) == 0)) {
+        __ma_seterr(EDOM);
+        return __ma_zero/__ma_zero;
+    }
+    if (x != x) return x+x;		/* NaN */
+
+    odd = (int)(n & 1);
+    if (x == 0.0) {
+        if (n > 0) return odd ? x : __ma_zero;
+        return odd ? one/x : one/__ma_zero;
+    }
+    if (x-x != 0.0) return (n > 0) ? x : one/x;	/* +-inf */
+    if (n == 1) return x;
+    if (n == -1) return one/x;
+
+    k = (n < 0) ? 0UL-(unsigned long)n : (unsigned long)n;
+    ax = fabs(x);
+    y = pow(ax, one/(double)n);
+
+    /* residual d with y**|n| = x**sign(n) * (1+d), then y *= 1-d/|n| */
+    hi = __kernel_pown(y, 0.0, k, &lo, &e);
+    mx = frexp(ax, &ex);
+    if (n > 0) {
+        t = ldexp(mx, ex-(int)e);
+        d = ((hi-t)+lo)/t;
+    } else {
+        __kernel_mul12(hi, mx, &ph, &pl);
+        t = ldexp(one, -ex-(int)e);
+        d = ((ph-t)+(pl+lo*mx))/t;
+    }
+    y -= y*(d/(double)k);
+
+    return (x < 0.0) ? -y : y;
+}
@@ -66,8 +66,9 @@ double round(double x)
     if(j0<20) {
         if(j0<0) {
             if(huge+x>0.0) {        /* raise inexact if x != 0 */
-                if(j0==-1) return x>0.0?1.0:-1.0;
-                else return 0.0;
+                i0 &= 0x80000000;   /* +-0, keeping the sign */
+                if(j0==-1) i0 |= 0x3ff00000;    /* +-1 */
+                i1 = 0;
             }
         } else {
             i = (0x000fffff)>>j0;
@@ -88,21 +89,10 @@ double round(double x)
         i = ((unsigned)(0xffffffff))>>(j0-20);
         if((i1&i)==0) return x;     /* x is integral */
         if(huge+x>0.0) {            /* raise inexact flag */
-            if(i0>0) {
-                if(j0==20) i0+=1;
-                else {
-                    j = i1+(1<<(52-j0));
-                    if(j<i1) i0 +=1 ;       /* got a carry */
-                    i1=j;
-                }
-            } else {
-                if(j0==20) i0-=1;
-                else {
-                    j = i1 - (1<<(52-j0));
-                    if(j>i1) i0 -=1;        /* got a borrow */
-                    i1 = j;
-                }
-            }
+            /* add half a unit to the magnitude, then drop the fraction */
+            j = i1+(1U<<(51-j0));
+            if(j<i1) i0 +=1 ;       /* got a carry */
+            i1 = j&(~i);
         }
     }
     
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * double rsqrt(double x)
+ * Return reciprocal square root of x
+ */
+
+#include <math.h>
+#include "include/internal/m99_math.h"
+
+/* Exact product - see pown.c */
+extern void __kernel_mul12(double a, double b, double *hi, double *lo);
+
+static const double
+one     = 1.0,
+half    = 0.5,
+two900  = 8.45271249817064394164e+270,	/* 0x78300000, 0x00000000 */
+twom900 = 1.18305218616677471097e-271,	/* 0x07B00000, 0x00000000 */
+two108  = 3.24518553658426726783e+32,	/* 0x46B00000, 0x00000000 */
+twom108 = 3.08148791101957736489e-33,	/* 0x39300000, 0x00000000 */
+two54   = 1.80143985094819840000e+16,	/* 0x43500000, 0x00000000 */
+twom54  = 5.55111512312578270212e-17;	/* 0x3C900000, 0x00000000 */
+
+/****** ma.lib/rsqrt ********************************************************
+*
+*   NAME	
+* 	rsqrt -- Return reciprocal square root of x. (V1.0)
+*
+*   SYNOPSIS
+*	double result = rsqrt(double x);
+*	  D0		    D0
+*	double rsqrt(double x);
+*
+*   FUNCTION
+*	Compute 1/sqrt(x). The quotient of 1.0 and sqrt() is rounded
+*	twice, so it is corrected with one Newton step against the exact
+*	residual 1 - x*y*y, giving a nearly correctly rounded result for
+*	code that normalises vectors.
+*
+*   INPUTS
+*	x - Input value. Must be non-negative for valid result.
+*
+*   RESULT
+*	result - 1/sqrt(x). Returns +-Infinity for +-0.0, +0.0 for
+*	        +Infinity and NaN for x < 0.
+*
+*   EXAMPLE
+*	double len2 = vx*vx + vy*vy;
+*	double k = rsqrt(len2);
+*	vx *= k; vy *= k;
+*
+*   NOTES
+*	Sets errno to EDOM for negative arguments.
+*
+*   SEE ALSO
+*	sqrt(), rsqrtf(), hypot(), math.h
+*
+******************************************************************************/
+
+double rsqrt(double x)
+{
+    double y, p, pl, h, l, e, s;
+
+    if (x != x) return x+x;		/* NaN */
+    if (x == 0.0) return one/x;		/* +-inf */
+    if (x < 0.0) {
+        __ma_seterr(EDOM);
+        return __ma_zero/__ma_zero;
+    }
+    if (x-x != 0.0) return __ma_zero;	/* +inf */
+
+    /* keep x*y*y and its exact split inside the normal range */
+    s = one;
+    if (x < twom900) {
+        x *= two108; s = two54;
+    } else if (x > two900) {
+        x *= twom108; s = twom54;
+    }
+
+    y = one/sqrt(x);
+    __kernel_mul12(y, y, &p, &pl);
+    __kernel_mul12(x, p, &h, &l);
+    e = ((one-h)-l)-x*pl;
+    y += y*(half*e);
+    return y*s;
+}
@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * float rsqrtf(float x)
+ * Return reciprocal square root of x (float)
+ */
+
+#include <math.h>
+#include "include/internal/m99_math.h"
+
+/****** ma.lib/rsqrtf *******************************************************
+*
+*   NAME	
+* 	rsqrtf -- Return reciprocal square root of x (float). (V1.0)
+*
+*   SYNOPSIS
+*	float result = rsqrtf(float x);
+*	  D0		    D0
+*	float rsqrtf(float x);
+*
+*   FUNCTION
+*	Compute 1/sqrt(x) for float arguments. The result of rsqrt() is
+*	close enough to correctly rounded that the conversion to float
+*	rounds correctly as well.
+*
+*   INPUTS
+*	x - Input value. Must be non-negative for valid result.
+*
+*   RESULT
+*	result - 1/sqrt(x), as rsqrt().
+*
+*   EXAMPLE
+*	float k = rsqrtf(4.0f);
+*
+*   NOTES
+*	Sets errno to EDOM for negative arguments.
+*
+*   SEE ALSO
+*	rsqrt(), sqrt(), math.h
+*
+******************************************************************************/
+
+float rsqrtf(float x)
+{
+    return (float)rsqrt((double)x);
+}
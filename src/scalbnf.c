@@ -19,10 +19,6 @@
 #include <math.h>
 #include "include/internal/m99_math.h"
 
-/* Helper macros for accessing high/low parts of float */
-/* SAS/C uses big-endian, so high word is first */
-#define __HI(x) *(int*)&x
-
 static const float
 two25   =  3.3554432000e+07, /* 0x4c000000 */
 twom25  =  2.9802322388e-08, /* 0x33000000 */
@@ -64,7 +60,6 @@ tiny   = 1.0e-30;
 * 
 ******************************************************************************/
 
-
 float scalbnf(float x, int n)
 {
     int  k, hx;
@@ -8,6 +8,8 @@
 #include <math.h>
 #include "include/internal/m99_math.h"
 
+#undef signbit
+
 /*
  * signbit(x) - returns 1 if x is negative, 0 otherwise
  * 
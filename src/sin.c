@@ -17,11 +17,6 @@
 #include <math.h>
 #include "include/internal/m99_math.h"
 
-/* Helper macros for accessing high/low parts of double */
-/* SAS/C uses big-endian, so high word is first */
-#define __HI(x) *(int*)&x
-#define __LO(x) *(1+(int*)&x)
-
 /****** ma.lib/sin ***********************************************************
 * 
 *   NAME	
@@ -143,7 +138,10 @@ double __kernel_cos(double x, double y)
     }
 }
 
-int __ieee754_rem_pio2(double x, double *y)
+/*
+ * rem_pio2 - Reduce x modulo pi/2: x = n*pi/2 + y[0] + y[1].
+ */
+static int rem_pio2(double x, double *y)
 {
     double z, w, t, r, fn;
     double tx[3];
@@ -228,6 +226,49 @@ int __ieee754_rem_pio2(double x, double *y)
     return n;
 }
 
+/*
+ * __ieee754_rem_pio2 - rem_pio2() behind a one-entry memo, shared by
+ * sin, cos and tan.
+ *
+ * Rotation code calls sin(a), cos(a) and tan(a) back to back, and each
+ * would redo the same reduction. Arguments beyond 3*pi/4, where the
+ * reduction costs several multiplies, are memoized on their exact bit
+ * pattern in the calling task's installed ma_ctx, if it has pio2_memo
+ * set. Finding the context costs a FindTask() and a slot scan, about
+ * as much as a medium-sized reduction, so the memo is opt-in, and the
+ * lookup is skipped outright while no task has a context installed.
+ * Build with MA_NO_TRIG_MEMO defined to leave the memo out.
+ */
+int __ieee754_rem_pio2(double x, double *y)
+{
+#ifndef MA_NO_TRIG_MEMO
+    ma_ctx *ctx;
+    unsigned long hx, lx;
+    int n;
+
+    hx = (unsigned long)__HI(x);
+    lx = (unsigned long)__LO(x);
+    if ((hx&0x7fffffff) >= 0x4002d97c && __ma_ctx_installed != 0 &&
+        (ctx = __ma_ctx_own()) != (ma_ctx *)0 && ctx->pio2_memo) {
+        if (ctx->pio2_key[0] == hx && ctx->pio2_key[1] == lx) {
+            ctx->pio2_hits++;
+            y[0] = ctx->pio2_y[0];
+            y[1] = ctx->pio2_y[1];
+            return ctx->pio2_n;
+        }
+        ctx->pio2_misses++;
+        n = rem_pio2(x, y);
+        ctx->pio2_key[0] = hx;
+        ctx->pio2_key[1] = lx;
+        ctx->pio2_y[0] = y[0];
+        ctx->pio2_y[1] = y[1];
+        ctx->pio2_n = n;
+        return n;
+    }
+#endif
+    return rem_pio2(x, y);
+}
+
 /****** ma.lib/sin ******************************************************
 * 
 *   NAME	
@@ -256,7 +297,11 @@ int __ieee754_rem_pio2(double x, double *y)
 *
 *   NOTES
 *	This function is C89 compliant and provides IEEE 754 accuracy.
-*	Performance is optimized for the Amiga platform.
+*	Performance is optimized for the Amiga platform. A task with an
+*	installed ma_ctx that has pio2_memo set reduces a large argument
+*	only once when it calls sin(), cos() and tan() on it in turn; the
+*	memo's hit and miss counts are in the pio2_hits and pio2_misses
+*	fields.
 * 
 *   SEE ALSO
 *	cos(), tan(), asin(), math.h
@@ -18,11 +18,6 @@
 #include <math.h>
 #include "include/internal/m99_math.h"
 
-/* Helper macros for accessing high/low parts of double */
-/* SAS/C uses big-endian, so high word is first */
-#define __HI(x) *(int*)&x
-#define __LO(x) *(1+(int*)&x)
-
 static const double one = 1.0, shuge = 1.0e307;
 
 static double __ieee754_sinh(double x)
@@ -104,4 +99,3 @@ double sinh(double x)
     return __ieee754_sinh(x);
 }
 
-
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * double sinpi(double x)
+ * Return sin(pi*x)
+ *
+ * Method :
+ *	Because the period of sinpi is 2, the argument reduction is exact
+ *	and needs no multi-word value of pi: the multiples of 2 in x are
+ *	cleared from its mantissa, and x = k/2 + r with |r| <= 1/4 then
+ *	follows by a subtraction that is exact as well. Only pi*r is
+ *	rounded, formed as a double-double for __kernel_sin/__kernel_cos.
+ */
+
+#include <math.h>
+#include <errno.h>
+#include "include/internal/m99_math.h"
+
+/* Shared kernels - see sin.c and pown.c */
+extern double __kernel_sin(double x, double y, int iy);
+extern double __kernel_cos(double x, double y);
+extern void __kernel_mul12(double a, double b, double *hi, double *lo);
+
+static const double
+zero  =  0.00000000000000000000e+00,
+pi    =  3.14159265358979311600e+00, /* 0x400921FB, 0x54442D18 */
+pi_lo =  1.22464679914735320717e-16; /* 0x3CA1A626, 0x33145C07 */
+
+/*
+ * __kernel_rempi - Reduce a finite x to x = k/2 + r, |r| <= 1/4.
+ * Stores r, which is exact, in *r and pi*r as a double-double in
+ * y[0] + y[1], and returns k mod 4. For an integer or half-integer x,
+ * *r is a zero with the sign of x.
+ */
+int __kernel_rempi(double x, double *r, double *y)
+{
+    double ax, t, h, l;
+    int hx, ix, j, k;
+
+    hx = __HI(x);
+    ix = hx&0x7fffffff;
+    ax = fabs(x);
+    if(ix >= 0x43300000) {		/* |x| >= 2**52, an integer */
+        k = (ix < 0x43400000) ? (__LO(x)&1)<<1 : 0;
+        *r = zero;
+    } else {
+        if(ix >= 0x40000000) {		/* |x| >= 2: clear the bits >= 2 */
+            t = ax;
+            j = 0x434-(ix>>20);		/* bits worth less than 2 */
+            if(j >= 32) {
+                __HI(t) &= ~((1<<(j-32))-1);
+                __LO(t) = 0;
+            } else {
+                __LO(t) &= (int)~((1UL<<j)-1);
+            }
+            ax -= t;			/* exact, in [0,2) */
+        }
+        k = (int)(ax*2.0+0.5);
+        *r = ax-0.5*(double)k;		/* exact */
+    }
+    if(hx < 0) {
+        *r = -*r;
+        k = -k;
+    }
+
+    __kernel_mul12(*r, pi, &h, &l);
+    l += *r*pi_lo;
+    y[0] = h+l;
+    y[1] = l-(y[0]-h);
+    return k&3;
+}
+
+/****** ma.lib/sinpi ********************************************************
+*
+*   NAME	
+* 	sinpi -- Return sin(pi*x). (V1.0)
+*
+*   SYNOPSIS
+*	double result = sinpi(double x);
+*	  D0		    D0
+*	double sinpi(double x);
+*
+*   FUNCTION
+*	Compute the sine of pi times x. The argument is reduced modulo 2
+*	exactly, so the result stays accurate for any x, including
+*	those where pi*x itself could not be represented.
+*
+*   INPUTS
+*	x - Input value, in half-turns.
+*
+*   RESULT
+*	result - sin(pi*x). Exactly zero, with the sign of x, for any
+*	        integer x and exactly +-1 for any half-integer x. Returns
+*	        NaN for an infinite or NaN x.
+*
+*   EXAMPLE
+*	double s = sinpi(0.5);
+*
+*   NOTES
+*	C23. Cheaper than sin(M_PI*x) for large x, since no reduction by
+*	a multi-word pi is needed, and more accurate for all x, since
+*	M_PI*x is not rounded. Sets errno to EDOM for infinite x.
+*
+*   SEE ALSO
+*	cospi(), tanpi(), asinpi(), sin(), ma_sind(), math.h
+*
+******************************************************************************/
+
+double sinpi(double x)
+{
+    double r, y[2];
+    int n;
+
+    /* sinpi(Inf or NaN) is NaN */
+    if((__HI(x)&0x7fffffff) >= 0x7ff00000) {
+        if(x == x) __ma_seterr(EDOM);
+        return x-x;
+    }
+
+    n = __kernel_rempi(x, &r, y);
+    if(r == zero && (n&1) == 0) return x*zero;	/* integer */
+    switch(n) {
+        case 0: return  __kernel_sin(y[0],y[1],1);
+        case 1: return  __kernel_cos(y[0],y[1]);
+        case 2: return -__kernel_sin(y[0],y[1],1);
+        default:
+                return -__kernel_cos(y[0],y[1]);
+    }
+}
@@ -2,7 +2,7 @@
  * Copyright (c) 2025 amigazen project
  * SPDX-License-Identifier: BSD-2-Clause
  * 
- * Based on fdlibm/e_sqrt.c and w_sqrt.c
+ * Based on fdlibm/e_sqrt.c and w_sqrt.c (root extraction rewritten)
  * Copyright (C) 1993 by Sun Microsystems, Inc. All rights reserved.
  * 
  * Developed at SunSoft, a Sun Microsystems, Inc. business.
@@ -17,20 +17,66 @@
 #include <math.h>
 #include <errno.h>
 #include "include/internal/m99_math.h"
+#include "include/internal/bits.h"
+#include "include/internal/fpu.h"
 
-/* Helper macros for accessing high/low parts of double */
-/* SAS/C uses big-endian, so high word is first */
-#define __HI(x) *(int*)&x
-#define __LO(x) *(1+(int*)&x)
+#ifndef MA_FPU     /* the FPU builds use FSQRT */
 
-static const double one = 1.0, tiny = 1.0e-300;
+/*
+ * 1/sqrt(m) for m in [1,4) in steps of 1/32, as 16-bit fractions.
+ * Entry i covers [1+i/32, 1+(i+1)/32); the value is chosen to halve
+ * the worst relative error over the interval.
+ */
+static const unsigned short rsqrt_tab[96] = {
+    65032, 64054, 63119, 62223, 61365, 60541, 59749, 58988,
+    58255, 57549, 56868, 56211, 55575, 54961, 54367, 53792,
+    53234, 52694, 52169, 51660, 51166, 50685, 50218, 49764,
+    49321, 48891, 48471, 48062, 47663, 47274, 46894, 46523,
+    46161, 45808, 45462, 45124, 44793, 44470, 44153, 43843,
+    43540, 43243, 42952, 42666, 42386, 42112, 41843, 41579,
+    41320, 41066, 40816, 40571, 40330, 40093, 39861, 39633,
+    39408, 39187, 38970, 38757, 38547, 38340, 38136, 37936,
+    37739, 37545, 37354, 37166, 36981, 36798, 36618, 36441,
+    36266, 36094, 35924, 35756, 35591, 35428, 35268, 35109,
+    34953, 34798, 34646, 34496, 34347, 34201, 34056, 33913,
+    33772, 33633, 33496, 33360, 33225, 33093, 32962, 32832
+};
+
+/* 16x16->32 multiply, which the 68000 has as a single MULU */
+#define MULU(a,b) ((unsigned)(unsigned short)(a)*(unsigned short)(b))
+
+/*
+ * umul32 - Full 32x32->64 bit product from four 16-bit multiplies.
+ */
+static void umul32(unsigned a, unsigned b, unsigned *hi, unsigned *lo)
+{
+    unsigned p00, p01, p10, mid;
+
+    p00 = MULU(a, b);
+    p01 = MULU(a, b>>16);
+    p10 = MULU(a>>16, b);
+    mid = (p00>>16) + (p01&0xffff) + (p10&0xffff);
+    *lo = (mid<<16) | (p00&0xffff);
+    *hi = MULU(a>>16, b>>16) + (p01>>16) + (p10>>16) + (mid>>16);
+}
+
+/*
+ * mulhi - High 32 bits of a 32x32 bit product.
+ */
+static unsigned mulhi(unsigned a, unsigned b)
+{
+    unsigned hi, lo;
+
+    umul32(a, b, &hi, &lo);
+    return hi;
+}
 
 static double __ieee754_sqrt(double x)
 {
     double z;
     int sign = (int)0x80000000; 
-    unsigned r, t1, s1, ix1, q1;
-    int ix0, s0, q, m, t, i;
+    unsigned ix1, m32, r, s, t, dh, dl, qh, ql, th, tl, c;
+    int ix0, m, i, neg;
 
     ix0 = __HI(x);			/* high word of x */
     ix1 = __LO(x);		/* low word of x */
@@ -49,14 +95,15 @@ static double __ieee754_sqrt(double x)
     /* normalize x */
     m = (ix0>>20);
     if(m==0) {				/* subnormal x */
-        while(ix0==0) {
-            m -= 21;
-            ix0 |= (ix1>>11); ix1 <<= 21;
-        }
-        for(i=0;(ix0&0x00100000)==0;i++) ix0<<=1;
+        i = (ix0!=0) ? __ma_clz32(ix0)-11 : 21+__ma_clz32(ix1);
         m -= i-1;
-        ix0 |= (ix1>>(32-i));
-        ix1 <<= i;
+        if(i<32) {
+            ix0 = (ix0<<i)|(ix1>>(32-i));
+            ix1 <<= i;
+        } else {
+            ix0 = ix1<<(i-32);
+            ix1 = 0;
+        }
     }
     m -= 1023;	/* unbias exponent */
     ix0 = (ix0&0x000fffff)|0x00100000;
@@ -66,63 +113,90 @@ static double __ieee754_sqrt(double x)
     }
     m >>= 1;	/* m = [m/2] */
 
-    /* generate sqrt(x) bit by bit */
-    ix0 += ix0 + ((ix1&sign)>>31);
-    ix1 += ix1;
-    q = q1 = s0 = s1 = 0;	/* [q,q1] = sqrt(x) */
-    r = 0x00200000;		/* r = moving bit from right to left */
-
-    while(r!=0) {
-        t = s0+r; 
-        if(t<=ix0) { 
-            s0   = t+r; 
-            ix0 -= t; 
-            q   += r; 
-        } 
-        ix0 += ix0 + ((ix1&sign)>>31);
-        ix1 += ix1;
-        r>>=1;
+    /*
+     * Now x = M * 2**(2m-52) with M = [ix0,ix1] in [2**52,2**54), and
+     * Q = floor(sqrt(M * 2**54)) is the 54-bit root with one guard bit.
+     * Seed 1/sqrt from the table, refine it with one Newton step in
+     * 16-bit and one in 32-bit fixed point, take one Newton step for
+     * the root itself and then correct the last few units exactly.
+     */
+    m32 = ((unsigned)ix0<<10) | (ix1>>22);	/* M/2**22, in [2**30,2**32) */
+    r = rsqrt_tab[(m32>>25)-32];		/* 1/sqrt(m), Q16 */
+    t = MULU(m32>>16, MULU(r, r)>>16) >> 16;	/* m*r*r, Q14 */
+    r = MULU(r, 0xc000-t);			/* r*(3-m*r*r)/2, Q31 */
+    t = mulhi(m32, mulhi(r, r));		/* m*r*r, Q28 */
+    r = mulhi(r, 0x30000000-t) << 3;		/* r*(3-m*r*r)/2, Q31 */
+    s = mulhi(m32, r);				/* sqrt(m), Q29 */
+
+    /* d = M*64 - s*s, the residual of s; it is small */
+    umul32(s, s, &th, &tl);
+    dl = ix1<<6;
+    dh = ((unsigned)ix0<<6) | (ix1>>26);
+    dh = dh - th - (dl < tl);
+    dl = dl - tl;
+    neg = (dh & 0x80000000) != 0;
+    if (neg) {
+        dl = 0-dl;
+        dh = ~dh + (dl == 0);
     }
 
-    r = sign;
-    while(r!=0) {
-        t1 = s1+r; 
-        t  = s0;
-        if((t<ix0)||((t==ix0)&&(t1<=ix1))) { 
-            s1  = t1+r;
-            if(((t1&sign)==sign)&&(s1&sign)==0) s0 += 1;
-            ix0 -= t;
-            if (ix1 < t1) ix0 -= 1;
-            ix1 -= t1;
-            q1  += r;
-        }
-        ix0 += ix0 + ((ix1&sign)>>31);
-        ix1 += ix1;
-        r>>=1;
+    /* Q ~ s*2**24 + d*r/2**6 */
+    c = mulhi((dh<<28) | (dl>>4), r) >> 1;
+    qh = s>>8;
+    ql = s<<24;
+    if (neg) {
+        qh -= (ql < c);
+        ql -= c;
+    } else {
+        ql += c;
+        qh += (ql < c);
     }
 
-    /* use floating add to find out rounding direction */
-    if((ix0|ix1)!=0) {
-        z = one-tiny; /* trigger inexact flag */
-        if (z>=one) {
-            z = one+tiny;
-            if (q1==(unsigned)0xffffffff) { q1=0; q += 1;}
-        else if (z>one) {
-            if (q1==(unsigned)0xfffffffe) q+=1;
-            q1+=2; 
-        } else
-                q1 += (q1&1);
-        }
+    /* remainder R = M*2**54 - Q*Q, exact modulo 2**64 */
+    umul32(ql, ql, &th, &tl);
+    th += (qh*ql)<<1;
+    dh = ((ix1&0x3ff)<<22) - th - (tl != 0);
+    dl = 0-tl;
+
+    /* step Q until 0 <= R < 2Q+1 */
+    while (dh & 0x80000000) {
+        qh -= (ql == 0);
+        ql -= 1;
+        th = (qh<<1) | (ql>>31);		/* R += 2Q+1 */
+        tl = (ql<<1) | 1;
+        dl += tl;
+        dh += th + (dl < tl);
     }
-    ix0 = (q>>1)+0x3fe00000;
-    ix1 =  q1>>1;
-    if ((q&1)==1) ix1 |= sign;
+    for (;;) {
+        th = (qh<<1) | (ql>>31);
+        tl = (ql<<1) | 1;
+        if (dh < th || (dh == th && dl < tl)) break;
+        dh = dh - th - (dl < tl);		/* R -= 2Q+1 */
+        dl -= tl;
+        ql += 1;
+        qh += (ql == 0);
+    }
+
+    /*
+     * Round to nearest on the guard bit. A tie would need an exact
+     * 54-bit root, which a 53-bit x cannot have, so the remainder can
+     * be ignored.
+     */
+    c = ql&1;
+    ql = (ql>>1) | (qh<<31);
+    qh >>= 1;
+    ql += c;
+    qh += (ql < c);
+    ix0 = (int)qh+0x3fe00000;
+    ix1 = ql;
     ix0 += (m <<20);
     __HI(z) = ix0;
     __LO(z) = ix1;
     return z;
 }
 
+#endif /* !MA_FPU */
+
 /****** ma.lib/sqrt *****************************************************
 * 
 *   NAME	
@@ -136,7 +210,11 @@ static double __ieee754_sqrt(double x)
 *   FUNCTION
 *	Compute the square root of x. For x >= 0, returns the non-negative
 *	square root. For x < 0, returns NaN and sets errno to EDOM.
-*	This implementation uses high-precision algorithms from fdlibm.
+*	The root is found with integer arithmetic on 32-bit words: a
+*	table-seeded Newton iteration gives the root to within a few
+*	units, which are then corrected exactly. All multiplies are
+*	16x16 bit, so no FPU or 32-bit multiply instruction is needed.
+*	ma881.lib and ma040.lib use the FSQRT instruction instead.
 * 
 *   INPUTS
 *	x - Input value. Must be non-negative for valid result.
@@ -154,17 +232,21 @@ static double __ieee754_sqrt(double x)
 *	Sets errno to EDOM for negative arguments.
 * 
 *   SEE ALSO
-*	cbrt(), pow(), hypot(), math.h
+*	rsqrt(), cbrt(), pow(), hypot(), math.h
 * 
 ******************************************************************************/
 
 double sqrt(double x)
 {
+#ifdef MA_FPU
+    double result = __ma_fpu_sqrt(x);
+#else
     double result = __ieee754_sqrt(x);
+#endif
     
     /* Set errno for domain error (negative argument) */
     if (x < 0.0) {
-        errno = EDOM;
+        __ma_seterr(EDOM);
     }
     
     return result;
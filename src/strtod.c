@@ -0,0 +1,525 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * double ma_strtod(const char *s, char **endptr)
+ * Convert a decimal or hexadecimal string to the nearest double
+ *
+ * Method :
+ *	Decimal: the first 19 significant digits w and the power of ten q
+ *	give w*10**q, which is multiplied by the 128-bit significand of
+ *	10**q (Eisel-Lemire; Lemire, "Number Parsing at a Gigabyte per
+ *	Second", 2021). Mushtak and Lemire (2023) show that the 128 bits
+ *	always suffice to round w*10**q correctly, so the result is exact
+ *	whenever the number has at most 19 digits. With more, w and w+1
+ *	bracket the value; if they round differently, the digits are
+ *	compared exactly with the halfway point between the two
+ *	candidates, as big integers.
+ *
+ *	Hexadecimal: up to 64 significant bits are kept, with a sticky bit
+ *	for the rest, and rounded once to the precision of the result.
+ *
+ *	Only integer arithmetic is used, so the result does not depend on
+ *	the FPU's precision or rounding mode.
+ */
+
+#include <stddef.h>
+#include <math.h>
+#include <errno.h>
+#include <ctype.h>
+#include <amiga/conv.h>
+#include "include/internal/m99_math.h"
+#include "include/internal/conv.h"
+
+/* Significant digits the exact comparison looks at; more cannot matter */
+#define MAX_DIGITS 769
+
+static const double zero = 0.0;
+
+/* Shift m left until its top bit is set; return the shift */
+static int norm64(unsigned_long_long_t *m)
+{
+    int lz;
+
+    lz = 0;
+    if (m->hi == 0) {
+        m->hi = m->lo;
+        m->lo = 0;
+        lz = 32;
+    }
+    while ((m->hi & 0x80000000UL) == 0) {
+        m->hi = (m->hi << 1) | (m->lo >> 31);
+        m->lo <<= 1;
+        lz++;
+    }
+    return lz;
+}
+
+/* m >> s for 0 < s < 64 */
+static void shr64(unsigned_long_long_t *m, int s)
+{
+    if (s >= 32) {
+        m->lo = m->hi >> (s-32);
+        m->hi = 0;
+    } else {
+        m->lo = (m->lo >> s) | (m->hi << (32-s));
+        m->hi >>= s;
+    }
+}
+
+/* m = m*10 + d */
+static void mul10add(unsigned_long_long_t *m, int d)
+{
+    unsigned long hi, lo, t;
+
+    hi = (m->hi << 3)+(m->hi << 1)+(m->lo >> 29)+(m->lo >> 31);
+    lo = m->lo << 3;
+    t = lo+(m->lo << 1);
+    hi += (t < lo);
+    lo = t+(unsigned long)d;
+    hi += (lo < t);
+    m->hi = hi;
+    m->lo = lo;
+}
+
+/* Add 1 to m */
+static void inc64(unsigned_long_long_t *m)
+{
+    if (++m->lo == 0) m->hi++;
+}
+
+/*
+ * eisel_lemire - Round w*10**q, w != 0, to the bits of a positive
+ * double, as a 64-bit integer in r. The result may be Infinity.
+ */
+static void eisel_lemire(unsigned_long_long_t w, int q, unsigned_long_long_t *r)
+{
+    unsigned_long_long_t t, hi, lo, hi2, lo2, m;
+    const unsigned long *p;
+    int lz, upper, shift, e;
+
+    if (q < MA_POW10_MIN) {			/* below half of 2**-1074 */
+        r->hi = r->lo = 0;
+        return;
+    }
+    if (q > 308) {				/* above DBL_MAX */
+        r->hi = 0x7ff00000UL;
+        r->lo = 0;
+        return;
+    }
+    lz = norm64(&w);
+
+    /* the top bits of w*10**q, refined with the low half if need be */
+    p = __ma_pow10_tab[q-MA_POW10_MIN];
+    t.hi = p[0];
+    t.lo = p[1];
+    __ma_umul64(&w, &t, &hi, &lo);
+    if ((hi.lo & 0x1ff) == 0x1ff) {
+        t.hi = p[2];
+        t.lo = p[3];
+        __ma_umul64(&w, &t, &hi2, &lo2);
+        lo.lo += hi2.lo;
+        lo.hi += hi2.hi+(lo.lo < hi2.lo);
+        if (lo.hi < hi2.hi || (lo.hi == hi2.hi && lo.lo < hi2.lo))
+            inc64(&hi);
+    }
+
+    /* 54 or 55 bits of hi: the mantissa and a rounding bit */
+    upper = (int)(hi.hi >> 31);
+    shift = upper+9;
+    m = hi;
+    shr64(&m, shift);
+    e = (int)(__ma_pow10_exp(q)+63)+upper-lz+1023;
+
+    if (e <= 0) {				/* subnormal */
+        if (1-e >= 64) {
+            r->hi = r->lo = 0;
+            return;
+        }
+        shr64(&m, 1-e);
+        if (m.lo & 1) inc64(&m);
+        shr64(&m, 1);
+        /* a carry into bit 52 makes the smallest normal, as it should */
+        *r = m;
+        return;
+    }
+
+    /* exactly halfway, which happens only for small q: round to even */
+    if ((lo.hi == 0 && lo.lo <= 1) && q >= -4 && q <= 23 &&
+        (m.lo & 3) == 1) {
+        t = m;
+        if (shift >= 32) {
+            t.hi = t.lo << (shift-32);
+            t.lo = 0;
+        } else {
+            t.hi = (t.hi << shift) | (t.lo >> (32-shift));
+            t.lo <<= shift;
+        }
+        if (t.hi == hi.hi && t.lo == hi.lo) m.lo &= ~1UL;
+    }
+    if (m.lo & 1) inc64(&m);
+    shr64(&m, 1);
+    if (m.hi >= 0x00200000UL) {		/* rounded up to 2**53 */
+        m.hi = 0x00100000UL;
+        e++;
+    }
+    if (e >= 0x7ff) {
+        r->hi = 0x7ff00000UL;
+        r->lo = 0;
+        return;
+    }
+    r->hi = ((unsigned long)e << 20) | (m.hi & 0x000fffffUL);
+    r->lo = m.lo;
+}
+
+/*
+ * slow_round - Decide between the bits in r and the next double up by
+ * comparing the digits from s, which give a value of digits*10**dq,
+ * with the point halfway between the two.
+ */
+static void slow_round(const char *s, int dq, unsigned_long_long_t *r)
+{
+    ma_big_t a, b;
+    unsigned long chunk, mh, ml;
+    int e, k, nd, sticky, point, cmp, pa, pb;
+
+    /* the digits, up to MAX_DIGITS of them, with a sticky remainder */
+    a.n = 0;
+    chunk = 0;
+    k = nd = sticky = point = 0;
+    for (;; s++) {
+        if (*s == '.' && !point) {
+            point = 1;
+            continue;
+        }
+        if (!isdigit((unsigned char)*s)) break;
+        if (nd == MAX_DIGITS) {
+            if (*s != '0') sticky = 1;
+            dq++;
+            continue;
+        }
+        chunk = chunk*10+(*s-'0');
+        nd++;
+        if (++k == 9) {
+            __ma_big_muladd(&a, 1000000000UL, chunk);
+            chunk = k = 0;
+        }
+    }
+    if (k > 0) {
+        static const unsigned long pow10[9] = {
+            1UL, 10UL, 100UL, 1000UL, 10000UL, 100000UL, 1000000UL,
+            10000000UL, 100000000UL
+        };
+        __ma_big_muladd(&a, pow10[k], chunk);
+    }
+
+    /* the halfway point (2m+1)*2**(e-1) */
+    e = (int)(r->hi >> 20);
+    mh = r->hi & 0x000fffffUL;
+    ml = r->lo;
+    if (e == 0) {
+        e = 1;
+    } else {
+        mh |= 0x00100000UL;
+    }
+    e -= 1075;
+    mh = (mh << 1) | (ml >> 31);
+    ml = (ml << 1) | 1;
+    __ma_big_set(&b, mh, ml);
+
+    /* compare a*10**dq with b*2**(e-1), scaling both to integers */
+    pa = dq;
+    pb = e-1;
+    if (dq >= 0) {
+        __ma_big_mulpow5(&a, dq);
+    } else {
+        __ma_big_mulpow5(&b, -dq);
+    }
+    if (pa > pb) {
+        __ma_big_shl(&a, pa-pb);
+    } else {
+        __ma_big_shl(&b, pb-pa);
+    }
+    cmp = __ma_big_cmp(&a, &b);
+    if (cmp == 0) cmp = (sticky) ? 1 : (int)(r->lo & 1);
+    if (cmp > 0) inc64(r);
+}
+
+/*
+ * parse_hex - Convert the hexadecimal digits at s, after the 0x, to
+ * the bits of a positive double in r. Returns the end of the number.
+ */
+static const char *parse_hex(const char *s, unsigned_long_long_t *r)
+{
+    unsigned_long_long_t m;
+    long e2, x;
+    int d, nd, sticky, point, esign, be, shift;
+    unsigned long round, rest;
+
+    m.hi = m.lo = 0;
+    e2 = 0;
+    nd = sticky = point = 0;
+    for (;; s++) {
+        if (*s == '.' && !point) {
+            point = 1;
+            continue;
+        }
+        if (!isxdigit((unsigned char)*s)) break;
+        d = isdigit((unsigned char)*s) ? *s-'0' : (tolower((unsigned char)*s)-'a'+10);
+        if (nd == 0 && d == 0) {
+            if (point) e2 -= 4;			/* leading zero */
+            continue;
+        }
+        if (nd < 16) {
+            m.hi = (m.hi << 4) | (m.lo >> 28);
+            m.lo = (m.lo << 4) | d;
+            nd++;
+            if (point) e2 -= 4;
+        } else {
+            if (d) sticky = 1;
+            if (!point) e2 += 4;
+        }
+    }
+
+    /* the binary exponent, which needs at least one digit */
+    if (*s == 'p' || *s == 'P') {
+        const char *t = s+1;
+
+        esign = 1;
+        if (*t == '+' || *t == '-') {
+            if (*t == '-') esign = -1;
+            t++;
+        }
+        if (isdigit((unsigned char)*t)) {
+            x = 0;
+            while (isdigit((unsigned char)*t)) {
+                if (x < 100000L) x = x*10+(*t-'0');
+                t++;
+            }
+            e2 += esign*x;
+            s = t;
+        }
+    }
+
+    if ((m.hi|m.lo) == 0) {
+        r->hi = r->lo = 0;
+        return s;
+    }
+
+    /* round m*2**e2 to 53 bits, or fewer for a subnormal */
+    e2 -= norm64(&m);
+    e2 += 63;					/* exponent of the top bit */
+    if (e2 > 1023) {
+        r->hi = 0x7ff00000UL;
+        r->lo = 0;
+        return s;
+    }
+    if (e2 >= -1022) {
+        be = (int)e2+1023;
+        shift = 11;
+    } else {
+        be = 1;
+        shift = (e2 < -1022-60) ? 71 : (int)(11-1022-e2);
+    }
+    if (shift > 64) {				/* below half of 2**-1074 */
+        r->hi = r->lo = 0;
+        return s;
+    }
+    if (shift == 64) {
+        round = m.hi >> 31;
+        rest = (m.hi << 1) | m.lo | sticky;
+        m.hi = m.lo = 0;
+    } else {
+        if (shift > 32) {
+            round = (m.hi >> (shift-33)) & 1;
+            rest = (m.hi & ((1UL << (shift-33))-1)) | m.lo | sticky;
+        } else {
+            round = (m.lo >> (shift-1)) & 1;
+            rest = (m.lo & ((1UL << (shift-1))-1)) | sticky;
+        }
+        shr64(&m, shift);
+    }
+    if (round && (rest || (m.lo & 1))) inc64(&m);
+
+    /* the exponent field is added, so that carries move into it */
+    m.hi += (unsigned long)(be-1) << 20;
+    if (m.hi >= 0x7ff00000UL) {
+        m.hi = 0x7ff00000UL;
+        m.lo = 0;
+    }
+    *r = m;
+    return s;
+}
+
+/* Match the word w, in lower case, at s regardless of case */
+static int match(const char *s, const char *w)
+{
+    for (; *w; s++, w++) {
+        if (tolower((unsigned char)*s) != *w) return 0;
+    }
+    return 1;
+}
+
+/****** ma.lib/ma_strtod *****************************************************
+*
+*   NAME	
+* 	ma_strtod -- Convert a string to the nearest double. (V1.0)
+*
+*   SYNOPSIS
+*	double result = ma_strtod(const char *s, char **endptr);
+*	  D0		              A0            A1
+*	double ma_strtod(const char *s, char **endptr);
+*
+*   FUNCTION
+*	Convert the initial part of s to a double, as strtod() does, but
+*	correctly rounded for every input. Leading white space is
+*	skipped, then an optional sign and one of:
+*	    decimal digits with an optional point, and an optional
+*	    exponent of 'e' or 'E', an optional sign and digits;
+*	    "0x" or "0X", hexadecimal digits with an optional point, and
+*	    an optional binary exponent of 'p' or 'P', a sign and digits;
+*	    "inf" or "infinity", in any case;
+*	    "nan", in any case, optionally followed by "(chars)".
+*
+*   INPUTS
+*	s      - String to convert.
+*	endptr - If not NULL, set to the first character after the
+*	         number, or to s if no number was found.
+*
+*   RESULT
+*	result - The double nearest to the number, ties to even. +0 if
+*	        no number was found. +-HUGE_VAL if the number is too big
+*	        and +-0 if it is too small to represent.
+*
+*   EXAMPLE
+*	char *end;
+*	double v = ma_strtod("0.1e-2", &end);
+*
+*   NOTES
+*	ma.lib extension. Only integer arithmetic is used, so the result
+*	does not depend on the FPU. Numbers of up to 19 digits take a
+*	single 64 by 128-bit product; longer ones rarely need more. Sets
+*	errno to ERANGE when the result overflows or underflows to zero.
+*
+*   SEE ALSO
+*	ma_dtoa(), strtod(), amiga/conv.h
+*
+******************************************************************************/
+
+double ma_strtod(const char *s, char **endptr)
+{
+    unsigned_long_long_t w, r, r1;
+    const char *p, *digits;
+    long x, dq;
+    int neg, nd, nt, esign, any, trunc, point;
+    double v;
+
+    p = s;
+    while (isspace((unsigned char)*p)) p++;
+    neg = 0;
+    if (*p == '+' || *p == '-') {
+        neg = (*p == '-');
+        p++;
+    }
+
+    if (match(p, "inf")) {
+        p += match(p, "infinity") ? 8 : 3;
+        r.hi = 0x7ff00000UL;
+        r.lo = 0;
+        goto done;
+    }
+    if (match(p, "nan")) {
+        p += 3;
+        if (*p == '(') {
+            const char *t = p+1;
+
+            while (isalnum((unsigned char)*t) || *t == '_') t++;
+            if (*t == ')') p = t+1;
+        }
+        r.hi = 0x7ff80000UL;
+        r.lo = 0;
+        goto done;
+    }
+    if (*p == '0' && (p[1] == 'x' || p[1] == 'X') &&
+        (isxdigit((unsigned char)p[2]) ||
+         (p[2] == '.' && isxdigit((unsigned char)p[3])))) {
+        p = parse_hex(p+2, &r);
+        goto range;
+    }
+
+    /* the first 19 significant digits in w, w*10**dq the value */
+    w.hi = w.lo = 0;
+    dq = 0;
+    nd = nt = any = trunc = point = 0;
+    digits = NULL;
+    for (;; p++) {
+        if (*p == '.' && !point) {
+            point = 1;
+            continue;
+        }
+        if (!isdigit((unsigned char)*p)) break;
+        any = 1;
+        if (nt == 0) {
+            if (*p == '0') {			/* leading zero */
+                if (point) dq--;
+                continue;
+            }
+            digits = p;
+        }
+        nt++;
+        if (nd < 19) {
+            mul10add(&w, *p-'0');
+            nd++;
+            if (point) dq--;
+        } else {
+            if (*p != '0') trunc = 1;
+            if (!point) dq++;
+        }
+    }
+    if (!any) {
+        if (endptr) *endptr = (char *)s;
+        return zero;
+    }
+    if (*p == 'e' || *p == 'E') {
+        const char *t = p+1;
+
+        esign = 1;
+        if (*t == '+' || *t == '-') {
+            if (*t == '-') esign = -1;
+            t++;
+        }
+        if (isdigit((unsigned char)*t)) {
+            x = 0;
+            while (isdigit((unsigned char)*t)) {
+                if (x < 100000L) x = x*10+(*t-'0');
+                t++;
+            }
+            dq += esign*x;
+            p = t;
+        }
+    }
+
+    if ((w.hi|w.lo) == 0) {
+        r.hi = r.lo = 0;
+        goto done;				/* an exact zero */
+    }
+    if (dq < -100000L) dq = -100000L;
+    if (dq > 100000L) dq = 100000L;
+    eisel_lemire(w, (int)dq, &r);
+    if (trunc && r.hi < 0x7ff00000UL) {
+        inc64(&w);
+        eisel_lemire(w, (int)dq, &r1);
+        if (r1.hi != r.hi || r1.lo != r.lo)
+            slow_round(digits, (int)(dq-(nt-nd)), &r);
+    }
+
+range:
+    if (r.hi >= 0x7ff00000UL) __ma_seterr(ERANGE);
+    else if ((r.hi|r.lo) == 0) __ma_setrange(0.0);
+
+done:
+    if (endptr) *endptr = (char *)p;
+    __HI(v) = (int)r.hi;
+    __LO(v) = (int)r.lo;
+    return (neg) ? -v : v;
+}
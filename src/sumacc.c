@@ -0,0 +1,238 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * sumacc - Exact, mergeable summation accumulator
+ *
+ * Every double is an integer multiple of 2**-1074 below 2**1024, so a
+ * fixed-point number of 2098 bits, plus headroom, holds any sum of
+ * doubles exactly. It is kept as 24-bit digits in 32-bit longs: a
+ * double's 53-bit mantissa lands in at most four digits, and the
+ * seven spare bits of each long let carries wait for CARRY_EVERY
+ * additions. Only integer operations are used until the final
+ * rounding, which suits machines without an FPU.
+ */
+
+#include <math.h>
+#include <amiga/sum.h>
+#include "include/internal/m99_math.h"
+
+#define DIGIT        0xffffffL
+#define RADIX        0x1000000L
+#define CARRY_EVERY  120
+
+/* Propagate the carries, leaving every digit but the top in [0,RADIX) */
+static void carry(ma_sumacc *acc)
+{
+    long d, c;
+    int i;
+
+    c = 0;
+    for (i = 0; i < MA_SUMACC_LIMBS-1; i++) {
+        d = acc->limb[i]+c;
+        acc->limb[i] = d & DIGIT;
+        c = (d-(d & DIGIT))/RADIX;		/* exact */
+    }
+    acc->limb[i] += c;
+    acc->pending = 0;
+}
+
+static void negate(ma_sumacc *acc)
+{
+    int i;
+
+    for (i = 0; i < MA_SUMACC_LIMBS; i++) acc->limb[i] = -acc->limb[i];
+    carry(acc);
+}
+
+/* w <= 24 bits of a carried accumulator, from bit pos up */
+static unsigned long getbits(const ma_sumacc *acc, int pos, int w)
+{
+    unsigned long v;
+    int i, s;
+
+    i = pos/24;
+    s = pos%24;
+    v = (unsigned long)acc->limb[i] >> s;
+    if (s+w > 24) v |= (unsigned long)acc->limb[i+1] << (24-s);
+    return v & ((1UL << w)-1);
+}
+
+/****** ma.lib/ma_sumacc_init ************************************************
+*
+*   NAME	
+* 	ma_sumacc_init -- Exact, mergeable summation. (V1.0)
+*
+*   SYNOPSIS
+*	ma_sumacc_init(ma_sumacc *acc);
+*	                A0
+*	void ma_sumacc_init(ma_sumacc *acc);
+*	void ma_sumacc_add(ma_sumacc *acc, double x);
+*	void ma_sumacc_addv(ma_sumacc *acc, const double *x, unsigned long n);
+*	void ma_sumacc_merge(ma_sumacc *acc, const ma_sumacc *other);
+*	double ma_sumacc_result(ma_sumacc *acc);
+*
+*   FUNCTION
+*	A ma_sumacc adds doubles without any rounding. ma_sumacc_init()
+*	empties it, ma_sumacc_add() adds one value, ma_sumacc_addv()
+*	adds n values, and ma_sumacc_merge() adds the sum held in
+*	another accumulator. ma_sumacc_result() returns the sum so far,
+*	correctly rounded to nearest even; the accumulator can go on
+*	being used afterwards.
+*
+*	Because nothing is rounded until the end, the result is the same
+*	for any order of the terms. A job split between tasks, each with
+*	its own accumulator, gives a bit-identical answer whatever the
+*	number of tasks once their accumulators are merged.
+*
+*   INPUTS
+*	acc   - Accumulator.
+*	x     - Value, or array of n values, to add.
+*	n     - Number of values.
+*	other - Accumulator whose sum is added to acc; it is unchanged.
+*
+*   RESULT
+*	ma_sumacc_result() returns the correctly rounded sum: +-Infinity
+*	if it overflows, and the sum of any infinities or NaNs that were
+*	added if there were some (NaN if they included both signs).
+*
+*   EXAMPLE
+*	ma_sumacc acc;
+*	ma_sumacc_init(&acc);
+*	ma_sumacc_addv(&acc, samples, count);
+*	total = ma_sumacc_result(&acc);
+*
+*   NOTES
+*	An accumulator takes about 370 bytes. Additions use integer
+*	operations only. Sets errno to ERANGE if the result overflows.
+*
+*   SEE ALSO
+*	ma_fsum(), amiga/sum.h
+*
+******************************************************************************/
+
+void ma_sumacc_init(ma_sumacc *acc)
+{
+    int i;
+
+    for (i = 0; i < MA_SUMACC_LIMBS; i++) acc->limb[i] = 0;
+    acc->pending = 0;
+    acc->special = 0.0;
+}
+
+void ma_sumacc_add(ma_sumacc *acc, double x)
+{
+    unsigned long hx, mh, ml, d0, d1, d2, d3;
+    long *l;
+    int e, s, t;
+
+    hx = (unsigned long)__HI(x);
+    ml = (unsigned long)__LO(x);
+    e = (int)((hx >> 20) & 0x7ff);
+    if (e == 0x7ff) {			/* Inf or NaN */
+        acc->special += x;
+        return;
+    }
+    mh = hx & 0xfffff;
+    if (e != 0) mh |= 0x100000;
+    else if ((mh | ml) == 0) return;	/* +-0 */
+    else e = 1;				/* subnormal */
+
+    /* the mantissa's lowest bit is worth 2**(e-1) units of 2**-1074 */
+    l = acc->limb+(e-1)/24;
+    s = (e-1)%24;
+    d0 = (ml << s) & DIGIT;
+    t = 24-s;
+    d1 = ((ml >> t) | (mh << (32-t))) & DIGIT;
+    t += 24;
+    d2 = ((t < 32) ? (ml >> t) | (mh << (32-t)) : mh >> (t-32)) & DIGIT;
+    t += 24;
+    d3 = (t < 53) ? mh >> (t-32) : 0;
+
+    if (hx & 0x80000000UL) {
+        l[0] -= (long)d0; l[1] -= (long)d1; l[2] -= (long)d2; l[3] -= (long)d3;
+    } else {
+        l[0] += (long)d0; l[1] += (long)d1; l[2] += (long)d2; l[3] += (long)d3;
+    }
+    if (++acc->pending >= CARRY_EVERY) carry(acc);
+}
+
+void ma_sumacc_addv(ma_sumacc *acc, const double *x, unsigned long n)
+{
+    while (n--) {
+        ma_sumacc_add(acc, *x++);
+    }
+}
+
+void ma_sumacc_merge(ma_sumacc *acc, const ma_sumacc *other)
+{
+    int i;
+
+    /* carried digits plus uncarried ones still fit a long */
+    carry(acc);
+    for (i = 0; i < MA_SUMACC_LIMBS; i++) acc->limb[i] += other->limb[i];
+    carry(acc);
+    acc->special += other->special;
+}
+
+double ma_sumacc_result(ma_sumacc *acc)
+{
+    unsigned long mh, ml, d;
+    double r;
+    int i, p, q, neg, sticky;
+
+    if (acc->special != 0.0 || acc->special != acc->special)
+        return acc->special;
+
+    carry(acc);
+    neg = acc->limb[MA_SUMACC_LIMBS-1] < 0;
+    if (neg) negate(acc);
+
+    for (i = MA_SUMACC_LIMBS-1; i >= 0 && acc->limb[i] == 0; i--)
+        ;
+    if (i < 0) return 0.0;
+    if (i > (1024+1074)/24) {		/* at least 2**1038 */
+        r = HUGE_VAL;
+        __ma_seterr(ERANGE);
+        goto out;
+    }
+
+    /* p is the position of the leading bit */
+    d = (unsigned long)acc->limb[i];
+    for (p = 24*i; d > 1; d >>= 1) p++;
+
+    if (p < 53) {
+        /* below 2**-1021 every multiple of 2**-1074 is a double */
+        r = ldexp(((double)acc->limb[2]*(double)RADIX+(double)acc->limb[1])*
+                  (double)RADIX+(double)acc->limb[0], -1074);
+        goto out;
+    }
+
+    /* 53 bits from p down, then round to nearest even */
+    mh = getbits(acc, p-20, 21);
+    ml = getbits(acc, p-52, 24) | (getbits(acc, p-28, 8) << 24);
+    q = p-53;
+    sticky = (acc->limb[q/24] & ((1L << (q%24))-1)) != 0;
+    for (i = q/24-1; i >= 0 && !sticky; i--) sticky = acc->limb[i] != 0;
+    if (getbits(acc, q, 1) && (sticky || (ml & 1))) {
+        ml = (ml+1) & 0xffffffffUL;
+        if (ml == 0 && ++mh == 0x200000) {
+            mh = 0x100000;
+            p++;
+        }
+    }
+    if (p-51 >= 0x7ff) {
+        r = HUGE_VAL;
+        __ma_seterr(ERANGE);
+        goto out;
+    }
+    __HI(r) = (int)(((unsigned long)(p-51) << 20) | (mh & 0xfffff));
+    __LO(r) = (int)ml;
+
+out:
+    if (neg) {
+        negate(acc);
+        r = -r;
+    }
+    return r;
+}
@@ -17,14 +17,9 @@
 #include <math.h>
 #include "include/internal/m99_math.h"
 
-/* Helper macros for accessing high/low parts of double */
-/* SAS/C uses big-endian, so high word is first */
-#define __HI(x) *(int*)&x
-#define __LO(x) *(1+(int*)&x)
-
 /* Internal functions for tan */
 extern int __ieee754_rem_pio2(double x, double *y);
-static double __kernel_tan(double x, double y, int iy);
+double __kernel_tan(double x, double y, int iy);
 
 /* Kernel tan function constants */
 static const double
@@ -47,7 +42,7 @@ T[] =  {
   2.59073051863633712884e-05, /* 0x3EFB2A70, 0x74BF7AD4 */
 };
 
-static double __kernel_tan(double x, double y, int iy)
+double __kernel_tan(double x, double y, int iy)
 {
     double z, r, v, w, s;
     int ix, hx;
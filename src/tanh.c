@@ -17,11 +17,6 @@
 #include <math.h>
 #include "include/internal/m99_math.h"
 
-/* Helper macros for accessing high/low parts of double */
-/* SAS/C uses big-endian, so high word is first */
-#define __HI(x) *(int*)&x
-#define __LO(x) *(1+(int*)&x)
-
 static const double one=1.0, two=2.0, tiny = 1.0e-300;
 
 /****** ma.lib/tanh *********************************************************
@@ -91,4 +86,3 @@ double tanh(double x)
     return (jx>=0)? z: -z;
 }
 
-
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * double tanpi(double x)
+ * Return tan(pi*x)
+ */
+
+#include <math.h>
+#include <errno.h>
+#include "include/internal/m99_math.h"
+
+/* Shared kernels - see tan.c and sinpi.c */
+extern double __kernel_tan(double x, double y, int iy);
+extern int __kernel_rempi(double x, double *r, double *y);
+
+static const double one = 1.0;
+
+/****** ma.lib/tanpi ********************************************************
+*
+*   NAME	
+* 	tanpi -- Return tan(pi*x). (V1.0)
+*
+*   SYNOPSIS
+*	double result = tanpi(double x);
+*	  D0		    D0
+*	double tanpi(double x);
+*
+*   FUNCTION
+*	Compute the tangent of pi times x, with the same exact reduction
+*	modulo 2 as sinpi(). Odd multiples of 1/2 are poles.
+*
+*   INPUTS
+*	x - Input value, in half-turns.
+*
+*   RESULT
+*	result - tan(pi*x). Exactly +-1 at odd multiples of 1/4. At an
+*	        integer n the result is a zero, +0 for positive even n or
+*	        negative odd n and -0 otherwise. At n+1/2 it is +Infinity
+*	        for even n and -Infinity for odd n. Returns NaN for an
+*	        infinite or NaN x.
+*
+*   EXAMPLE
+*	double t = tanpi(0.25);
+*
+*   NOTES
+*	C23. Sets errno to ERANGE at the poles and EDOM for infinite x.
+*
+*   SEE ALSO
+*	sinpi(), cospi(), atanpi(), tan(), ma_tand(), math.h
+*
+******************************************************************************/
+
+double tanpi(double x)
+{
+    double r, y[2];
+    int n;
+
+    /* tanpi(Inf or NaN) is NaN */
+    if((__HI(x)&0x7fffffff) >= 0x7ff00000) {
+        if(x == x) __ma_seterr(EDOM);
+        return x-x;
+    }
+
+    n = __kernel_rempi(x, &r, y);
+    if(r == __ma_zero) {
+        if(n&1) {			/* pole at a half-integer */
+            __ma_seterr(ERANGE);
+            return (n == 1) ? one/__ma_zero : -one/__ma_zero;
+        }
+        return (n == 0) ? x*__ma_zero : -(x*__ma_zero);
+    }
+    if(fabs(r) == 0.25) return (n&1) ? -4.0*r : 4.0*r;
+    return __kernel_tan(y[0],y[1],(n&1) ? -1 : 1);
+}
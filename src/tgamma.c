@@ -19,11 +19,33 @@
 #include <math.h>
 #include "include/internal/m99_math.h"
 
-extern int signgam;
-
-static double __ieee754_gamma_r(double x, int *signgamp)
+/*
+ * Compute gamma(x) from lgamma_r, leaving the sign of gamma(x) in
+ * *signgamp. Returns the non-finite lgamma value unchanged at a pole
+ * or on overflow and reports which one through *err; an underflow to
+ * zero is reported as ERANGE too.
+ */
+static double __ieee754_tgamma(double x, int *signgamp, int *err)
 {
-    return lgamma_r(x, signgamp);
+    double y;
+
+    *err = 0;
+    y = lgamma_r(x, signgamp);
+    if(!finite(y)&&finite(x)) {
+        if(floor(x)==x&&x<=0.0) {
+            /* gamma pole */
+            *err = EDOM;
+        } else {
+            /* gamma overflow */
+            *err = ERANGE;
+        }
+        return y;
+    }
+    y = exp(y);
+    if(!finite(y)) *err = ERANGE;	/* gamma overflow */
+    else if(y==0.0) *err = ERANGE;	/* gamma underflow */
+    if(*signgamp<0) y = -y;
+    return y;
 }
 
 /****** ma.lib/tgamma ***************************************************
@@ -54,26 +76,68 @@ static double __ieee754_gamma_r(double x, int *signgamp)
 *
 *   NOTES
 *	This function is POSIX.1 compliant and provides IEEE 754 accuracy.
-*	Uses high-precision algorithms from fdlibm.
+*	Uses high-precision algorithms from fdlibm. Does not modify
+*	signgam; sets errno on a pole, overflow or underflow to zero.
 * 
 *   SEE ALSO
-*	lgamma(), gamma(), lgamma_r(), math.h
+*	lgamma(), gamma(), lgamma_r(), ma_tgamma_r(), math.h
 * 
 ******************************************************************************/
 
 double tgamma(double x)
 {
     double y;
-    y = __ieee754_gamma_r(x,&signgam);
-    if(!finite(y)&&finite(x)) {
-        if(floor(x)==x&&x<=0.0) {
-            /* gamma pole */
-            return y;
-        } else {
-            /* gamma overflow */
-            return y;
-        }
-    } else {
-        return exp(y);
-    }
+    int sign, err;
+
+    y = __ieee754_tgamma(x, &sign, &err);
+    if(err == ERANGE) __ma_setrange(y);
+    else if(err) __ma_seterr(err);
+    return y;
+}
+
+/****** ma.lib/ma_tgamma_r ***************************************************
+* 
+*   NAME	
+* 	ma_tgamma_r -- Return true gamma function of x (context). (V1.0)
+*
+*   SYNOPSIS
+*	double result = ma_tgamma_r(ma_ctx *ctx, double x);
+*	  D0		             A0          D0
+*	double ma_tgamma_r(ma_ctx *ctx, double x);
+*
+*   FUNCTION
+*	Compute the true gamma function of x, as tgamma(), reporting the
+*	sign of the result in ctx->signgam and any error in ctx.
+* 
+*   INPUTS
+*	ctx - Math context to receive the sign and any error.
+*	x   - Input value.
+*	
+*   RESULT
+*	result - Gamma function of x, as tgamma(). A pole raises
+*	        MA_FE_INVALID, an overflow MA_FE_OVERFLOW and an
+*	        underflow to zero MA_FE_UNDERFLOW in ctx.
+* 
+*   EXAMPLE
+*	ma_ctx ctx;
+*	ma_ctx_init(&ctx);
+*	r = ma_tgamma_r(&ctx, 5.0);
+*
+*   NOTES
+*	Writes only to ctx, never to signgam or errno, so it may be called
+*	from several tasks at once as long as each passes its own context.
+* 
+*   SEE ALSO
+*	tgamma(), ma_lgamma_r(), ma_ctx_init(), math.h
+* 
+******************************************************************************/
+
+double ma_tgamma_r(ma_ctx *ctx, double x)
+{
+    double y;
+    int err;
+
+    y = __ieee754_tgamma(x, &ctx->signgam, &err);
+    if(err) __ma_ctx_raise(ctx, err, y);
+    return y;
 }
@@ -0,0 +1,345 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * footprint - size report for the objects of ma.lib
+ *
+ * Usage : footprint [-l] file ...
+ *
+ * Each file is an AmigaDOS object file or a library of them, as sc and
+ * oml write. Every unit is read for the size of its code, data and
+ * bss hunks and for the symbols it defines and refers to in HUNK_EXT.
+ * For each exported symbol one line gives the unit that defines it,
+ * that unit's text, data and bss, and the same totals over the
+ * transitive closure: the units a program linking only that symbol
+ * would pull in from the files named. With -l the units of each
+ * closure are listed, with the references none of the files define
+ * (sc.lib, amiga.lib).
+ *
+ * The format is read byte by byte, big-endian, so the tool also runs
+ * on a cross-development host.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define HUNK_UNIT       0x3E7
+#define HUNK_NAME       0x3E8
+#define HUNK_CODE       0x3E9
+#define HUNK_DATA       0x3EA
+#define HUNK_BSS        0x3EB
+#define HUNK_RELOC32    0x3EC
+#define HUNK_RELOC16    0x3ED
+#define HUNK_RELOC8     0x3EE
+#define HUNK_EXT        0x3EF
+#define HUNK_SYMBOL     0x3F0
+#define HUNK_DEBUG      0x3F1
+#define HUNK_END        0x3F2
+#define HUNK_DREL32     0x3F7
+#define HUNK_DREL16     0x3F8
+#define HUNK_DREL8      0x3F9
+#define HUNK_RELOC32SHORT 0x3FC
+
+#define EXT_COMMON      130     /* first reference type with a size */
+
+typedef struct unit {
+    char *name;
+    char *file;
+    unsigned long text, data, bss;
+    char **defs;                /* exported symbols */
+    int ndefs;
+    char **refs;                /* symbols referred to */
+    int nrefs;
+    int mark;                   /* closure being built, or 0 */
+} UNIT;
+
+static UNIT *units;
+static int nunits, maxunits;
+
+static unsigned char *buf;
+static unsigned long len, pos;
+static const char *fname;
+
+static void fail(const char *msg)
+{
+    fprintf(stderr, "footprint: %s: %s at offset %lu\n", fname, msg, pos);
+    exit(20);
+}
+
+static void *xalloc(size_t n)
+{
+    void *p = malloc(n ? n : 1);
+
+    if (p == NULL) {
+        fprintf(stderr, "footprint: out of memory\n");
+        exit(20);
+    }
+    return p;
+}
+
+static unsigned long get32(void)
+{
+    unsigned long v;
+
+    if (pos + 4 > len) fail("unexpected end of file");
+    v = ((unsigned long)buf[pos] << 24) | ((unsigned long)buf[pos+1] << 16) |
+        ((unsigned long)buf[pos+2] << 8) | buf[pos+3];
+    pos += 4;
+    return v;
+}
+
+static void skip32(unsigned long n)
+{
+    if (n > (len - pos) / 4) fail("unexpected end of file");
+    pos += n * 4;
+}
+
+/* Read a name n longwords long, without its padding NULs */
+static char *getname(unsigned long n)
+{
+    char *s;
+    unsigned long i;
+
+    if (n > (len - pos) / 4) fail("unexpected end of file");
+    s = xalloc(n * 4 + 1);
+    memcpy(s, buf + pos, n * 4);
+    s[n * 4] = '\0';
+    for (i = n * 4; i > 0 && s[i-1] == '\0'; i--)
+        ;
+    pos += n * 4;
+    return s;
+}
+
+static void addname(char ***v, int *n, char *s)
+{
+    int i;
+
+    for (i = 0; i < *n; i++)
+        if (strcmp((*v)[i], s) == 0) { free(s); return; }
+    if ((*n & 15) == 0) {
+        char **w = xalloc((*n + 16) * sizeof(char *));
+        if (*n) memcpy(w, *v, *n * sizeof(char *));
+        free(*v);
+        *v = w;
+    }
+    (*v)[(*n)++] = s;
+}
+
+static UNIT *newunit(char *name)
+{
+    UNIT *u;
+
+    if (nunits == maxunits) {
+        UNIT *w;
+        maxunits = maxunits ? maxunits * 2 : 256;
+        w = xalloc(maxunits * sizeof(UNIT));
+        if (nunits) memcpy(w, units, nunits * sizeof(UNIT));
+        free(units);
+        units = w;
+    }
+    u = &units[nunits++];
+    memset(u, 0, sizeof(UNIT));
+    u->name = name;
+    u->file = (char *)fname;
+    return u;
+}
+
+/* Skip reloc blocks: (count, hunk, count offsets)... 0 */
+static void skipreloc(void)
+{
+    unsigned long n;
+
+    while ((n = get32()) != 0)
+        skip32(n + 1);
+}
+
+/* The same with 16-bit counts and offsets, padded to a longword */
+static void skipreloc16(void)
+{
+    unsigned long n, start = pos;
+
+    for (;;) {
+        if (pos + 2 > len) fail("unexpected end of file");
+        n = ((unsigned long)buf[pos] << 8) | buf[pos+1];
+        pos += 2;
+        if (n == 0) break;
+        if (n + 1 > (len - pos) / 2) fail("unexpected end of file");
+        pos += (n + 1) * 2;
+    }
+    if ((pos - start) & 2) pos += 2;
+}
+
+static void readext(UNIT *u)
+{
+    unsigned long w, type, n;
+    char *s;
+
+    while ((w = get32()) != 0) {
+        type = w >> 24;
+        s = getname(w & 0xffffff);
+        if (type < 128) {
+            /* EXT_SYMB, EXT_DEF, EXT_ABS, EXT_RES: one value */
+            skip32(1);
+            if (type == 0) free(s);
+            else addname(&u->defs, &u->ndefs, s);
+        } else {
+            if (type == EXT_COMMON || type == 137)
+                skip32(1);      /* size of the common block */
+            n = get32();
+            skip32(n);
+            addname(&u->refs, &u->nrefs, s);
+        }
+    }
+}
+
+static void readfile(const char *path)
+{
+    FILE *fp;
+    UNIT *u = NULL;
+    unsigned long type, n;
+
+    fname = path;
+    if ((fp = fopen(path, "rb")) == NULL) {
+        fprintf(stderr, "footprint: cannot open %s\n", path);
+        exit(20);
+    }
+    fseek(fp, 0L, SEEK_END);
+    len = (unsigned long)ftell(fp);
+    fseek(fp, 0L, SEEK_SET);
+    buf = xalloc(len);
+    if (fread(buf, 1, len, fp) != len) fail("read error");
+    fclose(fp);
+
+    pos = 0;
+    while (pos < len) {
+        type = get32() & 0x3fffffff;
+        switch (type) {
+        case HUNK_UNIT:
+            u = newunit(getname(get32()));
+            break;
+        case HUNK_NAME:
+            free(getname(get32()));
+            break;
+        case HUNK_CODE:
+        case HUNK_DATA:
+        case HUNK_BSS:
+            if (u == NULL) fail("hunk outside a unit");
+            n = get32();
+            if ((n & 0xc0000000UL) == 0xc0000000UL) skip32(1);
+            n &= 0x3fffffff;
+            if (type == HUNK_CODE) u->text += n * 4;
+            else if (type == HUNK_DATA) u->data += n * 4;
+            else u->bss += n * 4;
+            if (type != HUNK_BSS) skip32(n);
+            break;
+        case HUNK_RELOC32:
+        case HUNK_RELOC16:
+        case HUNK_RELOC8:
+        case HUNK_DREL32:
+        case HUNK_DREL16:
+        case HUNK_DREL8:
+            skipreloc();
+            break;
+        case HUNK_RELOC32SHORT:
+            skipreloc16();
+            break;
+        case HUNK_EXT:
+            if (u == NULL) fail("hunk outside a unit");
+            readext(u);
+            break;
+        case HUNK_SYMBOL:
+            while ((n = get32()) != 0)
+                skip32(n + 1);
+            break;
+        case HUNK_DEBUG:
+            skip32(get32());
+            break;
+        case HUNK_END:
+            break;
+        default:
+            fail("unknown hunk type");
+        }
+    }
+    free(buf);
+}
+
+static UNIT *definer(const char *s)
+{
+    int i, j;
+
+    for (i = 0; i < nunits; i++)
+        for (j = 0; j < units[i].ndefs; j++)
+            if (strcmp(units[i].defs[j], s) == 0)
+                return &units[i];
+    return NULL;
+}
+
+/* Mark u and every unit its references pull in with m */
+static void closure(UNIT *u, int m)
+{
+    UNIT *d;
+    int j;
+
+    if (u->mark == m) return;
+    u->mark = m;
+    for (j = 0; j < u->nrefs; j++)
+        if ((d = definer(u->refs[j])) != NULL)
+            closure(d, m);
+}
+
+int main(int argc, char **argv)
+{
+    unsigned long text, data, bss;
+    int i, j, k, list = 0, count, m = 0;
+    UNIT *u, *v;
+
+    for (i = 1; i < argc && argv[i][0] == '-'; i++) {
+        if (strcmp(argv[i], "-l") == 0) list = 1;
+        else break;
+    }
+    if (i == argc) {
+        fprintf(stderr, "usage: footprint [-l] file ...\n");
+        return 10;
+    }
+    for (; i < argc; i++)
+        readfile(argv[i]);
+
+    printf("%-24s %-16s %6s %6s %6s %7s %6s %6s %5s\n",
+           "symbol", "unit", "text", "data", "bss",
+           "+text", "+data", "+bss", "units");
+    for (i = 0; i < nunits; i++) {
+        u = &units[i];
+        for (j = 0; j < u->ndefs; j++) {
+            closure(u, ++m);
+            text = data = bss = 0;
+            count = 0;
+            for (k = 0; k < nunits; k++) {
+                v = &units[k];
+                if (v->mark != m) continue;
+                text += v->text; data += v->data; bss += v->bss;
+                count++;
+            }
+            printf("%-24s %-16s %6lu %6lu %6lu %7lu %6lu %6lu %5d\n",
+                   u->defs[j], u->name, u->text, u->data, u->bss,
+                   text, data, bss, count);
+            if (!list) continue;
+            for (k = 0; k < nunits; k++) {
+                v = &units[k];
+                if (v->mark == m && v != u)
+                    printf("    %-20s %6lu %6lu %6lu\n",
+                           v->name, v->text, v->data, v->bss);
+            }
+            for (k = 0; k < nunits; k++) {
+                int r;
+                v = &units[k];
+                if (v->mark != m) continue;
+                for (r = 0; r < v->nrefs; r++)
+                    if (definer(v->refs[r]) == NULL)
+                        printf("    %-20s (external, from %s)\n",
+                               v->refs[r], v->name);
+            }
+        }
+    }
+    return 0;
+}
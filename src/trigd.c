@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Trigonometric functions in degrees
+ *
+ * The period of 360 degrees is an exact double, so fmod() reduces the
+ * argument without error, and x = 90k + r with |r| <= 45 follows by an
+ * exact subtraction. Only r*pi/180 is rounded, formed as a double-double
+ * for the kernels that sin(), cos() and tan() use.
+ */
+
+#include <math.h>
+#include <errno.h>
+#include "include/internal/m99_math.h"
+
+/* Shared kernels - see sin.c, tan.c and pown.c */
+extern double __kernel_sin(double x, double y, int iy);
+extern double __kernel_cos(double x, double y);
+extern double __kernel_tan(double x, double y, int iy);
+extern void __kernel_mul12(double a, double b, double *hi, double *lo);
+
+static const double
+one    =  1.0,
+deg    =  1.74532925199432954744e-02, /* 0x3F91DF46, 0xA2529D39 */
+deg_lo =  2.94865227087016868684e-19, /* 0x3C15C1D8, 0xBECDD291 */
+rad    =  5.72957795130823228646e+01, /* 0x404CA5DC, 0x1A63C1F8 */
+rad_lo = -1.98784956705762832680e-15; /* 0xBCE1E7AB, 0x456405F9 */
+
+/*
+ * remd - Reduce a finite x to x = 90k + r, |r| <= 45. Stores r, which
+ * is exact, in *r and r*pi/180 as a double-double in y[0] + y[1], and
+ * returns k mod 4. For a multiple of 90, *r is a zero with the sign
+ * of x.
+ */
+static int remd(double x, double *r, double *y)
+{
+    double ax, h, l;
+    int k;
+
+    ax = fabs(x);
+    if (ax >= 360.0) ax = fmod(ax, 360.0);	/* exact */
+    k = (int)(ax/90.0+0.5);
+    *r = ax-90.0*(double)k;			/* exact */
+    if (__HI(x) < 0) {
+        *r = -*r;
+        k = -k;
+    }
+
+    __kernel_mul12(*r, deg, &h, &l);
+    l += *r*deg_lo;
+    y[0] = h+l;
+    y[1] = l-(y[0]-h);
+    return k&3;
+}
+
+/* todeg - a*180/pi with a double-double 180/pi */
+static double todeg(double a)
+{
+    double h, l;
+
+    __kernel_mul12(a, rad, &h, &l);
+    return h+(l+a*rad_lo);
+}
+
+/****** ma.lib/ma_sind *******************************************************
+*
+*   NAME
+* 	ma_sind -- Trigonometric functions of an angle in degrees. (V1.0)
+*
+*   SYNOPSIS
+*	double result = ma_sind(double x);
+*	  D0		      D0
+*	double ma_sind(double x);
+*	double ma_cosd(double x);
+*	double ma_tand(double x);
+*
+*   FUNCTION
+*	Compute the sine, cosine or tangent of x degrees. The argument is
+*	reduced modulo 360 exactly, so the results stay accurate for any
+*	x, and the angles a programmer expects to be exact are: the sine
+*	and cosine of multiples of 30 degrees are exactly 0, +-1/2 or
+*	+-1 where the true value is, and the tangent of odd multiples of
+*	45 degrees is exactly +-1.
+*
+*   INPUTS
+*	x - Angle in degrees.
+*
+*   RESULT
+*	result - sin, cos or tan of x degrees. Zeros of ma_sind() and
+*	        ma_tand() take their signs as for sinpi() and tanpi(), and
+*	        ma_tand() gives +-Infinity at odd multiples of 90.
+*	        Returns NaN for an infinite or NaN x.
+*
+*   EXAMPLE
+*	double s = ma_sind(30.0);
+*
+*   NOTES
+*	ma.lib extension. Sets errno to ERANGE at the poles of ma_tand()
+*	and EDOM for infinite x.
+*
+*   SEE ALSO
+*	ma_asind(), sinpi(), sin(), math.h
+*
+******************************************************************************/
+
+double ma_sind(double x)
+{
+    double r, y[2];
+    int n;
+
+    if ((__HI(x)&0x7fffffff) >= 0x7ff00000) {
+        if (x == x) __ma_seterr(EDOM);
+        return x-x;
+    }
+
+    n = remd(x, &r, y);
+    if ((n&1) == 0) {
+        if (r == __ma_zero) return x*__ma_zero;
+        if (fabs(r) == 30.0) return (n == 0) ? r/60.0 : -r/60.0;
+    }
+    switch (n) {
+        case 0: return  __kernel_sin(y[0],y[1],1);
+        case 1: return  __kernel_cos(y[0],y[1]);
+        case 2: return -__kernel_sin(y[0],y[1],1);
+        default:
+                return -__kernel_cos(y[0],y[1]);
+    }
+}
+
+double ma_cosd(double x)
+{
+    double r, y[2];
+    int n;
+
+    if ((__HI(x)&0x7fffffff) >= 0x7ff00000) {
+        if (x == x) __ma_seterr(EDOM);
+        return x-x;
+    }
+
+    n = remd(x, &r, y);
+    if (n&1) {
+        if (r == __ma_zero) return __ma_zero;
+        if (fabs(r) == 30.0) return (n == 1) ? -r/60.0 : r/60.0;
+    }
+    switch (n) {
+        case 0: return  __kernel_cos(y[0],y[1]);
+        case 1: return -__kernel_sin(y[0],y[1],1);
+        case 2: return -__kernel_cos(y[0],y[1]);
+        default:
+                return  __kernel_sin(y[0],y[1],1);
+    }
+}
+
+double ma_tand(double x)
+{
+    double r, y[2];
+    int n;
+
+    if ((__HI(x)&0x7fffffff) >= 0x7ff00000) {
+        if (x == x) __ma_seterr(EDOM);
+        return x-x;
+    }
+
+    n = remd(x, &r, y);
+    if (r == __ma_zero) {
+        if (n&1) {				/* pole */
+            __ma_seterr(ERANGE);
+            return (n == 1) ? one/__ma_zero : -one/__ma_zero;
+        }
+        return (n == 0) ? x*__ma_zero : -(x*__ma_zero);
+    }
+    if (fabs(r) == 45.0) return (n&1) ? -r/45.0 : r/45.0;
+    return __kernel_tan(y[0],y[1],(n&1) ? -1 : 1);
+}
+
+/****** ma.lib/ma_asind ******************************************************
+*
+*   NAME
+* 	ma_asind -- Inverse trigonometric functions in degrees. (V1.0)
+*
+*   SYNOPSIS
+*	double result = ma_asind(double x);
+*	  D0		       D0
+*	double ma_asind(double x);
+*	double ma_acosd(double x);
+*	double ma_atand(double x);
+*
+*   FUNCTION
+*	Compute the arc sine, arc cosine or arc tangent of x in degrees,
+*	scaling the result of asin(), acos() or atan() by a double-double
+*	180/pi. The angles of the special values are exact: 0, +-30,
+*	+-45, 60, +-90, 120 and 180 degrees.
+*
+*   INPUTS
+*	x - Input value; in [-1,1] for ma_asind() and ma_acosd().
+*
+*   RESULT
+*	result - The angle in degrees: [-90,90] for ma_asind() and
+*	        ma_atand(), [0,180] for ma_acosd(). Returns NaN for
+*	        |x| > 1 in ma_asind() and ma_acosd().
+*
+*   EXAMPLE
+*	double a = ma_atand(1.0);
+*
+*   NOTES
+*	ma.lib extension. Sets errno to EDOM for |x| > 1, as asin() and
+*	acos() do.
+*
+*   SEE ALSO
+*	ma_sind(), asinpi(), asin(), math.h
+*
+******************************************************************************/
+
+double ma_asind(double x)
+{
+    double ax;
+
+    ax = fabs(x);
+    if (x == 0.0) return x;
+    if (ax == 1.0) return 90.0*x;
+    if (ax == 0.5) return 60.0*x;
+    return todeg(asin(x));
+}
+
+double ma_acosd(double x)
+{
+    if (x == 0.0) return 90.0;
+    if (x == 0.5) return 60.0;
+    if (x == -0.5) return 120.0;
+    if (x == -1.0) return 180.0;
+    return todeg(acos(x));
+}
+
+double ma_atand(double x)
+{
+    double ax;
+
+    ax = fabs(x);
+    if (x == 0.0) return x;
+    if (ax == 1.0) return 45.0*x;
+    if (ax > 1.0e300 && ax-ax != 0.0) {		/* +-inf */
+        return (x > 0.0) ? 90.0 : -90.0;
+    }
+    return todeg(atan(x));
+}
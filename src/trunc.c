@@ -7,12 +7,13 @@
 
 #include <math.h>
 #include "include/internal/m99_math.h"
+#include "include/internal/fpu.h"
 
 /*
  * trunc(x)
  * Return x rounded toward 0 to integral value
  * Method:
- *      Bit twiddling.
+ *      Bit twiddling; FINTRZ on the 68881 build.
  * Exception:
  *      Inexact flag raised if x not equal to trunc(x).
  */
@@ -56,6 +57,9 @@ static const double huge = 1.0e300;
 
 double trunc(double x)
 {
+#ifdef MA_FPU_FULL
+    return __ma_fpu_intrz(x);
+#else
     int i0,i1,j0;
     unsigned i;
     double result;
@@ -91,4 +95,5 @@ double trunc(double x)
     __HI(result) = i0;
     __LO(result) = i1;
     return result;
+#endif
 }
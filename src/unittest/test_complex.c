@@ -38,6 +38,9 @@ void test_casinh(void);
 void test_cacosh(void);
 void test_catanh(void);
 void test_cpow(void);
+void test_cpowi(void);
+void test_complex_float(void);
+void test_complex_long_double(void);
 int complex_approx_equal(complex_t a, complex_t b, double tolerance);
 int double_approx_equal(double a, double b, double tolerance);
 
@@ -581,6 +584,94 @@ void test_cpow() {
     ASSERT(complex_approx_equal(pow3, expected3, 1e-10));
 }
 
+void test_cpowi() {
+    complex_t z, r, w;
+    
+    printf("\n--- Testing cpowi ---\n");
+    
+    /* (1+i)^8 = 16 exactly */
+    z.re = 1.0; z.im = 1.0;
+    r = cpowi(z, 8);
+    ASSERT(r.re == 16.0 && r.im == 0.0);
+    
+    /* i^-1 = -i */
+    z.re = 0.0; z.im = 1.0;
+    r = cpowi(z, -1);
+    ASSERT(r.re == 0.0 && r.im == -1.0);
+    
+    z.re = 0.6; z.im = -0.8;
+    r = cpowi(z, 0);
+    ASSERT(r.re == 1.0 && r.im == 0.0);
+    
+    /* agrees with cpow() */
+    z.re = 1.25; z.im = 0.5;
+    w.re = 7.0; w.im = 0.0;
+    ASSERT(complex_approx_equal(cpowi(z, 7), cpow(z, w), 1e-12));
+}
+
+void test_complex_float() {
+    float_complex zf, rf;
+    complex_t z, r;
+
+    printf("\n--- Testing float complex functions ---\n");
+
+    zf.re = 0.5f; zf.im = -1.25f;
+    z.re = 0.5; z.im = -1.25;
+
+    ASSERT(double_approx_equal(cabsf(zf), cabs(z), 1e-6));
+    ASSERT(double_approx_equal(cargf(zf), carg(z), 1e-6));
+
+    rf = cexpf(zf); r = cexp(z);
+    ASSERT(double_approx_equal(rf.re, r.re, 1e-6) && double_approx_equal(rf.im, r.im, 1e-6));
+    rf = clogf(zf); r = clog(z);
+    ASSERT(double_approx_equal(rf.re, r.re, 1e-6) && double_approx_equal(rf.im, r.im, 1e-6));
+    rf = csqrtf(zf); r = csqrt(z);
+    ASSERT(double_approx_equal(rf.re, r.re, 1e-6) && double_approx_equal(rf.im, r.im, 1e-6));
+    rf = csinf(zf); r = csin(z);
+    ASSERT(double_approx_equal(rf.re, r.re, 1e-6) && double_approx_equal(rf.im, r.im, 1e-6));
+    rf = ccosf(zf); r = ccos(z);
+    ASSERT(double_approx_equal(rf.re, r.re, 1e-6) && double_approx_equal(rf.im, r.im, 1e-6));
+    rf = ctanhf(zf); r = ctanh(z);
+    ASSERT(double_approx_equal(rf.re, r.re, 1e-6) && double_approx_equal(rf.im, r.im, 1e-6));
+    rf = casinf(zf); r = casin(z);
+    ASSERT(double_approx_equal(rf.re, r.re, 1e-6) && double_approx_equal(rf.im, r.im, 1e-6));
+    rf = catanf(zf); r = catan(z);
+    ASSERT(double_approx_equal(rf.re, r.re, 1e-6) && double_approx_equal(rf.im, r.im, 1e-6));
+
+    /* Large arguments must not overflow before the result does */
+    zf.re = 89.0f; zf.im = 0.5f;
+    rf = csinhf(zf);
+    ASSERT(rf.re > 1e38f && rf.re == rf.re);
+    zf.re = 100.0f; zf.im = 1.0f;
+    rf = ctanhf(zf);
+    ASSERT(rf.re == 1.0f && rf.im >= 0.0f && rf.im < 1e-30f);
+    
+    /* |z| just under 1 with a*a < 0.5: log|z| to a few ulps */
+    zf.re = 1482705.0f/2097152.0f; zf.im = 1482646.0f/2097152.0f;
+    rf = clogf(zf);
+    ASSERT(double_approx_equal(rf.re, -1.5841732043281038e-4, 6e-11));
+}
+
+void test_complex_long_double() {
+    long_double_complex zl, rl;
+    complex_t z, r;
+
+    printf("\n--- Testing long double complex functions ---\n");
+
+    zl.re = 0.5L; zl.im = -1.25L;
+    z.re = 0.5; z.im = -1.25;
+
+    ASSERT(cabsl(zl) == cabs(z));
+    rl = cexpl(zl); r = cexp(z);
+    ASSERT(rl.re == r.re && rl.im == r.im);
+    rl = clogl(zl); r = clog(z);
+    ASSERT(double_approx_equal(rl.re, r.re, 1e-15) && double_approx_equal(rl.im, r.im, 1e-15));
+    rl = conjl(zl);
+    ASSERT(rl.re == 0.5L && rl.im == 1.25L);
+    rl = catanhl(zl); r = catanh(z);
+    ASSERT(rl.re == r.re && rl.im == r.im);
+}
+
 int main() {
     printf("=== Complex Number Unit Tests ===\n");
     printf("Testing ma.lib complex number functions\n");
@@ -606,6 +697,9 @@ int main() {
     test_cacosh();
     test_catanh();
     test_cpow();
+    test_cpowi();
+    test_complex_float();
+    test_complex_long_double();
     
     printf("\n=== Test Results ===\n");
     printf("Tests run: %d\n", tests_run);
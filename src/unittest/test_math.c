@@ -10,10 +10,20 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <math.h>
 #include <errno.h>
 #include <float.h>
 #include "include/internal/m99_math.h"
+#include "include/amiga/fixed.h"
+#include "include/amiga/ffp.h"
+#include "include/amiga/sum.h"
+#include "include/amiga/reduce.h"
+#include "include/amiga/conv.h"
+#include "include/amiga/bits.h"
+#include "include/amiga/intmath.h"
+#include "include/amiga/mpn.h"
+#include "include/amiga/vround.h"
 
 /* Test case counters */
 static int tests_run = 0;
@@ -22,6 +32,7 @@ static int tests_failed = 0;
 /* Function prototypes */
 void assert_test(const char* test_name, int condition, const char* file, int line);
 void test_trigonometric(void);
+void test_trig_pi(void);
 void test_hyperbolic(void);
 void test_exponential_logarithmic(void);
 void test_power_root(void);
@@ -30,10 +41,27 @@ void test_floating_point_manipulation(void);
 void test_classification_comparison(void);
 void test_utility(void);
 void test_error_functions(void);
+void test_normal_distribution(void);
 void test_bessel(void);
+void test_integer_powers(void);
+void test_bessel_joint(void);
+void test_math_context(void);
+void test_fixed_point(void);
+void test_ffp(void);
+void test_summation(void);
+void test_reductions(void);
+void test_norms(void);
+void test_conversion(void);
+void test_long_long_text(void);
+void test_dividers(void);
+void test_bits(void);
+void test_intmath(void);
+void test_mpn(void);
+void test_vround(void);
 void test_constants(void);
 void test_float_variants(void);
 void test_long_double_variants(void);
+void test_tgmath(void);
 
 /* Simple assertion function */
 void assert_test(const char* test_name, int condition, const char* file, int line) {
@@ -105,6 +133,58 @@ void test_trigonometric() {
     ASSERT(double_approx_equal(atan2(-1.0, 0.0), -M_PI/2.0, 1e-10));
 }
 
+/* Test trigonometric functions of pi*x and of degrees */
+void test_trig_pi() {
+    printf("\n--- Testing sinpi/cospi/tanpi and Degree Variants ---\n");
+    
+    /* Exact at integers and half-integers, however large */
+    ASSERT(sinpi(0.5) == 1.0);
+    ASSERT(sinpi(-1.5) == 1.0);
+    ASSERT(sinpi(3.0) == 0.0 && signbit(sinpi(3.0)) == 0);
+    ASSERT(sinpi(-2.0) == 0.0 && signbit(sinpi(-2.0)) != 0);
+    ASSERT(cospi(1.0) == -1.0);
+    ASSERT(cospi(-0.5) == 0.0 && signbit(cospi(-0.5)) == 0);
+    ASSERT(cospi(1e300) == 1.0);
+    ASSERT(sinpi(4503599627370497.0) == 0.0);
+    ASSERT(cospi(4503599627370497.0) == -1.0);
+    ASSERT(tanpi(0.25) == 1.0);
+    ASSERT(tanpi(-0.75) == 1.0);
+    ASSERT(signbit(tanpi(1.0)) != 0 && signbit(tanpi(-1.0)) == 0);
+    ASSERT(isinf(tanpi(0.5)) && tanpi(0.5) > 0.0);
+    ASSERT(isinf(tanpi(1.5)) && tanpi(1.5) < 0.0);
+    
+    /* Between the exact points */
+    ASSERT(double_approx_equal(sinpi(1.0/6.0), 0.5, 1e-15));
+    ASSERT(double_approx_equal(sinpi(1000000.25), 0.70710678118654752, 1e-15));
+    ASSERT(double_approx_equal(cospi(-2.0/3.0), -0.5, 1e-15));
+    ASSERT(double_approx_equal(tanpi(0.1), 0.32491969623290633, 1e-15));
+    ASSERT(isnan(sinpi(INFINITY)));
+    
+    /* Inverses, in half-turns */
+    ASSERT(asinpi(1.0) == 0.5);
+    ASSERT(acospi(-1.0) == 1.0);
+    ASSERT(acospi(0.0) == 0.5);
+    ASSERT(atanpi(-1.0) == -0.25);
+    ASSERT(atanpi(INFINITY) == 0.5);
+    ASSERT(double_approx_equal(asinpi(0.5), 1.0/6.0, 1e-15));
+    
+    /* Degrees */
+    ASSERT(ma_sind(30.0) == 0.5);
+    ASSERT(ma_sind(-210.0) == 0.5);
+    ASSERT(ma_cosd(60.0) == 0.5);
+    ASSERT(ma_cosd(120.0) == -0.5);
+    ASSERT(ma_cosd(270.0) == 0.0);
+    ASSERT(ma_sind(-180.0) == 0.0 && signbit(ma_sind(-180.0)) != 0);
+    ASSERT(ma_tand(135.0) == -1.0);
+    ASSERT(isinf(ma_tand(90.0)));
+    ASSERT(ma_sind(3600000.0) == 0.0);
+    ASSERT(double_approx_equal(ma_sind(1e22), -0.98480775301220802, 1e-15));
+    ASSERT(ma_asind(0.5) == 30.0);
+    ASSERT(ma_acosd(-0.5) == 120.0);
+    ASSERT(ma_atand(1.0) == 45.0);
+    ASSERT(double_approx_equal(ma_atand(0.5), 26.565051177077990, 1e-13));
+}
+
 /* Test hyperbolic functions */
 void test_hyperbolic() {
     printf("\n--- Testing Hyperbolic Functions ---\n");
@@ -201,6 +281,20 @@ void test_power_root() {
     ASSERT(double_approx_equal(sqrt(4.0), 2.0, 1e-10));
     ASSERT(double_approx_equal(sqrt(9.0), 3.0, 1e-10));
     
+    /* sqrt is correctly rounded, including subnormal arguments */
+    ASSERT(sqrt(2.0) == 1.4142135623730951);
+    ASSERT(sqrt(1e-310) * sqrt(1e-310) > 0.99999e-310);
+    ASSERT(sqrt(ldexp(1.0, -1074)) == ldexp(1.0, -537));
+    ASSERT(sqrt(ldexp(9.0, 1020)) == ldexp(3.0, 510));
+    
+    /* Test rsqrt */
+    ASSERT(rsqrt(4.0) == 0.5);
+    ASSERT(rsqrt(0.0625) == 4.0);
+    ASSERT(rsqrt(2.0) == 0.70710678118654757);
+    ASSERT(isinf(rsqrt(0.0)) && rsqrt(0.0) > 0.0);
+    ASSERT(rsqrt(ldexp(1.0, -1074)) == ldexp(1.0, 537));
+    ASSERT(rsqrtf(16.0f) == 0.25f);
+    
     /* Test cbrt */
     ASSERT(double_approx_equal(cbrt(0.0), 0.0, 1e-10));
     ASSERT(double_approx_equal(cbrt(1.0), 1.0, 1e-10));
@@ -214,10 +308,55 @@ void test_power_root() {
     ASSERT(double_approx_equal(hypot(0.0, 1.0), 1.0, 1e-10));
 }
 
+/* Test integer power and root functions */
+void test_integer_powers() {
+    printf("\n--- Testing Integer Power and Root Functions ---\n");
+    
+    /* Exact cases */
+    ASSERT(pown(3.0, 5) == 243.0);
+    ASSERT(pown(-2.0, 3) == -8.0);
+    ASSERT(pown(2.0, -10) == 1.0 / 1024.0);
+    ASSERT(pown(1.5, 0) == 1.0);
+    ASSERT(powi(10.0, 22) == 1e22);
+    ASSERT(pown(2.0, 1023) == ldexp(1.0, 1023));
+    ASSERT(pown(2.0, -1074) == ldexp(1.0, -1074));
+    
+    /* pow() with integral |y| <= 4 goes the same way */
+    ASSERT(pow(1.1, 3.0) == pown(1.1, 3));
+    ASSERT(pow(1.1, -4.0) == pown(1.1, -4));
+    ASSERT(pow(-3.0, 3.0) == -27.0);
+    ASSERT(double_approx_equal(pow(1.1, 17.0), pown(1.1, 17), 1e-14));
+    
+    /* Zero and overflow */
+    ASSERT(pown(0.0, -3) > 0.0 && isinf(pown(0.0, -3)));
+    ASSERT(pown(-0.0, -3) < 0.0 && isinf(pown(-0.0, -3)));
+    ASSERT(isinf(pown(10.0, 400)));
+    ASSERT(pown(10.0, -400) == 0.0);
+    
+    /* rootn */
+    ASSERT(rootn(-27.0, 3) == -3.0);
+    ASSERT(rootn(1024.0, 10) == 2.0);
+    ASSERT(rootn(0.0625, -4) == 2.0);
+    ASSERT(double_approx_equal(rootn(2.0, 2), sqrt(2.0), 1e-15));
+    errno = 0;
+    ASSERT(isnan(rootn(-4.0, 2)));
+    ASSERT(errno == EDOM);
+    
+    /* compoundn keeps small rates exact */
+    ASSERT(compoundn(1.0, 10) == 1024.0);
+    ASSERT(compoundn(-0.5, -2) == 4.0);
+    ASSERT(double_approx_equal(compoundn(1e-12, 1000000), exp(1e-6 - 5e-19), 1e-15));
+    ASSERT(compoundn(-1.0, 3) == 0.0);
+    errno = 0;
+    ASSERT(isnan(compoundn(-2.0, 2)));
+    ASSERT(errno == EDOM);
+}
+
 /* Test rounding and remainder functions */
 void test_rounding_remainder() {
     int quo;
     double rem;
+    long_long_t ll;
     
     printf("\n--- Testing Rounding and Remainder Functions ---\n");
     
@@ -238,6 +377,13 @@ void test_rounding_remainder() {
     ASSERT(round(3.6) == 4.0);
     ASSERT(round(-3.4) == -3.0);
     ASSERT(round(-3.6) == -4.0);
+    ASSERT(round(-0.3) == 0.0 && signbit(round(-0.3)) != 0);
+    ASSERT(round(51341414.5) == 51341415.0);           /* past 2**20 */
+    ASSERT(round(-51341414.5) == -51341415.0);
+    ASSERT(round(13116366442.35) == 13116366442.0);
+    ASSERT(round(2097152.5) == 2097153.0);              /* 2**21 + 0.5 */
+    ASSERT(round(1048576.5) == 1048577.0);              /* 2**20 + 0.5 */
+    ASSERT(round(4503599627370495.5) == 4503599627370496.0);
     
     /* Test trunc */
     ASSERT(trunc(3.8) == 3.0);
@@ -280,6 +426,29 @@ void test_rounding_remainder() {
     ASSERT(long_long_equals_int(llrint(3.6), 4));
     ASSERT(long_long_equals_int(llrint(-3.4), -3));
     ASSERT(long_long_equals_int(llrint(-3.6), -4));
+    ASSERT(long_long_equals_int(llrint(2.5), 2));
+    ASSERT(long_long_equals_int(llround(2.5), 3));
+    ASSERT(long_long_equals_int(llround(-2.5), -3));
+    
+    /* Past 2**31 and up to the saturation points */
+    ll = llrint(1099511627776.5);                       /* 2**40 + 0.5 */
+    ASSERT(ll.hi == 0x100 && ll.lo == 0);
+    ll = llround(-4294967296.5);                        /* -(2**32 + 0.5) */
+    ASSERT(ll.hi == 0xFFFFFFFEUL && ll.lo == 0xFFFFFFFFUL);
+    ll = llround(51341414.5);
+    ASSERT(ll.hi == 0 && ll.lo == 51341415UL);
+    ll = llround(13116366442.35);
+    ASSERT(ll.hi == 3 && ll.lo == 0x0DCBDE6AUL);
+    ll = llrint(4503599627370497.0);                    /* 2**52 + 1 */
+    ASSERT(ll.hi == 0x100000 && ll.lo == 1);
+    ll = llrint(-9223372036854775808.0);                /* -2**63 */
+    ASSERT(ll.hi == 0x80000000UL && ll.lo == 0);
+    ll = llrint(1e19);
+    ASSERT(ll.hi == 0x7FFFFFFFUL && ll.lo == 0xFFFFFFFFUL);
+    ll = llround(-INFINITY);
+    ASSERT(ll.hi == 0x80000000UL && ll.lo == 0);
+    ll = llrint(NAN);
+    ASSERT(ll.hi == 0 && ll.lo == 0);
     
     /* Test fmod */
     ASSERT(double_approx_equal(fmod(5.0, 2.0), 1.0, 1e-10));
@@ -413,6 +582,39 @@ void test_classification_comparison() {
     ASSERT(fmax(2.0, 3.0) == 3.0);
     ASSERT(fmax(-3.0, -2.0) == -2.0);
     
+    /* Doubles below FLT_MIN are still normal */
+    ASSERT(fpclassify(1e-300) == FP_NORMAL);
+    ASSERT(fpclassify(DBL_MIN) == FP_NORMAL);
+    ASSERT(fpclassify(DBL_MIN / 4.0) == FP_SUBNORMAL);
+    ASSERT((fpclassify)(-DBL_MIN / 4.0) == FP_SUBNORMAL);
+    
+    /* The inline forms agree with the library functions */
+    {
+        static const double v[8] = {
+            0.0, 1.0, -2.5, 1e-310, 1e300, 1.0/0.0, -1.0/0.0, 0.0/0.0
+        };
+        double (*absf)(double) = fabs;
+        int i, j, ok = 1;
+        
+        for (i = 0; i < 8; i++) {
+            if (isnan(v[i]) != (isnan)(v[i])) ok = 0;
+            if (isinf(v[i]) != (isinf)(v[i])) ok = 0;
+            if (finite(v[i]) != (finite)(v[i])) ok = 0;
+            if (signbit(v[i]) != (signbit)(v[i])) ok = 0;
+            if (fpclassify(v[i]) != (fpclassify)(v[i])) ok = 0;
+            if (!isnan(v[i]) && fabs(v[i]) != absf(v[i])) ok = 0;
+            for (j = 0; j < 8; j++) {
+                if (isnan(v[i]) || isnan(v[j])) continue;
+                if (copysign(v[i], v[j]) != (copysign)(v[i], v[j])) ok = 0;
+                if (fmin(v[i], v[j]) != (fmin)(v[i], v[j])) ok = 0;
+                if (fmax(v[i], v[j]) != (fmax)(v[i], v[j])) ok = 0;
+            }
+        }
+        ASSERT(ok);
+        ASSERT(fmin(0.0/0.0, 2.0) == 2.0 && fmax(3.0, 0.0/0.0) == 3.0);
+        ASSERT(signbit(fmin(0.0, -0.0)) && !signbit(fmax(-0.0, 0.0)));
+    }
+    
     /* Test fdim */
     ASSERT(double_approx_equal(fdim(3.0, 2.0), 1.0, 1e-10));
     ASSERT(double_approx_equal(fdim(2.0, 3.0), 0.0, 1e-10));
@@ -486,6 +688,46 @@ void test_error_functions() {
     ASSERT(lgamma(3.0) > 0.0);
 }
 
+/* Test inverse error functions and the normal distribution */
+void test_normal_distribution() {
+    double v[3];
+    
+    printf("\n--- Testing Inverse Error Functions and Normal Distribution ---\n");
+    
+    /* Test ma_erfinv and ma_erfcinv */
+    ASSERT(ma_erfinv(0.0) == 0.0);
+    ASSERT(ma_erfinv(-0.0) == 0.0 && signbit(ma_erfinv(-0.0)) != 0);
+    ASSERT(double_approx_equal(ma_erfinv(0.5), 0.47693627620446987, 1e-15));
+    ASSERT(double_approx_equal(ma_erfinv(-0.999), -2.3267537655135246, 1e-14));
+    ASSERT(double_approx_equal(erf(ma_erfinv(0.3)), 0.3, 1e-15));
+    ASSERT(isinf(ma_erfinv(1.0)) && ma_erfinv(-1.0) < 0.0);
+    ASSERT(isnan(ma_erfinv(1.5)));
+    ASSERT(ma_erfcinv(1.0) == 0.0);
+    ASSERT(double_approx_equal(ma_erfcinv(1e-300) / 26.209469960516124, 1.0, 1e-14));
+    /* Subnormal arguments */
+    ASSERT(double_approx_equal(ma_erfcinv(ldexp(1.0, -1074)) / 27.213293210812949, 1.0, 1e-14));
+    ASSERT(double_approx_equal(ma_erfcinv(ldexp(3.0, -1070)) / 27.142121169875629, 1.0, 1e-14));
+    ASSERT(double_approx_equal(ma_erfcinv(1.5), -ma_erfcinv(0.5), 1e-15));
+    
+    /* Test ma_ndtri and ma_normcdf */
+    ASSERT(ma_ndtri(0.5) == 0.0);
+    ASSERT(double_approx_equal(ma_ndtri(0.975), 1.9599639845400540, 1e-14));
+    ASSERT(double_approx_equal(ma_ndtri(1e-10), -6.3613409024040557, 1e-14));
+    ASSERT(isinf(ma_ndtri(0.0)) && ma_ndtri(0.0) < 0.0);
+    ASSERT(double_approx_equal(ma_normcdf(0.0), 0.5, 1e-16));
+    ASSERT(double_approx_equal(ma_normcdf(-1.96), 0.024997895148220435, 1e-16));
+    ASSERT(double_approx_equal(ma_normcdf(-30.0) / 4.9067139271481872e-198, 1.0, 1e-14));
+    ASSERT(double_approx_equal(ma_ndtri(ma_normcdf(-30.0)), -30.0, 1e-13));
+    
+    /* Array forms, in place */
+    v[0] = 0.025; v[1] = 0.5; v[2] = 0.975;
+    ma_ndtri_v(v, v, 3);
+    ma_normcdf_v(v, v, 3);
+    ASSERT(double_approx_equal(v[0], 0.025, 1e-16));
+    ASSERT(double_approx_equal(v[1], 0.5, 1e-16));
+    ASSERT(double_approx_equal(v[2], 0.975, 1e-15));
+}
+
 /* Test Bessel functions */
 void test_bessel() {
     printf("\n--- Testing Bessel Functions ---\n");
@@ -504,9 +746,119 @@ void test_bessel() {
     ASSERT(y0(1.0) > 0.0);
     ASSERT(y0(2.0) > 0.0);
     
-    /* Test y1 */
-    ASSERT(y1(1.0) > 0.0);
-    ASSERT(y1(2.0) > 0.0);
+    /* Test y1 (Y1 is negative below its first zero at x ~ 2.197) */
+    ASSERT(y1(1.0) < 0.0);
+    ASSERT(y1(2.0) < 0.0);
+    
+    /* Reference values */
+    ASSERT(double_approx_equal(j0(1.0), 0.76519768655796655145, 1e-14));
+    ASSERT(double_approx_equal(y0(1.0), 0.08825696421567695798, 1e-14));
+    ASSERT(double_approx_equal(j1(1.0), 0.44005058574493351596, 1e-14));
+    ASSERT(double_approx_equal(y1(1.0), -0.78121282130028871655, 1e-14));
+    ASSERT(double_approx_equal(j0(10.0), -0.24593576445134833520, 1e-14));
+    ASSERT(double_approx_equal(y0(10.0), 0.05567116728359939142, 1e-14));
+    ASSERT(double_approx_equal(j1(10.0), 0.04347274616886143667, 1e-14));
+    ASSERT(double_approx_equal(y1(10.0), 0.24901542420695388392, 1e-14));
+    
+    /* Special values */
+    ASSERT(isinf(y0(0.0)) && y0(0.0) < 0.0);
+    ASSERT(isinf(y1(0.0)) && y1(0.0) < 0.0);
+    ASSERT(isnan(y0(-1.0)));
+    ASSERT(isnan(y1(-1.0)));
+}
+
+/* Test joint Bessel evaluation */
+void test_bessel_joint() {
+    double x, j, y;
+    int same;
+    
+    printf("\n--- Testing Joint Bessel Evaluation ---\n");
+    
+    /* ma_j0y0/ma_j1y1 must agree bit for bit with the single functions */
+    same = 1;
+    for (x = 0.001; x < 1000.0; x *= 1.37) {
+        ma_j0y0(x, &j, &y);
+        if (j != j0(x) || y != y0(x)) same = 0;
+        ma_j1y1(x, &j, &y);
+        if (j != j1(x) || y != y1(x)) same = 0;
+    }
+    ASSERT(same);
+    
+    ma_j0y0(0.0, &j, &y);
+    ASSERT(j == 1.0 && isinf(y) && y < 0.0);
+    ma_j1y1(0.0, &j, &y);
+    ASSERT(j == 0.0 && isinf(y) && y < 0.0);
+    ma_j0y0(-3.0, &j, &y);
+    ASSERT(j == j0(3.0) && isnan(y));
+    ma_j1y1(-3.0, &j, &y);
+    ASSERT(j == -j1(3.0) && isnan(y));
+}
+
+/* Test reentrant math context */
+void test_math_context() {
+    ma_ctx a, b, *old;
+    double r;
+    
+    printf("\n--- Testing Math Context ---\n");
+    
+    ma_ctx_init(&a);
+    ma_ctx_init(&b);
+    ASSERT(a.error == M99_ERR_NONE);
+    ASSERT(!ma_ctx_testexcept(&a, MA_FE_ALL_EXCEPT));
+    
+    /* Context-taking gamma keeps the sign in its own context */
+    r = ma_tgamma_r(&a, -0.5);
+    ASSERT(double_approx_equal(r, -3.5449077018110320, 1e-12));
+    ASSERT(a.signgam == -1);
+    r = ma_lgamma_r(&b, 0.5);
+    ASSERT(double_approx_equal(r, 0.57236494292470008, 1e-12));
+    ASSERT(b.signgam == 1);
+    ASSERT(a.signgam == -1);
+    
+    /* Errors are reported in the context that was passed */
+    r = ma_tgamma_r(&b, -2.0);
+    ASSERT(ma_ctx_testexcept(&b, MA_FE_INVALID));
+    ASSERT(b.error == M99_ERR_DOMAIN);
+    ASSERT(!ma_ctx_testexcept(&a, MA_FE_ALL_EXCEPT));
+    ma_ctx_clearexcept(&b, MA_FE_ALL_EXCEPT);
+    ASSERT(b.error == M99_ERR_NONE);
+    
+    /* Underflow and overflow raise different flags */
+    r = ma_tgamma_r(&b, -200.5);
+    ASSERT(r == 0.0);
+    ASSERT(ma_ctx_testexcept(&b, MA_FE_ALL_EXCEPT) == MA_FE_UNDERFLOW);
+    ma_ctx_clearexcept(&b, MA_FE_ALL_EXCEPT);
+    r = ma_tgamma_r(&b, 200.0);
+    ASSERT(ma_ctx_testexcept(&b, MA_FE_ALL_EXCEPT) == MA_FE_OVERFLOW);
+    ma_ctx_clearexcept(&b, MA_FE_ALL_EXCEPT);
+    
+    /* An installed context receives the calling task's state */
+    ASSERT(ma_ctx_install(&a, &old));
+    ASSERT(ma_ctx_current() == &a);
+    r = sqrt(-1.0);
+    ASSERT(ma_ctx_testexcept(&a, MA_FE_INVALID));
+    ASSERT(errno == EDOM);
+    r = lgamma(-0.5);
+    ASSERT(a.signgam == -1);
+    ASSERT(signgam == -1);
+    
+#ifndef MA_NO_TRIG_MEMO
+    /* The memo is off until the context asks for it */
+    r = sin(100.0);
+    ASSERT(a.pio2_misses == 0 && a.pio2_hits == 0);
+    
+    /* Then the installed context memoizes the last trig reduction */
+    a.pio2_memo = 1;
+    r = sin(100.0);
+    ASSERT(a.pio2_misses == 1 && a.pio2_hits == 0);
+    ASSERT(double_approx_equal(cos(100.0), 0.86231887228768389, 1e-15));
+    ASSERT(double_approx_equal(tan(100.0), -0.58721391515692908, 1e-15));
+    ASSERT(a.pio2_misses == 1 && a.pio2_hits == 2);
+    r = sin(0.5);
+    ASSERT(a.pio2_misses == 1 && a.pio2_hits == 2);
+#endif
+    ASSERT(ma_ctx_install(old, NULL));
+    ASSERT(ma_ctx_current() != &a);
 }
 
 /* Test mathematical constants */
@@ -563,6 +915,717 @@ void test_float_variants() {
     ASSERT(trunc(3.8) == 3.0);
 }
 
+/* Test fixed-point arithmetic and functions */
+void test_fixed_point() {
+    ma_q16 s, c;
+    
+    printf("\n--- Testing Fixed-Point Functions ---\n");
+    
+    /* Conversions and arithmetic round to nearest and saturate */
+    ASSERT(ma_q16_from_double(1.5) == 0x00018000L);
+    ASSERT(ma_q16_from_double(1e6) == MA_Q16_MAX);
+    ASSERT(ma_q30_to_double(MA_Q30_HALF) == 0.5);
+    ASSERT(ma_q16_mul(MA_Q16_FROM_INT(3), -MA_Q16_HALF) == -0x00018000L);
+    ASSERT(ma_q16_mul(MA_Q16_FROM_INT(300), MA_Q16_FROM_INT(300)) == MA_Q16_MAX);
+    ASSERT(ma_q16_div(MA_Q16_ONE, MA_Q16_FROM_INT(3)) == 21845L);
+    ASSERT(ma_q16_div(-MA_Q16_ONE, 0) == MA_Q16_MIN);
+    ASSERT(ma_q30_mul(MA_Q30_HALF, MA_Q30_HALF) == MA_Q30_ONE / 4);
+    
+    /* Square root is correctly rounded */
+    ASSERT(ma_q16_sqrt(MA_Q16_FROM_INT(4)) == MA_Q16_FROM_INT(2));
+    ASSERT(ma_q16_sqrt(MA_Q16_FROM_INT(2)) == ma_q16_from_double(sqrt(2.0)));
+    ASSERT(ma_q30_sqrt(MA_Q30_HALF) == ma_q30_from_double(sqrt(0.5)));
+    
+    /* CORDIC trigonometry against the double functions */
+    ma_q16_sincos(ma_q16_from_double(0.5), &s, &c);
+    ASSERT(labs(s - ma_q16_from_double(sin(0.5))) <= 1);
+    ASSERT(labs(c - ma_q16_from_double(cos(0.5))) <= 1);
+    ASSERT(labs(ma_q16_sin(MA_Q16_FROM_INT(1000)) - ma_q16_from_double(sin(1000.0))) <= 1);
+    ASSERT(labs(ma_q16_atan2(-MA_Q16_ONE, -MA_Q16_ONE) - ma_q16_from_double(-0.75 * M_PI)) <= 1);
+    ASSERT(ma_q16_hypot(MA_Q16_FROM_INT(3), MA_Q16_FROM_INT(4)) == MA_Q16_FROM_INT(5));
+    
+    /* Half-turn angles reduce exactly */
+    ASSERT(ma_q30_sinpi(MA_Q30_ONE) == 0);
+    ASSERT(ma_q30_cospi(-MA_Q30_ONE) == -MA_Q30_ONE);
+    ASSERT(labs(ma_q30_sinpi(MA_Q30_ONE / 6) - MA_Q30_HALF) <= 8);
+    ASSERT(labs(ma_q30_atan2pi(MA_Q30_HALF, MA_Q30_HALF) - MA_Q30_ONE / 4) <= 4);
+    
+    /* Exponential and logarithm */
+    ASSERT(ma_q16_exp2(MA_Q16_FROM_INT(3)) == MA_Q16_FROM_INT(8));
+    ASSERT(ma_q16_exp2(MA_Q16_FROM_INT(-2)) == MA_Q16_ONE / 4);
+    ASSERT(labs(ma_q16_exp2(MA_Q16_HALF) - ma_q16_from_double(sqrt(2.0))) <= 1);
+    ASSERT(ma_q16_exp2(MA_Q16_FROM_INT(20)) == MA_Q16_MAX);
+    ASSERT(ma_q16_log2(MA_Q16_FROM_INT(8)) == MA_Q16_FROM_INT(3));
+    ASSERT(labs(ma_q16_log2(MA_Q16_FROM_INT(10)) - ma_q16_from_double(log(10.0) / log(2.0))) <= 1);
+    ASSERT(ma_q16_log2(0) == MA_Q16_MIN);
+    ASSERT(labs(ma_q30_log2(MA_Q30_HALF + MA_Q30_ONE / 4) - ma_q30_from_double(log(0.75) / log(2.0))) <= 3);
+}
+
+/* Test FFP conversions and software FFP arithmetic */
+void test_ffp() {
+    float v[3];
+    double d[3];
+    ma_ffp f[3];
+    ma_ffp third;
+    
+    printf("\n--- Testing FFP Conversion and Arithmetic ---\n");
+    
+    /* Conversions are exact in range and saturate outside it */
+    ASSERT(ma_ffp_from_float(1.0f) == MA_FFP_ONE);
+    ASSERT(ma_ffp_to_double(MA_FFP_ONE) == 1.0);
+    ASSERT(ma_ffp_to_float(ma_ffp_from_float(-0.15625f)) == -0.15625f);
+    ASSERT(ma_ffp_from_double(1e30) == MA_FFP_MAX);
+    ASSERT(ma_ffp_from_double(-1e30) == (MA_FFP_MAX | 0x80));
+    ASSERT(ma_ffp_from_double(1e-30) == MA_FFP_ZERO);
+    ASSERT(ma_ffp_from_double(0.1) == ma_ffp_from_float(0.1f));
+    
+    /* Bulk conversions, in place for singles */
+    v[0] = 1.5f; v[1] = -2.0f; v[2] = 0.0f;
+    ma_ieee_to_ffp_v((ma_ffp *)v, v, 3);
+    ASSERT(((ma_ffp *)v)[0] == 0xC0000041UL);
+    ma_ffp_to_ieee_v(v, (ma_ffp *)v, 3);
+    ASSERT(v[0] == 1.5f && v[1] == -2.0f && v[2] == 0.0f);
+    d[0] = 3.0; d[1] = -0.5; d[2] = 1e-3;
+    ma_ieeedp_to_ffp_v(f, d, 3);
+    ma_ffp_to_ieeedp_v(d, f, 3);
+    ASSERT(d[0] == 3.0 && d[1] == -0.5 && d[2] == (double)1e-3f);
+    
+    /* Arithmetic rounds like IEEE single precision */
+    third = ma_ffp_div(MA_FFP_ONE, ma_ffp_from_float(3.0f));
+    ASSERT(ma_ffp_to_float(third) == 1.0f / 3.0f);
+    ASSERT(ma_ffp_add(MA_FFP_ONE, MA_FFP_ONE) == ma_ffp_from_float(2.0f));
+    ASSERT(ma_ffp_sub(MA_FFP_ONE, MA_FFP_ONE) == MA_FFP_ZERO);
+    ASSERT(ma_ffp_mul(third, ma_ffp_from_float(3.0f)) == MA_FFP_ONE);
+    ASSERT(ma_ffp_add(ma_ffp_from_float(1e8f), MA_FFP_ONE) == ma_ffp_from_float(1e8f));
+    ASSERT(ma_ffp_mul(MA_FFP_MAX, MA_FFP_MAX) == MA_FFP_MAX);
+    ASSERT(ma_ffp_div(MA_FFP_ONE, MA_FFP_ZERO) == MA_FFP_MAX);
+    
+    /* Comparison */
+    ASSERT(ma_ffp_cmp(ma_ffp_neg(MA_FFP_ONE), third) < 0);
+    ASSERT(ma_ffp_cmp(MA_FFP_MAX, MA_FFP_ONE) > 0);
+    ASSERT(ma_ffp_cmp(MA_FFP_ZERO, ma_ffp_neg(MA_FFP_ZERO)) == 0);
+}
+
+/* Test exact summation */
+void test_summation() {
+    double v[6];
+    double tiny[3];
+    ma_sumacc a, b;
+    int i;
+    
+    printf("\n--- Testing Exact Summation ---\n");
+    
+    /* Cancellation that a plain loop gets wrong */
+    v[0] = 1e100; v[1] = 1.0; v[2] = -1e100;
+    v[3] = 1e-100; v[4] = 3.0; v[5] = -1e-100;
+    ASSERT(ma_fsum(v, 6) == 4.0);
+    ASSERT(ma_fsum(v, 0) == 0.0);
+    
+    /* Correct rounding of a tie broken by a tiny term */
+    tiny[0] = 1.0; tiny[1] = ldexp(1.0, -53); tiny[2] = ldexp(1.0, -100);
+    ASSERT(ma_fsum(tiny, 3) == 1.0 + ldexp(1.0, -52));
+    ASSERT(ma_fsum(tiny, 2) == 1.0);
+    
+    /* Intermediate overflow is not an error */
+    tiny[0] = DBL_MAX; tiny[1] = DBL_MAX; tiny[2] = -DBL_MAX;
+    ASSERT(ma_fsum(tiny, 3) == DBL_MAX);
+    
+    /* The accumulator agrees, in any order and split any way */
+    ma_sumacc_init(&a);
+    ma_sumacc_addv(&a, v, 6);
+    ASSERT(ma_sumacc_result(&a) == 4.0);
+    ma_sumacc_init(&a);
+    ma_sumacc_init(&b);
+    for (i = 5; i >= 0; i--) {
+        ma_sumacc_add((i & 1) ? &a : &b, v[i]);
+    }
+    ma_sumacc_merge(&a, &b);
+    ASSERT(ma_sumacc_result(&a) == 4.0);
+    ma_sumacc_add(&a, -5.0);
+    ASSERT(ma_sumacc_result(&a) == -1.0);
+    ma_sumacc_init(&a);
+    ma_sumacc_add(&a, ldexp(1.0, -1074));
+    ma_sumacc_add(&a, ldexp(1.0, -1074));
+    ASSERT(ma_sumacc_result(&a) == ldexp(1.0, -1073));
+    ma_sumacc_add(&a, INFINITY);
+    ASSERT(isinf(ma_sumacc_result(&a)));
+}
+
+void test_reductions() {
+    double v[7], lo, hi, s, ssq;
+    float f[5];
+    
+    printf("\n--- Testing Array Reductions ---\n");
+    
+    /* NaNs are skipped, as by fmin() and fmax() */
+    v[0] = NAN; v[1] = 3.0; v[2] = -2.0; v[3] = NAN;
+    v[4] = 7.0; v[5] = -2.0; v[6] = 1.0;
+    ASSERT(ma_vmin(v, 7) == -2.0);
+    ASSERT(ma_vmax(v, 7) == 7.0);
+    ASSERT(ma_vargmin(v, 7) == 2);
+    ASSERT(ma_vargmax(v, 7) == 4);
+    ma_vminmax(v, 7, &lo, &hi);
+    ASSERT(lo == -2.0 && hi == 7.0);
+    ma_vminmax(v, 4, &lo, &hi);
+    ASSERT(lo == -2.0 && hi == 3.0);
+    ASSERT(isnan(ma_vmin(v, 1)));
+    ASSERT(ma_vargmax(v, 1) == -1);
+    ASSERT(isnan(ma_vmax(v, 0)));
+    
+    f[0] = 2.5f; f[1] = NAN; f[2] = -1.5f; f[3] = 4.0f; f[4] = -1.5f;
+    ASSERT(ma_vminf(f, 5) == -1.5f);
+    ASSERT(ma_vmaxf(f, 5) == 4.0f);
+    ASSERT(ma_vargminf(f, 5) == 2);
+    
+    /* Dot products and sums of squares */
+    v[0] = 1.0; v[1] = 2.0; v[2] = 3.0; v[3] = 4.0; v[4] = 5.0;
+    ASSERT(ma_vdot(v, v, 5) == 55.0);
+    ASSERT(ma_vsumsq(v, 5, NULL) == 55.0);
+    f[0] = 3.0f; f[1] = 4.0f;
+    ASSERT(ma_vsumsqf(f, 2) == 25.0);
+    ASSERT(ma_vdotf(f, f, 2) == 25.0);
+    
+    /* Squares beyond the range of double keep their scale */
+    v[0] = 3e200; v[1] = 4e200;
+    ssq = ma_vsumsq(v, 2, &s);
+    ASSERT(double_approx_equal(s*sqrt(ssq)/5e200, 1.0, 1e-15));
+    v[0] = 3e-200; v[1] = 4e-200;
+    ssq = ma_vsumsq(v, 2, &s);
+    ASSERT(double_approx_equal(s*sqrt(ssq)/5e-200, 1.0, 1e-15));
+    v[2] = INFINITY;
+    ASSERT(isinf(ma_vsumsq(v, 3, NULL)));
+}
+
+void test_norms() {
+    double x[4], y[4], r[4];
+    complex_t z[2];
+    
+    printf("\n--- Testing Euclidean Norms ---\n");
+    
+    /* hypot() across the exponent range: exact where 5 is */
+    ASSERT(hypot(ldexp(3.0, 1000), ldexp(4.0, 1000)) == ldexp(5.0, 1000));
+    ASSERT(hypot(ldexp(3.0, -1000), ldexp(4.0, -1000)) == ldexp(5.0, -1000));
+    ASSERT(double_approx_equal(hypot(3e300, 4e300)/5e300, 1.0, 1e-15));
+    ASSERT(double_approx_equal(hypot(3e-300, 4e-300)/5e-300, 1.0, 1e-15));
+    ASSERT(hypot(ldexp(3.0, -1074), ldexp(4.0, -1074)) == ldexp(5.0, -1074));
+    ASSERT(isinf(hypot(INFINITY, NAN)));
+    ASSERT(isnan(hypot(NAN, 1.0)));
+    ASSERT(isinf(hypot(DBL_MAX, DBL_MAX)));
+    
+    /* Three components */
+    ASSERT(ma_hypot3(1.0, 2.0, 2.0) == 3.0);
+    ASSERT(ma_hypot3(ldexp(2.0, 1000), -ldexp(1.0, 1000), ldexp(2.0, 1000)) == ldexp(3.0, 1000));
+    ASSERT(ma_hypot3(ldexp(2.0, -1060), ldexp(1.0, -1060), ldexp(2.0, -1060)) == ldexp(3.0, -1060));
+    ASSERT(double_approx_equal(ma_hypot3(2e300, -1e300, 2e300)/3e300, 1.0, 1e-15));
+    ASSERT(ma_hypot3(0.0, -0.0, 0.0) == 0.0);
+    ASSERT(isinf(ma_hypot3(NAN, 1.0, -INFINITY)));
+    ASSERT(isnan(ma_hypot3(1.0, NAN, 2.0)));
+    
+    /* Array forms */
+    x[0] = 3.0; x[1] = ldexp(5.0, 900); x[2] = 0.0; x[3] = ldexp(8.0, -1060);
+    y[0] = 4.0; y[1] = ldexp(12.0, 900); y[2] = -2.0; y[3] = ldexp(15.0, -1060);
+    ma_hypot_v(r, x, y, 4);
+    ASSERT(r[0] == 5.0 && r[1] == ldexp(13.0, 900));
+    ASSERT(r[2] == 2.0 && r[3] == ldexp(17.0, -1060));
+    z[0].re = 3.0; z[0].im = -4.0;
+    z[1].re = 1e300; z[1].im = 1e300;
+    ma_cabs_v(r, z, 2);
+    ASSERT(r[0] == 5.0 && r[1] == hypot(1e300, 1e300));
+    
+    /* Norms of arrays whose squares overflow or underflow */
+    x[0] = 1e300; x[1] = 1e300; x[2] = 1e300; x[3] = 1e300;
+    ASSERT(double_approx_equal(ma_vnorm(x, 4)/2e300, 1.0, 1e-15));
+    x[0] = 1e-300; x[1] = 1e-300; x[2] = 1e-300; x[3] = 1e-300;
+    ASSERT(double_approx_equal(ma_vnorm(x, 4)/2e-300, 1.0, 1e-15));
+    x[0] = 1e300; x[1] = 1e-300; x[2] = 3.0; x[3] = 4.0;
+    ASSERT(ma_vnorm(x, 4) == 1e300);
+    ASSERT(ma_vnorm(x+2, 2) == 5.0);
+}
+
+void test_conversion() {
+    char buf[MA_DTOA_BUFSIZE];
+    char *end;
+    double x;
+    int e, i;
+    
+    printf("\n--- Testing Decimal Conversion ---\n");
+    
+    /* Shortest digits that read back exactly */
+    ma_dtoa(0.1, buf);
+    ASSERT(strcmp(buf, "0.1") == 0);
+    ma_dtoa(0.1+0.2, buf);
+    ASSERT(strcmp(buf, "0.30000000000000004") == 0);
+    ma_dtoa(-2.5e-7, buf);
+    ASSERT(strcmp(buf, "-2.5e-07") == 0);
+    ma_dtoa(1e23, buf);
+    ASSERT(strcmp(buf, "1e+23") == 0);
+    ma_dtoa(123456.0, buf);
+    ASSERT(strcmp(buf, "123456") == 0);
+    ma_dtoa(ldexp(1.0, -1074), buf);
+    ASSERT(strcmp(buf, "5e-324") == 0);
+    ma_dtoa(DBL_MAX, buf);
+    ASSERT(strcmp(buf, "1.7976931348623157e+308") == 0);
+    ma_dtoa(-INFINITY, buf);
+    ASSERT(strcmp(buf, "-inf") == 0);
+    ASSERT(ma_dtoa_digits(-1250.0, buf, &e) == 3 && strcmp(buf, "125") == 0 && e == 1);
+    
+    /* Hexadecimal */
+    ma_dtoa_hex(0.1, buf);
+    ASSERT(strcmp(buf, "0x1.999999999999ap-4") == 0);
+    ma_dtoa_hex(ldexp(1.0, -1074), buf);
+    ASSERT(strcmp(buf, "0x0.0000000000001p-1022") == 0);
+    
+    /* Correct rounding, including halfway and long inputs */
+    ASSERT(ma_strtod("9007199254740993", NULL) == 9007199254740992.0);
+    ASSERT(ma_strtod("9007199254740993.000000000000000000001", NULL) == 9007199254740994.0);
+    ASSERT(ma_strtod("2.4703282292062328e-324", NULL) == ldexp(1.0, -1074));
+    ASSERT(ma_strtod("2.4703282292062327e-324", NULL) == 0.0);
+    ASSERT(ma_strtod("0x1.8p1", NULL) == 3.0);
+    ASSERT(ma_strtod("-0X.8P-1", NULL) == -0.25);
+    ASSERT(ma_strtod("  1.5e3x", &end) == 1500.0 && *end == 'x');
+    ASSERT(ma_strtod(".e1", &end) == 0.0 && *end == '.');
+    ASSERT(isnan(ma_strtod("nan(1)", NULL)));
+    
+    /* Overflow and underflow set ERANGE */
+    errno = 0;
+    ASSERT(isinf(ma_strtod("1e309", NULL)) && errno == ERANGE);
+    errno = 0;
+    ASSERT(ma_strtod("1e-400", NULL) == 0.0 && errno == ERANGE);
+    
+    /* Round trips */
+    x = 1.0/3.0;
+    for (i = 0; i < 40; i++) {
+        ma_dtoa(x, buf);
+        ASSERT(ma_strtod(buf, NULL) == x);
+        ma_dtoa_hex(x, buf);
+        ASSERT(ma_strtod(buf, NULL) == x);
+        x *= -1234.5678e-3;
+        x = ldexp(x, 47*(i & 1 ? 1 : -1)+i);
+    }
+}
+
+void test_long_long_text() {
+    char buf[LONG_LONG_BUFSIZE];
+    char *end;
+    long_long_t v;
+    unsigned_long_long_t u;
+    
+    printf("\n--- Testing 64-bit Integer Text ---\n");
+    
+    /* Parsing, in blocks of digits */
+    u = strtoull("18446744073709551615", &end, 10);
+    ASSERT(u.hi == 0xFFFFFFFF && u.lo == 0xFFFFFFFF && *end == '\0');
+    errno = 0;
+    u = strtoull("18446744073709551616", NULL, 10);
+    ASSERT(u.hi == 0xFFFFFFFF && u.lo == 0xFFFFFFFF && errno == ERANGE);
+    u = strtoull("0x123456789abcdef0", NULL, 0);
+    ASSERT(u.hi == 0x12345678 && u.lo == 0x9ABCDEF0);
+    u = strtoull("-1", NULL, 10);
+    ASSERT(u.hi == 0xFFFFFFFF && u.lo == 0xFFFFFFFF);
+    v = strtoll("  -9223372036854775808x", &end, 10);
+    ASSERT(v.hi == 0x80000000 && v.lo == 0 && *end == 'x');
+    errno = 0;
+    v = strtoll("9223372036854775808", NULL, 10);
+    ASSERT(v.hi == 0x7FFFFFFF && v.lo == 0xFFFFFFFF && errno == ERANGE);
+    v = strtoll("0777", NULL, 0);
+    ASSERT(long_long_equals_int(v, 511));
+    v = strtoll("0x", &end, 0);
+    ASSERT(long_long_equals_int(v, 0) && *end == 'x');
+    v = strtoll("zz", &end, 10);
+    ASSERT(long_long_equals_int(v, 0) && *end == 'z');
+    ASSERT(long_long_equals_int(atoll("-123456789"), -123456789));
+    
+    /* Formatting */
+    u.hi = 0xFFFFFFFF; u.lo = 0xFFFFFFFF;
+    ulltoa(u, buf, 10);
+    ASSERT(strcmp(buf, "18446744073709551615") == 0);
+    ulltoa(u, buf, 2);
+    ASSERT(strlen(buf) == 64);
+    ulltoa(u, buf, 36);
+    ASSERT(strcmp(buf, "3w5e11264sgsf") == 0);
+    u.hi = 0; u.lo = 0;
+    ulltoa(u, buf, 16);
+    ASSERT(strcmp(buf, "0") == 0);
+    v = get_long_long_min();
+    lltoa(v, buf, 10);
+    ASSERT(strcmp(buf, "-9223372036854775808") == 0);
+    lltoa(v, buf, 16);
+    ASSERT(strcmp(buf, "8000000000000000") == 0);
+    lltoa(long_to_long_long(-42), buf, 10);
+    ASSERT(strcmp(buf, "-42") == 0);
+    ASSERT(lltoa(v, buf, 1) == NULL);
+}
+
+void test_dividers() {
+    ma_lldivider sd;
+    ma_ulldivider ud;
+    ma_ldivider ld;
+    ma_uldivider uld;
+    long_long_t x, q, r, want;
+    unsigned_long_long_t ux, uq;
+    long i;
+    
+    printf("\n--- Testing Invariant Integer Division ---\n");
+    
+    /* 32-bit, against the C operators */
+    ma_uldiv_init(&uld, 7);
+    ASSERT(ma_uldiv_apply(&uld, 0xFFFFFFFFUL) == 0xFFFFFFFFUL / 7);
+    ma_uldiv_init(&uld, 641);
+    ASSERT(ma_uldiv_apply(&uld, 4294967295UL) == 6700416UL);
+    ma_ldiv_init(&ld, -10);
+    ASSERT(ma_ldiv_apply(&ld, 123456789L) == -12345678L);
+    ASSERT(ma_ldiv_apply(&ld, -123456789L) == 12345678L);
+    ma_ldiv_init(&ld, 16);
+    ASSERT(ma_ldiv_apply(&ld, -33L) == -2L);
+    for (i = -1000; i <= 1000; i += 7) {
+        ma_ldiv_init(&ld, 3);
+        ASSERT(ma_ldiv_apply(&ld, i*12345L) == i*12345L / 3);
+    }
+    errno = 0;
+    ASSERT(ma_uldiv_init(&uld, 0) == 0 && errno == EDOM);
+    
+    /* 64-bit, against long_long_divmod() */
+    ma_lldiv_init(&sd, long_to_long_long(-1000003));
+    x = strtoll("-9223372036854775807", NULL, 10);
+    for (i = 0; i < 64; i++) {
+        q = ma_lldiv_apply(&sd, x);
+        long_long_divmod(x, long_to_long_long(-1000003), &want, &r);
+        ASSERT(long_long_eq(q, want));
+        x = long_long_add(long_long_sar(x, 1), long_to_long_long(i*977));
+    }
+    ma_ulldiv_init(&ud, strtoull("10000000000000000000", NULL, 10));
+    ux = strtoull("18446744073709551615", NULL, 10);
+    uq = ma_ulldiv_apply(&ud, ux);
+    ASSERT(uq.hi == 0 && uq.lo == 1);
+    ma_ulldiv_init(&ud, strtoull("1000000007", NULL, 10));
+    uq = ma_ulldiv_apply(&ud, ux);
+    ASSERT(uq.hi == 0x00000004 && uq.lo == 0x4B82F988);
+    
+    /* LONG_LONG_MIN, as long_long_div() treats it */
+    ma_lldiv_init(&sd, long_to_long_long(-1));
+    errno = 0;
+    q = ma_lldiv_apply(&sd, get_long_long_min());
+    ASSERT(long_long_eq(q, get_long_long_max()) && errno == ERANGE);
+    ma_lldiv_init(&sd, get_long_long_min());
+    ASSERT(long_long_equals_int(ma_lldiv_apply(&sd, get_long_long_min()), 1));
+    q = long_long_div(get_long_long_min(), long_to_long_long(2));
+    ASSERT(q.hi == 0xC0000000 && q.lo == 0);
+}
+
+void test_bits() {
+    unsigned_long_long_t x, y;
+    double d;
+    float_complex zf;
+    
+    printf("\n--- Testing Bit Manipulation ---\n");
+    
+    ASSERT(ma_clz32(0) == 32 && ma_clz32(1) == 31);
+    ASSERT(ma_clz32(0x00012345UL) == 15 && ma_clz32(0x80000000UL) == 0);
+    ASSERT(ma_ctz32(0) == 32 && ma_ctz32(0x00012340UL) == 6);
+    ASSERT(ma_ctz32(0x80000000UL) == 31);
+    x.hi = 0; x.lo = 0x100;
+    ASSERT(ma_clz64(x) == 55 && ma_ctz64(x) == 8);
+    x.hi = 0x10; x.lo = 0;
+    ASSERT(ma_clz64(x) == 27 && ma_ctz64(x) == 36);
+    ASSERT(long_long_clz(long_to_long_long(1)) == 63);
+    ASSERT(long_long_ctz(long_to_long_long(0)) == 64);
+    ASSERT(long_long_popcount(long_to_long_long(-1)) == 64);
+    
+    ASSERT(ma_popcount32(0xF0F0UL) == 8 && ma_popcount32(0xFFFFFFFFUL) == 32);
+    ASSERT(ma_parity32(0x7UL) == 1 && ma_parity32(0x80000001UL) == 0);
+    x.hi = 0x80000000UL; x.lo = 0x00000007UL;
+    ASSERT(ma_popcount64(x) == 4 && ma_parity64(x) == 0);
+    
+    ASSERT(ma_bswap32(0x11223344UL) == 0x44332211UL);
+    y = ma_bswap64(x);
+    ASSERT(y.hi == 0x07000000UL && y.lo == 0x00000080UL);
+    ASSERT(ma_rotl32(0x80000001UL, 4) == 0x00000018UL);
+    ASSERT(ma_rotr32(0x80000001UL, 4) == 0x18000000UL);
+    ASSERT(ma_rotl32(0x12345678UL, 32) == 0x12345678UL);
+    y = ma_rotl64(x, 36);
+    ASSERT(y.hi == 0x00000078UL && y.lo == 0x00000000UL);
+    y = ma_rotr64(y, 36);
+    ASSERT(y.hi == x.hi && y.lo == x.lo);
+    ASSERT(ma_bitrev32(0x00000001UL) == 0x80000000UL);
+    ASSERT(ma_bitrev32(0x12345678UL) == 0x1E6A2C48UL);
+    y = ma_bitrev64(x);
+    ASSERT(y.hi == 0xE0000000UL && y.lo == 0x00000001UL);
+    
+    /* Subnormal normalisation in the kernels */
+    d = ldexp(1.0, -1074);
+    ASSERT(ilogb(d) == -1074);
+    ASSERT(ilogb(ldexp(1.0, -1040)) == -1040);
+    ASSERT(ilogbf(scalbnf(1.0f, -127)) == -127);
+    ASSERT(ilogbf(scalbnf(1.0f, -149)) == -149);
+    ASSERT(sqrt(d) == ldexp(1.0, -537));
+    zf.re = scalbnf(1.0f, -148); zf.im = 0.0f;
+    zf = csqrtf(zf);                                    /* __kernel_sqrtf() */
+    ASSERT(zf.re == scalbnf(1.0f, -74) && zf.im == 0.0f);
+    ASSERT(fmod(ldexp(3.0, -1070), ldexp(1.0, -1073)) == 0.0);
+    ASSERT(fmod(1.0, ldexp(3.0, -1074)) == ldexp(1.0, -1074));
+}
+
+void test_intmath() {
+    unsigned_long_long_t x, y, m, r;
+    unsigned long i, p;
+    int ok;
+    
+    printf("\n--- Testing Integer Math ---\n");
+    
+    /* Every square and cube boundary in 32 bits */
+    ok = 1;
+    for (i = 1; i < 65536; i++) {
+        p = i*i;
+        if (ma_isqrt32(p) != i || ma_isqrt32(p-1) != i-1) ok = 0;
+    }
+    for (i = 1; i < 1626; i++) {
+        p = i*i*i;
+        if (ma_icbrt32(p) != i || ma_icbrt32(p-1) != i-1) ok = 0;
+    }
+    ASSERT(ok);
+    ASSERT(ma_isqrt32(0) == 0 && ma_isqrt32(0xFFFFFFFFUL) == 65535);
+    ASSERT(ma_icbrt32(0) == 0 && ma_icbrt32(0xFFFFFFFFUL) == 1625);
+    
+    /* 64-bit, around squares and cubes */
+    ok = 1;
+    for (i = 1; i < 65536; i += 37) {          /* (2**32-i)**2 */
+        x.hi = 0UL - 2*i;
+        x.lo = i*i;
+        if (ma_isqrt64(x) != 0UL-i) ok = 0;
+        x.lo -= 1;
+        if (ma_isqrt64(x) != 0UL-i-1) ok = 0;
+    }
+    ASSERT(ok);
+    x = strtoull("18446744073709551615", NULL, 10);
+    ASSERT(ma_isqrt64(x) == 0xFFFFFFFFUL && ma_icbrt64(x) == 2642245UL);
+    x = strtoull("18446724184312856125", NULL, 10);    /* 2642245**3 */
+    ASSERT(ma_icbrt64(x) == 2642245UL);
+    x.lo -= 1;
+    ASSERT(ma_icbrt64(x) == 2642244UL);
+    x = strtoull("9007199254740993", NULL, 10);        /* 2**53+1 */
+    ASSERT(ma_isqrt64(x) == 94906265UL);
+    
+    /* Logarithms, exact at every power of 10 */
+    ASSERT(ma_ilog2_32(0) == -1 && ma_ilog2_32(1) == 0);
+    ASSERT(ma_ilog2_32(0x80000000UL) == 31);
+    ok = 1;
+    for (i = 1, p = 0; i <= 9; i++) {
+        p = p ? p*10 : 10;
+        if (ma_ilog10_32(p) != (int)i || ma_ilog10_32(p-1) != (int)i-1) ok = 0;
+    }
+    ASSERT(ok);
+    ASSERT(ma_ilog10_32(0) == -1 && ma_ilog10_32(0xFFFFFFFFUL) == 9);
+    x = strtoull("10000000000000000000", NULL, 10);
+    ASSERT(ma_ilog10_64(x) == 19 && ma_ilog2_64(x) == 63);
+    x = strtoull("9999999999999999999", NULL, 10);
+    ASSERT(ma_ilog10_64(x) == 18);
+    x = strtoull("10000000000", NULL, 10);
+    ASSERT(ma_ilog10_64(x) == 10);
+    
+    /* gcd and lcm */
+    ASSERT(ma_gcd32(1071UL, 462UL) == 21 && ma_gcd32(0, 5) == 5);
+    ASSERT(ma_lcm32(4UL, 6UL) == 12 && ma_lcm32(0, 6UL) == 0);
+    errno = 0;
+    ASSERT(ma_lcm32(0xFFFFFFFFUL, 0xFFFFFFFEUL) == 0 && errno == ERANGE);
+    x.hi = 0x1500; x.lo = 0;                    /* 2**40*3*7 */
+    y.hi = 0x268; y.lo = 0;                     /* 2**35*7*11 */
+    r = ma_gcd64(x, y);
+    ASSERT(r.hi == 0x38 && r.lo == 0);
+    x.hi = 0x300; x.lo = 0;                     /* 2**40*3 */
+    y.hi = 0; y.lo = 0x500000;                  /* 2**20*5 */
+    r = ma_lcm64(x, y);
+    ASSERT(r.hi == 0xF00 && r.lo == 0);
+    
+    /* Modular arithmetic */
+    ASSERT(ma_mulmod32(0xFFFFFFFFUL, 0xFFFFFFFFUL, 0xFFFFFFFBUL) == 16);
+    ASSERT(ma_powmod32(2UL, 1000000UL, 1000000007UL) == 235042059UL);
+    ASSERT(ma_powmod32(5UL, 0, 1UL) == 0);
+    errno = 0;
+    ASSERT(ma_mulmod32(3, 4, 0) == 0 && errno == EDOM);
+    m = strtoull("18446744073709551557", NULL, 10);     /* prime 2**64-59 */
+    x.hi = 0x12345678UL; x.lo = 0x9ABCDEF0UL;
+    y.hi = 0xFEDCBA98UL; y.lo = 0x76543210UL;
+    r = ma_mulmod64(x, y, m);
+    ASSERT(r.hi == 0x50B76B7EUL && r.lo == 0x000293C2UL);
+    y = m;
+    y.lo -= 1;
+    r = ma_powmod64(x, y, m);                           /* Fermat */
+    ASSERT(r.hi == 0 && r.lo == 1);
+}
+
+void test_mpn() {
+    static unsigned long a[100], b[40], r1[140], r2[140], q[140];
+    static unsigned long tmp[MA_MPN_MUL_TMP(40)];
+    unsigned_long_long_t x, hi, lo;
+    long_long_t s, t, p;
+    unsigned long seed, c;
+    int i, ok;
+    
+    printf("\n--- Testing Multi-Precision Core ---\n");
+    
+    /* Carries and borrows through every limb */
+    for (i = 0; i < 8; i++) a[i] = 0xFFFFFFFFUL;
+    b[0] = 1;
+    c = ma_mpn_add(r1, a, 8, b, 1);
+    ok = (c == 1);
+    for (i = 0; i < 8; i++) if (r1[i] != 0) ok = 0;
+    c = ma_mpn_sub(r1, r1, 8, b, 1);
+    ASSERT(ok && c == 1 && ma_mpn_cmp(r1, a, 8) == 0);
+    
+    /* (B**40-1)**2 = B**80 - 2*B**40 + 1, through Karatsuba */
+    for (i = 0; i < 40; i++) b[i] = 0xFFFFFFFFUL;
+    ma_mpn_mul(r1, b, 40, b, 40, tmp);
+    ok = (r1[0] == 1 && r1[40] == 0xFFFFFFFEUL);
+    for (i = 1; i < 40; i++) if (r1[i] != 0) ok = 0;
+    for (i = 41; i < 80; i++) if (r1[i] != 0xFFFFFFFFUL) ok = 0;
+    ASSERT(ok);
+    
+    /* Karatsuba agrees with the schoolbook product, balanced or not */
+    seed = 12345;
+    for (i = 0; i < 100; i++) {
+        seed = seed*1664525UL + 1013904223UL;
+        a[i] = seed;
+    }
+    for (i = 0; i < 40; i++) {
+        seed = seed*1664525UL + 1013904223UL;
+        b[i] = seed ^ (seed << 7);
+    }
+    ma_mpn_mul(r1, a, 40, b, 40, tmp);
+    ma_mpn_mul(r2, a, 40, b, 40, NULL);
+    ASSERT(ma_mpn_cmp(r1, r2, 80) == 0);
+    ma_mpn_mul(r1, a, 100, b, 37, tmp);
+    ma_mpn_mul(r2, a, 100, b, 37, NULL);
+    ASSERT(ma_mpn_cmp(r1, r2, 137) == 0);
+    
+    /* q*d + rem gives back the dividend */
+    c = ma_mpn_divrem_1(q, r1, 137, 1000000007UL);
+    r2[137] = ma_mpn_mul_1(r2, q, 137, 1000000007UL);
+    ma_mpn_add(r2, r2, 138, &c, 1);
+    ASSERT(c < 1000000007UL && r2[137] == 0 && ma_mpn_cmp(r2, r1, 137) == 0);
+    c = ma_mpn_divrem_1(q, r1, 137, 0xFFFFFFFFUL);
+    r2[137] = ma_mpn_mul_1(r2, q, 137, 0xFFFFFFFFUL);
+    ma_mpn_add(r2, r2, 138, &c, 1);
+    ASSERT(r2[137] == 0 && ma_mpn_cmp(r2, r1, 137) == 0);
+    a[0] = 0; a[1] = 7;                                 /* 7*2**32 mod 10 */
+    ASSERT(ma_mpn_divrem_1(q, a, 2, 10) == 2 && q[1] == 0 && q[0] == 0xB3333333UL);
+    errno = 0;
+    ASSERT(ma_mpn_divrem_1(q, a, 2, 0) == 0 && errno == EDOM);
+    
+    /* Single-word products */
+    x.hi = 0xFFFFFFFFUL; x.lo = 0xFFFFFFFFUL;
+    ma_umul64x128(x, x, &hi, &lo);
+    ASSERT(hi.hi == 0xFFFFFFFFUL && hi.lo == 0xFFFFFFFEUL);
+    ASSERT(lo.hi == 0 && lo.lo == 1);
+    hi = ma_mulhi64(x, x);
+    ASSERT(hi.hi == 0xFFFFFFFFUL && hi.lo == 0xFFFFFFFEUL);
+    ASSERT(ma_mulhi32(0xFFFFFFFFUL, 0xFFFFFFFFUL) == 0xFFFFFFFEUL);
+    ASSERT(ma_mulhi32(0x10000UL, 0x10000UL) == 1);
+    
+    /* long_long_mul() sees overflow from the high words */
+    s = strtoll("4294967296", NULL, 10);                /* 2**32 */
+    p = long_long_mul(s, s);
+    ASSERT(p.hi == 0x7FFFFFFFUL && p.lo == 0xFFFFFFFFUL);
+    t = strtoll("-2147483648", NULL, 10);
+    p = long_long_mul(s, t);                            /* -2**63 exactly */
+    ASSERT(p.hi == 0x80000000UL && p.lo == 0);
+    s = strtoll("3037000500", NULL, 10);                /* squares past 2**63 */
+    p = long_long_mul(s, s);
+    ASSERT(p.hi == 0x7FFFFFFFUL && p.lo == 0xFFFFFFFFUL);
+    s = strtoll("-3037000499", NULL, 10);
+    p = long_long_mul(s, s);
+    ASSERT(p.hi == 0x7FFFFFFEUL && p.lo == 0x9EA1DC29UL);
+}
+
+void test_vround() {
+    static double v[8], r[8];
+    static float f[8], g[8];
+    static short s16[1000];
+    static signed char s8[8];
+    static long s32[8];
+    static long_long_t s64[4];
+    static double c[1000];
+    unsigned long seed, seed2;
+    long sum, sum2;
+    int i, ok;
+    
+    printf("\n--- Testing Array Rounding and Conversion ---\n");
+    
+    v[0] = 2.5; v[1] = -2.5; v[2] = 0.3; v[3] = -0.3;
+    v[4] = 3.5; v[5] = -7.75; v[6] = 4503599627370495.5; v[7] = INFINITY;
+    ma_vfloor(r, v, 8);
+    ASSERT(r[0] == 2.0 && r[1] == -3.0 && r[2] == 0.0 && r[3] == -1.0);
+    ASSERT(r[5] == -8.0 && r[6] == 4503599627370495.0 && isinf(r[7]));
+    ma_vceil(r, v, 8);
+    ASSERT(r[0] == 3.0 && r[1] == -2.0 && r[2] == 1.0 && r[5] == -7.0);
+    ASSERT(r[3] == 0.0 && signbit(r[3]));
+    ma_vtrunc(r, v, 8);
+    ASSERT(r[0] == 2.0 && r[1] == -2.0 && r[5] == -7.0 && signbit(r[3]));
+    ma_vround(r, v, 8);
+    ASSERT(r[0] == 3.0 && r[1] == -3.0 && r[2] == 0.0 && r[4] == 4.0);
+    ASSERT(r[5] == -8.0 && r[6] == 4503599627370496.0);
+    ma_vrint(r, v, 8);
+    ASSERT(r[0] == 2.0 && r[1] == -2.0 && r[4] == 4.0 && signbit(r[3]));
+    
+    /* In place, and in float */
+    for (i = 0; i < 8; i++) f[i] = (float)v[i];
+    f[6] = 8388607.5f;
+    ma_vfloorf(g, f, 8);
+    ASSERT(g[0] == 2.0f && g[1] == -3.0f && g[3] == -1.0f && g[6] == 8388607.0f);
+    ma_vroundf(g, f, 8);
+    ASSERT(g[0] == 3.0f && g[1] == -3.0f && g[6] == 8388608.0f);
+    ma_vrintf(f, f, 8);
+    ASSERT(f[0] == 2.0f && f[4] == 4.0f && f[5] == -8.0f && isinf(f[7]));
+    
+    /* Saturation, and NaN to 0 */
+    v[0] = 0.5; v[1] = -1.5; v[2] = 1e10; v[3] = -1e10;
+    v[4] = NAN; v[5] = 126.6; v[6] = -32768.4; v[7] = 2147483646.5;
+    ma_vcvt_s8(s8, v, 8, 1.0, NULL);
+    ASSERT(s8[0] == 0 && s8[1] == -2 && s8[2] == 127 && s8[3] == -128);
+    ASSERT(s8[4] == 0 && s8[5] == 127 && s8[6] == -128);
+    ma_vcvt_s16(s16, v, 8, 1.0, NULL);
+    ASSERT(s16[2] == 32767 && s16[3] == -32768 && s16[5] == 127);
+    ASSERT(s16[6] == -32768 && s16[7] == 32767);
+    ma_vcvt_s32(s32, v, 8, 1.0, NULL);
+    ASSERT(s32[2] == 2147483647L && s32[3] == -2147483647L-1);
+    ASSERT(s32[4] == 0 && s32[6] == -32768L && s32[7] == 2147483646L);
+    v[0] = 1e10; v[1] = -1e30; v[2] = 0.75; v[3] = NAN;
+    ma_vcvt_s64(s64, v, 4, 2.0, NULL);
+    ASSERT(s64[0].hi == 4 && s64[0].lo == 0xA817C800UL);
+    ASSERT(s64[1].hi == 0x80000000UL && s64[1].lo == 0);
+    ASSERT(s64[2].hi == 0 && s64[2].lo == 2);
+    ASSERT(s64[3].hi == 0 && s64[3].lo == 0);
+    f[0] = 0.25f; f[1] = -1.0f; f[2] = 3e9f; f[3] = -16777217.0f;
+    ma_vcvtf_s16(s16, f, 3, 32767.0f, NULL);
+    ASSERT(s16[0] == 8192 && s16[1] == -32767 && s16[2] == 32767);
+    ma_vcvtf_s32(s32, f, 4, 1.0f, NULL);
+    ASSERT(s32[0] == 0 && s32[1] == -1 && s32[2] == 2147483647L);
+    ASSERT(s32[3] == -16777216L);
+    
+    /* TPDF dither: within one step, unbiased, and continued across calls */
+    for (i = 0; i < 1000; i++) c[i] = 0.25;
+    seed = 0;
+    sum = 0;
+    ok = 1;
+    for (i = 0; i < 10; i++) {
+        int j;
+        ma_vcvt_s16(s16, c, 8, 1.0, &seed);
+        for (j = 0; j < 8; j++) if (s16[j] < -1 || s16[j] > 1) ok = 0;
+    }
+    ASSERT(ok && seed != 0);
+    seed = 0;
+    for (i = 0; i < 1000; i += 8) {
+        int j, n = (1000 - i < 8) ? 1000 - i : 8;
+        ma_vcvt_s16(s16, c + i, n, 1.0, &seed);
+        for (j = 0; j < n; j++) sum += s16[j];
+    }
+    ASSERT(sum > 200 && sum < 300);
+    seed2 = 0;
+    sum2 = 0;
+    ma_vcvt_s16(s16, c, 1000, 1.0, &seed2);
+    for (i = 0; i < 1000; i++) sum2 += s16[i];
+    ASSERT(seed2 == seed && sum2 == sum);
+}
+
 /* Test long double variants */
 void test_long_double_variants() {
     printf("\n--- Testing Long Double Variants ---\n");
@@ -582,18 +1645,36 @@ int main() {
     printf("Testing all math functions in ma.lib\n");
     
     test_trigonometric();
+    test_trig_pi();
     test_hyperbolic();
     test_exponential_logarithmic();
     test_power_root();
+    test_integer_powers();
     test_rounding_remainder();
     test_floating_point_manipulation();
     test_classification_comparison();
     test_utility();
     test_error_functions();
+    test_normal_distribution();
     test_bessel();
+    test_bessel_joint();
+    test_math_context();
+    test_fixed_point();
+    test_ffp();
+    test_summation();
+    test_reductions();
+    test_norms();
+    test_conversion();
+    test_long_long_text();
+    test_dividers();
+    test_bits();
+    test_intmath();
+    test_mpn();
+    test_vround();
     test_constants();
     test_float_variants();
     test_long_double_variants();
+    test_tgmath();
     
     printf("\n==================== SUMMARY =====================\n");
     printf("Tests Run:    %d\n", tests_run);
@@ -607,3 +1688,33 @@ int main() {
         return EXIT_FAILURE;
     }
 }
+
+/* Last, so that the type-generic macros reach only this test */
+#include <tgmath.h>
+
+void test_tgmath() {
+    float f = 2.0f;
+    double d = 2.0;
+    float_complex z;
+    
+    printf("\n--- Testing Type-Generic Math ---\n");
+    
+    /* float arguments reach the float functions */
+    ASSERT(acosh(f) == acoshf(f) && acosh(f) != (acosh)(d));
+    ASSERT(exp2(0.1f) == exp2f(0.1f) && log1p(0.1f) == log1pf(0.1f));
+    ASSERT(hypot(3.0f, 4.0f) == 5.0);
+    ASSERT(lround(2.5f) == 3 && trunc(-2.5f) == -2.0);
+    ASSERT(scalbn(f, 3) == 16.0);
+    
+    /* double arguments, any argument that is double, and names with
+       only a double function in ma.lib stay double */
+    ASSERT(acosh(d) == (acosh)(d));
+    ASSERT(hypot(0.1f, 0.2) == (hypot)(0.1f, 0.2));
+    ASSERT(fma(0.1f, 0.2f, 0.3) == (fma)(0.1f, 0.2f, 0.3));
+    ASSERT(hypot(0.1f, 0.2f) == (hypot)(0.1f, 0.2f));
+    ASSERT(cbrt(f) == (cbrt)(d));
+    
+    z.re = 1.5f;
+    z.im = -2.0f;
+    ASSERT(creal(z) == 1.5f && cimag(z) == -2.0f);
+}
@@ -0,0 +1,201 @@
+/*
+ * Unit tests for amiga/tmath.h
+ *
+ * Each inline kernel is run over a sweep of arguments and compared
+ * bit for bit with the ma.lib function it stands for.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <complex.h>
+#include <amiga/tmath.h>
+
+/* Test case counters */
+static int tests_run = 0;
+static int tests_failed = 0;
+
+static void assert_test(const char *test_name, int condition, const char *file, int line)
+{
+    tests_run++;
+    if (!condition) {
+        printf("[FAIL] %s:%d: %s failed\n", file, line, test_name);
+        tests_failed++;
+    } else {
+        printf("[PASS] %s:%d: %s passed\n", file, line, test_name);
+    }
+}
+
+#define ASSERT(condition) assert_test(#condition, (condition), __FILE__, __LINE__)
+
+/* Same bits, so NaN matches NaN and -0 does not match +0 */
+static int same(double a, double b) { return memcmp(&a, &b, sizeof(a)) == 0; }
+static int samef(float a, float b) { return memcmp(&a, &b, sizeof(a)) == 0; }
+
+/* Arguments: specials, multiples of pi/2 and xorshift values in bands */
+#define NARGS 4096
+
+static double args[NARGS];
+
+static void make_args(void)
+{
+    static const double special[] = {
+        0.0, -0.0, 1e-300, -1e-30, 1e-9, 0.25, 0.5, 0.7853981633974483,
+        0.78539816339744839, 1.5707963267948966, -1.5707963267948966,
+        2.356194490192345, 3.141592653589793, 4.71238898038469,
+        6.283185307179586, 100.0, 709.7, 709.79, -745.1, -746.0,
+        823549.0, 823551.0, 1e7, -1e22, 1e300
+    };
+    unsigned long s = 0x2545F491UL;
+    int i, n;
+    double v;
+
+    n = (int)(sizeof(special)/sizeof(special[0]));
+    for (i = 0; i < n; i++) args[i] = special[i];
+    args[n++] = HUGE_VAL;
+    args[n++] = -HUGE_VAL;
+    args[n++] = HUGE_VAL-HUGE_VAL;
+    for (i = 1; n < 160; i++, n += 2) {
+        args[n] = i*1.5707963267948966;
+        args[n+1] = -i*3.141592653589793;
+    }
+    for (i = n; i < NARGS; i++) {
+        s ^= s << 13; s ^= s >> 17; s ^= s << 5;
+        v = (double)(s & 0xffffff)/16777216.0;
+        switch (i&3) {
+            case 0: args[i] = (v-0.5)*8.0; break;
+            case 1: args[i] = (v-0.5)*2e5; break;
+            case 2: args[i] = (v-0.5)*1e7; break;
+            default: args[i] = (v-0.5)*1500.0; break;
+        }
+    }
+}
+
+static void test_exact_double(void)
+{
+    int i, bs = 0, bc = 0, be = 0, bsc = 0;
+    double s, c;
+
+    for (i = 0; i < NARGS; i++) {
+        if (!same(ma::sin(args[i]), sin(args[i]))) bs++;
+        if (!same(ma::cos(args[i]), cos(args[i]))) bc++;
+        if (!same(ma::exp(args[i]), exp(args[i]))) be++;
+        ma::sincos(args[i], &s, &c);
+        if (!same(s, sin(args[i])) || !same(c, cos(args[i]))) bsc++;
+    }
+    ASSERT(bs == 0);
+    ASSERT(bc == 0);
+    ASSERT(be == 0);
+    ASSERT(bsc == 0);
+}
+
+static void test_exact_float(void)
+{
+    int i, bad = 0;
+    float x, s, c;
+
+    for (i = 0; i < NARGS; i++) {
+        x = (float)args[i];
+        if (!samef(ma::sin(x), (float)sin((double)x))) bad++;
+        if (!samef(ma::cos(x), (float)cos((double)x))) bad++;
+        if (!samef(ma::exp(x), (float)exp((double)x))) bad++;
+        ma::sincos(x, &s, &c);
+        if (!samef(s, (float)sin((double)x)) || !samef(c, (float)cos((double)x))) bad++;
+    }
+    ASSERT(bad == 0);
+}
+
+/* The fast double tier agrees up to 3pi/4 and stays close beyond */
+static void test_fast_double(void)
+{
+    int i, near = 0, far = 0, bad = 0;
+    double a, b;
+
+    for (i = 0; i < NARGS; i++) {
+        a = ma_kernel<double, ma_fast>::sin(args[i]);
+        b = sin(args[i]);
+        if (fabs(args[i]) < 2.356194490192345) {
+            if (!same(a, b)) near++;
+        } else if (i >= 160 && fabs(a-b) > 1e-13*fabs(b)) {
+            far++;
+        }
+        if (!same(ma_kernel<double, ma_fast>::exp(args[i]), exp(args[i]))) bad++;
+    }
+    ASSERT(near == 0);
+    ASSERT(far == 0);
+    ASSERT(bad == 0);
+}
+
+/* The fast float tier is cexpf()'s exp and sincos */
+static void test_fast_float(void)
+{
+    int i, be = 0, bsc = 0;
+    float x, s, c;
+    float_complex z, w;
+
+    for (i = 0; i < NARGS; i++) {
+        x = (float)args[i];
+        z.re = x; z.im = 0.0f;
+        w = cexpf(z);
+        if (!samef(ma_kernel<float, ma_fast>::exp(x), w.re)) be++;
+        z.re = 0.0f; z.im = x;
+        w = cexpf(z);
+        ma_kernel<float, ma_fast>::sincos(x, &s, &c);
+        if (!samef(c, w.re) || !samef(s, w.im)) bsc++;
+    }
+    ASSERT(be == 0);
+    ASSERT(bsc == 0);
+}
+
+static void test_complex(void)
+{
+    int i, bad = 0;
+    float_complex z, w;
+    ma_complex<float> mz, mw;
+    ma_complex<double> a(1.0, 2.0), b(3.0, -1.0), p;
+
+    for (i = 0; i+1 < NARGS; i += 2) {
+        z.re = (float)fmod(args[i], 200.0);
+        z.im = (float)args[i+1];
+        w = cexpf(z);
+        mz = ma_complex<float>(z.re, z.im);
+        mw = ma::exp(mz);
+        if (!samef(mw.re, w.re) || !samef(mw.im, w.im)) bad++;
+    }
+    ASSERT(bad == 0);
+
+    p = a*b;
+    ASSERT(p.re == 5.0 && p.im == 5.0);
+    p = a+b-a;
+    ASSERT(p.re == 3.0 && p.im == -1.0);
+    p = ma::exp(ma_complex<double>(0.0, 3.141592653589793));
+    ASSERT(same(p.re, cos(3.141592653589793)) && same(p.im, sin(3.141592653589793)));
+    ASSERT(sizeof(ma_complex<double>) == sizeof(complex_t));
+    ASSERT(sizeof(ma_complex<float>) == sizeof(float_complex));
+}
+
+int main()
+{
+    printf("=== Inline Kernel Unit Tests ===\n");
+    printf("Testing amiga/tmath.h against ma.lib\n");
+
+    make_args();
+    test_exact_double();
+    test_exact_float();
+    test_fast_double();
+    test_fast_float();
+    test_complex();
+
+    printf("\n=== Test Results ===\n");
+    printf("Tests run: %d\n", tests_run);
+    printf("Tests failed: %d\n", tests_failed);
+    printf("Tests passed: %d\n", tests_run - tests_failed);
+
+    if (tests_failed == 0) {
+        printf("\n*** ALL TESTS PASSED! ***\n");
+        return 0;
+    } else {
+        printf("\n*** %d TESTS FAILED! ***\n", tests_failed);
+        return 1;
+    }
+}
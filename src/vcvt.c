@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Saturating conversion of double arrays to integers
+ *
+ * Method :
+ *	For |v| < 2**51, v + 1.5*2**52 rounds v to an integer in the
+ *	current rounding mode and leaves it, two's complement, in the
+ *	low word of the sum; no call to rint() and no conversion
+ *	instruction are needed. Values are compared against the limits
+ *	of the target type first, so the sum is only formed in range;
+ *	NaN fails both comparisons and gives 0.
+ *
+ *	The dither is the difference of two uniform 16-bit values taken
+ *	from an xorshift generator, scaled to one step: triangular on
+ *	(-1,+1) with zero mean, which decorrelates the rounding error
+ *	from the signal.
+ */
+
+#include <math.h>
+#include <amiga/vround.h>
+#include "include/internal/m99_math.h"
+#include "include/internal/longlong.h"
+
+static const double
+magic  = 6.75539944105574400000e+15,   /* 0x43380000, 0x00000000 */
+two51  = 2.25179981368524800000e+15,   /* 0x43200000, 0x00000000 */
+two63  = 9.22337203685477580800e+18,   /* 0x43E00000, 0x00000000 */
+step   = 1.52587890625000000000e-05;   /* 2**-16 */
+
+/* Seed used when *dither is 0, which xorshift would never leave */
+#define DITHER_SEED     0x2545F491UL
+
+/* Advance the generator s and add one TPDF dither sample to v */
+#define DITHER(v, s) \
+    s ^= s << 13; s ^= s >> 17; s ^= s << 5; \
+    v += ((long)(s >> 16) - (long)(s & 0xffff)) * step
+
+/* r = v rounded and clamped to [lo, hi], for hi < 2**31 */
+#define CVT(r, v, lo, hi, t) \
+    if ((v) >= (double)(hi)) r = (hi); \
+    else if ((v) > (double)(lo)) { t = (v) + magic; r = __LO(t); } \
+    else r = ((v) <= (double)(lo)) ? (lo) : 0
+
+/****** ma.lib/ma_vcvt_s16 ****************************************************
+*
+*   NAME	
+* 	ma_vcvt_s16 -- Convert doubles to saturated, dithered integers. (V1.0)
+*
+*   SYNOPSIS
+*	ma_vcvt_s16(short *dst, const double *x, unsigned long n,
+*	            A0          A1               D0
+*	            double scale, unsigned long *dither);
+*	void ma_vcvt_s8(signed char *dst, const double *x, unsigned long n,
+*	                double scale, unsigned long *dither);
+*	void ma_vcvt_s16(short *dst, const double *x, unsigned long n,
+*	                 double scale, unsigned long *dither);
+*	void ma_vcvt_s32(long *dst, const double *x, unsigned long n,
+*	                 double scale, unsigned long *dither);
+*	void ma_vcvt_s64(long_long_t *dst, const double *x, unsigned long n,
+*	                 double scale, unsigned long *dither);
+*
+*   FUNCTION
+*	Set each dst[i] to x[i]*scale rounded to the nearest integer in
+*	the current rounding mode. Results beyond the range of the
+*	destination type are clamped to its minimum or maximum rather
+*	than wrapping, and NaN gives 0.
+*
+*	If dither is not NULL, triangular (TPDF) noise of up to one step
+*	either way is added to each scaled value before it is rounded.
+*	*dither holds the state of the noise generator; it is read on
+*	entry and written back on return, so consecutive calls on the
+*	pieces of one stream continue the same sequence. An initial
+*	*dither of 0 selects a fixed seed.
+*
+*   INPUTS
+*	dst    - Array of n integers to receive the results.
+*	x      - Array of n values.
+*	n      - Number of values.
+*	scale  - Factor applied before rounding, such as 32767.0 to turn
+*	         samples in [-1,1] into 16-bit audio.
+*	dither - NULL for plain rounding, or the dither state.
+*
+*   RESULT
+*	None.
+*
+*   EXAMPLE
+*	unsigned long seed = 0;
+*
+*	ma_vcvt_s16(pcm, mix, frames, 32767.0, &seed);
+*
+*   NOTES
+*	ma.lib extension. Without dither each result is lrint() of the
+*	scaled value, clamped; ma_vcvt_s64() gives llrint().
+*
+*   SEE ALSO
+*	ma_vcvtf_s16(), ma_vrint(), lrint(), llrint(), amiga/vround.h
+*
+******************************************************************************/
+
+void ma_vcvt_s8(signed char *dst, const double *x, unsigned long n,
+                double scale, unsigned long *dither)
+{
+    double v, t;
+    long r;
+    unsigned long i, s;
+
+    s = dither ? *dither : 0;
+    if (dither && s == 0) s = DITHER_SEED;
+    for (i = 0; i < n; i++) {
+        v = x[i] * scale;
+        if (dither) { DITHER(v, s); }
+        CVT(r, v, -128L, 127L, t);
+        dst[i] = (signed char)r;
+    }
+    if (dither) *dither = s;
+}
+
+void ma_vcvt_s16(short *dst, const double *x, unsigned long n,
+                 double scale, unsigned long *dither)
+{
+    double v, t;
+    long r;
+    unsigned long i, s;
+
+    s = dither ? *dither : 0;
+    if (dither && s == 0) s = DITHER_SEED;
+    for (i = 0; i < n; i++) {
+        v = x[i] * scale;
+        if (dither) { DITHER(v, s); }
+        CVT(r, v, -32768L, 32767L, t);
+        dst[i] = (short)r;
+    }
+    if (dither) *dither = s;
+}
+
+void ma_vcvt_s32(long *dst, const double *x, unsigned long n,
+                 double scale, unsigned long *dither)
+{
+    double v, t;
+    long r;
+    unsigned long i, s;
+
+    s = dither ? *dither : 0;
+    if (dither && s == 0) s = DITHER_SEED;
+    for (i = 0; i < n; i++) {
+        v = x[i] * scale;
+        if (dither) { DITHER(v, s); }
+        CVT(r, v, -2147483647L-1, 2147483647L, t);
+        dst[i] = r;
+    }
+    if (dither) *dither = s;
+}
+
+void ma_vcvt_s64(long_long_t *dst, const double *x, unsigned long n,
+                 double scale, unsigned long *dither)
+{
+    double v, t;
+    unsigned long i, s;
+
+    s = dither ? *dither : 0;
+    if (dither && s == 0) s = DITHER_SEED;
+    for (i = 0; i < n; i++) {
+        v = x[i] * scale;
+        if (dither) { DITHER(v, s); }
+        if (v < two51 && v > -two51) {
+            t = v + magic;
+            dst[i].hi = __HI(t) - 0x43380000;
+            dst[i].lo = __LO(t);
+        } else if (v >= two63) {
+            dst[i] = get_long_long_max();
+        } else if (v < -two63) {
+            dst[i] = get_long_long_min();
+        } else {
+            dst[i] = llrint(v);         /* large or NaN */
+        }
+    }
+    if (dither) *dither = s;
+}
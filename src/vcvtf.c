@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Saturating conversion of float arrays to integers
+ *
+ * Method :
+ *	As vcvt.c, in float. For |v| < 2**22, v + 1.5*2**23 stored to a
+ *	float holds v rounded to an integer in its low bits, so the
+ *	result is the word of the sum less 0x4b400000. Larger 32-bit
+ *	results are rounded with 2**23 and then converted directly, the
+ *	value being integral by then.
+ */
+
+#include <math.h>
+#include <amiga/vround.h>
+#include "include/internal/m99_math.h"
+#include "include/internal/fpu.h"
+
+static const float
+magic = 1.2582912000e+07f,              /* 0x4b400000 */
+two22 = 4.1943040000e+06f,              /* 0x4a800000 */
+two31 = 2.1474836480e+09f,              /* 0x4f000000 */
+step  = 1.5258789062e-05f,              /* 2**-16 */
+TWO23[2] = {
+     8.3886080000e+06f,                 /* 0x4b000000 */
+    -8.3886080000e+06f,                 /* 0xcb000000 */
+};
+
+/* Same seed and generator as vcvt.c */
+#define DITHER_SEED     0x2545F491UL
+
+/* Advance the generator s and add one TPDF dither sample to v */
+#define DITHER(v, s) \
+    s ^= s << 13; s ^= s >> 17; s ^= s << 5; \
+    v += (float)((long)(s >> 16) - (long)(s & 0xffff)) * step
+
+/* r = v rounded and clamped to [lo, hi], for hi < 2**22 */
+#define CVT(r, v, lo, hi, t) \
+    if ((v) >= (float)(hi)) r = (hi); \
+    else if ((v) > (float)(lo)) { t = (v) + magic; r = __HI(t) - 0x4b400000; } \
+    else r = ((v) <= (float)(lo)) ? (lo) : 0
+
+/****** ma.lib/ma_vcvtf_s16 ***************************************************
+*
+*   NAME	
+* 	ma_vcvtf_s16 -- Convert floats to saturated, dithered integers. (V1.0)
+*
+*   SYNOPSIS
+*	ma_vcvtf_s16(short *dst, const float *x, unsigned long n,
+*	             A0          A1              D0
+*	             float scale, unsigned long *dither);
+*	void ma_vcvtf_s8(signed char *dst, const float *x, unsigned long n,
+*	                 float scale, unsigned long *dither);
+*	void ma_vcvtf_s16(short *dst, const float *x, unsigned long n,
+*	                  float scale, unsigned long *dither);
+*	void ma_vcvtf_s32(long *dst, const float *x, unsigned long n,
+*	                  float scale, unsigned long *dither);
+*
+*   FUNCTION
+*	Set each dst[i] to x[i]*scale rounded to the nearest integer,
+*	clamped to the range of the destination type, with optional
+*	TPDF dither, as ma_vcvt_s16() does for doubles. The scaling
+*	and dither are done in float.
+*
+*   INPUTS
+*	dst    - Array of n integers to receive the results.
+*	x      - Array of n values.
+*	n      - Number of values.
+*	scale  - Factor applied before rounding.
+*	dither - NULL for plain rounding, or the dither state, which
+*	         may be shared with ma_vcvt_s16() and the others.
+*
+*   RESULT
+*	None.
+*
+*   EXAMPLE
+*	unsigned long seed = 0;
+*
+*	ma_vcvtf_s8(pcm, mix, frames, 127.0f, &seed);
+*
+*   NOTES
+*	ma.lib extension. NaN gives 0.
+*
+*   SEE ALSO
+*	ma_vcvt_s16(), ma_vrintf(), lrintf(), amiga/vround.h
+*
+******************************************************************************/
+
+void ma_vcvtf_s8(signed char *dst, const float *x, unsigned long n,
+                 float scale, unsigned long *dither)
+{
+    float v, t;
+    long r;
+    unsigned long i, s;
+
+    s = dither ? *dither : 0;
+    if (dither && s == 0) s = DITHER_SEED;
+    for (i = 0; i < n; i++) {
+        v = x[i] * scale;
+        if (dither) { DITHER(v, s); }
+        CVT(r, v, -128L, 127L, t);
+        dst[i] = (signed char)r;
+    }
+    if (dither) *dither = s;
+}
+
+void ma_vcvtf_s16(short *dst, const float *x, unsigned long n,
+                  float scale, unsigned long *dither)
+{
+    float v, t;
+    long r;
+    unsigned long i, s;
+
+    s = dither ? *dither : 0;
+    if (dither && s == 0) s = DITHER_SEED;
+    for (i = 0; i < n; i++) {
+        v = x[i] * scale;
+        if (dither) { DITHER(v, s); }
+        CVT(r, v, -32768L, 32767L, t);
+        dst[i] = (short)r;
+    }
+    if (dither) *dither = s;
+}
+
+void ma_vcvtf_s32(long *dst, const float *x, unsigned long n,
+                  float scale, unsigned long *dither)
+{
+    float v, t;
+    long r;
+    int hv;
+    unsigned long i, s;
+
+    s = dither ? *dither : 0;
+    if (dither && s == 0) s = DITHER_SEED;
+    for (i = 0; i < n; i++) {
+        v = x[i] * scale;
+        if (dither) { DITHER(v, s); }
+        if (v < two22 && v > -two22) {
+            t = v + magic;
+            r = __HI(t) - 0x4b400000;
+        } else if (v >= two31) {
+            r = 2147483647L;
+        } else if (v >= -two31) {
+            hv = __HI(v);
+            if ((hv & 0x7fffffff) < 0x4b000000) {
+                STRICT_ASSIGN(float, t, v + TWO23[(unsigned int)hv >> 31]);
+                v = t - TWO23[(unsigned int)hv >> 31];
+            }
+            r = (long)v;
+        } else {
+            r = (v < -two31) ? -2147483647L-1 : 0;
+        }
+        dst[i] = r;
+    }
+    if (dither) *dither = s;
+}
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Dot product, sum of squares and norm of double arrays
+ *
+ * Method :
+ *	ma_vdot() keeps four partial sums, so that an FPU can overlap
+ *	the additions of an unrolled block instead of waiting on each.
+ *	MA_SMALL builds use the first sum alone.
+ *
+ *	ma_vsumsq() is Blue's algorithm, as in the reference BLAS
+ *	dnrm2 (Anderson, "Algorithm 978: Safe Scaling in the Level 1
+ *	BLAS", 2017). Elements too big to square safely and elements
+ *	too small to square without underflow are summed, scaled by
+ *	powers of 2, in accumulators of their own; the rest are squared
+ *	as they are. So the sum never overflows or loses its small terms
+ *	in one pass, without a division per element as in LAPACK dlassq.
+ */
+
+#include <stddef.h>
+#include <math.h>
+#include <errno.h>
+#include <float.h>
+#include <amiga/reduce.h>
+#include "include/internal/m99_math.h"
+
+static const double
+one  = 1.0,
+tsml = 1.49166814624004134866e-154, /* 2**-511 */
+tbig = 1.99791907220223502808e+146, /* 2**486 */
+ssml = 4.49891379454319638281e+161, /* 2**537 */
+sbig = 1.11137937474253874172e-162; /* 2**-538 */
+
+/****** ma.lib/ma_vdot *******************************************************
+*
+*   NAME	
+* 	ma_vdot -- Dot product, sum of squares and norm of arrays. (V1.0)
+*
+*   SYNOPSIS
+*	double result = ma_vdot(const double *x, const double *y,
+*	  D0		              A0                A1
+*	                        unsigned long n);
+*	                                      D0
+*	double ma_vdot(const double *x, const double *y, unsigned long n);
+*	double ma_vsumsq(const double *x, unsigned long n, double *scale);
+*	double ma_vnorm(const double *x, unsigned long n);
+*
+*   FUNCTION
+*	ma_vdot() returns the sum of x[i]*y[i]. ma_vsumsq() returns the
+*	sum of the squares of x[i] in scaled form, as ssq with a power
+*	of 2 in *scale such that the sum is (*scale)*(*scale)*ssq. The
+*	scaling means neither overflow nor underflow can spoil the sum,
+*	whatever the range of the elements. ma_vnorm() returns the
+*	Euclidean norm, *scale*sqrt(ssq), from a single pass over x.
+*
+*   INPUTS
+*	x     - Array of values.
+*	y     - Second array of values for ma_vdot().
+*	n     - Number of values.
+*	scale - Where ma_vsumsq() stores the scale factor, or NULL to
+*	        have the sum of squares returned unscaled.
+*
+*   RESULT
+*	result - The dot product, scaled sum of squares or norm, +0 for
+*	        n = 0. NaN if any element is a NaN; ma_vsumsq() returns
+*	        +Infinity with *scale = 1, and ma_vnorm() +Infinity, if
+*	        any is infinite.
+*
+*   EXAMPLE
+*	double len = ma_vnorm(v, count);
+*
+*   NOTES
+*	ma.lib extension. The sums are not compensated, so cancellation
+*	in ma_vdot() loses accuracy, and the rounding error of the norm
+*	grows with n, as in a plain loop. ma_vnorm() sets errno to ERANGE
+*	only if the norm itself overflows.
+*
+*   SEE ALSO
+*	ma_vdotf(), ma_vmin(), ma_fsum(), amiga/reduce.h
+*
+******************************************************************************/
+
+double ma_vdot(const double *x, const double *y, unsigned long n)
+{
+    double s0, s1, s2, s3;
+
+    s0 = s1 = s2 = s3 = 0.0;
+#ifndef MA_SMALL
+    for (; n >= 4; n -= 4, x += 4, y += 4) {
+        s0 += x[0]*y[0];
+        s1 += x[1]*y[1];
+        s2 += x[2]*y[2];
+        s3 += x[3]*y[3];
+    }
+#endif
+    while (n-- > 0)
+        s0 += *x++ * *y++;
+    return (s0+s1)+(s2+s3);
+}
+
+double ma_vsumsq(const double *x, unsigned long n, double *scale)
+{
+    double asml, amed, abig, ax, ymin, ymax, scl, ssq;
+
+    asml = amed = abig = 0.0;
+    while (n-- > 0) {
+        ax = fabs(*x++);
+        if (ax > tbig) {
+            ax *= sbig;
+            abig += ax*ax;
+        } else if (ax < tsml) {
+            ax *= ssml;
+            asml += ax*ax;
+        } else {
+            amed += ax*ax;			/* and NaNs */
+        }
+    }
+
+    if (abig > 0.0) {
+        /* the small terms are lost against abig */
+        if (amed > 0.0 || amed != amed) abig += (amed*sbig)*sbig;
+        if (abig-abig != 0.0) {			/* Infinity or NaN */
+            scl = one;
+        } else {
+            scl = one/sbig;
+        }
+        ssq = abig;
+    } else if (asml > 0.0) {
+        if (amed > 0.0 || amed != amed) {
+            amed = sqrt(amed);
+            asml = sqrt(asml)/ssml;
+            if (asml > amed) {
+                ymin = amed;
+                ymax = asml;
+            } else {
+                ymin = asml;
+                ymax = amed;
+            }
+            scl = one;
+            ssq = ymax*ymax*(one+(ymin/ymax)*(ymin/ymax));
+        } else {
+            scl = one/ssml;
+            ssq = asml;
+        }
+    } else {
+        scl = one;
+        ssq = amed;
+    }
+
+    if (scale == NULL) return scl*(scl*ssq);
+    *scale = scl;
+    return ssq;
+}
+
+double ma_vnorm(const double *x, unsigned long n)
+{
+    double scl, ssq, r;
+
+    ssq = ma_vsumsq(x, n, &scl);
+    r = scl*sqrt(ssq);
+    if (r > DBL_MAX && ssq-ssq == 0.0) __ma_seterr(ERANGE);
+    return r;
+}
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Dot product, sum of squares and norm of float arrays
+ *
+ * The products of two floats are exact in double, and a double
+ * cannot overflow or underflow summing them: the largest is below
+ * 2**256 and the smallest above 2**-300. Accumulating in double thus
+ * needs none of the scaling of ma_vsumsq() and returns the sums with
+ * far more accuracy than a float accumulator would.
+ */
+
+#include <math.h>
+#include <errno.h>
+#include <float.h>
+#include <amiga/reduce.h>
+#include "include/internal/m99_math.h"
+
+/****** ma.lib/ma_vdotf ******************************************************
+*
+*   NAME	
+* 	ma_vdotf -- Dot product, sum of squares and norm of float arrays. (V1.0)
+*
+*   SYNOPSIS
+*	double result = ma_vdotf(const float *x, const float *y,
+*	  D0		               A0               A1
+*	                         unsigned long n);
+*	                                       D0
+*	double ma_vdotf(const float *x, const float *y, unsigned long n);
+*	double ma_vsumsqf(const float *x, unsigned long n);
+*	float ma_vnormf(const float *x, unsigned long n);
+*
+*   FUNCTION
+*	Return the sum of x[i]*y[i], or of the squares of x[i], formed
+*	in double precision. ma_vnormf() returns the Euclidean norm,
+*	the square root of the sum of squares, rounded once to float.
+*
+*   INPUTS
+*	x - Array of values.
+*	y - Second array of values for ma_vdotf().
+*	n - Number of values.
+*
+*   RESULT
+*	result - The dot product or sum of squares as a double, or the
+*	        norm as a float; +0 for n = 0. NaN if any element is a
+*	        NaN.
+*
+*   EXAMPLE
+*	double energy = ma_vsumsqf(samples, count);
+*
+*   NOTES
+*	ma.lib extension. The result is a double so that it can hold
+*	sums beyond the range of float; convert it if a float is wanted.
+*	The norm of finite floats overflows only if it exceeds FLT_MAX,
+*	and then sets errno to ERANGE.
+*
+*   SEE ALSO
+*	ma_vdot(), ma_vminf(), amiga/reduce.h
+*
+******************************************************************************/
+
+double ma_vdotf(const float *x, const float *y, unsigned long n)
+{
+    double s0, s1, s2, s3;
+
+    s0 = s1 = s2 = s3 = 0.0;
+#ifndef MA_SMALL
+    for (; n >= 4; n -= 4, x += 4, y += 4) {
+        s0 += (double)x[0]*y[0];
+        s1 += (double)x[1]*y[1];
+        s2 += (double)x[2]*y[2];
+        s3 += (double)x[3]*y[3];
+    }
+#endif
+    while (n-- > 0)
+        s0 += (double)*x++ * *y++;
+    return (s0+s1)+(s2+s3);
+}
+
+double ma_vsumsqf(const float *x, unsigned long n)
+{
+    double s0, s1, s2, s3, t;
+
+    s0 = s1 = s2 = s3 = 0.0;
+#ifndef MA_SMALL
+    for (; n >= 4; n -= 4, x += 4) {
+        t = x[0]; s0 += t*t;
+        t = x[1]; s1 += t*t;
+        t = x[2]; s2 += t*t;
+        t = x[3]; s3 += t*t;
+    }
+#endif
+    while (n-- > 0) {
+        t = *x++;
+        s0 += t*t;
+    }
+    return (s0+s1)+(s2+s3);
+}
+
+float ma_vnormf(const float *x, unsigned long n)
+{
+    double r;
+
+    r = sqrt(ma_vsumsqf(x, n));
+    if (r > FLT_MAX && r-r == 0.0) __ma_seterr(ERANGE);
+    return (float)r;
+}
@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Extremes of a double array
+ *
+ * Method :
+ *	A comparison with a NaN is false, so once the running extreme
+ *	holds a number, "if (v < m) m = v" passes over NaNs by itself.
+ *	Only the leading NaNs need a test of their own; after that the
+ *	loops, unrolled by four, make one comparison per element and no
+ *	NaN checks at all. MA_SMALL builds leave the unrolling out.
+ *
+ *	ma_vminmax() takes the elements in pairs: one comparison orders
+ *	the pair, then the smaller is compared with the minimum and the
+ *	larger with the maximum, 3 comparisons per 2 elements instead
+ *	of 4. A pair holding a NaN is unordered either way round, which
+ *	is the one NaN check per pair, and its elements are then taken
+ *	singly.
+ */
+
+#include <math.h>
+#include <amiga/reduce.h>
+#include "include/internal/m99_math.h"
+
+/* Index of the first element that is not a NaN, or n */
+static unsigned long skipnan(const double *x, unsigned long n)
+{
+    unsigned long i;
+
+    for (i = 0; i < n && x[i] != x[i]; i++)
+        ;
+    return i;
+}
+
+/****** ma.lib/ma_vmin *******************************************************
+*
+*   NAME	
+* 	ma_vmin -- Extremes of a double array. (V1.0)
+*
+*   SYNOPSIS
+*	double result = ma_vmin(const double *x, unsigned long n);
+*	  D0		              A0                D0
+*	double ma_vmin(const double *x, unsigned long n);
+*	double ma_vmax(const double *x, unsigned long n);
+*	long ma_vargmin(const double *x, unsigned long n);
+*	long ma_vargmax(const double *x, unsigned long n);
+*	void ma_vminmax(const double *x, unsigned long n, double *min,
+*	                double *max);
+*
+*   FUNCTION
+*	Find the smallest or largest of n doubles, the index of the
+*	first element holding it, or both extremes in a single pass.
+*	NaNs are ignored, as fmin() and fmax() ignore a NaN argument,
+*	so the result is the same as folding fmin() or fmax() over the
+*	array, at a fraction of the cost.
+*
+*   INPUTS
+*	x   - Array of values.
+*	n   - Number of values.
+*	min - Where ma_vminmax() stores the minimum.
+*	max - Where ma_vminmax() stores the maximum.
+*
+*   RESULT
+*	result - The minimum or maximum, or NaN if n is 0 or every
+*	        element is a NaN. ma_vargmin() and ma_vargmax() return
+*	        the index of the first element equal to it, or -1 in
+*	        those cases.
+*
+*   EXAMPLE
+*	double lo, hi;
+*	ma_vminmax(samples, count, &lo, &hi);
+*
+*   NOTES
+*	ma.lib extension. When the extreme is a zero, which sign is
+*	returned depends on the order of the elements, as for fmin()
+*	and fmax().
+*
+*   SEE ALSO
+*	ma_vminf(), ma_vdot(), fmin(), fmax(), amiga/reduce.h
+*
+******************************************************************************/
+
+double ma_vmin(const double *x, unsigned long n)
+{
+    double m;
+    unsigned long i;
+
+    i = skipnan(x, n);
+    if (i == n) return (n) ? x[0] : __ma_zero/__ma_zero;
+
+    m = x[i++];
+#ifndef MA_SMALL
+    for (; i+4 <= n; i += 4) {
+        if (x[i] < m) m = x[i];
+        if (x[i+1] < m) m = x[i+1];
+        if (x[i+2] < m) m = x[i+2];
+        if (x[i+3] < m) m = x[i+3];
+    }
+#endif
+    for (; i < n; i++)
+        if (x[i] < m) m = x[i];
+    return m;
+}
+
+double ma_vmax(const double *x, unsigned long n)
+{
+    double m;
+    unsigned long i;
+
+    i = skipnan(x, n);
+    if (i == n) return (n) ? x[0] : __ma_zero/__ma_zero;
+
+    m = x[i++];
+#ifndef MA_SMALL
+    for (; i+4 <= n; i += 4) {
+        if (x[i] > m) m = x[i];
+        if (x[i+1] > m) m = x[i+1];
+        if (x[i+2] > m) m = x[i+2];
+        if (x[i+3] > m) m = x[i+3];
+    }
+#endif
+    for (; i < n; i++)
+        if (x[i] > m) m = x[i];
+    return m;
+}
+
+long ma_vargmin(const double *x, unsigned long n)
+{
+    double m;
+    unsigned long i, k;
+
+    k = skipnan(x, n);
+    if (k == n) return -1;
+
+    m = x[k];
+    i = k+1;
+#ifndef MA_SMALL
+    for (; i+4 <= n; i += 4) {
+        if (x[i] < m) m = x[k = i];
+        if (x[i+1] < m) m = x[k = i+1];
+        if (x[i+2] < m) m = x[k = i+2];
+        if (x[i+3] < m) m = x[k = i+3];
+    }
+#endif
+    for (; i < n; i++)
+        if (x[i] < m) m = x[k = i];
+    return (long)k;
+}
+
+long ma_vargmax(const double *x, unsigned long n)
+{
+    double m;
+    unsigned long i, k;
+
+    k = skipnan(x, n);
+    if (k == n) return -1;
+
+    m = x[k];
+    i = k+1;
+#ifndef MA_SMALL
+    for (; i+4 <= n; i += 4) {
+        if (x[i] > m) m = x[k = i];
+        if (x[i+1] > m) m = x[k = i+1];
+        if (x[i+2] > m) m = x[k = i+2];
+        if (x[i+3] > m) m = x[k = i+3];
+    }
+#endif
+    for (; i < n; i++)
+        if (x[i] > m) m = x[k = i];
+    return (long)k;
+}
+
+void ma_vminmax(const double *x, unsigned long n, double *min, double *max)
+{
+    double lo, hi, a, b;
+    unsigned long i;
+
+    i = skipnan(x, n);
+    if (i == n) {
+        *min = *max = (n) ? x[0] : __ma_zero/__ma_zero;
+        return;
+    }
+
+    lo = hi = x[i++];
+    if ((n-i) & 1) {
+        a = x[i++];
+        if (a < lo) lo = a;
+        else if (a > hi) hi = a;
+    }
+    for (; i < n; i += 2) {
+        a = x[i];
+        b = x[i+1];
+        if (a < b) {
+            if (a < lo) lo = a;
+            if (b > hi) hi = b;
+        } else if (b <= a) {
+            if (b < lo) lo = b;
+            if (a > hi) hi = a;
+        } else {				/* a NaN in the pair */
+            if (a < lo) lo = a;
+            else if (a > hi) hi = a;
+            if (b < lo) lo = b;
+            else if (b > hi) hi = b;
+        }
+    }
+    *min = lo;
+    *max = hi;
+}
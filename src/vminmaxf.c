@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Extremes of a float array
+ *
+ * The float forms of vminmax.c, by the same method. Comparing floats
+ * directly keeps the loops free of conversions to double.
+ */
+
+#include <math.h>
+#include <amiga/reduce.h>
+#include "include/internal/m99_math.h"
+
+/* Index of the first element that is not a NaN, or n */
+static unsigned long skipnan(const float *x, unsigned long n)
+{
+    unsigned long i;
+
+    for (i = 0; i < n && x[i] != x[i]; i++)
+        ;
+    return i;
+}
+
+/****** ma.lib/ma_vminf ******************************************************
+*
+*   NAME	
+* 	ma_vminf -- Extremes of a float array. (V1.0)
+*
+*   SYNOPSIS
+*	float result = ma_vminf(const float *x, unsigned long n);
+*	  D0		              A0                D0
+*	float ma_vminf(const float *x, unsigned long n);
+*	float ma_vmaxf(const float *x, unsigned long n);
+*	long ma_vargminf(const float *x, unsigned long n);
+*	long ma_vargmaxf(const float *x, unsigned long n);
+*	void ma_vminmaxf(const float *x, unsigned long n, float *min,
+*	                float *max);
+*
+*   FUNCTION
+*	Find the smallest or largest of n floats, the index of the
+*	first element holding it, or both extremes in a single pass.
+*	NaNs are ignored, as fmin() and fmax() ignore a NaN argument,
+*	so the result is the same as folding fmin() or fmax() over the
+*	array, at a fraction of the cost.
+*
+*   INPUTS
+*	x   - Array of values.
+*	n   - Number of values.
+*	min - Where ma_vminmaxf() stores the minimum.
+*	max - Where ma_vminmaxf() stores the maximum.
+*
+*   RESULT
+*	result - The minimum or maximum, or NaN if n is 0 or every
+*	        element is a NaN. ma_vargminf() and ma_vargmaxf() return
+*	        the index of the first element equal to it, or -1 in
+*	        those cases.
+*
+*   EXAMPLE
+*	float lo, hi;
+*	ma_vminmaxf(samples, count, &lo, &hi);
+*
+*   NOTES
+*	ma.lib extension. When the extreme is a zero, which sign is
+*	returned depends on the order of the elements, as for fmin()
+*	and fmax().
+*
+*   SEE ALSO
+*	ma_vmin(), ma_vdotf(), fminf(), fmaxf(), amiga/reduce.h
+*
+******************************************************************************/
+
+float ma_vminf(const float *x, unsigned long n)
+{
+    float m;
+    unsigned long i;
+
+    i = skipnan(x, n);
+    if (i == n) return (n) ? x[0] : __ma_zerof/__ma_zerof;
+
+    m = x[i++];
+#ifndef MA_SMALL
+    for (; i+4 <= n; i += 4) {
+        if (x[i] < m) m = x[i];
+        if (x[i+1] < m) m = x[i+1];
+        if (x[i+2] < m) m = x[i+2];
+        if (x[i+3] < m) m = x[i+3];
+    }
+#endif
+    for (; i < n; i++)
+        if (x[i] < m) m = x[i];
+    return m;
+}
+
+float ma_vmaxf(const float *x, unsigned long n)
+{
+    float m;
+    unsigned long i;
+
+    i = skipnan(x, n);
+    if (i == n) return (n) ? x[0] : __ma_zerof/__ma_zerof;
+
+    m = x[i++];
+#ifndef MA_SMALL
+    for (; i+4 <= n; i += 4) {
+        if (x[i] > m) m = x[i];
+        if (x[i+1] > m) m = x[i+1];
+        if (x[i+2] > m) m = x[i+2];
+        if (x[i+3] > m) m = x[i+3];
+    }
+#endif
+    for (; i < n; i++)
+        if (x[i] > m) m = x[i];
+    return m;
+}
+
+long ma_vargminf(const float *x, unsigned long n)
+{
+    float m;
+    unsigned long i, k;
+
+    k = skipnan(x, n);
+    if (k == n) return -1;
+
+    m = x[k];
+    i = k+1;
+#ifndef MA_SMALL
+    for (; i+4 <= n; i += 4) {
+        if (x[i] < m) m = x[k = i];
+        if (x[i+1] < m) m = x[k = i+1];
+        if (x[i+2] < m) m = x[k = i+2];
+        if (x[i+3] < m) m = x[k = i+3];
+    }
+#endif
+    for (; i < n; i++)
+        if (x[i] < m) m = x[k = i];
+    return (long)k;
+}
+
+long ma_vargmaxf(const float *x, unsigned long n)
+{
+    float m;
+    unsigned long i, k;
+
+    k = skipnan(x, n);
+    if (k == n) return -1;
+
+    m = x[k];
+    i = k+1;
+#ifndef MA_SMALL
+    for (; i+4 <= n; i += 4) {
+        if (x[i] > m) m = x[k = i];
+        if (x[i+1] > m) m = x[k = i+1];
+        if (x[i+2] > m) m = x[k = i+2];
+        if (x[i+3] > m) m = x[k = i+3];
+    }
+#endif
+    for (; i < n; i++)
+        if (x[i] > m) m = x[k = i];
+    return (long)k;
+}
+
+void ma_vminmaxf(const float *x, unsigned long n, float *min, float *max)
+{
+    float lo, hi, a, b;
+    unsigned long i;
+
+    i = skipnan(x, n);
+    if (i == n) {
+        *min = *max = (n) ? x[0] : __ma_zerof/__ma_zerof;
+        return;
+    }
+
+    lo = hi = x[i++];
+    if ((n-i) & 1) {
+        a = x[i++];
+        if (a < lo) lo = a;
+        else if (a > hi) hi = a;
+    }
+    for (; i < n; i += 2) {
+        a = x[i];
+        b = x[i+1];
+        if (a < b) {
+            if (a < lo) lo = a;
+            if (b > hi) hi = b;
+        } else if (b <= a) {
+            if (b < lo) lo = b;
+            if (a > hi) hi = a;
+        } else {				/* a NaN in the pair */
+            if (a < lo) lo = a;
+            else if (a > hi) hi = a;
+            if (b < lo) lo = b;
+            else if (b > hi) hi = b;
+        }
+    }
+    *min = lo;
+    *max = hi;
+}
@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Rounding of double arrays to integral values
+ *
+ * Method :
+ *	For |x| < 2**52, adding and subtracting 2**52 (with the sign of
+ *	x) leaves x rounded to an integer in the current rounding mode,
+ *	as rint() does; this is one add and one subtract in place of
+ *	rint()'s three paths of bit manipulation. floor, ceil and trunc
+ *	then step the result back by one where it went the wrong way,
+ *	and round adds one where trunc dropped a half or more, the
+ *	difference x - trunc(x) being exact. The sign of x is copied to
+ *	the result last, which gives -0 wherever C requires it.
+ *	|x| >= 2**52, infinities and NaNs are returned unchanged.
+ */
+
+#include <math.h>
+#include <amiga/vround.h>
+#include "include/internal/m99_math.h"
+#include "include/internal/fpu.h"
+
+static const double TWO52[2] = {
+     4.50359962737049600000e+15,        /* 0x43300000, 0x00000000 */
+    -4.50359962737049600000e+15,        /* 0xC3300000, 0x00000000 */
+};
+
+/* t = v rounded to an integer, for |v| < 2**52 with sign word hv */
+#define RINT(t, v, hv) \
+    STRICT_ASSIGN(double, t, (v) + TWO52[(unsigned int)(hv) >> 31]); \
+    t -= TWO52[(unsigned int)(hv) >> 31]
+
+/****** ma.lib/ma_vfloor *****************************************************
+*
+*   NAME	
+* 	ma_vfloor -- Round a double array to integral values. (V1.0)
+*
+*   SYNOPSIS
+*	ma_vfloor(double *dst, const double *x, unsigned long n);
+*	          A0           A1               D0
+*	void ma_vfloor(double *dst, const double *x, unsigned long n);
+*	void ma_vceil(double *dst, const double *x, unsigned long n);
+*	void ma_vtrunc(double *dst, const double *x, unsigned long n);
+*	void ma_vround(double *dst, const double *x, unsigned long n);
+*	void ma_vrint(double *dst, const double *x, unsigned long n);
+*
+*   FUNCTION
+*	Set each dst[i] to floor(), ceil(), trunc(), round() or rint()
+*	of x[i]. The results are those of the scalar functions, at a
+*	fraction of the cost of calling them once per element.
+*
+*   INPUTS
+*	dst - Where the results go; it may be the same array as x.
+*	x   - Array of values.
+*	n   - Number of values.
+*
+*   RESULT
+*	None.
+*
+*   EXAMPLE
+*	ma_vfloor(cells, coords, count);
+*
+*   NOTES
+*	ma.lib extension. Like rint(), ma_vrint() rounds in the current
+*	rounding mode, to nearest even unless the mode has been changed.
+*
+*   SEE ALSO
+*	ma_vfloorf(), ma_vcvt_s16(), floor(), rint(), amiga/vround.h
+*
+******************************************************************************/
+
+void ma_vfloor(double *dst, const double *x, unsigned long n)
+{
+    double v, t;
+    int hv;
+    unsigned long i;
+
+    for (i = 0; i < n; i++) {
+        v = x[i];
+        hv = __HI(v);
+        if ((hv & 0x7fffffff) < 0x43300000) {
+            RINT(t, v, hv);
+            if (t > v) t -= 1.0;
+            __HI(t) |= hv & 0x80000000;
+            v = t;
+        }
+        dst[i] = v;
+    }
+}
+
+void ma_vceil(double *dst, const double *x, unsigned long n)
+{
+    double v, t;
+    int hv;
+    unsigned long i;
+
+    for (i = 0; i < n; i++) {
+        v = x[i];
+        hv = __HI(v);
+        if ((hv & 0x7fffffff) < 0x43300000) {
+            RINT(t, v, hv);
+            if (t < v) t += 1.0;
+            __HI(t) |= hv & 0x80000000;
+            v = t;
+        }
+        dst[i] = v;
+    }
+}
+
+void ma_vtrunc(double *dst, const double *x, unsigned long n)
+{
+    double v, t;
+    int hv;
+    unsigned long i;
+
+    for (i = 0; i < n; i++) {
+        v = x[i];
+        hv = __HI(v);
+        if ((hv & 0x7fffffff) < 0x43300000) {
+            RINT(t, v, hv);
+            if (hv < 0) {
+                if (t < v) t += 1.0;
+            } else {
+                if (t > v) t -= 1.0;
+            }
+            __HI(t) |= hv & 0x80000000;
+            v = t;
+        }
+        dst[i] = v;
+    }
+}
+
+void ma_vround(double *dst, const double *x, unsigned long n)
+{
+    double v, t;
+    int hv;
+    unsigned long i;
+
+    for (i = 0; i < n; i++) {
+        v = x[i];
+        hv = __HI(v);
+        if ((hv & 0x7fffffff) < 0x43300000) {
+            RINT(t, v, hv);
+            if (hv < 0) {
+                if (t < v) t += 1.0;
+                if (t - v >= 0.5) t -= 1.0;
+            } else {
+                if (t > v) t -= 1.0;
+                if (v - t >= 0.5) t += 1.0;
+            }
+            __HI(t) |= hv & 0x80000000;
+            v = t;
+        }
+        dst[i] = v;
+    }
+}
+
+void ma_vrint(double *dst, const double *x, unsigned long n)
+{
+    double v, t;
+    int hv;
+    unsigned long i;
+
+    for (i = 0; i < n; i++) {
+        v = x[i];
+        hv = __HI(v);
+        if ((hv & 0x7fffffff) < 0x43300000) {
+            RINT(t, v, hv);
+            __HI(t) |= hv & 0x80000000;
+            v = t;
+        }
+        dst[i] = v;
+    }
+}
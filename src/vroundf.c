@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2025 amigazen project
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Rounding of float arrays to integral values
+ *
+ * The method is that of vround.c with 2**23 as the constant. The
+ * sum is stored to a float before the constant is taken off again,
+ * which rounds it to an integer even where the compiler evaluates
+ * float expressions in double.
+ */
+
+#include <math.h>
+#include <amiga/vround.h>
+#include "include/internal/m99_math.h"
+#include "include/internal/fpu.h"
+
+static const float TWO23[2] = {
+     8.3886080000e+06f,                 /* 0x4b000000 */
+    -8.3886080000e+06f,                 /* 0xcb000000 */
+};
+
+/* t = v rounded to an integer, for |v| < 2**23 with bits hv */
+#define RINT(t, v, hv) \
+    STRICT_ASSIGN(float, t, (v) + TWO23[(unsigned int)(hv) >> 31]); \
+    t -= TWO23[(unsigned int)(hv) >> 31]
+
+/****** ma.lib/ma_vfloorf *****************************************************
+*
+*   NAME	
+* 	ma_vfloorf -- Round a float array to integral values. (V1.0)
+*
+*   SYNOPSIS
+*	ma_vfloorf(float *dst, const float *x, unsigned long n);
+*	           A0          A1              D0
+*	void ma_vfloorf(float *dst, const float *x, unsigned long n);
+*	void ma_vceilf(float *dst, const float *x, unsigned long n);
+*	void ma_vtruncf(float *dst, const float *x, unsigned long n);
+*	void ma_vroundf(float *dst, const float *x, unsigned long n);
+*	void ma_vrintf(float *dst, const float *x, unsigned long n);
+*
+*   FUNCTION
+*	Set each dst[i] to floor(), ceil(), trunc(), round() or rint()
+*	of x[i], working in float throughout.
+*
+*   INPUTS
+*	dst - Where the results go; it may be the same array as x.
+*	x   - Array of values.
+*	n   - Number of values.
+*
+*   RESULT
+*	None.
+*
+*   EXAMPLE
+*	ma_vroundf(pixels, levels, count);
+*
+*   NOTES
+*	ma.lib extension. Each result is exact, so it is the same as
+*	rounding (double)x[i] and storing the result to a float.
+*
+*   SEE ALSO
+*	ma_vfloor(), ma_vcvtf_s16(), floor(), rint(), amiga/vround.h
+*
+******************************************************************************/
+
+void ma_vfloorf(float *dst, const float *x, unsigned long n)
+{
+    float v, t;
+    int hv;
+    unsigned long i;
+
+    for (i = 0; i < n; i++) {
+        v = x[i];
+        hv = __HI(v);
+        if ((hv & 0x7fffffff) < 0x4b000000) {
+            RINT(t, v, hv);
+            if (t > v) t -= 1.0f;
+            __HI(t) |= hv & 0x80000000;
+            v = t;
+        }
+        dst[i] = v;
+    }
+}
+
+void ma_vceilf(float *dst, const float *x, unsigned long n)
+{
+    float v, t;
+    int hv;
+    unsigned long i;
+
+    for (i = 0; i < n; i++) {
+        v = x[i];
+        hv = __HI(v);
+        if ((hv & 0x7fffffff) < 0x4b000000) {
+            RINT(t, v, hv);
+            if (t < v) t += 1.0f;
+            __HI(t) |= hv & 0x80000000;
+            v = t;
+        }
+        dst[i] = v;
+    }
+}
+
+void ma_vtruncf(float *dst, const float *x, unsigned long n)
+{
+    float v, t;
+    int hv;
+    unsigned long i;
+
+    for (i = 0; i < n; i++) {
+        v = x[i];
+        hv = __HI(v);
+        if ((hv & 0x7fffffff) < 0x4b000000) {
+            RINT(t, v, hv);
+            if (hv < 0) {
+                if (t < v) t += 1.0f;
+            } else {
+                if (t > v) t -= 1.0f;
+            }
+            __HI(t) |= hv & 0x80000000;
+            v = t;
+        }
+        dst[i] = v;
+    }
+}
+
+void ma_vroundf(float *dst, const float *x, unsigned long n)
+{
+    float v, t;
+    int hv;
+    unsigned long i;
+
+    for (i = 0; i < n; i++) {
+        v = x[i];
+        hv = __HI(v);
+        if ((hv & 0x7fffffff) < 0x4b000000) {
+            RINT(t, v, hv);
+            if (hv < 0) {
+                if (t < v) t += 1.0f;
+                if (t - v >= 0.5f) t -= 1.0f;
+            } else {
+                if (t > v) t -= 1.0f;
+                if (v - t >= 0.5f) t += 1.0f;
+            }
+            __HI(t) |= hv & 0x80000000;
+            v = t;
+        }
+        dst[i] = v;
+    }
+}
+
+void ma_vrintf(float *dst, const float *x, unsigned long n)
+{
+    float v, t;
+    int hv;
+    unsigned long i;
+
+    for (i = 0; i < n; i++) {
+        v = x[i];
+        hv = __HI(v);
+        if ((hv & 0x7fffffff) < 0x4b000000) {
+            RINT(t, v, hv);
+            __HI(t) |= hv & 0x80000000;
+            v = t;
+        }
+        dst[i] = v;
+    }
+}
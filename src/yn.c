@@ -17,11 +17,6 @@
 #include <math.h>
 #include "include/internal/m99_math.h"
 
-/* Helper macros for accessing high/low parts of double */
-/* SAS/C uses big-endian, so high word is first */
-#define __HI(x) *(int*)&x
-#define __LO(x) *(1+(int*)&x)
-
 /****** ma.lib/yn **************************************************************
 * 
 *   NAME	
@@ -65,8 +60,6 @@ invsqrtpi=  5.64189583547756279280e-01, /* 0x3FE20DD7, 0x50429B6D */
 two   =  2.00000000000000000000e+00, /* 0x40000000, 0x00000000 */
 one   =  1.00000000000000000000e+00; /* 0x3FF00000, 0x00000000 */
 
-static double zero  =  0.00000000000000000000e+00;
-
 static double __ieee754_yn(int n, double x)
 {
     int i,hx,ix,lx;
@@ -78,8 +71,8 @@ static double __ieee754_yn(int n, double x)
     lx = __LO(x);
     /* if Y(n,NaN) is NaN */
     if((ix|((unsigned)(lx|-lx))>>31)>0x7ff00000) return x+x;
-    if((ix|lx)==0) return -one/zero;
-    if(hx<0) return zero/zero;
+    if((ix|lx)==0) return -one/__ma_zero;
+    if(hx<0) return __ma_zero/__ma_zero;
     sign = 1;
     if(n<0){
         n = -n;
@@ -87,7 +80,7 @@ static double __ieee754_yn(int n, double x)
     }
     if(n==0) return(y0(x));
     if(n==1) return(sign*y1(x));
-    if(ix==0x7ff00000) return zero;
+    if(ix==0x7ff00000) return __ma_zero;
     if(ix>=0x52D00000) { /* x > 2**302 */
     /* (x >> n**2) 
      *	    Jn(x) = cos(x-(2n+1)*pi/4)*sqrt(2/x*pi)